@@ -0,0 +1,1481 @@
+// kiero-bench-hooks: what a kiero hook costs. Measures the per call overhead of an inline
+// (detour), a vtable and a GOT hook against a direct call, bind/unbind latency as the number of
+// hooks grows, init/shutdown per backend, and how the call overhead and the bind/unbind latency
+// (without and with waiting for the calls inside) change with threads calling the hooked
+// function at the same time, along with the longest those threads stall while bind or bindMany
+// patches it with the others. Resolving a methods table by a dlsym per name is compared with the
+// bulk export walk, and the same pre and post callbacks in a hand-written detour, a bindThunk
+// thunk and a std::function wrapper. With libvulkan.so.1 loaded, a Vulkan device-level function
+// is hooked at the loader's trampoline and at the driver's entry, and called through both. The
+// frame arena (kiero_frame.h) is compared with malloc in a synthetic present loop, per
+// allocation and as frame time jitter, alone and with threads churning the heap, and the frame
+// limiter (kiero_limiter.h) by its pacing error at 240 fps in both modes, and recording a frame
+// into the statistics ring (kiero_stats.h) alone and while another thread reads it. The census
+// (kiero_census.h) is measured like the hooks: a call through its counting stub, a frame
+// boundary aggregating it, and starting/stopping it over the stand-in's table. The timing layer
+// (kiero_timing.h) is measured as the extra cost of a timed call over the inline hook, and
+// trampolines carved from the slab arena against a page each. Checks of what the measured paths
+// must get right (the census and timing counts, a shadow vtable at an address reused by a new
+// object) report their failures on stderr.
+//
+//   kiero-bench-hooks [--json results.json] [--trace trace.json] [runtimes to load...]
+//
+// The hooked functions come from the stand-in libGL.so.1 this is linked against
+// (benchmarks/standin_gl.cpp), so no GPU driver is needed. Runtimes given on the command line
+// (e.g. libvulkan.so.1, or a stand-in through LD_LIBRARY_PATH) are loaded for the init and
+// shutdown measurements and the Vulkan calls. Times are medians in nanoseconds per operation,
+// cycles are TSC ticks. --trace records kiero's own spans over the whole run
+// (-DKIERO_ENABLE_TRACE=ON) and writes them as Chrome trace JSON, the timings then include the
+// recording.
+
+#include "kiero.h"
+#include "kiero_census.h"
+#include "kiero_detour.h"
+#include "kiero_exports.h"
+#include "kiero_frame.h"
+#include "kiero_limiter.h"
+#include "kiero_methods.h"
+#include "kiero_stats.h"
+#include "kiero_thunk.h"
+#include "kiero_timing.h"
+#include "kiero_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dlfcn.h>
+
+#if KIERO_INCLUDE_VULKAN
+# include <vulkan/vulkan.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+extern "C" void glFlush();
+
+namespace
+{
+
+constexpr int Rounds = 11;
+constexpr ::std::uint64_t Calls = 1'000'000;
+
+// The stand-in exports the first methods of the OpenGL table, glFlush and HookTargets others
+constexpr ::std::uint16_t HookTargets = 256;
+constexpr ::std::uint16_t HookCounts[] = { 1, 4, 16, 64, 128, 256 };
+
+// The table index of the i-th hook target, skipping glFlush's
+[[nodiscard]] constexpr ::std::uint16_t hookTarget(const ::std::uint16_t i) noexcept
+{
+    return i < kiero::opengl::glFlush::index ? i : static_cast<::std::uint16_t>(i + 1);
+}
+
+constexpr unsigned ThreadCounts[] = { 1, 2, 4, 8 };
+
+using Clock = ::std::chrono::steady_clock;
+
+struct Elapsed
+{
+    double ns;
+    double cycles;
+};
+
+[[nodiscard]] ::std::uint64_t readCycles() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Stopwatch
+{
+    Clock::time_point start = Clock::now();
+    ::std::uint64_t cycles = readCycles();
+
+    [[nodiscard]] Elapsed elapsed() const noexcept
+    {
+        const ::std::uint64_t end = readCycles();
+        return { ::std::chrono::duration<double, ::std::nano>(Clock::now() - start).count(), static_cast<double>(end - cycles) };
+    }
+};
+
+[[nodiscard]] double median(::std::vector<double> samples)
+{
+    ::std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+struct Record
+{
+    ::std::string name;
+    unsigned threads;
+    unsigned hooks;
+    double ns;     // per operation
+    double cycles; // per operation
+};
+
+::std::vector<Record> g_records;
+
+void report(const char* const name, const unsigned threads, const unsigned hooks, const ::std::vector<Elapsed>& rounds, const double operations)
+{
+    ::std::vector<double> ns;
+    ::std::vector<double> cycles;
+
+    for(const Elapsed& round : rounds)
+    {
+        ns.push_back(round.ns / operations);
+        cycles.push_back(round.cycles / operations);
+    }
+
+    g_records.push_back({ name, threads, hooks, median(ns), median(cycles) });
+
+    const Record& record = g_records.back();
+    ::std::printf("%-22s %7u %5u %12.2f ns %12.1f cycles\n", name, threads, hooks, record.ns, record.cycles);
+}
+
+[[nodiscard]] const char* renderTypeName(const kiero::RenderType renderType) noexcept
+{
+    switch(renderType)
+    {
+        case kiero::RenderType::OpenGL: return "OpenGL";
+        case kiero::RenderType::Vulkan: return "Vulkan";
+        default:                        return "other";
+    }
+}
+
+// Detours doing nothing but calling the original, the overhead is the hook's alone
+using Function = void (*)();
+
+Function g_originalFlush = nullptr;
+
+void hookedFlush()
+{
+    g_originalFlush();
+}
+
+struct Object
+{
+    virtual void call();
+};
+
+__attribute__((noinline)) void Object::call()
+{
+    asm volatile("" ::: "memory");
+}
+
+// Constructed where a bound Object was destroyed
+struct Other : Object
+{
+    void call() override;
+};
+
+__attribute__((noinline)) void Other::call()
+{
+    asm volatile("" ::: "memory");
+}
+
+using Method = void (*)(Object*);
+
+Method g_originalCall = nullptr;
+
+void hookedCall(Object* const self)
+{
+    g_originalCall(self);
+}
+
+Function g_originals[HookTargets];
+
+void hookedTarget()
+{
+}
+
+[[nodiscard]] Elapsed callFlush(const ::std::uint64_t calls) noexcept
+{
+    const Stopwatch stopwatch;
+
+    for(::std::uint64_t i = 0; i < calls; ++i)
+    {
+        glFlush();
+    }
+
+    return stopwatch.elapsed();
+}
+
+void measureCalls(const char* const name)
+{
+    ::std::vector<Elapsed> rounds;
+    for(int round = 0; round < Rounds; ++round)
+    {
+        rounds.push_back(callFlush(Calls));
+    }
+
+    report(name, 1, 1, rounds, Calls);
+}
+
+void measureVirtualCalls(const char* const name, Object* const volatile& object)
+{
+    ::std::vector<Elapsed> rounds;
+    for(int round = 0; round < Rounds; ++round)
+    {
+        const Stopwatch stopwatch;
+
+        for(::std::uint64_t i = 0; i < Calls; ++i)
+        {
+            object->call();
+        }
+
+        rounds.push_back(stopwatch.elapsed());
+    }
+
+    report(name, 1, 1, rounds, Calls);
+}
+
+[[nodiscard]] void* vtableOf(const void* const object) noexcept
+{
+    void* vtable;
+    (void) ::std::memcpy(&vtable, object, sizeof(vtable));
+    return vtable;
+}
+
+// A shadow vtable only holds while its object uses it: an object constructed where a bound one
+// was destroyed is bound afresh, and unbinding the destroyed one leaves its vptr alone
+void checkInstanceReuse()
+{
+    alignas(Other) unsigned char storage[sizeof(Other)];
+
+    Object* const first = new(storage) Object;
+    bool reused = kiero::bindInstance(first, 0, reinterpret_cast<void**>(&g_originalCall), reinterpret_cast<void*>(&hookedCall)) == kiero::Status::Success;
+    first->~Object();
+
+    Other* const second = new(storage) Other;
+    void* const vtable = vtableOf(second);
+
+    reused = reused && kiero::bindInstance(second, 0, reinterpret_cast<void**>(&g_originalCall), reinterpret_cast<void*>(&hookedCall)) == kiero::Status::Success;
+    reused = reused && vtableOf(second) != vtable;
+    second->~Other();
+
+    Other* const third = new(storage) Other;
+    kiero::unbindInstance(third, 0);
+    reused = reused && vtableOf(third) == vtable;
+    third->~Other();
+
+    if(!reused)
+    {
+        ::std::fprintf(stderr, "bindInstance/unbindInstance trusted the shadow vtable of a destroyed object\n");
+    }
+}
+
+[[nodiscard]] bool bindFlush(const kiero::HookMode mode)
+{
+    if(kiero::setHookMode(mode) != kiero::Status::Success)
+    {
+        return false;
+    }
+
+    const kiero::Status status = kiero::bind(kiero::RenderType::OpenGL, kiero::opengl::glFlush::index, reinterpret_cast<void**>(&g_originalFlush), reinterpret_cast<void*>(&hookedFlush));
+
+    (void) kiero::setHookMode(kiero::HookMode::Detour);
+    return status == kiero::Status::Success;
+}
+
+void benchmarkCalls()
+{
+    measureCalls("call/direct");
+
+    if(bindFlush(kiero::HookMode::Detour))
+    {
+        measureCalls("call/inline");
+        kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::glFlush::index);
+    }
+
+    if(bindFlush(kiero::HookMode::ImportTable))
+    {
+        measureCalls("call/got");
+        kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::glFlush::index);
+    }
+
+    Object object;
+    Object* const volatile pointer = &object;
+
+    measureVirtualCalls("call/virtual", pointer);
+
+    if(kiero::bindInstance(&object, 0, reinterpret_cast<void**>(&g_originalCall), reinterpret_cast<void*>(&hookedCall)) == kiero::Status::Success)
+    {
+        measureVirtualCalls("call/vtable", pointer);
+        kiero::unbindInstance(&object, 0);
+    }
+
+    checkInstanceReuse();
+}
+
+#if KIERO_INCLUDE_VULKAN
+// A device-level Vulkan function hooked where KIERO_VULKAN_DEVICE_FUNCTIONS 0 hooks it, at the
+// loader's exported trampoline, against where 1 does, at the driver's own entry. An app that
+// fetched the pointer with vkGetDeviceProcAddr calls the driver directly and only the second
+// catches it. vkGetFenceStatus is a cheap call on any driver and keeps no state per call.
+PFN_vkGetFenceStatus g_originalFenceStatus = nullptr;
+::std::uint64_t g_fenceStatusCalls = 0;
+
+VKAPI_ATTR VkResult VKAPI_CALL hookedFenceStatus(VkDevice device, VkFence fence)
+{
+    ++g_fenceStatusCalls;
+    return g_originalFenceStatus(device, fence);
+}
+
+void measureFenceStatus(const char* const name, const PFN_vkGetFenceStatus function, const VkDevice device, const VkFence fence)
+{
+    g_fenceStatusCalls = 0;
+
+    ::std::vector<Elapsed> rounds;
+    for(int round = 0; round < Rounds; ++round)
+    {
+        const Stopwatch stopwatch;
+
+        for(::std::uint64_t i = 0; i < Calls; ++i)
+        {
+            (void) function(device, fence);
+        }
+
+        rounds.push_back(stopwatch.elapsed());
+    }
+
+    report(name, 1, 1, rounds, Calls);
+}
+
+// Hooks target with the built-in detour engine and measures the calls through every path
+void measureHookedFenceStatus(void* const target, const ::std::initializer_list<::std::pair<const char*, PFN_vkGetFenceStatus>> paths, const VkDevice device, const VkFence fence)
+{
+    kiero::detail::Hook hook;
+    if(kiero::detail::createHook(target, reinterpret_cast<void*>(&hookedFenceStatus), hook) != kiero::Status::Success
+        || kiero::detail::enableHook(hook) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "hooking vkGetFenceStatus at %p failed\n", target);
+        kiero::detail::destroyHook(hook);
+        return;
+    }
+
+    g_originalFenceStatus = reinterpret_cast<PFN_vkGetFenceStatus>(hook.trampoline);
+
+    for(const auto& [name, function] : paths)
+    {
+        measureFenceStatus(name, function, device, fence);
+
+        if(g_fenceStatusCalls != Calls * Rounds)
+        {
+            ::std::fprintf(stderr, "%s caught %llu of %llu calls\n", name, static_cast<unsigned long long>(g_fenceStatusCalls), static_cast<unsigned long long>(Calls * Rounds));
+        }
+    }
+
+    kiero::detail::destroyHook(hook);
+}
+
+// Needs a loaded libvulkan.so.1 with a driver, lavapipe will do
+void benchmarkVulkanCalls()
+{
+    void* const handle = ::dlopen("libvulkan.so.1", RTLD_NOW | RTLD_NOLOAD);
+    if(!handle)
+    {
+        return;
+    }
+
+    const auto vkGetInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(::dlsym(handle, "vkGetInstanceProcAddr"));
+    const auto loaderFenceStatus = reinterpret_cast<PFN_vkGetFenceStatus>(::dlsym(handle, "vkGetFenceStatus"));
+    const auto vkCreateInstance = vkGetInstanceProcAddr ? reinterpret_cast<PFN_vkCreateInstance>(vkGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance")) : nullptr;
+
+    VkApplicationInfo applicationInfo = { };
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo instanceCreateInfo = { };
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    VkInstance instance = VK_NULL_HANDLE;
+    if(!loaderFenceStatus || !vkCreateInstance || vkCreateInstance(&instanceCreateInfo, nullptr, &instance) != VK_SUCCESS)
+    {
+        ::std::fprintf(stderr, "no Vulkan instance, no Vulkan call timings\n");
+        ::dlclose(handle);
+        return;
+    }
+
+    const auto vkDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(vkGetInstanceProcAddr(instance, "vkDestroyInstance"));
+    const auto vkEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(vkGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices"));
+    const auto vkCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(vkGetInstanceProcAddr(instance, "vkCreateDevice"));
+    const auto vkGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(vkGetInstanceProcAddr(instance, "vkGetDeviceProcAddr"));
+
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    ::std::uint32_t physicalDevicesCount = 1;
+
+    const VkResult result = vkEnumeratePhysicalDevices(instance, &physicalDevicesCount, &physicalDevice);
+
+    // Any device has a queue family 0
+    const float queuePriority = 1.0f;
+
+    VkDeviceQueueCreateInfo queueCreateInfo = { };
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    VkDeviceCreateInfo deviceCreateInfo = { };
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+
+    VkDevice device = VK_NULL_HANDLE;
+    if((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDevicesCount == 0 || !vkGetDeviceProcAddr
+        || vkCreateDevice(physicalDevice, &deviceCreateInfo, nullptr, &device) != VK_SUCCESS)
+    {
+        ::std::fprintf(stderr, "no Vulkan device, no Vulkan call timings\n");
+        vkDestroyInstance(instance, nullptr);
+        ::dlclose(handle);
+        return;
+    }
+
+    const auto vkDestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(vkGetDeviceProcAddr(device, "vkDestroyDevice"));
+    const auto vkCreateFence = reinterpret_cast<PFN_vkCreateFence>(vkGetDeviceProcAddr(device, "vkCreateFence"));
+    const auto vkDestroyFence = reinterpret_cast<PFN_vkDestroyFence>(vkGetDeviceProcAddr(device, "vkDestroyFence"));
+    const auto deviceFenceStatus = reinterpret_cast<PFN_vkGetFenceStatus>(vkGetDeviceProcAddr(device, "vkGetFenceStatus"));
+
+    VkFenceCreateInfo fenceCreateInfo = { };
+    fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence = VK_NULL_HANDLE;
+    if(deviceFenceStatus && vkCreateFence(device, &fenceCreateInfo, nullptr, &fence) == VK_SUCCESS)
+    {
+        measureFenceStatus("call/vk-loader", loaderFenceStatus, device, fence);
+        measureFenceStatus("call/vk-device", deviceFenceStatus, device, fence);
+
+        // A layer in between hands out its own entry, the split is then the layer's
+        if(deviceFenceStatus != loaderFenceStatus)
+        {
+            measureHookedFenceStatus(reinterpret_cast<void*>(loaderFenceStatus), { { "call/vk-loader-hook", loaderFenceStatus } }, device, fence);
+            measureHookedFenceStatus(reinterpret_cast<void*>(deviceFenceStatus), { { "call/vk-device-hook", deviceFenceStatus }, { "call/vk-device-hook/ld", loaderFenceStatus } }, device, fence);
+        }
+
+        vkDestroyFence(device, fence, nullptr);
+    }
+
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+    ::dlclose(handle);
+}
+#endif
+
+[[nodiscard]] Elapsed endFrames(const ::std::uint64_t frames) noexcept
+{
+    const Stopwatch stopwatch;
+
+    for(::std::uint64_t i = 0; i < frames; ++i)
+    {
+        const kiero::FrameScope frame;
+    }
+
+    return stopwatch.elapsed();
+}
+
+void measureFrames(const char* const name, const unsigned hooks)
+{
+    constexpr ::std::uint64_t Frames = 10'000;
+
+    ::std::vector<Elapsed> rounds;
+    for(int round = 0; round < Rounds; ++round)
+    {
+        rounds.push_back(endFrames(Frames));
+    }
+
+    report(name, 1, hooks, rounds, Frames);
+}
+
+[[nodiscard]] ::std::uint64_t countedFlushes()
+{
+    kiero::CensusEntry entries[kiero::opengl::MethodsCount];
+    const ::std::size_t count = kiero::getCensus(entries);
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        if(entries[i].index == kiero::opengl::glFlush::index)
+        {
+            return entries[i].total;
+        }
+    }
+
+    return 0;
+}
+
+void benchmarkCensus()
+{
+    measureFrames("frame/plain", 0);
+
+    ::std::vector<Elapsed> starts;
+    ::std::vector<Elapsed> stops;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        Stopwatch stopwatch;
+        if(kiero::startCensus(kiero::RenderType::OpenGL) != kiero::Status::Success)
+        {
+            ::std::fprintf(stderr, "startCensus failed\n");
+            return;
+        }
+        starts.push_back(stopwatch.elapsed());
+
+        stopwatch = { };
+        kiero::stopCensus();
+        stops.push_back(stopwatch.elapsed());
+    }
+
+    (void) kiero::startCensus(kiero::RenderType::OpenGL);
+
+    const unsigned counted = static_cast<unsigned>(kiero::getCensus({ }));
+
+    report("census/start", 1, counted, starts, 1);
+    report("census/stop", 1, counted, stops, 1);
+
+    // Until its first frame boundary this thread counts into the shared shards
+    measureCalls("call/census-shared");
+    measureFrames("frame/census", counted);
+    measureCalls("call/census");
+
+    // Every call went through the stub exactly once
+    if(countedFlushes() != 2 * Rounds * Calls)
+    {
+        ::std::fprintf(stderr, "census counted %llu glFlush calls instead of %llu\n", static_cast<unsigned long long>(countedFlushes()),
+            static_cast<unsigned long long>(2 * Rounds * Calls));
+    }
+
+    kiero::stopCensus();
+
+    // Through the import table no gate runs, what is left is the stub's own cost
+    if(kiero::setHookMode(kiero::HookMode::ImportTable) == kiero::Status::Success)
+    {
+        if(kiero::startCensus(kiero::RenderType::OpenGL) == kiero::Status::Success)
+        {
+            measureCalls("call/census-got");
+            kiero::stopCensus();
+        }
+
+        (void) kiero::setHookMode(kiero::HookMode::Detour);
+    }
+}
+
+void benchmarkBinds()
+{
+    for(const ::std::uint16_t count : HookCounts)
+    {
+        ::std::vector<Elapsed> binds;
+        ::std::vector<Elapsed> unbinds;
+        ::std::vector<Elapsed> manyBinds;
+        ::std::vector<Elapsed> manyUnbinds;
+
+        kiero::Binding bindings[HookTargets];
+        ::std::uint16_t indices[HookTargets];
+
+        for(::std::uint16_t i = 0; i < count; ++i)
+        {
+            bindings[i] = { hookTarget(i), reinterpret_cast<void**>(&g_originals[i]), reinterpret_cast<void*>(&hookedTarget), kiero::Status::Success };
+            indices[i] = hookTarget(i);
+        }
+
+        for(int round = 0; round < Rounds; ++round)
+        {
+            Stopwatch stopwatch;
+            for(::std::uint16_t i = 0; i < count; ++i)
+            {
+                if(kiero::bind(kiero::RenderType::OpenGL, bindings[i].index, bindings[i].original, bindings[i].function) != kiero::Status::Success)
+                {
+                    ::std::fprintf(stderr, "bind of index %u failed\n", bindings[i].index);
+                    return;
+                }
+            }
+            binds.push_back(stopwatch.elapsed());
+
+            stopwatch = { };
+            for(::std::uint16_t i = 0; i < count; ++i)
+            {
+                kiero::unbind(kiero::RenderType::OpenGL, indices[i]);
+            }
+            unbinds.push_back(stopwatch.elapsed());
+
+            stopwatch = { };
+            if(kiero::bindMany(kiero::RenderType::OpenGL, { bindings, count }) != kiero::Status::Success)
+            {
+                ::std::fprintf(stderr, "bindMany of %u hooks failed\n", count);
+                return;
+            }
+            manyBinds.push_back(stopwatch.elapsed());
+
+            stopwatch = { };
+            kiero::unbindMany(kiero::RenderType::OpenGL, { indices, count });
+            manyUnbinds.push_back(stopwatch.elapsed());
+        }
+
+        report("bind", 1, count, binds, count);
+        report("unbind", 1, count, unbinds, count);
+        report("bindMany", 1, count, manyBinds, count);
+        report("unbindMany", 1, count, manyUnbinds, count);
+    }
+}
+
+// Trampolines from the near-target slab arena against a page (an allocation granule on Windows)
+// each: creating drained hooks on count stand-in functions, whose trampolines and stubs are
+// carved from shared slabs, next to allocating, writing and sealing a page per trampoline. The
+// arena's figure also covers decoding the prologue and the stub, the page's only the memory.
+void benchmarkTrampolines()
+{
+    void* targets[HookTargets];
+
+    for(::std::uint16_t i = 0; i < HookTargets; ++i)
+    {
+        targets[i] = kiero::getMethod(kiero::RenderType::OpenGL, hookTarget(i));
+        if(!targets[i])
+        {
+            ::std::fprintf(stderr, "index %u of the stand-in table is not resolved\n", hookTarget(i));
+            return;
+        }
+    }
+
+    static kiero::detail::Hook hooks[HookTargets];
+    kiero::detail::Hook* pointers[HookTargets];
+
+    for(::std::uint16_t i = 0; i < HookTargets; ++i)
+    {
+        pointers[i] = &hooks[i];
+    }
+
+    for(const ::std::uint16_t count : HookCounts)
+    {
+        ::std::vector<Elapsed> arena;
+        ::std::vector<Elapsed> pages;
+
+        for(int round = 0; round < Rounds; ++round)
+        {
+            Stopwatch stopwatch;
+            for(::std::uint16_t i = 0; i < count; ++i)
+            {
+                if(kiero::detail::createHook(targets[i], reinterpret_cast<void*>(&hookedTarget), hooks[i], true) != kiero::Status::Success)
+                {
+                    ::std::fprintf(stderr, "createHook of index %u failed\n", hookTarget(i));
+                    return;
+                }
+            }
+            arena.push_back(stopwatch.elapsed());
+
+            (void) kiero::detail::destroyHooks(pointers, count);
+
+            void* codes[HookTargets];
+
+            stopwatch = { };
+            for(::std::uint16_t i = 0; i < count; ++i)
+            {
+                codes[i] = kiero::detail::allocateCode(targets[i], kiero::detail::MaxTrampolineSize);
+                if(!codes[i])
+                {
+                    ::std::fprintf(stderr, "allocateCode near index %u failed\n", hookTarget(i));
+                    return;
+                }
+
+                (void) ::std::memcpy(codes[i], targets[i], kiero::detail::MaxPatchSize);
+                kiero::detail::sealCode(codes[i], kiero::detail::MaxTrampolineSize);
+            }
+            pages.push_back(stopwatch.elapsed());
+
+            for(::std::uint16_t i = 0; i < count; ++i)
+            {
+                kiero::detail::releaseCode(codes[i], kiero::detail::MaxTrampolineSize);
+            }
+        }
+
+        report("trampoline/arena", 1, count, arena, count);
+        report("trampoline/page", 1, count, pages, count);
+    }
+
+    if(kiero::drainHooks() != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "drained hooks of the trampoline benchmark were left pending\n");
+    }
+}
+
+// Resolving a whole methods table from a loaded runtime, a dlsym per name against one walk of
+// its exports. Both must find the same functions.
+constexpr auto g_openGLExportNames = kiero::detail::makeExportNames(kiero::opengl::Names);
+constexpr auto g_vulkanExportNames = kiero::detail::makeExportNames(kiero::vulkan::Names);
+
+template<::std::size_t N>
+void measureExports(const char* const library, const char* const type, const kiero::detail::ExportNames<N>& set)
+{
+    void* const handle = ::dlopen(library, RTLD_NOW | RTLD_NOLOAD);
+    if(!handle)
+    {
+        return;
+    }
+
+    ::std::vector<void*> looked(N);
+    ::std::vector<void*> resolved(N);
+    ::std::vector<Elapsed> lookups;
+    ::std::vector<Elapsed> walks;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        Stopwatch stopwatch;
+        for(::std::size_t i = 0; i < N; ++i)
+        {
+            looked[i] = ::dlsym(handle, set.names[i]);
+        }
+        lookups.push_back(stopwatch.elapsed());
+
+        ::std::fill(resolved.begin(), resolved.end(), nullptr);
+
+        stopwatch = { };
+        (void) kiero::detail::resolveExports(handle, set, resolved.data());
+        walks.push_back(stopwatch.elapsed());
+    }
+
+    if(looked != resolved)
+    {
+        ::std::fprintf(stderr, "resolveExports of %s disagrees with dlsym\n", library);
+    }
+
+    ::dlclose(handle);
+
+    char name[64];
+    ::std::snprintf(name, sizeof(name), "exports/dlsym/%s", type);
+    report(name, 1, static_cast<unsigned>(N), lookups, 1);
+
+    ::std::snprintf(name, sizeof(name), "exports/bulk/%s", type);
+    report(name, 1, static_cast<unsigned>(N), walks, 1);
+}
+
+void benchmarkExports()
+{
+    measureExports("libGL.so.1", "OpenGL", g_openGLExportNames);
+    measureExports("libvulkan.so.1", "Vulkan", g_vulkanExportNames);
+}
+
+void benchmarkLifecycle()
+{
+    for(const kiero::RenderType type : { kiero::RenderType::OpenGL, kiero::RenderType::Vulkan })
+    {
+        for(const kiero::InitMode mode : { kiero::InitMode::Eager, kiero::InitMode::Lazy })
+        {
+            ::std::vector<Elapsed> inits;
+            ::std::vector<Elapsed> shutdowns;
+
+            for(int round = 0; round < Rounds; ++round)
+            {
+                Stopwatch stopwatch;
+                if(kiero::init(type, mode) != kiero::Status::Success)
+                {
+                    break;
+                }
+                inits.push_back(stopwatch.elapsed());
+
+                stopwatch = { };
+                kiero::shutdown(type);
+                shutdowns.push_back(stopwatch.elapsed());
+            }
+
+            if(inits.empty())
+            {
+                break;
+            }
+
+            char name[64];
+            ::std::snprintf(name, sizeof(name), "init/%s/%s", renderTypeName(type), mode == kiero::InitMode::Eager ? "eager" : "lazy");
+            report(name, 1, 0, inits, 1);
+
+            ::std::snprintf(name, sizeof(name), "shutdown/%s/%s", renderTypeName(type), mode == kiero::InitMode::Eager ? "eager" : "lazy");
+            report(name, 1, 0, shutdowns, 1);
+        }
+    }
+}
+
+// threads call glFlush at once, each round reports the slowest thread
+void measureConcurrentCalls(const char* const name, const unsigned threads)
+{
+    ::std::vector<Elapsed> rounds;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        ::std::atomic<bool> start { false };
+        ::std::vector<Elapsed> elapsed(threads);
+        ::std::vector<::std::thread> workers;
+
+        for(unsigned i = 0; i < threads; ++i)
+        {
+            workers.emplace_back([&start, &elapsed, i]
+            {
+                while(!start.load(::std::memory_order_acquire))
+                {
+                    ::std::this_thread::yield();
+                }
+
+                elapsed[i] = callFlush(Calls / 4);
+            });
+        }
+
+        start.store(true, ::std::memory_order_release);
+
+        for(::std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        rounds.push_back(*::std::max_element(elapsed.begin(), elapsed.end(), [](const Elapsed& a, const Elapsed& b) { return a.ns < b.ns; }));
+    }
+
+    report(name, threads, 1, rounds, Calls / 4);
+}
+
+// bind and unbind of glFlush while threads keep calling it. A Detour unbind does not wait for
+// the calls inside, a DrainedDetour one waits until no thread runs the hook and frees it.
+void measureLoadedBinds(const unsigned threads, const kiero::HookMode mode)
+{
+    const bool drained = mode == kiero::HookMode::DrainedDetour;
+
+    ::std::atomic<bool> stop { false };
+    ::std::vector<::std::thread> workers;
+
+    for(unsigned i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&stop]
+        {
+            while(!stop.load(::std::memory_order_relaxed))
+            {
+                (void) callFlush(64);
+            }
+        });
+    }
+
+    ::std::vector<Elapsed> binds;
+    ::std::vector<Elapsed> unbinds;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        Stopwatch stopwatch;
+        if(!bindFlush(mode))
+        {
+            break;
+        }
+        binds.push_back(stopwatch.elapsed());
+
+        stopwatch = { };
+        kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::glFlush::index);
+        unbinds.push_back(stopwatch.elapsed());
+    }
+
+    stop.store(true, ::std::memory_order_relaxed);
+
+    for(::std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    if(drained && kiero::drainHooks() != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "drained glFlush hooks were still running after the callers stopped\n");
+    }
+
+    if(!binds.empty())
+    {
+        report(drained ? "bind/drained" : "bind/loaded", threads, 1, binds, 1);
+        report(drained ? "unbind/drained" : "unbind/loaded", threads, 1, unbinds, 1);
+    }
+}
+
+void benchmarkTiming()
+{
+    if(!bindFlush(kiero::HookMode::Detour))
+    {
+        return;
+    }
+
+    constexpr ::std::uint16_t index = kiero::opengl::glFlush::index;
+
+    if(kiero::startTiming(kiero::RenderType::OpenGL, index) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "startTiming failed\n");
+        kiero::unbind(kiero::RenderType::OpenGL, index);
+        return;
+    }
+
+    measureCalls("call/timed");
+
+    for(const unsigned threads : ThreadCounts)
+    {
+        measureConcurrentCalls("concurrent/timed", threads);
+    }
+
+    // Every call was timed once in the detour and once in the original
+    ::std::uint64_t expected = Rounds * Calls;
+    for(const unsigned threads : ThreadCounts)
+    {
+        expected += Rounds * threads * (Calls / 4);
+    }
+
+    kiero::TimingStats stats;
+    if(kiero::getTiming(kiero::RenderType::OpenGL, index, stats) != kiero::Status::Success || stats.hook.count != expected || stats.original.count != expected)
+    {
+        ::std::fprintf(stderr, "timing recorded %llu detour and %llu original calls instead of %llu\n", static_cast<unsigned long long>(stats.hook.count),
+            static_cast<unsigned long long>(stats.original.count), static_cast<unsigned long long>(expected));
+    }
+
+    kiero::stopTiming(kiero::RenderType::OpenGL, index);
+    kiero::unbind(kiero::RenderType::OpenGL, index);
+}
+
+// The longest a thread calling glFlush went between two calls while hooks count hooks, glFlush
+// among them, were bound one by one or with bindMany. Each round reports the longest stall of
+// any thread.
+void measureStalls(const unsigned threads)
+{
+    for(const ::std::uint16_t count : HookCounts)
+    {
+        kiero::Binding bindings[HookTargets + 1];
+        ::std::uint16_t indices[HookTargets + 1];
+
+        for(::std::uint16_t i = 0; i < count; ++i)
+        {
+            bindings[i] = { hookTarget(i), reinterpret_cast<void**>(&g_originals[i]), reinterpret_cast<void*>(&hookedTarget), kiero::Status::Success };
+            indices[i] = hookTarget(i);
+        }
+
+        bindings[count] = { kiero::opengl::glFlush::index, reinterpret_cast<void**>(&g_originalFlush), reinterpret_cast<void*>(&hookedFlush), kiero::Status::Success };
+        indices[count] = kiero::opengl::glFlush::index;
+
+        const ::std::size_t hooks = count + 1u;
+
+        for(const bool many : { false, true })
+        {
+            ::std::vector<Elapsed> rounds;
+
+            for(int round = 0; round < Rounds; ++round)
+            {
+                ::std::atomic<bool> stop { false };
+                ::std::atomic<bool> measuring { false };
+                ::std::atomic<unsigned> running { 0 };
+                ::std::vector<Elapsed> stalls(threads, Elapsed { 0, 0 });
+                ::std::vector<::std::thread> workers;
+
+                for(unsigned i = 0; i < threads; ++i)
+                {
+                    workers.emplace_back([&, i]
+                    {
+                        glFlush();
+                        running.fetch_add(1, ::std::memory_order_relaxed);
+
+                        Clock::time_point last = Clock::now();
+                        ::std::uint64_t lastCycles = readCycles();
+
+                        while(!stop.load(::std::memory_order_relaxed))
+                        {
+                            glFlush();
+
+                            const Clock::time_point now = Clock::now();
+                            const ::std::uint64_t cycles = readCycles();
+
+                            if(measuring.load(::std::memory_order_relaxed))
+                            {
+                                const double ns = ::std::chrono::duration<double, ::std::nano>(now - last).count();
+                                if(ns > stalls[i].ns)
+                                {
+                                    stalls[i] = { ns, static_cast<double>(cycles - lastCycles) };
+                                }
+                            }
+
+                            last = now;
+                            lastCycles = cycles;
+                        }
+                    });
+                }
+
+                while(running.load(::std::memory_order_relaxed) != threads)
+                {
+                    ::std::this_thread::yield();
+                }
+
+                measuring.store(true, ::std::memory_order_relaxed);
+                ::std::this_thread::sleep_for(::std::chrono::microseconds(100));
+
+                bool bound = true;
+                if(many)
+                {
+                    bound = kiero::bindMany(kiero::RenderType::OpenGL, { bindings, hooks }) == kiero::Status::Success;
+                }
+                else
+                {
+                    for(::std::size_t i = 0; i < hooks && bound; ++i)
+                    {
+                        bound = kiero::bind(kiero::RenderType::OpenGL, bindings[i].index, bindings[i].original, bindings[i].function) == kiero::Status::Success;
+                    }
+                }
+
+                // Lets a call stalled across the end of the patching return
+                ::std::this_thread::sleep_for(::std::chrono::microseconds(100));
+                measuring.store(false, ::std::memory_order_relaxed);
+                stop.store(true, ::std::memory_order_relaxed);
+
+                for(::std::thread& worker : workers)
+                {
+                    worker.join();
+                }
+
+                kiero::unbindMany(kiero::RenderType::OpenGL, { indices, hooks });
+
+                if(!bound)
+                {
+                    ::std::fprintf(stderr, "%s of %zu hooks failed\n", many ? "bindMany" : "bind", hooks);
+                    return;
+                }
+
+                rounds.push_back(*::std::max_element(stalls.begin(), stalls.end(), [](const Elapsed& a, const Elapsed& b) { return a.ns < b.ns; }));
+            }
+
+            report(many ? "stall/bindMany" : "stall/bind", threads, static_cast<unsigned>(hooks), rounds, 1);
+        }
+    }
+}
+
+// The same pre and post callbacks around glFlush three ways: written into a detour by hand,
+// generated by bindThunk, and held by std::function in a generic wrapper
+::std::uint64_t g_callbacks = 0;
+
+__attribute__((noinline)) void countCallback()
+{
+    asm volatile("" ::: "memory");
+    ++g_callbacks;
+}
+
+void handFlush()
+{
+    countCallback();
+    g_originalFlush();
+    countCallback();
+}
+
+struct Wrapper
+{
+    ::std::function<void()> pre;
+    ::std::function<void()> post;
+};
+
+Wrapper g_wrapper;
+
+void wrappedFlush()
+{
+    g_wrapper.pre();
+    g_originalFlush();
+    g_wrapper.post();
+}
+
+void measureCallbacks(const char* const name, const bool bound)
+{
+    if(!bound)
+    {
+        ::std::fprintf(stderr, "binding %s failed\n", name);
+        return;
+    }
+
+    g_callbacks = 0;
+    measureCalls(name);
+    kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::glFlush::index);
+
+    if(g_callbacks != 2 * Rounds * Calls)
+    {
+        ::std::fprintf(stderr, "%s ran %llu callbacks instead of %llu\n", name, static_cast<unsigned long long>(g_callbacks),
+            static_cast<unsigned long long>(2 * Rounds * Calls));
+    }
+}
+
+void benchmarkThunks()
+{
+    using Flush = kiero::opengl::glFlush;
+
+    measureCallbacks("call/hand-detour", kiero::bind(kiero::RenderType::OpenGL, Flush::index, reinterpret_cast<void**>(&g_originalFlush), reinterpret_cast<void*>(&handFlush)) == kiero::Status::Success);
+
+    measureCallbacks("call/thunk", kiero::bindThunk<Flush>([] { countCallback(); }, [] { countCallback(); }) == kiero::Status::Success);
+
+    g_wrapper = { countCallback, countCallback };
+    measureCallbacks("call/std-function", kiero::bind(kiero::RenderType::OpenGL, Flush::index, reinterpret_cast<void**>(&g_originalFlush), reinterpret_cast<void*>(&wrappedFlush)) == kiero::Status::Success);
+}
+
+// A synthetic present loop allocating a frame's worth of draw data, from the frame arena or
+// with malloc/free, while helpers churn the heap. Reports the cost per allocation and the
+// frame time jitter, p99 minus p50 of every frame.
+constexpr ::std::size_t FrameAllocations = 256;
+constexpr ::std::uint64_t AllocationFrames = 2'000;
+
+[[nodiscard]] ::std::size_t allocationSize(const ::std::size_t i) noexcept
+{
+    return ::std::size_t { 16 } << (i % 7);
+}
+
+void touch(void* const block) noexcept
+{
+    if(block)
+    {
+        *static_cast<volatile char*>(block) = 0;
+    }
+}
+
+void allocateFrame(const bool arena, void** const blocks) noexcept
+{
+    if(arena)
+    {
+        const kiero::FrameScope frame;
+
+        for(::std::size_t i = 0; i < FrameAllocations; ++i)
+        {
+            blocks[i] = kiero::frameAllocate(allocationSize(i));
+            touch(blocks[i]);
+        }
+
+        return;
+    }
+
+    for(::std::size_t i = 0; i < FrameAllocations; ++i)
+    {
+        blocks[i] = ::std::malloc(allocationSize(i));
+        touch(blocks[i]);
+    }
+
+    for(::std::size_t i = 0; i < FrameAllocations; ++i)
+    {
+        ::std::free(blocks[i]);
+    }
+}
+
+void measureAllocations(const bool arena, const unsigned helpers)
+{
+    ::std::atomic<bool> stop { false };
+    ::std::vector<::std::thread> workers;
+
+    for(unsigned i = 0; i < helpers; ++i)
+    {
+        workers.emplace_back([&stop]
+        {
+            void* blocks[FrameAllocations];
+            while(!stop.load(::std::memory_order_relaxed))
+            {
+                allocateFrame(false, blocks);
+            }
+        });
+    }
+
+    void* blocks[FrameAllocations];
+    ::std::vector<Elapsed> rounds;
+    ::std::vector<double> frameNs;
+    ::std::vector<double> frameCycles;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        const Stopwatch total;
+
+        for(::std::uint64_t i = 0; i < AllocationFrames; ++i)
+        {
+            const Stopwatch stopwatch;
+            allocateFrame(arena, blocks);
+
+            const Elapsed elapsed = stopwatch.elapsed();
+            frameNs.push_back(elapsed.ns);
+            frameCycles.push_back(elapsed.cycles);
+        }
+
+        rounds.push_back(total.elapsed());
+    }
+
+    stop.store(true, ::std::memory_order_relaxed);
+
+    for(::std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    const unsigned threads = helpers + 1;
+    report(arena ? "alloc/arena" : "alloc/malloc", threads, 0, rounds, AllocationFrames * FrameAllocations);
+
+    const auto jitter = [](::std::vector<double>& samples)
+    {
+        ::std::sort(samples.begin(), samples.end());
+        return samples[samples.size() * 99 / 100] - samples[samples.size() / 2];
+    };
+
+    report(arena ? "jitter/arena" : "jitter/malloc", threads, 0, { Elapsed { jitter(frameNs), jitter(frameCycles) } }, 1);
+}
+
+void benchmarkAllocations()
+{
+    for(const unsigned helpers : { 0u, 3u })
+    {
+        measureAllocations(false, helpers);
+        measureAllocations(true, helpers);
+    }
+}
+
+// A synthetic present loop capped at LimitedRate, doing between a quarter and three quarters of
+// a frame's worth of work before each boundary. The pacing error is how far each interval
+// between two boundaries returning from the limiter is off the target, reported as its p50,
+// p99 and max.
+constexpr double LimitedRate = 240.0;
+constexpr ::std::uint64_t LimitedFrames = 240;
+
+void spinFor(const ::std::chrono::nanoseconds duration) noexcept
+{
+    const Clock::time_point end = Clock::now() + duration;
+    while(Clock::now() < end)
+    {
+    }
+}
+
+void measurePacing(const kiero::FrameLimitMode mode, const char* const name)
+{
+    const auto interval = ::std::chrono::nanoseconds(static_cast<::std::int64_t>(1e9 / LimitedRate));
+
+    kiero::setFrameLimit(LimitedRate, mode);
+
+    ::std::vector<double> errors;
+    Clock::time_point last { };
+
+    for(::std::uint64_t frame = 0; frame <= LimitedFrames; ++frame)
+    {
+        spinFor(interval * static_cast<::std::int64_t>(1 + frame % 3) / 4);
+
+        const kiero::FrameScope scope;
+        const Clock::time_point now = Clock::now();
+
+        if(frame)
+        {
+            const double error = ::std::chrono::duration<double, ::std::nano>(now - last - interval).count();
+            errors.push_back(error < 0 ? -error : error);
+        }
+
+        last = now;
+    }
+
+    kiero::setFrameLimit(0);
+
+    ::std::sort(errors.begin(), errors.end());
+
+    const auto at = [&errors](const ::std::size_t permille)
+    {
+        // Nanoseconds only, the limiter paces on the steady clock
+        const double ns = errors[::std::min(errors.size() - 1, errors.size() * permille / 1000)];
+        return ::std::vector<Elapsed> { { ns, 0 } };
+    };
+
+    char record[64];
+    ::std::snprintf(record, sizeof(record), "pacing/%s-p50", name);
+    report(record, 1, 0, at(500), 1);
+
+    ::std::snprintf(record, sizeof(record), "pacing/%s-p99", name);
+    report(record, 1, 0, at(990), 1);
+
+    ::std::snprintf(record, sizeof(record), "pacing/%s-max", name);
+    report(record, 1, 0, at(1000), 1);
+}
+
+void benchmarkLimiter()
+{
+    measurePacing(kiero::FrameLimitMode::Present, "present");
+    measurePacing(kiero::FrameLimitMode::Predictive, "predictive");
+}
+
+// What recording a frame boundary into the statistics ring costs, on a thread of its own so
+// its first boundary is the first of the loop, alone and with a thread reading the statistics
+// all along. Every interval is a synthetic 60 fps frame.
+void measureFrameStats(const bool reading)
+{
+    constexpr ::std::int64_t Interval = 16'666'667;
+
+    kiero::resetFrameStats();
+
+    ::std::atomic<bool> stop { false };
+    ::std::thread reader;
+
+    if(reading)
+    {
+        reader = ::std::thread([&stop]
+        {
+            kiero::FrameStats stats;
+            while(!stop.load(::std::memory_order_relaxed))
+            {
+                (void) kiero::getFrameStats(stats);
+            }
+        });
+    }
+
+    ::std::vector<Elapsed> rounds;
+
+    ::std::thread([&rounds]
+    {
+        ::std::int64_t time = Interval;
+
+        for(int round = 0; round < Rounds; ++round)
+        {
+            const Stopwatch stopwatch;
+
+            for(::std::uint64_t i = 0; i < Calls; ++i)
+            {
+                (void) kiero::detail::recordPresent(time);
+                time += Interval;
+            }
+
+            rounds.push_back(stopwatch.elapsed());
+        }
+    }).join();
+
+    stop.store(true, ::std::memory_order_relaxed);
+    if(reader.joinable())
+    {
+        reader.join();
+    }
+
+    kiero::FrameStats stats;
+    if(!kiero::getFrameStats(stats) || stats.frames != kiero::FrameStatsCapacity || ::std::fabs(stats.p999 - Interval / 1e6) > 1e-6)
+    {
+        ::std::fprintf(stderr, "frame statistics hold %u intervals of %.6f ms at p99.9 instead of %u of %.6f ms\n", stats.frames, stats.p999,
+            kiero::FrameStatsCapacity, Interval / 1e6);
+    }
+
+    report(reading ? "stats/record-read" : "stats/record", reading ? 2 : 1, 0, rounds, Calls);
+    kiero::resetFrameStats();
+}
+
+void benchmarkFrameStats()
+{
+    measureFrameStats(false);
+    measureFrameStats(true);
+}
+
+void benchmarkThreads()
+{
+    measureLoadedBinds(0, kiero::HookMode::DrainedDetour);
+
+    for(const unsigned threads : ThreadCounts)
+    {
+        measureConcurrentCalls("concurrent/direct", threads);
+
+        if(bindFlush(kiero::HookMode::Detour))
+        {
+            measureConcurrentCalls("concurrent/inline", threads);
+            kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::glFlush::index);
+        }
+
+        measureLoadedBinds(threads, kiero::HookMode::Detour);
+        measureLoadedBinds(threads, kiero::HookMode::DrainedDetour);
+        measureStalls(threads);
+    }
+}
+
+[[nodiscard]] bool writeJson(const char* const path)
+{
+    ::std::FILE* const file = ::std::fopen(path, "w");
+    if(!file)
+    {
+        return false;
+    }
+
+    ::std::fprintf(file, "{\n  \"kiero\": \"%s\",\n  \"hardwareThreads\": %u,\n  \"benchmarks\": [\n", KIERO_VERSION, ::std::thread::hardware_concurrency());
+
+    for(::std::size_t i = 0; i < g_records.size(); ++i)
+    {
+        const Record& record = g_records[i];
+        ::std::fprintf(file, "    { \"name\": \"%s\", \"threads\": %u, \"hooks\": %u, \"ns\": %.3f, \"cycles\": %.1f }%s\n",
+            record.name.c_str(), record.threads, record.hooks, record.ns, record.cycles, i + 1 < g_records.size() ? "," : "");
+    }
+
+    ::std::fprintf(file, "  ]\n}\n");
+    return ::std::fclose(file) == 0;
+}
+
+}
+
+int main(const int argc, char** const argv)
+{
+    const char* json = nullptr;
+    const char* trace = nullptr;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(::std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            json = argv[++i];
+        }
+        else if(::std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            trace = argv[++i];
+        }
+        else if(!::dlopen(argv[i], RTLD_NOW | RTLD_GLOBAL))
+        {
+            ::std::fprintf(stderr, "%s: %s\n", argv[0], ::dlerror());
+            return 1;
+        }
+    }
+
+    if(trace && kiero::startTrace(true) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "%s: tracing is not compiled in (-DKIERO_ENABLE_TRACE=ON)\n", argv[0]);
+        return 1;
+    }
+
+    ::std::printf("%-22s %7s %5s\n", "benchmark", "threads", "hooks");
+
+    benchmarkExports();
+    benchmarkLifecycle();
+
+    if(kiero::init(kiero::RenderType::OpenGL) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "%s: the stand-in libGL.so.1 is not loaded\n", argv[0]);
+        return 1;
+    }
+
+    benchmarkCalls();
+#if KIERO_INCLUDE_VULKAN
+    benchmarkVulkanCalls();
+#endif
+    benchmarkCensus();
+    benchmarkTiming();
+    benchmarkThunks();
+    benchmarkAllocations();
+    benchmarkLimiter();
+    benchmarkFrameStats();
+    benchmarkBinds();
+    benchmarkTrampolines();
+    benchmarkThreads();
+
+    kiero::shutdown();
+
+    if(trace)
+    {
+        kiero::stopTrace();
+
+        if(kiero::writeTrace(trace) != kiero::Status::Success)
+        {
+            ::std::fprintf(stderr, "%s: cannot write %s\n", argv[0], trace);
+            return 1;
+        }
+    }
+
+    if(json && !writeJson(json))
+    {
+        ::std::fprintf(stderr, "%s: cannot write %s\n", argv[0], json);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+// kiero-bench-init: wall time of building the methods tables one backend after the other
+// against initAsync building them at once, and of init with a cold methods-table cache (built
+// and saved) against a warm one (loaded). kiero only considers runtimes the process has
+// already loaded, pass them on the command line:
+//
+//   kiero-bench-init libGL.so.1 libvulkan.so.1
+//
+// Point LD_LIBRARY_PATH at stand-in runtimes to benchmark without a GPU driver.
+
+#include "kiero.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <dlfcn.h>
+#include <unistd.h>
+
+namespace
+{
+
+constexpr int Rounds = 21;
+
+using Clock = ::std::chrono::steady_clock;
+
+[[nodiscard]] double millisecondsSince(const Clock::time_point start) noexcept
+{
+    return ::std::chrono::duration<double, ::std::milli>(Clock::now() - start).count();
+}
+
+[[nodiscard]] double median(::std::vector<double> samples)
+{
+    ::std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+struct Completion
+{
+    ::std::mutex mutex;
+    ::std::condition_variable done;
+    bool finished = false;
+    kiero::Status status = kiero::Status::UnknownError;
+    Clock::time_point time;
+};
+
+void complete(void* const context, const kiero::Status status)
+{
+    Completion& completion = *static_cast<Completion*>(context);
+
+    const ::std::lock_guard<::std::mutex> lock(completion.mutex);
+    completion.time = Clock::now();
+    completion.status = status;
+    completion.finished = true;
+    completion.done.notify_one();
+}
+
+[[nodiscard]] const char* renderTypeName(const kiero::RenderType renderType) noexcept
+{
+    switch(renderType)
+    {
+        case kiero::RenderType::OpenGL: return "OpenGL";
+        case kiero::RenderType::Vulkan: return "Vulkan";
+        default:                        return "other";
+    }
+}
+
+// Counts the cache files, and removes them so the next init misses
+int scanDirectory(const char* const directory, const bool remove)
+{
+    DIR* const handle = ::opendir(directory);
+    if(!handle)
+    {
+        return 0;
+    }
+
+    int files = 0;
+    while(const dirent* const entry = ::readdir(handle))
+    {
+        if(entry->d_name[0] == '.')
+        {
+            continue;
+        }
+
+        ++files;
+        if(remove)
+        {
+            (void) ::unlink((::std::string(directory) + '/' + entry->d_name).c_str());
+        }
+    }
+
+    ::closedir(handle);
+    return files;
+}
+
+// init(type) against a cache that misses every round, then one that hits every round
+void measureCache(const kiero::RenderType type)
+{
+    char directory[] = "/tmp/kiero-bench-init-XXXXXX";
+    if(!::mkdtemp(directory))
+    {
+        ::std::fprintf(stderr, "mkdtemp failed, no cache timings\n");
+        return;
+    }
+
+    kiero::setCacheDirectory(directory);
+
+    ::std::vector<double> cold;
+    ::std::vector<double> warm;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        (void) scanDirectory(directory, true);
+
+        Clock::time_point start = Clock::now();
+        if(kiero::init(type) != kiero::Status::Success)
+        {
+            break;
+        }
+
+        cold.push_back(millisecondsSince(start));
+        kiero::shutdown();
+
+        // Tables with unresolved entries are not saved, a warm init would miss too
+        if(scanDirectory(directory, false) == 0)
+        {
+            ::std::printf("init(%s) saved no cache, its table is incomplete\n", renderTypeName(type));
+            warm.clear();
+            break;
+        }
+
+        start = Clock::now();
+        if(kiero::init(type) != kiero::Status::Success)
+        {
+            break;
+        }
+
+        warm.push_back(millisecondsSince(start));
+        kiero::shutdown();
+    }
+
+    kiero::setCacheDirectory(nullptr);
+    (void) scanDirectory(directory, true);
+    (void) ::rmdir(directory);
+
+    if(!cold.empty() && !warm.empty())
+    {
+        char label[48];
+        ::std::snprintf(label, sizeof(label), "init(%s), cold cache", renderTypeName(type));
+        ::std::printf("%-29s %8.3f ms\n", label, median(cold));
+        ::std::snprintf(label, sizeof(label), "init(%s), warm cache", renderTypeName(type));
+        ::std::printf("%-29s %8.3f ms\n", label, median(warm));
+    }
+}
+
+}
+
+int main(const int argc, char** const argv)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        if(!::dlopen(argv[i], RTLD_NOW | RTLD_GLOBAL))
+        {
+            ::std::fprintf(stderr, "%s: %s\n", argv[0], ::dlerror());
+            return 1;
+        }
+    }
+
+    // Sequential: every backend whose runtime is loaded, one after the other
+    ::std::vector<double> sequential;
+    ::std::vector<kiero::RenderType> candidates;
+
+    for(const kiero::RenderType type : { kiero::RenderType::OpenGL, kiero::RenderType::Vulkan })
+    {
+        ::std::vector<double> samples;
+
+        for(int round = 0; round < Rounds; ++round)
+        {
+            const Clock::time_point start = Clock::now();
+            if(kiero::init(type) != kiero::Status::Success)
+            {
+                break;
+            }
+
+            samples.push_back(millisecondsSince(start));
+            kiero::shutdown();
+        }
+
+        if(!samples.empty())
+        {
+            candidates.push_back(type);
+            sequential.push_back(median(samples));
+            char label[32];
+            ::std::snprintf(label, sizeof(label), "init(%s)", renderTypeName(type));
+            ::std::printf("%-29s %8.3f ms\n", label, sequential.back());
+        }
+    }
+
+    if(candidates.empty())
+    {
+        ::std::fprintf(stderr, "%s: no OpenGL or Vulkan runtime loaded\n", argv[0]);
+        return 1;
+    }
+
+    for(const kiero::RenderType type : candidates)
+    {
+        measureCache(type);
+    }
+
+    double sum = 0.0;
+    for(const double time : sequential)
+    {
+        sum += time;
+    }
+
+    ::std::vector<double> automatic;
+    ::std::vector<double> ready;
+    ::std::vector<double> drained;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        Clock::time_point start = Clock::now();
+        if(kiero::init(kiero::RenderType::Auto) != kiero::Status::Success)
+        {
+            return 1;
+        }
+
+        automatic.push_back(millisecondsSince(start));
+        kiero::shutdown();
+
+        Completion completion;
+
+        start = Clock::now();
+        if(kiero::initAsync(kiero::RenderType::Auto, kiero::InitMode::Eager, complete, &completion) != kiero::Status::Success)
+        {
+            return 1;
+        }
+
+        {
+            ::std::unique_lock<::std::mutex> lock(completion.mutex);
+            completion.done.wait(lock, [&] { return completion.finished; });
+        }
+
+        if(completion.status != kiero::Status::Success)
+        {
+            return 1;
+        }
+
+        ready.push_back(::std::chrono::duration<double, ::std::milli>(completion.time - start).count());
+
+        // shutdown waits for the workers still releasing the tables that lost
+        kiero::shutdown();
+        drained.push_back(millisecondsSince(start));
+    }
+
+    ::std::printf("sequential, every candidate   %8.3f ms\n", sum);
+    ::std::printf("init(Auto)                    %8.3f ms\n", median(automatic));
+    ::std::printf("initAsync(Auto), ready        %8.3f ms\n", median(ready));
+    ::std::printf("initAsync(Auto), all built    %8.3f ms (including shutdown)\n", median(drained));
+
+    return 0;
+}
@@ -0,0 +1,305 @@
+// kiero-bench-layer: the VkLayer_kiero implicit layer against inline hooks, on whatever Vulkan
+// driver the loader picks (lavapipe will do). vkGetFenceStatus is called through the device
+// pointer of a device created without the layer, directly and with an inline hook on the
+// driver's entry, then through the one of a device created with the layer, whose entry point
+// jumps down the chain, directly and with kiero::bind redirecting it. The layer is the copy
+// this program is linked against, the loader finds its manifest next to it. Times are medians
+// in nanoseconds per call, cycles are TSC ticks.
+//
+//   kiero-bench-layer
+
+#include "kiero.h"
+#include "kiero_detour.h"
+#include "kiero_layer.h"
+#include "kiero_methods.h"
+
+#include <vulkan/vulkan.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <dlfcn.h>
+#include <x86intrin.h>
+
+namespace
+{
+
+constexpr int Rounds = 11;
+constexpr ::std::uint64_t Calls = 1'000'000;
+
+using Clock = ::std::chrono::steady_clock;
+
+struct Elapsed
+{
+    double ns;
+    double cycles;
+};
+
+struct Stopwatch
+{
+    Clock::time_point start = Clock::now();
+    ::std::uint64_t cycles = __rdtsc();
+
+    [[nodiscard]] Elapsed elapsed() const noexcept
+    {
+        const ::std::uint64_t end = __rdtsc();
+        return { ::std::chrono::duration<double, ::std::nano>(Clock::now() - start).count(), static_cast<double>(end - cycles) };
+    }
+};
+
+[[nodiscard]] double median(::std::vector<double> samples)
+{
+    ::std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+void report(const char* const name, const ::std::vector<Elapsed>& rounds, const double operations)
+{
+    ::std::vector<double> ns;
+    ::std::vector<double> cycles;
+
+    for(const Elapsed& round : rounds)
+    {
+        ns.push_back(round.ns / operations);
+        cycles.push_back(round.cycles / operations);
+    }
+
+    ::std::printf("%-22s %12.2f ns %12.1f cycles\n", name, median(ns), median(cycles));
+}
+
+PFN_vkGetFenceStatus g_originalFenceStatus = nullptr;
+::std::uint64_t g_fenceStatusCalls = 0;
+
+VKAPI_ATTR VkResult VKAPI_CALL hookedFenceStatus(VkDevice device, VkFence fence)
+{
+    ++g_fenceStatusCalls;
+    return g_originalFenceStatus(device, fence);
+}
+
+void measureFenceStatus(const char* const name, const PFN_vkGetFenceStatus function, const VkDevice device, const VkFence fence, const bool hooked)
+{
+    g_fenceStatusCalls = 0;
+
+    ::std::vector<Elapsed> rounds;
+    for(int round = 0; round < Rounds; ++round)
+    {
+        const Stopwatch stopwatch;
+
+        for(::std::uint64_t i = 0; i < Calls; ++i)
+        {
+            (void) function(device, fence);
+        }
+
+        rounds.push_back(stopwatch.elapsed());
+    }
+
+    report(name, rounds, Calls);
+
+    if(hooked && g_fenceStatusCalls != Calls * Rounds)
+    {
+        ::std::fprintf(stderr, "%s caught %llu of %llu calls\n", name, static_cast<unsigned long long>(g_fenceStatusCalls), static_cast<unsigned long long>(Calls * Rounds));
+    }
+}
+
+// An instance, a device on the first physical device and an unsignaled fence
+struct Device
+{
+    PFN_vkDestroyInstance vkDestroyInstance = nullptr;
+    PFN_vkDestroyDevice vkDestroyDevice = nullptr;
+    PFN_vkDestroyFence vkDestroyFence = nullptr;
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+
+    PFN_vkGetFenceStatus getFenceStatus = nullptr;
+
+    Device(const Device&) = delete;
+    Device& operator=(const Device&) = delete;
+
+    explicit Device(const PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr)
+    {
+        const auto vkCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(vkGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+
+        VkApplicationInfo applicationInfo = { };
+        applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        applicationInfo.apiVersion = VK_API_VERSION_1_0;
+
+        VkInstanceCreateInfo instanceCreateInfo = { };
+        instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+        if(!vkCreateInstance || vkCreateInstance(&instanceCreateInfo, nullptr, &instance) != VK_SUCCESS)
+        {
+            instance = VK_NULL_HANDLE;
+            return;
+        }
+
+        vkDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(vkGetInstanceProcAddr(instance, "vkDestroyInstance"));
+        const auto vkEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(vkGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices"));
+        const auto vkCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(vkGetInstanceProcAddr(instance, "vkCreateDevice"));
+        const auto vkGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(vkGetInstanceProcAddr(instance, "vkGetDeviceProcAddr"));
+
+        VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+        ::std::uint32_t physicalDevicesCount = 1;
+
+        const VkResult result = vkEnumeratePhysicalDevices(instance, &physicalDevicesCount, &physicalDevice);
+        if((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDevicesCount == 0 || !vkGetDeviceProcAddr)
+        {
+            return;
+        }
+
+        // Any device has a queue family 0
+        const float queuePriority = 1.0f;
+
+        VkDeviceQueueCreateInfo queueCreateInfo = { };
+        queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueCreateInfo.queueCount = 1;
+        queueCreateInfo.pQueuePriorities = &queuePriority;
+
+        VkDeviceCreateInfo deviceCreateInfo = { };
+        deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        deviceCreateInfo.queueCreateInfoCount = 1;
+        deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+
+        if(vkCreateDevice(physicalDevice, &deviceCreateInfo, nullptr, &device) != VK_SUCCESS)
+        {
+            device = VK_NULL_HANDLE;
+            return;
+        }
+
+        vkDestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(vkGetDeviceProcAddr(device, "vkDestroyDevice"));
+        vkDestroyFence = reinterpret_cast<PFN_vkDestroyFence>(vkGetDeviceProcAddr(device, "vkDestroyFence"));
+        const auto vkCreateFence = reinterpret_cast<PFN_vkCreateFence>(vkGetDeviceProcAddr(device, "vkCreateFence"));
+
+        VkFenceCreateInfo fenceCreateInfo = { };
+        fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        if(vkCreateFence(device, &fenceCreateInfo, nullptr, &fence) != VK_SUCCESS)
+        {
+            fence = VK_NULL_HANDLE;
+            return;
+        }
+
+        getFenceStatus = reinterpret_cast<PFN_vkGetFenceStatus>(vkGetDeviceProcAddr(device, "vkGetFenceStatus"));
+    }
+
+    ~Device()
+    {
+        if(fence)
+        {
+            vkDestroyFence(device, fence, nullptr);
+        }
+
+        if(device)
+        {
+            vkDestroyDevice(device, nullptr);
+        }
+
+        if(instance)
+        {
+            vkDestroyInstance(instance, nullptr);
+        }
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return getFenceStatus != nullptr;
+    }
+};
+
+// The driver's entry, without and with an inline hook
+void measureInline(const PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr)
+{
+    const Device device(vkGetInstanceProcAddr);
+    if(!device)
+    {
+        ::std::fprintf(stderr, "no Vulkan device without the layer\n");
+        return;
+    }
+
+    measureFenceStatus("call/direct", device.getFenceStatus, device.device, device.fence, false);
+
+    kiero::detail::Hook hook;
+    if(kiero::detail::createHook(reinterpret_cast<void*>(device.getFenceStatus), reinterpret_cast<void*>(&hookedFenceStatus), hook) == kiero::Status::Success
+        && kiero::detail::enableHook(hook) == kiero::Status::Success)
+    {
+        g_originalFenceStatus = reinterpret_cast<PFN_vkGetFenceStatus>(hook.trampoline);
+        measureFenceStatus("call/inline", device.getFenceStatus, device.device, device.fence, true);
+    }
+    else
+    {
+        ::std::fprintf(stderr, "hooking the driver's vkGetFenceStatus failed\n");
+    }
+
+    kiero::detail::destroyHook(hook);
+}
+
+// The layer's entry, without and with kiero::bind redirecting it
+void measureLayer(const PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr)
+{
+    constexpr ::std::uint16_t Index = kiero::vulkan::vkGetFenceStatus::index;
+
+    const Device device(vkGetInstanceProcAddr);
+    if(!device)
+    {
+        ::std::fprintf(stderr, "no Vulkan device with the layer\n");
+        return;
+    }
+
+    if(reinterpret_cast<void*>(device.getFenceStatus) != kiero::detail::getLayerEntry(Index))
+    {
+        // VK_ADD_IMPLICIT_LAYER_PATH needs a recent loader, older ones need the manifest installed
+        ::std::fprintf(stderr, "the loader did not load VkLayer_kiero from %s\n", KIERO_BENCH_LAYER_DIRECTORY);
+        return;
+    }
+
+    measureFenceStatus("call/layer", device.getFenceStatus, device.device, device.fence, false);
+
+    if(kiero::init(kiero::RenderType::Vulkan) != kiero::Status::Success
+        || kiero::bind(kiero::RenderType::Vulkan, Index, reinterpret_cast<void**>(&g_originalFenceStatus), reinterpret_cast<void*>(&hookedFenceStatus)) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "binding vkGetFenceStatus in the layer failed\n");
+        kiero::shutdown();
+        return;
+    }
+
+    measureFenceStatus("call/layer-hook", device.getFenceStatus, device.device, device.fence, true);
+
+    kiero::unbind(kiero::RenderType::Vulkan, Index);
+    kiero::shutdown();
+}
+
+} // namespace
+
+int main()
+{
+    // The manifest enables the layer through ENABLE_KIERO_LAYER, the loader reads it at every
+    // vkCreateInstance
+    ::setenv("VK_ADD_IMPLICIT_LAYER_PATH", KIERO_BENCH_LAYER_DIRECTORY, 1);
+    ::setenv("DISABLE_KIERO_LAYER", "1", 1);
+
+    void* const handle = ::dlopen("libvulkan.so.1", RTLD_NOW | RTLD_GLOBAL);
+    const auto vkGetInstanceProcAddr = handle ? reinterpret_cast<PFN_vkGetInstanceProcAddr>(::dlsym(handle, "vkGetInstanceProcAddr")) : nullptr;
+
+    if(!vkGetInstanceProcAddr)
+    {
+        ::std::fprintf(stderr, "kiero-bench-layer: no Vulkan loader (libvulkan.so.1)\n");
+        return 1;
+    }
+
+    ::std::printf("benchmark\n");
+
+    measureInline(vkGetInstanceProcAddr);
+
+    ::unsetenv("DISABLE_KIERO_LAYER");
+    ::setenv("ENABLE_KIERO_LAYER", "1", 1);
+
+    measureLayer(vkGetInstanceProcAddr);
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+// kiero-bench-minhook: the built-in detour engine against MinHook, on Windows where MinHook
+// builds. Measures installing and removing one inline hook, installing a batch of them (kiero's
+// enableHooks against MinHook's queued enables) and the per call overhead of a hooked function
+// whose detour calls the original through the trampoline, next to a direct call. The targets
+// are functions of this program, so no graphics runtime is needed. Times are medians in
+// nanoseconds per operation, cycles are TSC ticks.
+//
+//   kiero-bench-minhook
+
+#include "kiero_detour.h"
+
+#include <MinHook.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <intrin.h>
+
+namespace
+{
+
+constexpr int Rounds = 11;
+constexpr ::std::uint64_t Calls = 1'000'000;
+constexpr int Installs = 1000;
+constexpr ::std::size_t Targets = 8;
+
+using Clock = ::std::chrono::steady_clock;
+
+struct Elapsed
+{
+    double ns;
+    double cycles;
+};
+
+struct Stopwatch
+{
+    Clock::time_point start = Clock::now();
+    ::std::uint64_t cycles = __rdtsc();
+
+    [[nodiscard]] Elapsed elapsed() const noexcept
+    {
+        const ::std::uint64_t end = __rdtsc();
+        return { ::std::chrono::duration<double, ::std::nano>(Clock::now() - start).count(), static_cast<double>(end - cycles) };
+    }
+};
+
+[[nodiscard]] double median(::std::vector<double> samples)
+{
+    ::std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+void report(const char* const name, const char* const engine, const ::std::vector<Elapsed>& rounds, const double operations)
+{
+    ::std::vector<double> ns;
+    ::std::vector<double> cycles;
+
+    for(const Elapsed& round : rounds)
+    {
+        ns.push_back(round.ns / operations);
+        cycles.push_back(round.cycles / operations);
+    }
+
+    ::std::printf("%-22s %-8s %12.2f ns %12.1f cycles\n", name, engine, median(ns), median(cycles));
+}
+
+volatile int g_sink;
+
+// Distinct bodies, long enough to patch, so the linker folds none of them
+template<int Salt>
+__declspec(noinline) int target(const int value)
+{
+    g_sink = value;
+    return value * Salt + g_sink;
+}
+
+using Function = int (*)(int);
+
+constexpr Function TargetFunctions[Targets] = { target<3>, target<5>, target<7>, target<11>, target<13>, target<17>, target<19>, target<23> };
+
+Function g_original = nullptr;
+
+__declspec(noinline) int detour(const int value)
+{
+    return g_original(value) + 1;
+}
+
+[[nodiscard]] int callMany(const Function function)
+{
+    int sum = 0;
+    for(::std::uint64_t i = 0; i < Calls; ++i)
+    {
+        sum += function(static_cast<int>(i));
+    }
+
+    return sum;
+}
+
+void measureInstall()
+{
+    void* const function = reinterpret_cast<void*>(TargetFunctions[0]);
+
+    ::std::vector<Elapsed> kieroRounds;
+    ::std::vector<Elapsed> minhookRounds;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        {
+            const Stopwatch stopwatch;
+            for(int i = 0; i < Installs; ++i)
+            {
+                kiero::detail::Hook hook;
+                (void) kiero::detail::createHook(function, reinterpret_cast<void*>(detour), hook);
+                (void) kiero::detail::enableHook(hook);
+                kiero::detail::destroyHook(hook);
+            }
+            kieroRounds.push_back(stopwatch.elapsed());
+        }
+
+        {
+            const Stopwatch stopwatch;
+            for(int i = 0; i < Installs; ++i)
+            {
+                void* original;
+                (void) MH_CreateHook(function, reinterpret_cast<void*>(detour), &original);
+                (void) MH_EnableHook(function);
+                (void) MH_RemoveHook(function);
+            }
+            minhookRounds.push_back(stopwatch.elapsed());
+        }
+    }
+
+    report("install+remove", "kiero", kieroRounds, Installs);
+    report("install+remove", "minhook", minhookRounds, Installs);
+}
+
+void measureBatch()
+{
+    ::std::vector<Elapsed> kieroRounds;
+    ::std::vector<Elapsed> minhookRounds;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        {
+            kiero::detail::Hook hooks[Targets];
+            kiero::detail::Hook* pointers[Targets];
+
+            const Stopwatch stopwatch;
+
+            for(::std::size_t i = 0; i < Targets; ++i)
+            {
+                (void) kiero::detail::createHook(reinterpret_cast<void*>(TargetFunctions[i]), reinterpret_cast<void*>(detour), hooks[i]);
+                pointers[i] = &hooks[i];
+            }
+
+            (void) kiero::detail::enableHooks(pointers, Targets, nullptr);
+            kieroRounds.push_back(stopwatch.elapsed());
+
+            for(kiero::detail::Hook& hook : hooks)
+            {
+                kiero::detail::destroyHook(hook);
+            }
+        }
+
+        {
+            const Stopwatch stopwatch;
+
+            for(const Function function : TargetFunctions)
+            {
+                void* original;
+                (void) MH_CreateHook(reinterpret_cast<void*>(function), reinterpret_cast<void*>(detour), &original);
+                (void) MH_QueueEnableHook(reinterpret_cast<void*>(function));
+            }
+            (void) MH_ApplyQueued();
+            minhookRounds.push_back(stopwatch.elapsed());
+
+            for(const Function function : TargetFunctions)
+            {
+                (void) MH_RemoveHook(reinterpret_cast<void*>(function));
+            }
+        }
+    }
+
+    report("install/batch", "kiero", kieroRounds, Targets);
+    report("install/batch", "minhook", minhookRounds, Targets);
+}
+
+void measureCalls()
+{
+    const Function function = TargetFunctions[1];
+
+    ::std::vector<Elapsed> rounds;
+    for(int round = 0; round < Rounds; ++round)
+    {
+        const Stopwatch stopwatch;
+        g_sink = callMany(function);
+        rounds.push_back(stopwatch.elapsed());
+    }
+
+    report("call/direct", "", rounds, Calls);
+
+    kiero::detail::Hook hook;
+    if(kiero::detail::createHook(reinterpret_cast<void*>(function), reinterpret_cast<void*>(detour), hook) == kiero::Status::Success
+        && kiero::detail::enableHook(hook) == kiero::Status::Success)
+    {
+        g_original = reinterpret_cast<Function>(hook.trampoline);
+
+        rounds.clear();
+        for(int round = 0; round < Rounds; ++round)
+        {
+            const Stopwatch stopwatch;
+            g_sink = callMany(function);
+            rounds.push_back(stopwatch.elapsed());
+        }
+
+        report("call/inline", "kiero", rounds, Calls);
+    }
+    else
+    {
+        ::std::fprintf(stderr, "hooking with the built-in engine failed\n");
+    }
+
+    kiero::detail::destroyHook(hook);
+
+    void* original;
+    if(MH_CreateHook(reinterpret_cast<void*>(function), reinterpret_cast<void*>(detour), &original) == MH_OK
+        && MH_EnableHook(reinterpret_cast<void*>(function)) == MH_OK)
+    {
+        g_original = reinterpret_cast<Function>(original);
+
+        rounds.clear();
+        for(int round = 0; round < Rounds; ++round)
+        {
+            const Stopwatch stopwatch;
+            g_sink = callMany(function);
+            rounds.push_back(stopwatch.elapsed());
+        }
+
+        report("call/inline", "minhook", rounds, Calls);
+    }
+    else
+    {
+        ::std::fprintf(stderr, "hooking with MinHook failed\n");
+    }
+
+    (void) MH_RemoveHook(reinterpret_cast<void*>(function));
+}
+
+} // namespace
+
+int main()
+{
+    if(MH_Initialize() != MH_OK)
+    {
+        ::std::fprintf(stderr, "MH_Initialize failed\n");
+        return 1;
+    }
+
+    ::std::printf("benchmark              engine\n");
+
+    measureInstall();
+    measureBatch();
+    measureCalls();
+
+    MH_Uninitialize();
+    return 0;
+}
@@ -0,0 +1,280 @@
+// A stand-in libGL.so.1 for kiero-bench-hooks, so it measures kiero instead of a driver. It
+// exports the first 257 names of the OpenGL methods table, glFlush and 256 others to hook,
+// every function only counts its calls in a counter of its own so none of them can be folded
+// into another.
+
+#include <cstdint>
+
+#define KIERO_BENCH_GL_FUNCTIONS(X) \
+    X(glAccum, 0) \
+    X(glAlphaFunc, 1) \
+    X(glAreTexturesResident, 2) \
+    X(glArrayElement, 3) \
+    X(glBegin, 4) \
+    X(glBindTexture, 5) \
+    X(glBitmap, 6) \
+    X(glBlendFunc, 7) \
+    X(glCallList, 8) \
+    X(glCallLists, 9) \
+    X(glClear, 10) \
+    X(glClearAccum, 11) \
+    X(glClearColor, 12) \
+    X(glClearDepth, 13) \
+    X(glClearIndex, 14) \
+    X(glClearStencil, 15) \
+    X(glClipPlane, 16) \
+    X(glColor3b, 17) \
+    X(glColor3bv, 18) \
+    X(glColor3d, 19) \
+    X(glColor3dv, 20) \
+    X(glColor3f, 21) \
+    X(glColor3fv, 22) \
+    X(glColor3i, 23) \
+    X(glColor3iv, 24) \
+    X(glColor3s, 25) \
+    X(glColor3sv, 26) \
+    X(glColor3ub, 27) \
+    X(glColor3ubv, 28) \
+    X(glColor3ui, 29) \
+    X(glColor3uiv, 30) \
+    X(glColor3us, 31) \
+    X(glColor3usv, 32) \
+    X(glColor4b, 33) \
+    X(glColor4bv, 34) \
+    X(glColor4d, 35) \
+    X(glColor4dv, 36) \
+    X(glColor4f, 37) \
+    X(glColor4fv, 38) \
+    X(glColor4i, 39) \
+    X(glColor4iv, 40) \
+    X(glColor4s, 41) \
+    X(glColor4sv, 42) \
+    X(glColor4ub, 43) \
+    X(glColor4ubv, 44) \
+    X(glColor4ui, 45) \
+    X(glColor4uiv, 46) \
+    X(glColor4us, 47) \
+    X(glColor4usv, 48) \
+    X(glColorMask, 49) \
+    X(glColorMaterial, 50) \
+    X(glColorPointer, 51) \
+    X(glCopyPixels, 52) \
+    X(glCopyTexImage1D, 53) \
+    X(glCopyTexImage2D, 54) \
+    X(glCopyTexSubImage1D, 55) \
+    X(glCopyTexSubImage2D, 56) \
+    X(glCullFace, 57) \
+    X(glDeleteLists, 58) \
+    X(glDeleteTextures, 59) \
+    X(glDepthFunc, 60) \
+    X(glDepthMask, 61) \
+    X(glDepthRange, 62) \
+    X(glDisable, 63) \
+    X(glDisableClientState, 64) \
+    X(glDrawArrays, 65) \
+    X(glDrawBuffer, 66) \
+    X(glDrawElements, 67) \
+    X(glDrawPixels, 68) \
+    X(glEdgeFlag, 69) \
+    X(glEdgeFlagPointer, 70) \
+    X(glEdgeFlagv, 71) \
+    X(glEnable, 72) \
+    X(glEnableClientState, 73) \
+    X(glEnd, 74) \
+    X(glEndList, 75) \
+    X(glEvalCoord1d, 76) \
+    X(glEvalCoord1dv, 77) \
+    X(glEvalCoord1f, 78) \
+    X(glEvalCoord1fv, 79) \
+    X(glEvalCoord2d, 80) \
+    X(glEvalCoord2dv, 81) \
+    X(glEvalCoord2f, 82) \
+    X(glEvalCoord2fv, 83) \
+    X(glEvalMesh1, 84) \
+    X(glEvalMesh2, 85) \
+    X(glEvalPoint1, 86) \
+    X(glEvalPoint2, 87) \
+    X(glFeedbackBuffer, 88) \
+    X(glFinish, 89) \
+    X(glFlush, 90) \
+    X(glFogf, 91) \
+    X(glFogfv, 92) \
+    X(glFogi, 93) \
+    X(glFogiv, 94) \
+    X(glFrontFace, 95) \
+    X(glFrustum, 96) \
+    X(glGenLists, 97) \
+    X(glGenTextures, 98) \
+    X(glGetBooleanv, 99) \
+    X(glGetClipPlane, 100) \
+    X(glGetDoublev, 101) \
+    X(glGetError, 102) \
+    X(glGetFloatv, 103) \
+    X(glGetIntegerv, 104) \
+    X(glGetLightfv, 105) \
+    X(glGetLightiv, 106) \
+    X(glGetMapdv, 107) \
+    X(glGetMapfv, 108) \
+    X(glGetMapiv, 109) \
+    X(glGetMaterialfv, 110) \
+    X(glGetMaterialiv, 111) \
+    X(glGetPixelMapfv, 112) \
+    X(glGetPixelMapuiv, 113) \
+    X(glGetPixelMapusv, 114) \
+    X(glGetPointerv, 115) \
+    X(glGetPolygonStipple, 116) \
+    X(glGetString, 117) \
+    X(glGetTexEnvfv, 118) \
+    X(glGetTexEnviv, 119) \
+    X(glGetTexGendv, 120) \
+    X(glGetTexGenfv, 121) \
+    X(glGetTexGeniv, 122) \
+    X(glGetTexImage, 123) \
+    X(glGetTexLevelParameterfv, 124) \
+    X(glGetTexLevelParameteriv, 125) \
+    X(glGetTexParameterfv, 126) \
+    X(glGetTexParameteriv, 127) \
+    X(glHint, 128) \
+    X(glIndexMask, 129) \
+    X(glIndexPointer, 130) \
+    X(glIndexd, 131) \
+    X(glIndexdv, 132) \
+    X(glIndexf, 133) \
+    X(glIndexfv, 134) \
+    X(glIndexi, 135) \
+    X(glIndexiv, 136) \
+    X(glIndexs, 137) \
+    X(glIndexsv, 138) \
+    X(glIndexub, 139) \
+    X(glIndexubv, 140) \
+    X(glInitNames, 141) \
+    X(glInterleavedArrays, 142) \
+    X(glIsEnabled, 143) \
+    X(glIsList, 144) \
+    X(glIsTexture, 145) \
+    X(glLightModelf, 146) \
+    X(glLightModelfv, 147) \
+    X(glLightModeli, 148) \
+    X(glLightModeliv, 149) \
+    X(glLightf, 150) \
+    X(glLightfv, 151) \
+    X(glLighti, 152) \
+    X(glLightiv, 153) \
+    X(glLineStipple, 154) \
+    X(glLineWidth, 155) \
+    X(glListBase, 156) \
+    X(glLoadIdentity, 157) \
+    X(glLoadMatrixd, 158) \
+    X(glLoadMatrixf, 159) \
+    X(glLoadName, 160) \
+    X(glLogicOp, 161) \
+    X(glMap1d, 162) \
+    X(glMap1f, 163) \
+    X(glMap2d, 164) \
+    X(glMap2f, 165) \
+    X(glMapGrid1d, 166) \
+    X(glMapGrid1f, 167) \
+    X(glMapGrid2d, 168) \
+    X(glMapGrid2f, 169) \
+    X(glMaterialf, 170) \
+    X(glMaterialfv, 171) \
+    X(glMateriali, 172) \
+    X(glMaterialiv, 173) \
+    X(glMatrixMode, 174) \
+    X(glMultMatrixd, 175) \
+    X(glMultMatrixf, 176) \
+    X(glNewList, 177) \
+    X(glNormal3b, 178) \
+    X(glNormal3bv, 179) \
+    X(glNormal3d, 180) \
+    X(glNormal3dv, 181) \
+    X(glNormal3f, 182) \
+    X(glNormal3fv, 183) \
+    X(glNormal3i, 184) \
+    X(glNormal3iv, 185) \
+    X(glNormal3s, 186) \
+    X(glNormal3sv, 187) \
+    X(glNormalPointer, 188) \
+    X(glOrtho, 189) \
+    X(glPassThrough, 190) \
+    X(glPixelMapfv, 191) \
+    X(glPixelMapuiv, 192) \
+    X(glPixelMapusv, 193) \
+    X(glPixelStoref, 194) \
+    X(glPixelStorei, 195) \
+    X(glPixelTransferf, 196) \
+    X(glPixelTransferi, 197) \
+    X(glPixelZoom, 198) \
+    X(glPointSize, 199) \
+    X(glPolygonMode, 200) \
+    X(glPolygonOffset, 201) \
+    X(glPolygonStipple, 202) \
+    X(glPopAttrib, 203) \
+    X(glPopClientAttrib, 204) \
+    X(glPopMatrix, 205) \
+    X(glPopName, 206) \
+    X(glPrioritizeTextures, 207) \
+    X(glPushAttrib, 208) \
+    X(glPushClientAttrib, 209) \
+    X(glPushMatrix, 210) \
+    X(glPushName, 211) \
+    X(glRasterPos2d, 212) \
+    X(glRasterPos2dv, 213) \
+    X(glRasterPos2f, 214) \
+    X(glRasterPos2fv, 215) \
+    X(glRasterPos2i, 216) \
+    X(glRasterPos2iv, 217) \
+    X(glRasterPos2s, 218) \
+    X(glRasterPos2sv, 219) \
+    X(glRasterPos3d, 220) \
+    X(glRasterPos3dv, 221) \
+    X(glRasterPos3f, 222) \
+    X(glRasterPos3fv, 223) \
+    X(glRasterPos3i, 224) \
+    X(glRasterPos3iv, 225) \
+    X(glRasterPos3s, 226) \
+    X(glRasterPos3sv, 227) \
+    X(glRasterPos4d, 228) \
+    X(glRasterPos4dv, 229) \
+    X(glRasterPos4f, 230) \
+    X(glRasterPos4fv, 231) \
+    X(glRasterPos4i, 232) \
+    X(glRasterPos4iv, 233) \
+    X(glRasterPos4s, 234) \
+    X(glRasterPos4sv, 235) \
+    X(glReadBuffer, 236) \
+    X(glReadPixels, 237) \
+    X(glRectd, 238) \
+    X(glRectdv, 239) \
+    X(glRectf, 240) \
+    X(glRectfv, 241) \
+    X(glRecti, 242) \
+    X(glRectiv, 243) \
+    X(glRects, 244) \
+    X(glRectsv, 245) \
+    X(glRenderMode, 246) \
+    X(glRotated, 247) \
+    X(glRotatef, 248) \
+    X(glScaled, 249) \
+    X(glScalef, 250) \
+    X(glScissor, 251) \
+    X(glSelectBuffer, 252) \
+    X(glShadeModel, 253) \
+    X(glStencilFunc, 254) \
+    X(glStencilMask, 255) \
+    X(glStencilOp, 256)
+
+extern "C"
+{
+
+__attribute__((visibility("default"))) volatile ::std::uint64_t kieroBenchCalls[257];
+
+#define KIERO_BENCH_DEFINE(name, slot) \
+    __attribute__((visibility("default"), noinline)) void name() \
+    { \
+        kieroBenchCalls[slot] = kieroBenchCalls[slot] + 1; \
+    }
+
+KIERO_BENCH_GL_FUNCTIONS(KIERO_BENCH_DEFINE)
+
+}
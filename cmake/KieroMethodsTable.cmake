@@ -0,0 +1,268 @@
+# Generates kiero_methods.h (typed indices, interface slices and names) and kiero_signatures.h
+# (the function type of every slot) from METHODSTABLE.txt.
+#
+#   cmake -DMETHODS_TABLE=METHODSTABLE.txt -DOUTPUT_DIRECTORY=<dir> [-DCHECK_DIRECTORY=<dir>] -P KieroMethodsTable.cmake
+#
+# With CHECK_DIRECTORY the generated headers must match the ones found there, the build uses it to
+# catch METHODSTABLE.txt edits that were not regenerated into the source tree.
+
+cmake_minimum_required(VERSION 3.25)
+
+if(NOT METHODS_TABLE OR NOT OUTPUT_DIRECTORY)
+    message(FATAL_ERROR "usage: cmake -DMETHODS_TABLE=<file> -DOUTPUT_DIRECTORY=<dir> [-DCHECK_DIRECTORY=<dir>] -P KieroMethodsTable.cmake")
+endif()
+
+# METHODSTABLE.txt only lists the slots, the slices of each table are the interfaces (or lookup
+# passes) kiero copies them from, in table order. Backends without interfaces are flat: their
+# methods live directly in the backend namespace.
+set(D3D9_NAMESPACE d3d9)
+set(D3D9_SLICES IDirect3DDevice9 119)
+
+set(D3D10_NAMESPACE d3d10)
+set(D3D10_SLICES IDXGISwapChain 18 ID3D10Device 98)
+
+set(D3D11_NAMESPACE d3d11)
+set(D3D11_SLICES IDXGISwapChain 18 ID3D11Device 43 ID3D11DeviceContext 115 ID3D11DeviceContext1 19 ID3D11DeviceContext2 10)
+
+set(D3D12_NAMESPACE d3d12)
+set(D3D12_SLICES ID3D12Device 44 ID3D12CommandQueue 19 ID3D12CommandAllocator 9 ID3D12GraphicsCommandList 60 IDXGISwapChain 18)
+
+set(OpenGL_NAMESPACE opengl)
+set(OpenGL_SLICES Functions 336 SwapBuffers 2)
+set(OpenGL_FLAT TRUE)
+
+set(Vulkan_NAMESPACE vulkan)
+set(Vulkan_SLICES Core 136 Present 1)
+set(Vulkan_FLAT TRUE)
+
+set(BACKENDS D3D9 D3D10 D3D11 D3D12 OpenGL Vulkan)
+
+# Slot names per backend, "<windows>|<linux>" for the platform dependent ones
+file(STRINGS "${METHODS_TABLE}" LINES)
+
+set(BACKEND "")
+foreach(LINE IN LISTS LINES)
+    if(LINE MATCHES "^([A-Za-z0-9]+) Methods Table:$")
+        set(BACKEND "${CMAKE_MATCH_1}")
+        if(NOT BACKEND IN_LIST BACKENDS)
+            message(FATAL_ERROR "${METHODS_TABLE}: unknown table ${BACKEND}")
+        endif()
+        set(${BACKEND}_METHODS "")
+    elseif(LINE MATCHES "^\\[([0-9]+)\\][ \t]+(.+)$")
+        set(INDEX "${CMAKE_MATCH_1}")
+        set(NAME "${CMAKE_MATCH_2}")
+
+        if(NAME MATCHES "^([A-Za-z0-9_]+) \\(Windows\\) / ([A-Za-z0-9_]+) \\(Linux\\)$")
+            set(NAME "${CMAKE_MATCH_1}|${CMAKE_MATCH_2}")
+        elseif(NOT NAME MATCHES "^[A-Za-z0-9_]+$")
+            message(FATAL_ERROR "${METHODS_TABLE}: unexpected entry '${LINE}'")
+        endif()
+
+        list(LENGTH ${BACKEND}_METHODS COUNT)
+        if(NOT INDEX EQUAL COUNT)
+            message(FATAL_ERROR "${METHODS_TABLE}: ${BACKEND} index ${INDEX} is out of order (expected ${COUNT})")
+        endif()
+
+        list(APPEND ${BACKEND}_METHODS "${NAME}")
+    endif()
+endforeach()
+
+set(GENERATED_NOTICE "// Generated from METHODSTABLE.txt by cmake/KieroMethodsTable.cmake, do not edit")
+
+# Appends the slot's C++ name (both, under #ifdef _WIN32, for platform dependent slots)
+function(emit_platform_split OUT NAME WINDOWS_LINE LINUX_LINE)
+    set(TEXT "${${OUT}}")
+    if(NAME MATCHES "^(.+)\\|(.+)$")
+        string(REPLACE "@NAME@" "${CMAKE_MATCH_1}" WINDOWS "${WINDOWS_LINE}")
+        string(REPLACE "@NAME@" "${CMAKE_MATCH_2}" LINUX "${LINUX_LINE}")
+        string(APPEND TEXT "#ifdef _WIN32\n${WINDOWS}\n#else\n${LINUX}\n#endif\n")
+    else()
+        string(REPLACE "@NAME@" "${NAME}" LINE "${WINDOWS_LINE}")
+        string(APPEND TEXT "${LINE}\n")
+    endif()
+    set(${OUT} "${TEXT}" PARENT_SCOPE)
+endfunction()
+
+set(METHODS "${GENERATED_NOTICE}\n#pragma once\n\n#include \"kiero.h\"\n\n#include <cstdint>\n")
+set(SIGNATURES "${GENERATED_NOTICE}\n#pragma once\n\n#include \"kiero_methods.h\"\n")
+
+string(APPEND SIGNATURES [=[
+
+// Included by the code using kiero::bind<Method>, not by kiero itself, so the graphics headers are
+// only needed there
+#if (KIERO_INCLUDE_D3D9 || KIERO_INCLUDE_D3D10 || KIERO_INCLUDE_D3D11 || KIERO_INCLUDE_D3D12) && defined(_WIN32)
+# include <Windows.h>
+# include <type_traits>
+
+namespace kiero::detail
+{
+	// A COM method as the free function its vtable slot points to, This first. A method returning
+	// a struct (GetDesc, GetAdapterLuid...) takes the caller's buffer after This and returns it, the
+	// MSVC ABI of a member function returning by value whatever the struct's size
+	template<typename Interface, typename Member>
+	struct ComMethod;
+
+	template<typename Interface, typename Return, typename Class, typename... Args>
+	struct ComMethod<Interface, Return (STDMETHODCALLTYPE Class::*)(Args...)>
+	{
+		using Type = Return (STDMETHODCALLTYPE*)(Interface*, Args...);
+	};
+
+	template<typename Interface, typename Return, typename Class, typename... Args>
+		requires ::std::is_class_v<Return>
+	struct ComMethod<Interface, Return (STDMETHODCALLTYPE Class::*)(Args...)>
+	{
+		using Type = Return* (STDMETHODCALLTYPE*)(Interface*, Return*, Args...);
+	};
+}
+#endif
+]=])
+
+foreach(BACKEND IN LISTS BACKENDS)
+    set(NAMESPACE "${${BACKEND}_NAMESPACE}")
+    set(NAMES ${${BACKEND}_METHODS})
+    list(LENGTH NAMES METHODS_COUNT)
+
+    if(METHODS_COUNT EQUAL 0)
+        message(FATAL_ERROR "${METHODS_TABLE}: no ${BACKEND} table")
+    endif()
+
+    string(APPEND METHODS "\nnamespace kiero::${NAMESPACE}\n{\n\tinline constexpr ::std::uint16_t MethodsCount = ${METHODS_COUNT};\n")
+
+    if(BACKEND STREQUAL "OpenGL")
+        string(APPEND SIGNATURES "\n#if KIERO_INCLUDE_OPENGL\n#ifdef _WIN32\n# include <Windows.h>\n# include <gl/GL.h>\n#else\n# include <GL/gl.h>\n\nstruct _XDisplay;\n#endif\n\nnamespace kiero\n{\n")
+    elseif(BACKEND STREQUAL "Vulkan")
+        string(APPEND SIGNATURES "\n#if KIERO_INCLUDE_VULKAN\n# include <vulkan/vulkan.h>\n\nnamespace kiero\n{\n")
+    else()
+        if(BACKEND STREQUAL "D3D9")
+            set(INCLUDES "# include <d3d9.h>")
+        elseif(BACKEND STREQUAL "D3D10")
+            set(INCLUDES "# include <dxgi.h>\n# include <d3d10_1.h>\n# include <d3d10.h>")
+        elseif(BACKEND STREQUAL "D3D11")
+            set(INCLUDES "# include <dxgi.h>\n# include <d3d11_2.h>")
+        else()
+            set(INCLUDES "# include <dxgi.h>\n# include <d3d12.h>")
+        endif()
+        string(APPEND SIGNATURES "\n#if KIERO_INCLUDE_${BACKEND} && defined(_WIN32)\n${INCLUDES}\n\nnamespace kiero\n{\n")
+    endif()
+
+    set(OFFSET 0)
+    set(FLAT_METHODS "")
+    set(SLICE_NAMES "")
+    set(TABLE_NAMES "")
+    set(SLICES ${${BACKEND}_SLICES})
+    list(LENGTH SLICES SLICES_LENGTH)
+    math(EXPR LAST_SLICE "${SLICES_LENGTH} - 2")
+
+    foreach(SLICE_INDEX RANGE 0 ${LAST_SLICE} 2)
+        math(EXPR SLICE_COUNT_INDEX "${SLICE_INDEX} + 1")
+        list(GET SLICES ${SLICE_INDEX} SLICE)
+        list(GET SLICES ${SLICE_COUNT_INDEX} SLICE_COUNT)
+        math(EXPR SLICE_END "${OFFSET} + ${SLICE_COUNT}")
+
+        if(SLICE_END GREATER METHODS_COUNT)
+            message(FATAL_ERROR "${METHODS_TABLE}: ${BACKEND} ${SLICE} ends past the table (${SLICE_END} > ${METHODS_COUNT})")
+        endif()
+
+        string(APPEND METHODS "\n\tnamespace ${SLICE}\n\t{\n\t\tinline constexpr ::std::uint16_t Offset = ${OFFSET};\n\t\tinline constexpr ::std::uint16_t Count = ${SLICE_COUNT};\n")
+
+        if(${BACKEND}_FLAT)
+            string(APPEND METHODS "\t}\n")
+        else()
+            string(APPEND METHODS "\n")
+        endif()
+
+        if(NOT ${BACKEND}_FLAT)
+            set(SLICE_NAMES "")
+        endif()
+
+        math(EXPR LAST "${SLICE_END} - 1")
+        foreach(INDEX RANGE ${OFFSET} ${LAST})
+            list(GET NAMES ${INDEX} NAME)
+
+            if(NAME IN_LIST SLICE_NAMES)
+                message(FATAL_ERROR "${METHODS_TABLE}: ${BACKEND} ${NAME} [${INDEX}] appears twice in ${SLICE}")
+            endif()
+            list(APPEND SLICE_NAMES "${NAME}")
+
+            if(${BACKEND}_FLAT)
+                list(APPEND TABLE_NAMES "${NAME}")
+            else()
+                list(APPEND TABLE_NAMES "${SLICE}::${NAME}")
+            endif()
+
+            set(METHODS_LINE "using @NAME@ = ::kiero::Method<::kiero::RenderType::${BACKEND}, ${INDEX}>;")
+            if(${BACKEND}_FLAT)
+                emit_platform_split(FLAT_METHODS "${NAME}" "\t${METHODS_LINE}" "\t${METHODS_LINE}")
+            else()
+                emit_platform_split(METHODS "${NAME}" "\t\t${METHODS_LINE}" "\t\t${METHODS_LINE}")
+            endif()
+
+            # The function type of the slot
+            set(PREFIX "\ttemplate<> struct MethodSignature<RenderType::${BACKEND}, ${INDEX}> { using Type = ")
+            if(BACKEND STREQUAL "Vulkan")
+                emit_platform_split(SIGNATURES "${NAME}" "${PREFIX}PFN_@NAME@; };" "")
+            elseif(BACKEND STREQUAL "OpenGL")
+                if(NAME MATCHES "\\|")
+                    # wglSwapBuffers/glXSwapBuffers are not declared by gl.h
+                    emit_platform_split(SIGNATURES "${NAME}" "${PREFIX}BOOL (WINAPI*)(HDC); }; // @NAME@" "${PREFIX}void (*)(::_XDisplay*, unsigned long); }; // @NAME@")
+                elseif(NAME STREQUAL "eglSwapBuffers")
+                    # Spelled out, egl.h pulls in the X11 headers on Linux
+                    emit_platform_split(SIGNATURES "${NAME}" "#ifdef _WIN32\n${PREFIX}unsigned int (__stdcall*)(void*, void*); }; // @NAME@\n#else\n${PREFIX}unsigned int (*)(void*, void*); }; // @NAME@\n#endif" "")
+                else()
+                    emit_platform_split(SIGNATURES "${NAME}" "${PREFIX}decltype(&::@NAME@); };" "")
+                endif()
+            elseif(NAME STREQUAL "QueryInterface")
+                # Overloaded with a template in Unknwn.h
+                emit_platform_split(SIGNATURES "${NAME}" "${PREFIX}HRESULT (STDMETHODCALLTYPE*)(::${SLICE}*, REFIID, void**); }; // ${SLICE}::@NAME@" "")
+            else()
+                emit_platform_split(SIGNATURES "${NAME}" "${PREFIX}detail::ComMethod<::${SLICE}, decltype(&::${SLICE}::@NAME@)>::Type; }; // ${SLICE}::@NAME@" "")
+            endif()
+        endforeach()
+
+        if(NOT ${BACKEND}_FLAT)
+            string(APPEND METHODS "\t}\n")
+        endif()
+
+        set(OFFSET ${SLICE_END})
+    endforeach()
+
+    if(NOT OFFSET EQUAL METHODS_COUNT)
+        message(FATAL_ERROR "${METHODS_TABLE}: the ${BACKEND} slices cover ${OFFSET} of ${METHODS_COUNT} methods")
+    endif()
+
+    if(${BACKEND}_FLAT)
+        string(APPEND METHODS "\n${FLAT_METHODS}")
+    endif()
+
+    # Looked up by name at runtime for the flat tables, kiero.cpp checks its own lists against
+    # these. The COM methods are qualified with their interface, e.g. "IDXGISwapChain::Present".
+    string(APPEND METHODS "\n\tinline constexpr const char* const Names[] = {\n")
+    foreach(NAME IN LISTS TABLE_NAMES)
+        emit_platform_split(METHODS "${NAME}" "\t\t\"@NAME@\"," "\t\t\"@NAME@\",")
+    endforeach()
+    string(APPEND METHODS "\t};\n")
+
+    string(APPEND METHODS "}\n")
+    string(APPEND SIGNATURES "}\n#endif\n")
+endforeach()
+
+file(MAKE_DIRECTORY "${OUTPUT_DIRECTORY}")
+
+foreach(HEADER kiero_methods.h kiero_signatures.h)
+    if(HEADER STREQUAL "kiero_methods.h")
+        set(CONTENT "${METHODS}")
+    else()
+        set(CONTENT "${SIGNATURES}")
+    endif()
+
+    # Unchanged files keep their timestamp, nothing including them is rebuilt
+    file(CONFIGURE OUTPUT "${OUTPUT_DIRECTORY}/${HEADER}" CONTENT "${CONTENT}" @ONLY NEWLINE_STYLE UNIX)
+
+    if(CHECK_DIRECTORY)
+        file(READ "${CHECK_DIRECTORY}/${HEADER}" EXPECTED)
+        if(NOT EXPECTED STREQUAL CONTENT)
+            message(FATAL_ERROR "${CHECK_DIRECTORY}/${HEADER} is out of date with METHODSTABLE.txt, run: cmake --build <build> --target KieroUpdateMethodsTable")
+        endif()
+    endif()
+endforeach()
@@ -21,10 +21,6 @@
 #if KIERO_INCLUDE_VULKAN
 #endif
 
-#if !KIERO_USE_MINHOOK
-# error "The example requires that minhook be enabled!"
-#endif
-
 #include <Windows.h>
 
 int kieroExampleThread()
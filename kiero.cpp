@@ -1,10 +1,32 @@
 #include "kiero.h"
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
-#include <cassert>
+#include "kiero_cache.h"
+#include "kiero_detour.h"
+#include "kiero_vtable.h"
+#include "kiero_vulkan.h"
+#include "kiero_layer.h"
+#include "kiero_got.h"
+#include "kiero_exports.h"
+#include "kiero_methods.h"
+#include "kiero_subscribers.h"
+#include "kiero_timing.h"
+#include "kiero_trace.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
 #include <iterator>
+#include <mutex>
 #include <new>
-#include <wrl/client.h>
+#include <string_view>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# include <Windows.h>
+# include <wrl/client.h>
+#else
+# include <dlfcn.h>
+# include <pthread.h>
+#endif
 
 #if KIERO_INCLUDE_D3D9
 # include <d3d9.h>
@@ -26,7 +48,7 @@
 # include <d3d12.h>
 #endif
 
-#if KIERO_INCLUDE_OPENGL
+#if KIERO_INCLUDE_OPENGL && defined(_WIN32)
 # include <gl/GL.h>
 #endif
 
@@ -47,770 +69,2669 @@
 namespace kiero
 {
 
-static RenderType g_renderType = RenderType::None;
-static void** g_methodsTable = nullptr;
-
-Status init(const RenderType renderType)
+enum class State
 {
-    if(g_renderType != RenderType::None)
-    {
-        return Status::AlreadyInitializedError;
-    }
+    Uninitialized,
+    Initializing,
+    Initialized,
+    ShuttingDown,
+};
 
-    if(renderType != RenderType::None)
-    {
-        if(renderType >= RenderType::D3D9 && renderType <= RenderType::D3D12)
-        {
-            WNDCLASSEX windowClass;
-            windowClass.cbSize = sizeof(WNDCLASSEX);
-            windowClass.style = CS_HREDRAW | CS_VREDRAW;
-            windowClass.lpfnWndProc = DefWindowProc;
-            windowClass.cbClsExtra = 0;
-            windowClass.cbWndExtra = 0;
-            windowClass.hInstance = GetModuleHandle(nullptr);
-            windowClass.hIcon = nullptr;
-            windowClass.hCursor = nullptr;
-            windowClass.hbrBackground = nullptr;
-            windowClass.lpszMenuName = nullptr;
-            windowClass.lpszClassName = KIERO_TEXT("Kiero");
-            windowClass.hIconSm = nullptr;
-
-            ::RegisterClassEx(&windowClass);
-
-            HWND window = ::CreateWindow(
-                windowClass.lpszClassName,
-                KIERO_TEXT("Kiero DirectX Window"),
-                WS_OVERLAPPEDWINDOW,
-                0,
-                0,
-                100,
-                100,
-                nullptr,
-                nullptr,
-                windowClass.hInstance,
-                nullptr
-            );
-
-            using Microsoft::WRL::ComPtr;
-
-            if(renderType == RenderType::D3D9)
-            {
-#if KIERO_INCLUDE_D3D9
-                HMODULE libD3D9 = ::GetModuleHandle(KIERO_TEXT("d3d9.dll"));
+// The registry (hooks, hook mode, the primary render type) only changes under g_registryMutex,
+// getRenderType reads lock-free
+static ::std::atomic<RenderType> g_renderType { RenderType::None };
+static ::std::mutex g_registryMutex;
 
-                if(!libD3D9)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::ModuleNotFoundError;
-                }
+static HookMode g_hookMode = HookMode::Detour;
 
-                auto Direct3DCreate9 = reinterpret_cast<decltype(&::Direct3DCreate9)>(::GetProcAddress(libD3D9, "Direct3DCreate9"));
-                if(!Direct3DCreate9)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+// A slice of the methods table copied from one interface (or resolved by one lookup pass)
+struct MethodsGroup
+{
+    ::std::uint16_t begin;
+    ::std::uint16_t count;
+};
 
-                ComPtr<IDirect3D9> direct3D9 = Direct3DCreate9(D3D_SDK_VERSION);
-                if(!direct3D9)
-                {
-                    direct3D9 = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+struct Backend
+{
+    RenderType type;
+    ::std::uint16_t methodsCount;
 
-                D3DPRESENT_PARAMETERS params { };
-                params.BackBufferWidth = 0;
-                params.BackBufferHeight = 0;
-                params.BackBufferFormat = D3DFMT_UNKNOWN;
-                params.BackBufferCount = 0;
-                params.MultiSampleType = D3DMULTISAMPLE_NONE;
-                params.MultiSampleQuality = 0;
-                params.SwapEffect = D3DSWAPEFFECT_DISCARD;
-                params.hDeviceWindow = window;
-                params.Windowed = 1;
-                params.EnableAutoDepthStencil = 0;
-                params.AutoDepthStencilFormat = D3DFMT_UNKNOWN;
-                params.Flags = 0;
-                params.FullScreen_RefreshRateInHz = 0;
-                params.PresentationInterval = 0;
-
-                ComPtr<IDirect3DDevice9> device;
-                HRESULT status = direct3D9->CreateDevice(
-                    D3DADAPTER_DEFAULT,
-                    D3DDEVTYPE_NULLREF,
-                    window,
-                    D3DCREATE_SOFTWARE_VERTEXPROCESSING | D3DCREATE_DISABLE_DRIVER_MANAGEMENT,
-                    &params,
-                    &device
-                );
-
-                if(!SUCCEEDED(status))
-                {
-                    device = nullptr;
-                    direct3D9 = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    const MethodsGroup* groups;
+    ::std::size_t groupsCount;
 
-                g_methodsTable = new(::std::nothrow) void* [119];
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable), *reinterpret_cast<void**>(device.Get()), 119 * sizeof(void*));
+    // Fails with ModuleNotFoundError when the runtime is not loaded
+    Status (*probe)();
 
-#if KIERO_USE_MINHOOK
-                MH_Initialize();
-#endif
+    // Fills the groups whose bits are set, building only the objects they need
+    Status (*resolve)(void** const methods, const ::std::uint32_t groups);
 
-                device = nullptr;
-                direct3D9 = nullptr;
+    // Frees what resolve had to keep alive for the table to stay valid, may be null
+    void (*release)();
 
-                g_renderType = RenderType::D3D9;
+    // Backends that can redirect calls without patching code (the Vulkan layer) take over
+    // bind/unbind, null otherwise
+    Status (*bind)(const ::std::uint16_t index, void** const original, void* const function);
+    void (*unbind)(const ::std::uint16_t index);
+};
 
-                ::DestroyWindow(window);
-                ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
+// One backend, any number of them can be initialized at once. init and shutdown move its state
+// with a compare-exchange, so only one of each can run per backend. The other fields are set
+// while Initializing and cleared while ShuttingDown, both under g_registryMutex like the hooks.
+struct Context
+{
+    ::std::atomic<State> state { State::Uninitialized };
 
-                return Status::Success;
-#endif
-            }
-            else if(renderType == RenderType::D3D10)
-            {
-#if KIERO_INCLUDE_D3D10
-                HMODULE libDXGI = ::GetModuleHandle(KIERO_TEXT("dxgi.dll"));
-                HMODULE libD3D10 = ::GetModuleHandle(KIERO_TEXT("d3d10.dll"));
+    const Backend* backend = nullptr;
+    void** methodsTable = nullptr;
+    ::std::uint16_t methodsCount = 0;
+    ::std::uint32_t resolvedGroups = 0; // under g_resolveMutex
 
-                if(!libDXGI || !libD3D10)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::ModuleNotFoundError;
-                }
+#if !KIERO_USE_MINHOOK
+    detail::Hook** hooks = nullptr;
+#endif
 
-                auto CreateDXGIFactory = reinterpret_cast<decltype(&::CreateDXGIFactory)>(::GetProcAddress(libDXGI, "CreateDXGIFactory"));
-                if(!CreateDXGIFactory)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+#ifndef _WIN32
+    detail::GotHook** gotHooks = nullptr;
+#endif
+};
 
-                ComPtr<IDXGIFactory> factory;
-                HRESULT status = CreateDXGIFactory(IID_PPV_ARGS(&factory));
+// Indexed by RenderType, None and Auto stay unused
+static Context g_contexts[static_cast<::std::size_t>(RenderType::Auto) + 1];
+static ::std::mutex g_resolveMutex;
 
-                if(!SUCCEEDED(status))
-                {
-                    factory = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+[[nodiscard]] static Context* findContext(const RenderType renderType) noexcept
+{
+    return renderType > RenderType::None && renderType < RenderType::Auto ? &g_contexts[static_cast<::std::size_t>(renderType)] : nullptr;
+}
 
-                ComPtr<IDXGIAdapter> adapter;
-                status = factory->EnumAdapters(0, &adapter);
+// Bindings with an index out of the table or a null pointer fail instead of reading past it
+[[nodiscard]] static bool isValidBinding(const Context& context, const ::std::uint16_t index, void** const original, void* const function) noexcept
+{
+    return original && function && index < context.methodsCount;
+}
 
-                if(!SUCCEEDED(status))
-                {
-                    adapter = nullptr;
-                    factory = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+// Copied under g_cacheMutex, init and lazy resolution read it on any thread
+static char g_cacheDirectory[512] = { };
+static ::std::mutex g_cacheMutex;
 
-                auto D3D10CreateDeviceAndSwapChain = reinterpret_cast<decltype(&::D3D10CreateDeviceAndSwapChain)>(::GetProcAddress(libD3D10, "D3D10CreateDeviceAndSwapChain"));
-                if(!D3D10CreateDeviceAndSwapChain)
-                {
-                    adapter = nullptr;
-                    factory = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+// The names a backend looks up must be the ones METHODSTABLE.txt lists from offset on
+template<::std::size_t N, ::std::size_t M>
+[[maybe_unused]] static constexpr bool matchesMethodsTable(const char* const (&names)[N], const char* const (&table)[M], const ::std::size_t offset)
+{
+    if(offset + N > M)
+    {
+        return false;
+    }
 
-                DXGI_RATIONAL refreshRate { };
-                refreshRate.Numerator = 60;
-                refreshRate.Denominator = 1;
-
-                DXGI_MODE_DESC bufferDesc { };
-                bufferDesc.Width = 100;
-                bufferDesc.Height = 100;
-                bufferDesc.RefreshRate = refreshRate;
-                bufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-                bufferDesc.ScanlineOrdering = DXGI_MODE_SCANLINE_ORDER_UNSPECIFIED;
-                bufferDesc.Scaling = DXGI_MODE_SCALING_UNSPECIFIED;
-
-                DXGI_SAMPLE_DESC sampleDesc { };
-                sampleDesc.Count = 1;
-                sampleDesc.Quality = 0;
-
-                DXGI_SWAP_CHAIN_DESC swapChainDesc { };
-                swapChainDesc.BufferDesc = bufferDesc;
-                swapChainDesc.SampleDesc = sampleDesc;
-                swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-                swapChainDesc.BufferCount = 1;
-                swapChainDesc.OutputWindow = window;
-                swapChainDesc.Windowed = 1;
-                swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
-                swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
-
-                ComPtr<ID3D10Device> device;
-                ComPtr<IDXGISwapChain> swapChain;
-                status = D3D10CreateDeviceAndSwapChain(
-                    adapter.Get(),
-                    D3D10_DRIVER_TYPE_HARDWARE,
-                    nullptr,
-                    0,
-                    D3D10_SDK_VERSION,
-                    &swapChainDesc,
-                    &swapChain,
-                    &device
-                );
-
-                if(!SUCCEEDED(status))
-                {
-                    swapChain = nullptr;
-                    device = nullptr;
-                    adapter = nullptr;
-                    factory = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    for(::std::size_t i = 0; i < N; ++i)
+    {
+        if(::std::string_view(names[i]) != table[offset + i])
+        {
+            return false;
+        }
+    }
 
-                g_methodsTable = new(::std::nothrow) void* [116];
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable), *reinterpret_cast<void**>(swapChain.Get()), 18 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 18), *reinterpret_cast<void**>(device.Get()), 98 * sizeof(void*));
+    return true;
+}
 
-#if KIERO_USE_MINHOOK
-                MH_Initialize();
-#endif
+[[maybe_unused]] static void copyMethods(void** const methods, const MethodsGroup& group, void* const object)
+{
+    (void) ::std::memcpy(static_cast<void*>(methods + group.begin), *static_cast<void***>(object), group.count * sizeof(void*));
+}
 
-                swapChain = nullptr;
-                device = nullptr;
-                adapter = nullptr;
-                factory = nullptr;
+#ifdef _WIN32
 
-                ::DestroyWindow(window);
-                ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
+// Hidden window the throwaway devices and swap chains are created for
+class DummyWindow
+{
+public:
+    DummyWindow()
+    {
+        KIERO_TRACE_SPAN(Init, "createWindow");
+
+        m_windowClass.cbSize = sizeof(WNDCLASSEX);
+        m_windowClass.style = CS_HREDRAW | CS_VREDRAW;
+        m_windowClass.lpfnWndProc = DefWindowProc;
+        m_windowClass.cbClsExtra = 0;
+        m_windowClass.cbWndExtra = 0;
+        m_windowClass.hInstance = GetModuleHandle(nullptr);
+        m_windowClass.hIcon = nullptr;
+        m_windowClass.hCursor = nullptr;
+        m_windowClass.hbrBackground = nullptr;
+        m_windowClass.lpszMenuName = nullptr;
+        m_windowClass.lpszClassName = KIERO_TEXT("Kiero");
+        m_windowClass.hIconSm = nullptr;
+
+        // initAsync builds several backends at once, the class stays registered while any
+        // of their windows exists
+        {
+            const ::std::lock_guard<::std::mutex> lock(s_classMutex);
+            if(s_classUsers++ == 0)
+            {
+                ::RegisterClassEx(&m_windowClass);
+            }
+        }
 
-                g_renderType = RenderType::D3D10;
+        m_window = ::CreateWindow(
+            m_windowClass.lpszClassName,
+            KIERO_TEXT("Kiero DirectX Window"),
+            WS_OVERLAPPEDWINDOW,
+            0,
+            0,
+            100,
+            100,
+            nullptr,
+            nullptr,
+            m_windowClass.hInstance,
+            nullptr
+        );
+    }
 
-                return Status::Success;
-#endif
-            }
-            else if(renderType == RenderType::D3D11)
-            {
-#if KIERO_INCLUDE_D3D11
-                HMODULE libD3D11 = ::GetModuleHandle(KIERO_TEXT("d3d11.dll"));
+    ~DummyWindow()
+    {
+        ::DestroyWindow(m_window);
 
-                if(!libD3D11)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::ModuleNotFoundError;
-                }
+        const ::std::lock_guard<::std::mutex> lock(s_classMutex);
+        if(--s_classUsers == 0)
+        {
+            ::UnregisterClass(m_windowClass.lpszClassName, m_windowClass.hInstance);
+        }
+    }
 
-                PFN_D3D11_CREATE_DEVICE_AND_SWAP_CHAIN D3D11CreateDeviceAndSwapChain = reinterpret_cast<PFN_D3D11_CREATE_DEVICE_AND_SWAP_CHAIN>(::GetProcAddress(libD3D11, "D3D11CreateDeviceAndSwapChain"));
+    DummyWindow(const DummyWindow&) = delete;
+    DummyWindow& operator=(const DummyWindow&) = delete;
 
-                if(!D3D11CreateDeviceAndSwapChain)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    [[nodiscard]] HWND get() const noexcept
+    {
+        return m_window;
+    }
 
-                D3D_FEATURE_LEVEL featureLevel;
-                constexpr D3D_FEATURE_LEVEL featureLevels[] = { D3D_FEATURE_LEVEL_10_1, D3D_FEATURE_LEVEL_11_0 };
-
-                DXGI_RATIONAL refreshRate { };
-                refreshRate.Numerator = 60;
-                refreshRate.Denominator = 1;
-
-                DXGI_MODE_DESC bufferDesc { };
-                bufferDesc.Width = 100;
-                bufferDesc.Height = 100;
-                bufferDesc.RefreshRate = refreshRate;
-                bufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-                bufferDesc.ScanlineOrdering = DXGI_MODE_SCANLINE_ORDER_UNSPECIFIED;
-                bufferDesc.Scaling = DXGI_MODE_SCALING_UNSPECIFIED;
-
-                DXGI_SAMPLE_DESC sampleDesc { };
-                sampleDesc.Count = 1;
-                sampleDesc.Quality = 0;
-
-                DXGI_SWAP_CHAIN_DESC swapChainDesc { };
-                swapChainDesc.BufferDesc = bufferDesc;
-                swapChainDesc.SampleDesc = sampleDesc;
-                swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-                swapChainDesc.BufferCount = 1;
-                swapChainDesc.OutputWindow = window;
-                swapChainDesc.Windowed = 1;
-                swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_DISCARD;
-                swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
-
-                ComPtr<ID3D11DeviceContext> context;
-                ComPtr<IDXGISwapChain> swapChain;
-                ComPtr<ID3D11Device> device;
-                HRESULT status = D3D11CreateDeviceAndSwapChain(
-                    nullptr,
-                    D3D_DRIVER_TYPE_HARDWARE,
-                    nullptr,
-                    0,
-                    featureLevels,
-                    2,
-                    D3D11_SDK_VERSION,
-                    &swapChainDesc,
-                    &swapChain,
-                    &device,
-                    &featureLevel,
-                    &context
-                );
-
-                if(!SUCCEEDED(status))
-                {
-                    context = nullptr;
-                    swapChain = nullptr;
-                    device = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+private:
+    static inline ::std::mutex s_classMutex;
+    static inline ::std::uint32_t s_classUsers = 0;
 
-                g_methodsTable = new(::std::nothrow) void* [205];
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable), *reinterpret_cast<void**>(swapChain.Get()), 18 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 18), *reinterpret_cast<void**>(device.Get()), 43 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 18 + 43), *reinterpret_cast<void**>(context.Get()), 144 * sizeof(void*));
+    WNDCLASSEX m_windowClass { };
+    HWND m_window = nullptr;
+};
 
-#if KIERO_USE_MINHOOK
-                MH_Initialize();
+#if KIERO_INCLUDE_D3D10 || KIERO_INCLUDE_D3D11 || KIERO_INCLUDE_D3D12
+static DXGI_SWAP_CHAIN_DESC makeSwapChainDesc(const HWND window, const UINT bufferCount, const DXGI_SWAP_EFFECT swapEffect)
+{
+    DXGI_RATIONAL refreshRate { };
+    refreshRate.Numerator = 60;
+    refreshRate.Denominator = 1;
+
+    DXGI_MODE_DESC bufferDesc { };
+    bufferDesc.Width = 100;
+    bufferDesc.Height = 100;
+    bufferDesc.RefreshRate = refreshRate;
+    bufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    bufferDesc.ScanlineOrdering = DXGI_MODE_SCANLINE_ORDER_UNSPECIFIED;
+    bufferDesc.Scaling = DXGI_MODE_SCALING_UNSPECIFIED;
+
+    DXGI_SAMPLE_DESC sampleDesc { };
+    sampleDesc.Count = 1;
+    sampleDesc.Quality = 0;
+
+    DXGI_SWAP_CHAIN_DESC swapChainDesc { };
+    swapChainDesc.BufferDesc = bufferDesc;
+    swapChainDesc.SampleDesc = sampleDesc;
+    swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    swapChainDesc.BufferCount = bufferCount;
+    swapChainDesc.OutputWindow = window;
+    swapChainDesc.Windowed = 1;
+    swapChainDesc.SwapEffect = swapEffect;
+    swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
+
+    return swapChainDesc;
+}
 #endif
 
-                context = nullptr;
-                swapChain = nullptr;
-                device = nullptr;
+using Microsoft::WRL::ComPtr;
 
-                ::DestroyWindow(window);
-                ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
+#elif KIERO_INCLUDE_OPENGL || KIERO_INCLUDE_VULKAN
 
-                g_renderType = RenderType::D3D11;
+// Reference to a library the process has already loaded, kiero never pulls a runtime in itself
+class LoadedLibrary
+{
+public:
+    explicit LoadedLibrary(const char* const name) noexcept
+        : m_handle(::dlopen(name, RTLD_LAZY | RTLD_NOLOAD))
+    {
+    }
 
-                return Status::Success;
-#endif
-            }
-            else if(renderType == RenderType::D3D12)
-            {
-#if KIERO_INCLUDE_D3D12
-                HMODULE libDXGI = ::GetModuleHandle(KIERO_TEXT("dxgi.dll"));
-                HMODULE libD3D12 = ::GetModuleHandle(KIERO_TEXT("d3d12.dll"));
+    ~LoadedLibrary()
+    {
+        if(m_handle)
+        {
+            ::dlclose(m_handle);
+        }
+    }
 
-                if(!libDXGI || !libD3D12)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::ModuleNotFoundError;
-                }
+    LoadedLibrary(const LoadedLibrary&) = delete;
+    LoadedLibrary& operator=(const LoadedLibrary&) = delete;
 
-                auto CreateDXGIFactory = reinterpret_cast<decltype(&::CreateDXGIFactory)>(::GetProcAddress(libDXGI, "CreateDXGIFactory"));
+    explicit operator bool() const noexcept
+    {
+        return m_handle != nullptr;
+    }
 
-                if(!CreateDXGIFactory)
-                {
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    [[nodiscard]] void* find(const char* const symbol) const noexcept
+    {
+        return m_handle ? ::dlsym(m_handle, symbol) : nullptr;
+    }
 
-                ComPtr<IDXGIFactory> factory;
-                HRESULT status = CreateDXGIFactory(IID_PPV_ARGS(&factory));
+    [[nodiscard]] void* handle() const noexcept
+    {
+        return m_handle;
+    }
 
-                if(!SUCCEEDED(status))
-                {
-                    factory = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+private:
+    void* m_handle;
+};
 
-                ComPtr<IDXGIAdapter> adapter;
-                status = factory->EnumAdapters(0, &adapter);
-                factory = nullptr;
+#endif
 
-                if(!SUCCEEDED(status))
-                {
-                    adapter = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+#if KIERO_INCLUDE_D3D9 && defined(_WIN32)
+static constexpr MethodsGroup g_d3d9Groups[] = {
+    { d3d9::IDirect3DDevice9::Offset, d3d9::IDirect3DDevice9::Count },
+};
 
-                PFN_D3D12_CREATE_DEVICE D3D12CreateDevice = reinterpret_cast<PFN_D3D12_CREATE_DEVICE>(::GetProcAddress(libD3D12, "D3D12CreateDevice"));
+static Status probeD3D9()
+{
+    return ::GetModuleHandle(KIERO_TEXT("d3d9.dll")) ? Status::Success : Status::ModuleNotFoundError;
+}
 
-                if(!D3D12CreateDevice)
-                {
-                    adapter = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+static Status resolveD3D9(void** const methods, const ::std::uint32_t)
+{
+    HMODULE libD3D9 = ::GetModuleHandle(KIERO_TEXT("d3d9.dll"));
 
-                ComPtr<ID3D12Device> device;
-                status = D3D12CreateDevice(
-                    adapter.Get(),
-                    D3D_FEATURE_LEVEL_11_0,
-                    IID_PPV_ARGS(&device)
-                );
+    auto Direct3DCreate9 = reinterpret_cast<decltype(&::Direct3DCreate9)>(::GetProcAddress(libD3D9, "Direct3DCreate9"));
+    if(!Direct3DCreate9)
+    {
+        return Status::UnknownError;
+    }
 
-                adapter = nullptr;
+    ComPtr<IDirect3D9> direct3D9 = Direct3DCreate9(D3D_SDK_VERSION);
+    if(!direct3D9)
+    {
+        return Status::UnknownError;
+    }
 
-                if(!SUCCEEDED(status))
-                {
-                    device = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    DummyWindow window;
+
+    D3DPRESENT_PARAMETERS params { };
+    params.BackBufferWidth = 0;
+    params.BackBufferHeight = 0;
+    params.BackBufferFormat = D3DFMT_UNKNOWN;
+    params.BackBufferCount = 0;
+    params.MultiSampleType = D3DMULTISAMPLE_NONE;
+    params.MultiSampleQuality = 0;
+    params.SwapEffect = D3DSWAPEFFECT_DISCARD;
+    params.hDeviceWindow = window.get();
+    params.Windowed = 1;
+    params.EnableAutoDepthStencil = 0;
+    params.AutoDepthStencilFormat = D3DFMT_UNKNOWN;
+    params.Flags = 0;
+    params.FullScreen_RefreshRateInHz = 0;
+    params.PresentationInterval = 0;
+
+    ComPtr<IDirect3DDevice9> device;
+    HRESULT status = direct3D9->CreateDevice(
+        D3DADAPTER_DEFAULT,
+        D3DDEVTYPE_NULLREF,
+        window.get(),
+        D3DCREATE_SOFTWARE_VERTEXPROCESSING | D3DCREATE_DISABLE_DRIVER_MANAGEMENT,
+        &params,
+        &device
+    );
+
+    if(!SUCCEEDED(status))
+    {
+        return Status::UnknownError;
+    }
 
-                D3D12_COMMAND_QUEUE_DESC queueDesc {};
-                queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
-                queueDesc.Priority = 0;
-                queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
-                queueDesc.NodeMask = 0;
+    copyMethods(methods, g_d3d9Groups[0], device.Get());
 
-                ComPtr<ID3D12CommandQueue> commandQueue;
-                status = device->CreateCommandQueue(
-                    &queueDesc,
-                    IID_PPV_ARGS(&commandQueue)
-                );
+    return Status::Success;
+}
 
-                if(!SUCCEEDED(status))
-                {
-                    commandQueue = nullptr;
-                    device = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+static constexpr Backend g_d3d9Backend = { RenderType::D3D9, d3d9::MethodsCount, g_d3d9Groups, ::std::size(g_d3d9Groups), probeD3D9, resolveD3D9, nullptr, nullptr, nullptr };
+#endif
 
-                ComPtr<ID3D12CommandAllocator> commandAllocator;
-                status = device->CreateCommandAllocator(
-                    D3D12_COMMAND_LIST_TYPE_DIRECT,
-                    IID_PPV_ARGS(&commandAllocator)
-                );
+#if KIERO_INCLUDE_D3D10 && defined(_WIN32)
+static constexpr MethodsGroup g_d3d10Groups[] = {
+    { d3d10::IDXGISwapChain::Offset, d3d10::IDXGISwapChain::Count },
+    { d3d10::ID3D10Device::Offset, d3d10::ID3D10Device::Count },
+};
 
-                if(!SUCCEEDED(status))
-                {
-                    commandAllocator = nullptr;
-                    commandQueue = nullptr;
-                    device = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+static Status probeD3D10()
+{
+    return ::GetModuleHandle(KIERO_TEXT("dxgi.dll")) && ::GetModuleHandle(KIERO_TEXT("d3d10.dll")) ? Status::Success : Status::ModuleNotFoundError;
+}
 
-                ComPtr<ID3D12GraphicsCommandList> commandList;
-                status = device->CreateCommandList(
-                    0,
-                    D3D12_COMMAND_LIST_TYPE_DIRECT,
-                    commandAllocator.Get(),
-                    nullptr,
-                    IID_PPV_ARGS(&commandList)
-                );
+static Status resolveD3D10(void** const methods, const ::std::uint32_t groups)
+{
+    HMODULE libDXGI = ::GetModuleHandle(KIERO_TEXT("dxgi.dll"));
+    HMODULE libD3D10 = ::GetModuleHandle(KIERO_TEXT("d3d10.dll"));
 
-                if(!SUCCEEDED(status))
-                {
-                    commandList = nullptr;
-                    commandAllocator = nullptr;
-                    commandQueue = nullptr;
-                    device = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    ComPtr<ID3D10Device> device;
+    ComPtr<IDXGISwapChain> swapChain;
 
-                DXGI_RATIONAL refreshRate { };
-                refreshRate.Numerator = 60;
-                refreshRate.Denominator = 1;
-
-                DXGI_MODE_DESC bufferDesc { };
-                bufferDesc.Width = 100;
-                bufferDesc.Height = 100;
-                bufferDesc.RefreshRate = refreshRate;
-                bufferDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-                bufferDesc.ScanlineOrdering = DXGI_MODE_SCANLINE_ORDER_UNSPECIFIED;
-                bufferDesc.Scaling = DXGI_MODE_SCALING_UNSPECIFIED;
-
-                DXGI_SAMPLE_DESC sampleDesc { };
-                sampleDesc.Count = 1;
-                sampleDesc.Quality = 0;
-
-                DXGI_SWAP_CHAIN_DESC swapChainDesc { };
-                swapChainDesc.BufferDesc = bufferDesc;
-                swapChainDesc.SampleDesc = sampleDesc;
-                swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-                swapChainDesc.BufferCount = 2;
-                swapChainDesc.OutputWindow = window;
-                swapChainDesc.Windowed = 1;
-                swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
-                swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
-
-                ComPtr<IDXGISwapChain> swapChain;
-                status = factory->CreateSwapChain(
-                    commandQueue.Get(),
-                    &swapChainDesc,
-                    &swapChain
-                );
-
-                if(!SUCCEEDED(status))
-                {
-                    swapChain = nullptr;
-                    commandList = nullptr;
-                    commandAllocator = nullptr;
-                    commandQueue = nullptr;
-                    device = nullptr;
-                    ::DestroyWindow(window);
-                    ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
-                    return Status::UnknownError;
-                }
+    if(groups & (1u << 0))
+    {
+        auto CreateDXGIFactory = reinterpret_cast<decltype(&::CreateDXGIFactory)>(::GetProcAddress(libDXGI, "CreateDXGIFactory"));
+        auto D3D10CreateDeviceAndSwapChain = reinterpret_cast<decltype(&::D3D10CreateDeviceAndSwapChain)>(::GetProcAddress(libD3D10, "D3D10CreateDeviceAndSwapChain"));
+        if(!CreateDXGIFactory || !D3D10CreateDeviceAndSwapChain)
+        {
+            return Status::UnknownError;
+        }
 
-                g_methodsTable = new(::std::nothrow) void* [150];
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable), *reinterpret_cast<void**>(device.Get()), 44 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 44), *reinterpret_cast<void**>(commandQueue.Get()), 19 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 44 + 19), *reinterpret_cast<void**>(commandAllocator.Get()), 9 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 44 + 19 + 9), *reinterpret_cast<void**>(commandList.Get()), 60 * sizeof(void*));
-                (void) ::std::memcpy(static_cast<void*>(g_methodsTable + 44 + 19 + 9 + 60), *reinterpret_cast<void**>(swapChain.Get()), 18 * sizeof(void*));
+        ComPtr<IDXGIFactory> factory;
+        HRESULT status = CreateDXGIFactory(IID_PPV_ARGS(&factory));
 
-#if KIERO_USE_MINHOOK
-                MH_Initialize();
-#endif
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
 
-                swapChain = nullptr;
-                commandList = nullptr;
-                commandAllocator = nullptr;
-                commandQueue = nullptr;
-                device = nullptr;
+        ComPtr<IDXGIAdapter> adapter;
+        status = factory->EnumAdapters(0, &adapter);
 
-                ::DestroyWindow(window);
-                ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
 
-                g_renderType = RenderType::D3D12;
+        DummyWindow window;
+        DXGI_SWAP_CHAIN_DESC swapChainDesc = makeSwapChainDesc(window.get(), 1, DXGI_SWAP_EFFECT_DISCARD);
+
+        status = D3D10CreateDeviceAndSwapChain(
+            adapter.Get(),
+            D3D10_DRIVER_TYPE_HARDWARE,
+            nullptr,
+            0,
+            D3D10_SDK_VERSION,
+            &swapChainDesc,
+            &swapChain,
+            &device
+        );
+
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
 
-                return Status::Success;
-#endif
-            }
+        copyMethods(methods, g_d3d10Groups[0], swapChain.Get());
+    }
+    else
+    {
+        // The device alone needs neither a window nor a swap chain
+        auto D3D10CreateDevice = reinterpret_cast<decltype(&::D3D10CreateDevice)>(::GetProcAddress(libD3D10, "D3D10CreateDevice"));
+        if(!D3D10CreateDevice)
+        {
+            return Status::UnknownError;
+        }
 
-            ::DestroyWindow(window);
-            ::UnregisterClass(windowClass.lpszClassName, windowClass.hInstance);
+        HRESULT status = D3D10CreateDevice(nullptr, D3D10_DRIVER_TYPE_HARDWARE, nullptr, 0, D3D10_SDK_VERSION, &device);
 
-            return Status::NotSupportedError;
-        }
-        else if(renderType != RenderType::Auto)
+        if(!SUCCEEDED(status))
         {
-            if(renderType == RenderType::OpenGL)
-            {
-#if KIERO_INCLUDE_OPENGL
-                HMODULE libOpenGL32 = ::GetModuleHandle(KIERO_TEXT("opengl32.dll"));
+            return Status::UnknownError;
+        }
+    }
 
-                if(!libOpenGL32)
-                {
-                    return Status::ModuleNotFoundError;
-                }
+    if(groups & (1u << 1))
+    {
+        copyMethods(methods, g_d3d10Groups[1], device.Get());
+    }
 
-                constexpr const char* const methodsNames[] = {
-                    "glAccum", "glAlphaFunc", "glAreTexturesResident", "glArrayElement", "glBegin", "glBindTexture", "glBitmap", "glBlendFunc", "glCallList", "glCallLists", "glClear", "glClearAccum",
-                    "glClearColor", "glClearDepth", "glClearIndex", "glClearStencil", "glClipPlane", "glColor3b", "glColor3bv", "glColor3d", "glColor3dv", "glColor3f", "glColor3fv", "glColor3i", "glColor3iv",
-                    "glColor3s", "glColor3sv", "glColor3ub", "glColor3ubv", "glColor3ui", "glColor3uiv", "glColor3us", "glColor3usv", "glColor4b", "glColor4bv", "glColor4d", "glColor4dv", "glColor4f",
-                    "glColor4fv", "glColor4i", "glColor4iv", "glColor4s", "glColor4sv", "glColor4ub", "glColor4ubv", "glColor4ui", "glColor4uiv", "glColor4us", "glColor4usv", "glColorMask", "glColorMaterial",
-                    "glColorPointer", "glCopyPixels", "glCopyTexImage1D", "glCopyTexImage2D", "glCopyTexSubImage1D", "glCopyTexSubImage2D", "glCullFaceglCullFace", "glDeleteLists", "glDeleteTextures",
-                    "glDepthFunc", "glDepthMask", "glDepthRange", "glDisable", "glDisableClientState", "glDrawArrays", "glDrawBuffer", "glDrawElements", "glDrawPixels", "glEdgeFlag", "glEdgeFlagPointer",
-                    "glEdgeFlagv", "glEnable", "glEnableClientState", "glEnd", "glEndList", "glEvalCoord1d", "glEvalCoord1dv", "glEvalCoord1f", "glEvalCoord1fv", "glEvalCoord2d", "glEvalCoord2dv",
-                    "glEvalCoord2f", "glEvalCoord2fv", "glEvalMesh1", "glEvalMesh2", "glEvalPoint1", "glEvalPoint2", "glFeedbackBuffer", "glFinish", "glFlush", "glFogf", "glFogfv", "glFogi", "glFogiv",
-                    "glFrontFace", "glFrustum", "glGenLists", "glGenTextures", "glGetBooleanv", "glGetClipPlane", "glGetDoublev", "glGetError", "glGetFloatv", "glGetIntegerv", "glGetLightfv", "glGetLightiv",
-                    "glGetMapdv", "glGetMapfv", "glGetMapiv", "glGetMaterialfv", "glGetMaterialiv", "glGetPixelMapfv", "glGetPixelMapuiv", "glGetPixelMapusv", "glGetPointerv", "glGetPolygonStipple",
-                    "glGetString", "glGetTexEnvfv", "glGetTexEnviv", "glGetTexGendv", "glGetTexGenfv", "glGetTexGeniv", "glGetTexImage", "glGetTexLevelParameterfv", "glGetTexLevelParameteriv",
-                    "glGetTexParameterfv", "glGetTexParameteriv", "glHint", "glIndexMask", "glIndexPointer", "glIndexd", "glIndexdv", "glIndexf", "glIndexfv", "glIndexi", "glIndexiv", "glIndexs", "glIndexsv",
-                    "glIndexub", "glIndexubv", "glInitNames", "glInterleavedArrays", "glIsEnabled", "glIsList", "glIsTexture", "glLightModelf", "glLightModelfv", "glLightModeli", "glLightModeliv", "glLightf",
-                    "glLightfv", "glLighti", "glLightiv", "glLineStipple", "glLineWidth", "glListBase", "glLoadIdentity", "glLoadMatrixd", "glLoadMatrixf", "glLoadName", "glLogicOp", "glMap1d", "glMap1f",
-                    "glMap2d", "glMap2f", "glMapGrid1d", "glMapGrid1f", "glMapGrid2d", "glMapGrid2f", "glMaterialf", "glMaterialfv", "glMateriali", "glMaterialiv", "glMatrixMode", "glMultMatrixd",
-                    "glMultMatrixf", "glNewList", "glNormal3b", "glNormal3bv", "glNormal3d", "glNormal3dv", "glNormal3f", "glNormal3fv", "glNormal3i", "glNormal3iv", "glNormal3s", "glNormal3sv",
-                    "glNormalPointer", "glOrtho", "glPassThrough", "glPixelMapfv", "glPixelMapuiv", "glPixelMapusv", "glPixelStoref", "glPixelStorei", "glPixelTransferf", "glPixelTransferi", "glPixelZoom",
-                    "glPointSize", "glPolygonMode", "glPolygonOffset", "glPolygonStipple", "glPopAttrib", "glPopClientAttrib", "glPopMatrix", "glPopName", "glPrioritizeTextures", "glPushAttrib",
-                    "glPushClientAttrib", "glPushMatrix", "glPushName", "glRasterPos2d", "glRasterPos2dv", "glRasterPos2f", "glRasterPos2fv", "glRasterPos2i", "glRasterPos2iv", "glRasterPos2s",
-                    "glRasterPos2sv", "glRasterPos3d", "glRasterPos3dv", "glRasterPos3f", "glRasterPos3fv", "glRasterPos3i", "glRasterPos3iv", "glRasterPos3s", "glRasterPos3sv", "glRasterPos4d",
-                    "glRasterPos4dv", "glRasterPos4f", "glRasterPos4fv", "glRasterPos4i", "glRasterPos4iv", "glRasterPos4s", "glRasterPos4sv", "glReadBuffer", "glReadPixels", "glRectd", "glRectdv", "glRectf",
-                    "glRectfv", "glRecti", "glRectiv", "glRects", "glRectsv", "glRenderMode", "glRotated", "glRotatef", "glScaled", "glScalef", "glScissor", "glSelectBuffer", "glShadeModel", "glStencilFunc",
-                    "glStencilMask", "glStencilOp", "glTexCoord1d", "glTexCoord1dv", "glTexCoord1f", "glTexCoord1fv", "glTexCoord1i", "glTexCoord1iv", "glTexCoord1s", "glTexCoord1sv", "glTexCoord2d",
-                    "glTexCoord2dv", "glTexCoord2f", "glTexCoord2fv", "glTexCoord2i", "glTexCoord2iv", "glTexCoord2s", "glTexCoord2sv", "glTexCoord3d", "glTexCoord3dv", "glTexCoord3f", "glTexCoord3fv",
-                    "glTexCoord3i", "glTexCoord3iv", "glTexCoord3s", "glTexCoord3sv", "glTexCoord4d", "glTexCoord4dv", "glTexCoord4f", "glTexCoord4fv", "glTexCoord4i", "glTexCoord4iv", "glTexCoord4s",
-                    "glTexCoord4sv", "glTexCoordPointer", "glTexEnvf", "glTexEnvfv", "glTexEnvi", "glTexEnviv", "glTexGend", "glTexGendv", "glTexGenf", "glTexGenfv", "glTexGeni", "glTexGeniv", "glTexImage1D",
-                    "glTexImage2D", "glTexParameterf", "glTexParameterfv", "glTexParameteri", "glTexParameteriv", "glTexSubImage1D", "glTexSubImage2D", "glTranslated", "glTranslatef", "glVertex2d",
-                    "glVertex2dv", "glVertex2f", "glVertex2fv", "glVertex2i", "glVertex2iv", "glVertex2s", "glVertex2sv", "glVertex3d", "glVertex3dv", "glVertex3f", "glVertex3fv", "glVertex3i", "glVertex3iv",
-                    "glVertex3s", "glVertex3sv", "glVertex4d", "glVertex4dv", "glVertex4f", "glVertex4fv", "glVertex4i", "glVertex4iv", "glVertex4s", "glVertex4sv", "glVertexPointer", "glViewport"
-                };
-
-                ::std::size_t size = ::std::size(methodsNames);
-
-                g_methodsTable = new(::std::nothrow) void* [size];
-
-                for(::std::size_t i = 0; i < size; ++i)
-                {
-                    g_methodsTable[i] = ::GetProcAddress(libOpenGL32, methodsNames[i]);
-                }
+    return Status::Success;
+}
 
-#if KIERO_USE_MINHOOK
-                MH_Initialize();
+static constexpr Backend g_d3d10Backend = { RenderType::D3D10, d3d10::MethodsCount, g_d3d10Groups, ::std::size(g_d3d10Groups), probeD3D10, resolveD3D10, nullptr, nullptr, nullptr };
 #endif
 
-                g_renderType = RenderType::OpenGL;
-
-                return Status::Success;
-#endif
-            }
-            else if(renderType == RenderType::Vulkan)
-            {
-#if KIERO_INCLUDE_VULKAN
-                HMODULE libVulkan = GetModuleHandle(KIERO_TEXT("vulkan-1.dll"));
-                if(!libVulkan)
-                {
-                    return Status::ModuleNotFoundError;
-                }
+#if KIERO_INCLUDE_D3D11 && defined(_WIN32)
+static constexpr MethodsGroup g_d3d11Groups[] = {
+    { d3d11::IDXGISwapChain::Offset, d3d11::IDXGISwapChain::Count },
+    { d3d11::ID3D11Device::Offset, d3d11::ID3D11Device::Count },
+    { d3d11::ID3D11DeviceContext::Offset, d3d11::MethodsCount - d3d11::ID3D11DeviceContext::Offset }, // up to ID3D11DeviceContext2
+};
 
-                constexpr const char* const methodsNames[] = {
-                    "vkCreateInstance", "vkDestroyInstance", "vkEnumeratePhysicalDevices", "vkGetPhysicalDeviceFeatures", "vkGetPhysicalDeviceFormatProperties", "vkGetPhysicalDeviceImageFormatProperties",
-                    "vkGetPhysicalDeviceProperties", "vkGetPhysicalDeviceQueueFamilyProperties", "vkGetPhysicalDeviceMemoryProperties", "vkGetInstanceProcAddr", "vkGetDeviceProcAddr", "vkCreateDevice",
-                    "vkDestroyDevice", "vkEnumerateInstanceExtensionProperties", "vkEnumerateDeviceExtensionProperties", "vkEnumerateDeviceLayerProperties", "vkGetDeviceQueue", "vkQueueSubmit", "vkQueueWaitIdle",
-                    "vkDeviceWaitIdle", "vkAllocateMemory", "vkFreeMemory", "vkMapMemory", "vkUnmapMemory", "vkFlushMappedMemoryRanges", "vkInvalidateMappedMemoryRanges", "vkGetDeviceMemoryCommitment",
-                    "vkBindBufferMemory", "vkBindImageMemory", "vkGetBufferMemoryRequirements", "vkGetImageMemoryRequirements", "vkGetImageSparseMemoryRequirements", "vkGetPhysicalDeviceSparseImageFormatProperties",
-                    "vkQueueBindSparse", "vkCreateFence", "vkDestroyFence", "vkResetFences", "vkGetFenceStatus", "vkWaitForFences", "vkCreateSemaphore", "vkDestroySemaphore", "vkCreateEvent", "vkDestroyEvent",
-                    "vkGetEventStatus", "vkSetEvent", "vkResetEvent", "vkCreateQueryPool", "vkDestroyQueryPool", "vkGetQueryPoolResults", "vkCreateBuffer", "vkDestroyBuffer", "vkCreateBufferView", "vkDestroyBufferView",
-                    "vkCreateImage", "vkDestroyImage", "vkGetImageSubresourceLayout", "vkCreateImageView", "vkDestroyImageView", "vkCreateShaderModule", "vkDestroyShaderModule", "vkCreatePipelineCache",
-                    "vkDestroyPipelineCache", "vkGetPipelineCacheData", "vkMergePipelineCaches", "vkCreateGraphicsPipelines", "vkCreateComputePipelines", "vkDestroyPipeline", "vkCreatePipelineLayout",
-                    "vkDestroyPipelineLayout", "vkCreateSampler", "vkDestroySampler", "vkCreateDescriptorSetLayout", "vkDestroyDescriptorSetLayout", "vkCreateDescriptorPool", "vkDestroyDescriptorPool",
-                    "vkResetDescriptorPool", "vkAllocateDescriptorSets", "vkFreeDescriptorSets", "vkUpdateDescriptorSets", "vkCreateFramebuffer", "vkDestroyFramebuffer", "vkCreateRenderPass", "vkDestroyRenderPass",
-                    "vkGetRenderAreaGranularity", "vkCreateCommandPool", "vkDestroyCommandPool", "vkResetCommandPool", "vkAllocateCommandBuffers", "vkFreeCommandBuffers", "vkBeginCommandBuffer", "vkEndCommandBuffer",
-                    "vkResetCommandBuffer", "vkCmdBindPipeline", "vkCmdSetViewport", "vkCmdSetScissor", "vkCmdSetLineWidth", "vkCmdSetDepthBias", "vkCmdSetBlendConstants", "vkCmdSetDepthBounds",
-                    "vkCmdSetStencilCompareMask", "vkCmdSetStencilWriteMask", "vkCmdSetStencilReference", "vkCmdBindDescriptorSets", "vkCmdBindIndexBuffer", "vkCmdBindVertexBuffers", "vkCmdDraw", "vkCmdDrawIndexed",
-                    "vkCmdDrawIndirect", "vkCmdDrawIndexedIndirect", "vkCmdDispatch", "vkCmdDispatchIndirect", "vkCmdCopyBuffer", "vkCmdCopyImage", "vkCmdBlitImage", "vkCmdCopyBufferToImage", "vkCmdCopyImageToBuffer",
-                    "vkCmdUpdateBuffer", "vkCmdFillBuffer", "vkCmdClearColorImage", "vkCmdClearDepthStencilImage", "vkCmdClearAttachments", "vkCmdResolveImage", "vkCmdSetEvent", "vkCmdResetEvent", "vkCmdWaitEvents",
-                    "vkCmdPipelineBarrier", "vkCmdBeginQuery", "vkCmdEndQuery", "vkCmdResetQueryPool", "vkCmdWriteTimestamp", "vkCmdCopyQueryPoolResults", "vkCmdPushConstants", "vkCmdBeginRenderPass", "vkCmdNextSubpass",
-                    "vkCmdEndRenderPass", "vkCmdExecuteCommands"
-                };
-
-                ::std::size_t size = ::std::size(methodsNames);
-
-                g_methodsTable = new(::std::nothrow) void* [size];
-
-                for(::std::size_t i = 0; i < size; ++i)
-                {
-                    g_methodsTable[i] = ::GetProcAddress(libVulkan, methodsNames[i]);
-                }
+static Status probeD3D11()
+{
+    return ::GetModuleHandle(KIERO_TEXT("d3d11.dll")) ? Status::Success : Status::ModuleNotFoundError;
+}
 
-#if KIERO_USE_MINHOOK
-                MH_Initialize();
-#endif
+static Status resolveD3D11(void** const methods, const ::std::uint32_t groups)
+{
+    HMODULE libD3D11 = ::GetModuleHandle(KIERO_TEXT("d3d11.dll"));
 
-                g_renderType = RenderType::Vulkan;
+    D3D_FEATURE_LEVEL featureLevel;
+    constexpr D3D_FEATURE_LEVEL featureLevels[] = { D3D_FEATURE_LEVEL_10_1, D3D_FEATURE_LEVEL_11_0 };
 
-                return Status::Success;
-#endif
-            }
+    ComPtr<ID3D11DeviceContext> context;
+    ComPtr<IDXGISwapChain> swapChain;
+    ComPtr<ID3D11Device> device;
 
-            return Status::NotSupportedError;
+    if(groups & (1u << 0))
+    {
+        PFN_D3D11_CREATE_DEVICE_AND_SWAP_CHAIN D3D11CreateDeviceAndSwapChain = reinterpret_cast<PFN_D3D11_CREATE_DEVICE_AND_SWAP_CHAIN>(::GetProcAddress(libD3D11, "D3D11CreateDeviceAndSwapChain"));
+        if(!D3D11CreateDeviceAndSwapChain)
+        {
+            return Status::UnknownError;
         }
-        else
+
+        DummyWindow window;
+        DXGI_SWAP_CHAIN_DESC swapChainDesc = makeSwapChainDesc(window.get(), 1, DXGI_SWAP_EFFECT_DISCARD);
+
+        HRESULT status = D3D11CreateDeviceAndSwapChain(
+            nullptr,
+            D3D_DRIVER_TYPE_HARDWARE,
+            nullptr,
+            0,
+            featureLevels,
+            2,
+            D3D11_SDK_VERSION,
+            &swapChainDesc,
+            &swapChain,
+            &device,
+            &featureLevel,
+            &context
+        );
+
+        if(!SUCCEEDED(status))
         {
-            RenderType type = RenderType::None;
+            return Status::UnknownError;
+        }
 
-            if(::GetModuleHandle(KIERO_TEXT("d3d9.dll")))
-            {
-                type = RenderType::D3D9;
-            }
-            else if(::GetModuleHandle(KIERO_TEXT("d3d10.dll")))
-            {
-                type = RenderType::D3D10;
-            }
-            else if(::GetModuleHandle(KIERO_TEXT("d3d11.dll")))
-            {
-                type = RenderType::D3D11;
-            }
-            else if(::GetModuleHandle(KIERO_TEXT("d3d12.dll")))
-            {
-                type = RenderType::D3D12;
-            }
-            else if(::GetModuleHandle(KIERO_TEXT("opengl32.dll")))
-            {
-                type = RenderType::OpenGL;
-            }
-            else if(::GetModuleHandle(KIERO_TEXT("vulkan-1.dll")))
-            {
-                type = RenderType::Vulkan;
-            }
-            else
-            {
-                return Status::NotSupportedError;
-            }
+        copyMethods(methods, g_d3d11Groups[0], swapChain.Get());
+    }
+    else
+    {
+        // The device and its immediate context need neither a window nor a swap chain
+        PFN_D3D11_CREATE_DEVICE D3D11CreateDevice = reinterpret_cast<PFN_D3D11_CREATE_DEVICE>(::GetProcAddress(libD3D11, "D3D11CreateDevice"));
+        if(!D3D11CreateDevice)
+        {
+            return Status::UnknownError;
+        }
 
-            return init(type);
+        HRESULT status = D3D11CreateDevice(
+            nullptr,
+            D3D_DRIVER_TYPE_HARDWARE,
+            nullptr,
+            0,
+            featureLevels,
+            2,
+            D3D11_SDK_VERSION,
+            &device,
+            &featureLevel,
+            &context
+        );
+
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
         }
     }
 
+    if(groups & (1u << 1))
+    {
+        copyMethods(methods, g_d3d11Groups[1], device.Get());
+    }
+
+    if(groups & (1u << 2))
+    {
+        copyMethods(methods, g_d3d11Groups[2], context.Get());
+    }
+
     return Status::Success;
 }
 
-void shutdown()
-{
-    if(g_renderType != RenderType::None)
-    {
-#if KIERO_USE_MINHOOK
-        MH_DisableHook(MH_ALL_HOOKS);
+static constexpr Backend g_d3d11Backend = { RenderType::D3D11, d3d11::MethodsCount, g_d3d11Groups, ::std::size(g_d3d11Groups), probeD3D11, resolveD3D11, nullptr, nullptr, nullptr };
 #endif
 
-        delete[] g_methodsTable;
-        g_methodsTable = nullptr;
-        g_renderType = RenderType::None;
-    }
+#if KIERO_INCLUDE_D3D12 && defined(_WIN32)
+static constexpr MethodsGroup g_d3d12Groups[] = {
+    { d3d12::ID3D12Device::Offset, d3d12::ID3D12Device::Count },
+    { d3d12::ID3D12CommandQueue::Offset, d3d12::ID3D12CommandQueue::Count },
+    { d3d12::ID3D12CommandAllocator::Offset, d3d12::ID3D12CommandAllocator::Count },
+    { d3d12::ID3D12GraphicsCommandList::Offset, d3d12::ID3D12GraphicsCommandList::Count },
+    { d3d12::IDXGISwapChain::Offset, d3d12::IDXGISwapChain::Count },
+};
+
+static Status probeD3D12()
+{
+    return ::GetModuleHandle(KIERO_TEXT("dxgi.dll")) && ::GetModuleHandle(KIERO_TEXT("d3d12.dll")) ? Status::Success : Status::ModuleNotFoundError;
 }
 
-Status bind(const ::std::uint16_t index, void** const original, void* const function)
+static Status resolveD3D12(void** const methods, const ::std::uint32_t groups)
 {
-    // TODO: Need own detour function
+    HMODULE libDXGI = ::GetModuleHandle(KIERO_TEXT("dxgi.dll"));
+    HMODULE libD3D12 = ::GetModuleHandle(KIERO_TEXT("d3d12.dll"));
 
-    assert(original != nullptr && function != nullptr);
+    const bool needQueue = (groups & ((1u << 1) | (1u << 4))) != 0;
+    const bool needAllocator = (groups & ((1u << 2) | (1u << 3))) != 0;
+    const bool needList = (groups & (1u << 3)) != 0;
+    const bool needSwapChain = (groups & (1u << 4)) != 0;
 
-    if(g_renderType != RenderType::None)
-    {
-#if KIERO_USE_MINHOOK
-        void* target = g_methodsTable[index];
-        if(MH_CreateHook(target, function, original) != MH_OK || MH_EnableHook(target) != MH_OK)
-        {
-            return Status::UnknownError;
-        }
-#endif
+    auto CreateDXGIFactory = reinterpret_cast<decltype(&::CreateDXGIFactory)>(::GetProcAddress(libDXGI, "CreateDXGIFactory"));
 
-        return Status::Success;
+    if(!CreateDXGIFactory)
+    {
+        return Status::UnknownError;
     }
 
-    return Status::NotInitializedError;
-}
+    ComPtr<IDXGIFactory> factory;
+    HRESULT status = CreateDXGIFactory(IID_PPV_ARGS(&factory));
 
-void unbind(const ::std::uint16_t index)
-{
-    if(g_renderType != RenderType::None)
+    if(!SUCCEEDED(status))
     {
-#if KIERO_USE_MINHOOK
-        MH_DisableHook(g_methodsTable[index]);
-#endif
+        return Status::UnknownError;
     }
-}
 
-[[nodiscard]] RenderType getRenderType() noexcept
-{
-    return g_renderType;
-}
+    ComPtr<IDXGIAdapter> adapter;
+    status = factory->EnumAdapters(0, &adapter);
 
-[[nodiscard]] void** getMethodsTable() noexcept
-{
-    return g_methodsTable;
-}
+    if(!SUCCEEDED(status))
+    {
+        return Status::UnknownError;
+    }
 
-}
\ No newline at end of file
+    PFN_D3D12_CREATE_DEVICE D3D12CreateDevice = reinterpret_cast<PFN_D3D12_CREATE_DEVICE>(::GetProcAddress(libD3D12, "D3D12CreateDevice"));
+
+    if(!D3D12CreateDevice)
+    {
+        return Status::UnknownError;
+    }
+
+    ComPtr<ID3D12Device> device;
+    status = D3D12CreateDevice(
+        adapter.Get(),
+        D3D_FEATURE_LEVEL_11_0,
+        IID_PPV_ARGS(&device)
+    );
+
+    adapter = nullptr;
+
+    if(!SUCCEEDED(status))
+    {
+        return Status::UnknownError;
+    }
+
+    if(groups & (1u << 0))
+    {
+        copyMethods(methods, g_d3d12Groups[0], device.Get());
+    }
+
+    ComPtr<ID3D12CommandQueue> commandQueue;
+    if(needQueue)
+    {
+        D3D12_COMMAND_QUEUE_DESC queueDesc {};
+        queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+        queueDesc.Priority = 0;
+        queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+        queueDesc.NodeMask = 0;
+
+        status = device->CreateCommandQueue(
+            &queueDesc,
+            IID_PPV_ARGS(&commandQueue)
+        );
+
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
+
+        if(groups & (1u << 1))
+        {
+            copyMethods(methods, g_d3d12Groups[1], commandQueue.Get());
+        }
+    }
+
+    ComPtr<ID3D12CommandAllocator> commandAllocator;
+    if(needAllocator)
+    {
+        status = device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            IID_PPV_ARGS(&commandAllocator)
+        );
+
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
+
+        if(groups & (1u << 2))
+        {
+            copyMethods(methods, g_d3d12Groups[2], commandAllocator.Get());
+        }
+    }
+
+    if(needList)
+    {
+        ComPtr<ID3D12GraphicsCommandList> commandList;
+        status = device->CreateCommandList(
+            0,
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            commandAllocator.Get(),
+            nullptr,
+            IID_PPV_ARGS(&commandList)
+        );
+
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
+
+        copyMethods(methods, g_d3d12Groups[3], commandList.Get());
+    }
+
+    if(needSwapChain)
+    {
+        DummyWindow window;
+        DXGI_SWAP_CHAIN_DESC swapChainDesc = makeSwapChainDesc(window.get(), 2, DXGI_SWAP_EFFECT_FLIP_DISCARD);
+
+        ComPtr<IDXGISwapChain> swapChain;
+        status = factory->CreateSwapChain(
+            commandQueue.Get(),
+            &swapChainDesc,
+            &swapChain
+        );
+
+        if(!SUCCEEDED(status))
+        {
+            return Status::UnknownError;
+        }
+
+        copyMethods(methods, g_d3d12Groups[4], swapChain.Get());
+    }
+
+    return Status::Success;
+}
+
+static constexpr Backend g_d3d12Backend = { RenderType::D3D12, d3d12::MethodsCount, g_d3d12Groups, ::std::size(g_d3d12Groups), probeD3D12, resolveD3D12, nullptr, nullptr, nullptr };
+#endif
+
+#if KIERO_INCLUDE_OPENGL
+static constexpr const char* const g_openGLMethodsNames[] = {
+    "glAccum", "glAlphaFunc", "glAreTexturesResident", "glArrayElement", "glBegin", "glBindTexture", "glBitmap", "glBlendFunc", "glCallList", "glCallLists", "glClear", "glClearAccum",
+    "glClearColor", "glClearDepth", "glClearIndex", "glClearStencil", "glClipPlane", "glColor3b", "glColor3bv", "glColor3d", "glColor3dv", "glColor3f", "glColor3fv", "glColor3i", "glColor3iv",
+    "glColor3s", "glColor3sv", "glColor3ub", "glColor3ubv", "glColor3ui", "glColor3uiv", "glColor3us", "glColor3usv", "glColor4b", "glColor4bv", "glColor4d", "glColor4dv", "glColor4f",
+    "glColor4fv", "glColor4i", "glColor4iv", "glColor4s", "glColor4sv", "glColor4ub", "glColor4ubv", "glColor4ui", "glColor4uiv", "glColor4us", "glColor4usv", "glColorMask", "glColorMaterial",
+    "glColorPointer", "glCopyPixels", "glCopyTexImage1D", "glCopyTexImage2D", "glCopyTexSubImage1D", "glCopyTexSubImage2D", "glCullFace", "glDeleteLists", "glDeleteTextures",
+    "glDepthFunc", "glDepthMask", "glDepthRange", "glDisable", "glDisableClientState", "glDrawArrays", "glDrawBuffer", "glDrawElements", "glDrawPixels", "glEdgeFlag", "glEdgeFlagPointer",
+    "glEdgeFlagv", "glEnable", "glEnableClientState", "glEnd", "glEndList", "glEvalCoord1d", "glEvalCoord1dv", "glEvalCoord1f", "glEvalCoord1fv", "glEvalCoord2d", "glEvalCoord2dv",
+    "glEvalCoord2f", "glEvalCoord2fv", "glEvalMesh1", "glEvalMesh2", "glEvalPoint1", "glEvalPoint2", "glFeedbackBuffer", "glFinish", "glFlush", "glFogf", "glFogfv", "glFogi", "glFogiv",
+    "glFrontFace", "glFrustum", "glGenLists", "glGenTextures", "glGetBooleanv", "glGetClipPlane", "glGetDoublev", "glGetError", "glGetFloatv", "glGetIntegerv", "glGetLightfv", "glGetLightiv",
+    "glGetMapdv", "glGetMapfv", "glGetMapiv", "glGetMaterialfv", "glGetMaterialiv", "glGetPixelMapfv", "glGetPixelMapuiv", "glGetPixelMapusv", "glGetPointerv", "glGetPolygonStipple",
+    "glGetString", "glGetTexEnvfv", "glGetTexEnviv", "glGetTexGendv", "glGetTexGenfv", "glGetTexGeniv", "glGetTexImage", "glGetTexLevelParameterfv", "glGetTexLevelParameteriv",
+    "glGetTexParameterfv", "glGetTexParameteriv", "glHint", "glIndexMask", "glIndexPointer", "glIndexd", "glIndexdv", "glIndexf", "glIndexfv", "glIndexi", "glIndexiv", "glIndexs", "glIndexsv",
+    "glIndexub", "glIndexubv", "glInitNames", "glInterleavedArrays", "glIsEnabled", "glIsList", "glIsTexture", "glLightModelf", "glLightModelfv", "glLightModeli", "glLightModeliv", "glLightf",
+    "glLightfv", "glLighti", "glLightiv", "glLineStipple", "glLineWidth", "glListBase", "glLoadIdentity", "glLoadMatrixd", "glLoadMatrixf", "glLoadName", "glLogicOp", "glMap1d", "glMap1f",
+    "glMap2d", "glMap2f", "glMapGrid1d", "glMapGrid1f", "glMapGrid2d", "glMapGrid2f", "glMaterialf", "glMaterialfv", "glMateriali", "glMaterialiv", "glMatrixMode", "glMultMatrixd",
+    "glMultMatrixf", "glNewList", "glNormal3b", "glNormal3bv", "glNormal3d", "glNormal3dv", "glNormal3f", "glNormal3fv", "glNormal3i", "glNormal3iv", "glNormal3s", "glNormal3sv",
+    "glNormalPointer", "glOrtho", "glPassThrough", "glPixelMapfv", "glPixelMapuiv", "glPixelMapusv", "glPixelStoref", "glPixelStorei", "glPixelTransferf", "glPixelTransferi", "glPixelZoom",
+    "glPointSize", "glPolygonMode", "glPolygonOffset", "glPolygonStipple", "glPopAttrib", "glPopClientAttrib", "glPopMatrix", "glPopName", "glPrioritizeTextures", "glPushAttrib",
+    "glPushClientAttrib", "glPushMatrix", "glPushName", "glRasterPos2d", "glRasterPos2dv", "glRasterPos2f", "glRasterPos2fv", "glRasterPos2i", "glRasterPos2iv", "glRasterPos2s",
+    "glRasterPos2sv", "glRasterPos3d", "glRasterPos3dv", "glRasterPos3f", "glRasterPos3fv", "glRasterPos3i", "glRasterPos3iv", "glRasterPos3s", "glRasterPos3sv", "glRasterPos4d",
+    "glRasterPos4dv", "glRasterPos4f", "glRasterPos4fv", "glRasterPos4i", "glRasterPos4iv", "glRasterPos4s", "glRasterPos4sv", "glReadBuffer", "glReadPixels", "glRectd", "glRectdv", "glRectf",
+    "glRectfv", "glRecti", "glRectiv", "glRects", "glRectsv", "glRenderMode", "glRotated", "glRotatef", "glScaled", "glScalef", "glScissor", "glSelectBuffer", "glShadeModel", "glStencilFunc",
+    "glStencilMask", "glStencilOp", "glTexCoord1d", "glTexCoord1dv", "glTexCoord1f", "glTexCoord1fv", "glTexCoord1i", "glTexCoord1iv", "glTexCoord1s", "glTexCoord1sv", "glTexCoord2d",
+    "glTexCoord2dv", "glTexCoord2f", "glTexCoord2fv", "glTexCoord2i", "glTexCoord2iv", "glTexCoord2s", "glTexCoord2sv", "glTexCoord3d", "glTexCoord3dv", "glTexCoord3f", "glTexCoord3fv",
+    "glTexCoord3i", "glTexCoord3iv", "glTexCoord3s", "glTexCoord3sv", "glTexCoord4d", "glTexCoord4dv", "glTexCoord4f", "glTexCoord4fv", "glTexCoord4i", "glTexCoord4iv", "glTexCoord4s",
+    "glTexCoord4sv", "glTexCoordPointer", "glTexEnvf", "glTexEnvfv", "glTexEnvi", "glTexEnviv", "glTexGend", "glTexGendv", "glTexGenf", "glTexGenfv", "glTexGeni", "glTexGeniv", "glTexImage1D",
+    "glTexImage2D", "glTexParameterf", "glTexParameterfv", "glTexParameteri", "glTexParameteriv", "glTexSubImage1D", "glTexSubImage2D", "glTranslated", "glTranslatef", "glVertex2d",
+    "glVertex2dv", "glVertex2f", "glVertex2fv", "glVertex2i", "glVertex2iv", "glVertex2s", "glVertex2sv", "glVertex3d", "glVertex3dv", "glVertex3f", "glVertex3fv", "glVertex3i", "glVertex3iv",
+    "glVertex3s", "glVertex3sv", "glVertex4d", "glVertex4dv", "glVertex4f", "glVertex4fv", "glVertex4i", "glVertex4iv", "glVertex4s", "glVertex4sv", "glVertexPointer", "glViewport"
+};
+
+// Frame boundaries, appended after the GL 1.1 functions. The first one is the platform's own
+// swap (wglSwapBuffers/glXSwapBuffers), eglSwapBuffers stays null unless EGL is loaded.
+static constexpr const char* const g_openGLSwapNames[] = {
+#ifdef _WIN32
+    "wglSwapBuffers",
+#else
+    "glXSwapBuffers",
+#endif
+    "eglSwapBuffers"
+};
+
+static constexpr ::std::uint16_t g_openGLFunctionsCount = static_cast<::std::uint16_t>(::std::size(g_openGLMethodsNames));
+static constexpr ::std::uint16_t g_openGLSwapCount = static_cast<::std::uint16_t>(::std::size(g_openGLSwapNames));
+
+static constexpr MethodsGroup g_openGLGroups[] = {
+    { opengl::Functions::Offset, opengl::Functions::Count },
+    { opengl::SwapBuffers::Offset, opengl::SwapBuffers::Count },
+};
+
+static_assert(matchesMethodsTable(g_openGLMethodsNames, opengl::Names, opengl::Functions::Offset), "g_openGLMethodsNames differs from METHODSTABLE.txt");
+static_assert(matchesMethodsTable(g_openGLSwapNames, opengl::Names, opengl::SwapBuffers::Offset), "g_openGLSwapNames differs from METHODSTABLE.txt");
+
+// Matched against each library's export table in one walk instead of a lookup per name
+static constexpr auto g_openGLExportNames = detail::makeExportNames(g_openGLMethodsNames);
+
+#ifdef _WIN32
+static Status probeOpenGL()
+{
+    return ::GetModuleHandle(KIERO_TEXT("opengl32.dll")) ? Status::Success : Status::ModuleNotFoundError;
+}
+
+static Status resolveOpenGL(void** const methods, const ::std::uint32_t groups)
+{
+    HMODULE libOpenGL32 = ::GetModuleHandle(KIERO_TEXT("opengl32.dll"));
+
+    if(groups & 1)
+    {
+        (void) detail::resolveExports(libOpenGL32, g_openGLExportNames, methods);
+    }
+
+    if(groups & 2)
+    {
+        methods[g_openGLFunctionsCount] = reinterpret_cast<void*>(::GetProcAddress(libOpenGL32, g_openGLSwapNames[0]));
+
+        if(HMODULE libEGL = ::GetModuleHandle(KIERO_TEXT("libEGL.dll")))
+        {
+            methods[g_openGLFunctionsCount + 1] = reinterpret_cast<void*>(::GetProcAddress(libEGL, g_openGLSwapNames[1]));
+        }
+    }
+
+    return Status::Success;
+}
+#else
+static Status probeOpenGL()
+{
+    for(const char* const name : { "libGL.so.1", "libOpenGL.so.0", "libGLX.so.0", "libEGL.so.1" })
+    {
+        if(LoadedLibrary(name))
+        {
+            return Status::Success;
+        }
+    }
+
+    return Status::ModuleNotFoundError;
+}
+
+static Status resolveOpenGL(void** const methods, const ::std::uint32_t groups)
+{
+    const LoadedLibrary libGL("libGL.so.1");
+    const LoadedLibrary libEGL("libEGL.so.1");
+
+    if(groups & 1)
+    {
+        // The legacy libGL first, then the GLVND one for apps linked against libOpenGL+libGLX
+        // or libEGL only. Both export their own dispatch stubs, a GL context made current
+        // through EGL alone is served by eglGetProcAddress as a last resort.
+        const LoadedLibrary libOpenGL("libOpenGL.so.0");
+
+        (void) ::std::memset(methods, 0, g_openGLFunctionsCount * sizeof(void*));
+
+        ::std::size_t resolved = detail::resolveExports(libGL.handle(), g_openGLExportNames, methods);
+        if(resolved < g_openGLFunctionsCount)
+        {
+            resolved += detail::resolveExports(libOpenGL.handle(), g_openGLExportNames, methods);
+        }
+
+        using GetProcAddressFn = void* (*)(const char*);
+        const auto eglGetProcAddress = reinterpret_cast<GetProcAddressFn>(libEGL.find("eglGetProcAddress"));
+
+        for(::std::size_t i = 0; resolved < g_openGLFunctionsCount && eglGetProcAddress && i < g_openGLFunctionsCount; ++i)
+        {
+            if(!methods[i])
+            {
+                methods[i] = eglGetProcAddress(g_openGLMethodsNames[i]);
+            }
+        }
+    }
+
+    if(groups & 2)
+    {
+        // Under GLVND libGL's glXSwapBuffers only forwards to libGLX's, hook the real one
+        const LoadedLibrary libGLX("libGLX.so.0");
+
+        void* swapBuffers = libGLX.find(g_openGLSwapNames[0]);
+        methods[g_openGLFunctionsCount] = swapBuffers ? swapBuffers : libGL.find(g_openGLSwapNames[0]);
+        methods[g_openGLFunctionsCount + 1] = libEGL.find(g_openGLSwapNames[1]);
+    }
+
+    return Status::Success;
+}
+#endif
+
+static constexpr Backend g_openGLBackend = { RenderType::OpenGL, opengl::MethodsCount, g_openGLGroups, ::std::size(g_openGLGroups), probeOpenGL, resolveOpenGL, nullptr, nullptr, nullptr };
+#endif
+
+#if KIERO_INCLUDE_VULKAN
+using detail::g_vulkanMethodsNames;
+
+static constexpr MethodsGroup g_vulkanGroups[] = {
+    { vulkan::Core::Offset, vulkan::Core::Count },
+    { vulkan::Present::Offset, vulkan::Present::Count },
+};
+
+static_assert(matchesMethodsTable(g_vulkanMethodsNames, vulkan::Names, 0), "g_vulkanMethodsNames differs from METHODSTABLE.txt");
+
+#if !KIERO_VULKAN_LAYER
+static constexpr auto g_vulkanExportNames = detail::makeExportNames(g_vulkanMethodsNames);
+#endif
+
+#if KIERO_VULKAN_LAYER
+// The loader already runs this library as a layer: the table holds the layer's own entry points
+// and binding an index redirects its entry instead of patching the function below it
+static Status probeVulkan()
+{
+    return Status::Success;
+}
+
+static Status resolveVulkan(void** const methods, const ::std::uint32_t groups)
+{
+    for(::std::size_t i = 0; i < ::std::size(g_vulkanGroups); ++i)
+    {
+        if(groups & (1u << i))
+        {
+            for(::std::uint16_t j = g_vulkanGroups[i].begin; j < g_vulkanGroups[i].begin + g_vulkanGroups[i].count; ++j)
+            {
+                methods[j] = detail::getLayerEntry(j);
+            }
+        }
+    }
+
+    return Status::Success;
+}
+
+static constexpr Backend g_vulkanBackend = { RenderType::Vulkan, vulkan::MethodsCount, g_vulkanGroups, ::std::size(g_vulkanGroups), probeVulkan, resolveVulkan, detail::releaseLayerSlots, detail::bindLayerSlot, detail::unbindLayerSlot };
+#else
+
+#if KIERO_VULKAN_DEVICE_FUNCTIONS
+// Throwaway instance and device whose vkGetDeviceProcAddr hands out the driver's own device-level
+// functions (or the first implicit layer's), i.e. what the loader's exports only jump to. They stay
+// alive until shutdown since destroying the last instance lets the loader unload the driver.
+static VkInstance g_vulkanInstance = VK_NULL_HANDLE;
+static VkDevice g_vulkanDevice = VK_NULL_HANDLE;
+
+static PFN_vkGetInstanceProcAddr g_vulkanGetInstanceProcAddr = nullptr;
+static PFN_vkGetDeviceProcAddr g_vulkanGetDeviceProcAddr = nullptr;
+
+static void releaseVulkan()
+{
+    KIERO_TRACE_SPAN(Init, "releaseDevice", RenderType, RenderType::Vulkan);
+
+    if(g_vulkanDevice)
+    {
+        const auto vkDestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(g_vulkanGetDeviceProcAddr(g_vulkanDevice, "vkDestroyDevice"));
+        vkDestroyDevice(g_vulkanDevice, nullptr);
+    }
+
+    if(g_vulkanInstance)
+    {
+        const auto vkDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(g_vulkanGetInstanceProcAddr(g_vulkanInstance, "vkDestroyInstance"));
+        vkDestroyInstance(g_vulkanInstance, nullptr);
+    }
+
+    g_vulkanInstance = VK_NULL_HANDLE;
+    g_vulkanDevice = VK_NULL_HANDLE;
+    g_vulkanGetInstanceProcAddr = nullptr;
+    g_vulkanGetDeviceProcAddr = nullptr;
+}
+
+static bool createVulkanDevice(const PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr)
+{
+    KIERO_TRACE_SPAN(Init, "createDevice", RenderType, RenderType::Vulkan);
+
+    const auto vkCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(vkGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+    if(!vkCreateInstance)
+    {
+        return false;
+    }
+
+    VkApplicationInfo applicationInfo = { };
+    applicationInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    applicationInfo.pApplicationName = "Kiero";
+    applicationInfo.pEngineName = "Kiero";
+    applicationInfo.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo instanceCreateInfo = { };
+    instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceCreateInfo.pApplicationInfo = &applicationInfo;
+
+    if(vkCreateInstance(&instanceCreateInfo, nullptr, &g_vulkanInstance) != VK_SUCCESS)
+    {
+        g_vulkanInstance = VK_NULL_HANDLE;
+        return false;
+    }
+
+    g_vulkanGetInstanceProcAddr = vkGetInstanceProcAddr;
+
+    const auto vkEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(vkGetInstanceProcAddr(g_vulkanInstance, "vkEnumeratePhysicalDevices"));
+    const auto vkGetPhysicalDeviceProperties = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(vkGetInstanceProcAddr(g_vulkanInstance, "vkGetPhysicalDeviceProperties"));
+    const auto vkEnumerateDeviceExtensionProperties = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(vkGetInstanceProcAddr(g_vulkanInstance, "vkEnumerateDeviceExtensionProperties"));
+    const auto vkCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(vkGetInstanceProcAddr(g_vulkanInstance, "vkCreateDevice"));
+
+    g_vulkanGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(vkGetInstanceProcAddr(g_vulkanInstance, "vkGetDeviceProcAddr"));
+
+    // Games render on the discrete GPU whenever there is one, the hooks only cover the driver picked here
+    VkPhysicalDevice physicalDevices[16];
+    ::std::uint32_t physicalDevicesCount = ::std::size(physicalDevices);
+
+    const VkResult result = vkEnumeratePhysicalDevices(g_vulkanInstance, &physicalDevicesCount, physicalDevices);
+    if((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalDevicesCount == 0 || !g_vulkanGetDeviceProcAddr)
+    {
+        releaseVulkan();
+        return false;
+    }
+
+    VkPhysicalDevice physicalDevice = physicalDevices[0];
+
+    for(::std::uint32_t i = 0; i < physicalDevicesCount; ++i)
+    {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physicalDevices[i], &properties);
+
+        if(properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU)
+        {
+            physicalDevice = physicalDevices[i];
+            break;
+        }
+    }
+
+    // VK_KHR_swapchain is needed for vkGetDeviceProcAddr to return vkQueuePresentKHR
+    const char* const swapchainExtension = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
+    bool hasSwapchain = false;
+
+    VkExtensionProperties extensions[256];
+    ::std::uint32_t extensionsCount = ::std::size(extensions);
+
+    if(vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionsCount, extensions) >= VK_SUCCESS)
+    {
+        for(::std::uint32_t i = 0; i < extensionsCount && !hasSwapchain; ++i)
+        {
+            hasSwapchain = ::std::strcmp(extensions[i].extensionName, swapchainExtension) == 0;
+        }
+    }
+
+    // Any device has a queue family 0
+    const float queuePriority = 1.0f;
+
+    VkDeviceQueueCreateInfo queueCreateInfo = { };
+    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueCreateInfo.queueFamilyIndex = 0;
+    queueCreateInfo.queueCount = 1;
+    queueCreateInfo.pQueuePriorities = &queuePriority;
+
+    VkDeviceCreateInfo deviceCreateInfo = { };
+    deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceCreateInfo.queueCreateInfoCount = 1;
+    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+    deviceCreateInfo.enabledExtensionCount = hasSwapchain ? 1 : 0;
+    deviceCreateInfo.ppEnabledExtensionNames = &swapchainExtension;
+
+    if(vkCreateDevice(physicalDevice, &deviceCreateInfo, nullptr, &g_vulkanDevice) != VK_SUCCESS)
+    {
+        g_vulkanDevice = VK_NULL_HANDLE;
+        releaseVulkan();
+        return false;
+    }
+
+    return true;
+}
+#endif
+
+static Status probeVulkan()
+{
+#ifdef _WIN32
+    return ::GetModuleHandle(KIERO_TEXT("vulkan-1.dll")) ? Status::Success : Status::ModuleNotFoundError;
+#else
+    return LoadedLibrary("libvulkan.so.1") ? Status::Success : Status::ModuleNotFoundError;
+#endif
+}
+
+static Status resolveVulkan(void** const methods, const ::std::uint32_t groups)
+{
+#ifdef _WIN32
+    const HMODULE libVulkan = ::GetModuleHandle(KIERO_TEXT("vulkan-1.dll"));
+    const auto findExport = [libVulkan](const char* const name) { return reinterpret_cast<void*>(::GetProcAddress(libVulkan, name)); };
+    void* const module = libVulkan;
+#else
+    const LoadedLibrary libVulkan("libvulkan.so.1");
+    const auto findExport = [&libVulkan](const char* const name) { return libVulkan.find(name); };
+    void* const module = libVulkan.handle();
+#endif
+
+#if KIERO_VULKAN_DEVICE_FUNCTIONS
+    // Without a device (no driver, or it failed) the table falls back to the loader's exports
+    if(!g_vulkanDevice)
+    {
+        if(const auto vkGetInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(findExport("vkGetInstanceProcAddr")))
+        {
+            (void) createVulkanDevice(vkGetInstanceProcAddr);
+        }
+    }
+#endif
+
+    for(::std::size_t i = 0; i < ::std::size(g_vulkanGroups); ++i)
+    {
+        if(!(groups & (1u << i)))
+        {
+            continue;
+        }
+
+        const MethodsGroup& group = g_vulkanGroups[i];
+
+        (void) ::std::memset(methods + group.begin, 0, group.count * sizeof(void*));
+
+#if KIERO_VULKAN_DEVICE_FUNCTIONS
+        // Null for global and instance-level names, those keep the exported entry point
+        for(::std::uint16_t j = group.begin; g_vulkanDevice && j < group.begin + group.count; ++j)
+        {
+            methods[j] = reinterpret_cast<void*>(g_vulkanGetDeviceProcAddr(g_vulkanDevice, g_vulkanMethodsNames[j]));
+        }
+#endif
+
+        (void) detail::resolveExports(module, g_vulkanExportNames, methods, group.begin, static_cast<::std::uint16_t>(group.begin + group.count));
+    }
+
+    return Status::Success;
+}
+
+#if KIERO_VULKAN_DEVICE_FUNCTIONS
+static constexpr Backend g_vulkanBackend = { RenderType::Vulkan, vulkan::MethodsCount, g_vulkanGroups, ::std::size(g_vulkanGroups), probeVulkan, resolveVulkan, releaseVulkan, nullptr, nullptr };
+#else
+static constexpr Backend g_vulkanBackend = { RenderType::Vulkan, vulkan::MethodsCount, g_vulkanGroups, ::std::size(g_vulkanGroups), probeVulkan, resolveVulkan, nullptr, nullptr, nullptr };
+#endif
+#endif
+#endif
+
+static const Backend* findBackend(const RenderType renderType)
+{
+    switch(renderType)
+    {
+#if KIERO_INCLUDE_D3D9 && defined(_WIN32)
+    case RenderType::D3D9:
+        return &g_d3d9Backend;
+#endif
+#if KIERO_INCLUDE_D3D10 && defined(_WIN32)
+    case RenderType::D3D10:
+        return &g_d3d10Backend;
+#endif
+#if KIERO_INCLUDE_D3D11 && defined(_WIN32)
+    case RenderType::D3D11:
+        return &g_d3d11Backend;
+#endif
+#if KIERO_INCLUDE_D3D12 && defined(_WIN32)
+    case RenderType::D3D12:
+        return &g_d3d12Backend;
+#endif
+#if KIERO_INCLUDE_OPENGL
+    case RenderType::OpenGL:
+        return &g_openGLBackend;
+#endif
+#if KIERO_INCLUDE_VULKAN
+    case RenderType::Vulkan:
+        return &g_vulkanBackend;
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+static bool getCachePath(const RenderType renderType, char (&path)[sizeof(g_cacheDirectory) + 32])
+{
+    const ::std::lock_guard<::std::mutex> lock(g_cacheMutex);
+
+    if(!g_cacheDirectory[0])
+    {
+        return false;
+    }
+
+    const int length = ::std::snprintf(path, sizeof(path), "%s/kiero-" KIERO_VERSION "-%d.cache", g_cacheDirectory, static_cast<int>(renderType));
+    return length > 0 && static_cast<::std::size_t>(length) < sizeof(path);
+}
+
+// The build options a table depends on, part of the cache's key
+static constexpr ::std::uint32_t g_cacheOptions = (KIERO_VULKAN_DEVICE_FUNCTIONS ? 1u : 0u) | (KIERO_VULKAN_LAYER ? 2u : 0u);
+
+static bool loadCache(const Backend& backend, void** const methods)
+{
+    KIERO_TRACE_SPAN(Init, "loadCache", RenderType, backend.type);
+
+    char path[sizeof(g_cacheDirectory) + 32];
+    return getCachePath(backend.type, path) && detail::loadMethodsCache(path, backend.type, g_cacheOptions, methods, backend.methodsCount);
+}
+
+static void saveCache(const Backend& backend, void* const* const methods)
+{
+    KIERO_TRACE_SPAN(Init, "saveCache", RenderType, backend.type);
+
+#if KIERO_INCLUDE_VULKAN && !KIERO_VULKAN_LAYER && KIERO_VULKAN_DEVICE_FUNCTIONS
+    // Without a device the table fell back to the loader's exports, the next run may get one
+    if(backend.type == RenderType::Vulkan && !g_vulkanDevice)
+    {
+        return;
+    }
+#endif
+
+    char path[sizeof(g_cacheDirectory) + 32];
+    if(getCachePath(backend.type, path))
+    {
+        (void) detail::saveMethodsCache(path, backend.type, g_cacheOptions, methods, backend.methodsCount);
+    }
+}
+
+// Resolves the group holding index if it was left out by a lazy init. Resolving may create a
+// window and a device, bind does it before taking g_registryMutex. Shutdown waits for a
+// resolution in progress before it releases the backend.
+static Status resolveMethod(Context& context, const ::std::uint16_t index)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_resolveMutex);
+
+    if(context.state.load(::std::memory_order_acquire) != State::Initialized || index >= context.methodsCount)
+    {
+        return Status::NotInitializedError;
+    }
+
+    const Backend& backend = *context.backend;
+
+    for(::std::size_t i = 0; i < backend.groupsCount; ++i)
+    {
+        const MethodsGroup& group = backend.groups[i];
+        if(index < group.begin || index >= group.begin + group.count)
+        {
+            continue;
+        }
+
+        if(!(context.resolvedGroups & (1u << i)))
+        {
+            KIERO_TRACE_SPAN(Init, "resolve", RenderType, backend.type);
+
+            const Status status = backend.resolve(context.methodsTable, 1u << i);
+            if(status != Status::Success)
+            {
+                return status;
+            }
+
+            context.resolvedGroups |= 1u << i;
+
+            if(context.resolvedGroups == (1u << backend.groupsCount) - 1)
+            {
+                saveCache(backend, context.methodsTable);
+            }
+        }
+
+        // Entries the runtime does not export (e.g. eglSwapBuffers without EGL) stay null
+        return context.methodsTable[index] ? Status::Success : Status::NotSupportedError;
+    }
+
+    return Status::UnknownError;
+}
+
+// The order Auto tries the backends in
+static constexpr RenderType g_autoOrder[] = {
+    RenderType::D3D9, RenderType::D3D10, RenderType::D3D11, RenderType::D3D12, RenderType::OpenGL, RenderType::Vulkan,
+};
+
+// A methods table built for a backend but not published yet
+struct Table
+{
+    void** methods = nullptr;
+    bool cached = false;
+};
+
+// Probes the backend and builds its table. Lazy mode builds each group's objects the first
+// time one of its indices is used, a valid cache skips building them at all.
+static Status buildTable(const Backend& backend, const InitMode mode, Table& table)
+{
+    KIERO_TRACE_SPAN(Init, "buildTable", RenderType, backend.type);
+
+    Status status = Status::Success;
+    {
+        KIERO_TRACE_SPAN(Init, "probe", RenderType, backend.type);
+        status = backend.probe();
+    }
+
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    void** methods = new(::std::nothrow) void* [backend.methodsCount]();
+    if(!methods)
+    {
+        return Status::UnknownError;
+    }
+
+    const bool cached = loadCache(backend, methods);
+
+    if(mode == InitMode::Eager && !cached)
+    {
+        {
+            KIERO_TRACE_SPAN(Init, "resolve", RenderType, backend.type);
+            status = backend.resolve(methods, (1u << backend.groupsCount) - 1);
+        }
+
+        if(status != Status::Success)
+        {
+            delete[] methods;
+            return status;
+        }
+
+        saveCache(backend, methods);
+    }
+
+    table.methods = methods;
+    table.cached = cached;
+
+    return Status::Success;
+}
+
+// Called while the backend's state is Initializing. The first backend initialized becomes the
+// primary one, the functions taking no render type address it.
+static void publishTable(const Backend& backend, const InitMode mode, const Table& table)
+{
+    KIERO_TRACE_SPAN(Init, "publishTable", RenderType, backend.type);
+
+#if KIERO_USE_MINHOOK
+    MH_Initialize(); // once, later calls fail harmlessly
+#endif
+
+    Context& context = *findContext(backend.type);
+
+    // The other backends' binds scan every context for a target that is hooked already
+    const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+    context.methodsTable = table.methods;
+    context.methodsCount = backend.methodsCount;
+    context.backend = &backend;
+    context.resolvedGroups = mode == InitMode::Eager || table.cached ? (1u << backend.groupsCount) - 1 : 0;
+
+    if(g_renderType.load(::std::memory_order_relaxed) == RenderType::None)
+    {
+        g_renderType.store(backend.type, ::std::memory_order_release);
+    }
+}
+
+// Frees a table that lost to another backend, with whatever its backend keeps alive for it
+static void discardTable(const Backend& backend, Table& table)
+{
+    if(backend.release)
+    {
+        backend.release();
+    }
+
+    delete[] table.methods;
+    table.methods = nullptr;
+}
+
+// Auto only picks a backend while none is in use: it moves all of them from Uninitialized to
+// Initializing, or none when one is taken
+static bool claimAuto()
+{
+    for(::std::size_t i = 0; i < ::std::size(g_autoOrder); ++i)
+    {
+        State expected = State::Uninitialized;
+        if(!findContext(g_autoOrder[i])->state.compare_exchange_strong(expected, State::Initializing, ::std::memory_order_acquire))
+        {
+            while(i-- > 0)
+            {
+                findContext(g_autoOrder[i])->state.store(State::Uninitialized, ::std::memory_order_release);
+            }
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Ends claimAuto, winner is None when every backend failed
+static void settleAuto(const RenderType winner)
+{
+    for(const RenderType type : g_autoOrder)
+    {
+        findContext(type)->state.store(type == winner ? State::Initialized : State::Uninitialized, ::std::memory_order_release);
+    }
+}
+
+Status init(const RenderType renderType, const InitMode mode)
+{
+    KIERO_TRACE_SPAN(Init, "init", RenderType, renderType);
+
+    if(renderType == RenderType::None)
+    {
+        for(const RenderType type : g_autoOrder)
+        {
+            if(findContext(type)->state.load(::std::memory_order_acquire) != State::Uninitialized)
+            {
+                return Status::AlreadyInitializedError;
+            }
+        }
+
+        return Status::Success;
+    }
+
+    Table table;
+
+    if(renderType != RenderType::Auto)
+    {
+        Context* const context = findContext(renderType);
+        if(!context)
+        {
+            return Status::NotSupportedError;
+        }
+
+        State expected = State::Uninitialized;
+        if(!context->state.compare_exchange_strong(expected, State::Initializing, ::std::memory_order_acquire))
+        {
+            return Status::AlreadyInitializedError;
+        }
+
+        const Backend* backend = findBackend(renderType);
+        const Status status = backend ? buildTable(*backend, mode, table) : Status::NotSupportedError;
+
+        if(status == Status::Success)
+        {
+            publishTable(*backend, mode, table);
+        }
+
+        context->state.store(status == Status::Success ? State::Initialized : State::Uninitialized, ::std::memory_order_release);
+
+        return status;
+    }
+
+    if(!claimAuto())
+    {
+        return Status::AlreadyInitializedError;
+    }
+
+    // The first backend whose runtime is loaded and whose table builds, a failing one falls
+    // through to the next
+    RenderType winner = RenderType::None;
+    Status status = Status::NotSupportedError;
+
+    for(const RenderType type : g_autoOrder)
+    {
+        const Backend* backend = findBackend(type);
+        if(!backend)
+        {
+            continue;
+        }
+
+        const Status built = buildTable(*backend, mode, table);
+        if(built == Status::Success)
+        {
+            publishTable(*backend, mode, table);
+            winner = type;
+            status = Status::Success;
+            break;
+        }
+
+        if(built != Status::ModuleNotFoundError && status == Status::NotSupportedError)
+        {
+            status = built;
+        }
+    }
+
+    settleAuto(winner);
+
+    return status;
+}
+
+static constexpr ::std::size_t MaxInitTasks = ::std::size(g_autoOrder);
+
+// One initAsync call, each candidate backend is built by its own worker. The first worker
+// that can tell the result publishes it, the last one to leave frees this.
+struct AsyncInit
+{
+    struct Task
+    {
+        AsyncInit* init;
+        ::std::size_t index;
+    };
+
+    InitMode mode;
+    InitCallback callback;
+    void* context;
+    bool automatic;
+
+    ::std::mutex mutex;
+    ::std::size_t count;
+    ::std::size_t running;
+    bool decided;
+    ::std::size_t winner; // count when every candidate failed
+
+    Task tasks[MaxInitTasks];
+    const Backend* backends[MaxInitTasks];
+    Table tables[MaxInitTasks];
+    Status results[MaxInitTasks];
+    bool done[MaxInitTasks];
+    bool claimed[MaxInitTasks]; // published or taken for discarding
+};
+
+// initAsync workers still building or discarding a table. shutdown waits for them so a
+// following init of a discarded backend never races with its release.
+static ::std::mutex g_initWorkersMutex;
+static ::std::condition_variable g_initWorkersIdle;
+static ::std::uint32_t g_initWorkers = 0;
+static thread_local bool g_inInitCallback = false;
+
+// Takes the finished candidate's result, decides once the first candidate in order built or
+// all of them failed, and discards the tables that lost. A losing backend is only given back
+// (Uninitialized) once its table is gone, so a following init of it never races with the release.
+static void finishInitTask(AsyncInit& async, const ::std::size_t index, const Table& table, const Status status)
+{
+    bool decided = false;
+    Status result = Status::NotSupportedError;
+    const Backend* discarded[MaxInitTasks];
+    Table discardedTables[MaxInitTasks];
+    ::std::size_t discardedCount = 0;
+    const Backend* failed[MaxInitTasks];
+    ::std::size_t failedCount = 0;
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(async.mutex);
+
+        async.tables[index] = table;
+        async.results[index] = status;
+        async.done[index] = true;
+
+        if(!async.decided)
+        {
+            ::std::size_t i = 0;
+            for(; i < async.count && async.done[i]; ++i)
+            {
+                if(async.results[i] == Status::Success)
+                {
+                    break;
+                }
+
+                if(async.results[i] != Status::ModuleNotFoundError && result == Status::NotSupportedError)
+                {
+                    result = async.results[i];
+                }
+            }
+
+            if(i == async.count || (async.done[i] && async.results[i] == Status::Success))
+            {
+                async.decided = decided = true;
+                async.winner = i;
+
+                if(i < async.count)
+                {
+                    async.claimed[i] = true;
+                    result = Status::Success;
+                }
+                else if(!async.automatic)
+                {
+                    result = async.results[0];
+                }
+            }
+        }
+
+        for(::std::size_t i = 0; async.decided && i < async.count; ++i)
+        {
+            if(async.done[i] && !async.claimed[i])
+            {
+                async.claimed[i] = true;
+
+                if(async.results[i] == Status::Success)
+                {
+                    discarded[discardedCount] = async.backends[i];
+                    discardedTables[discardedCount++] = async.tables[i];
+                }
+                else
+                {
+                    failed[failedCount++] = async.backends[i];
+                }
+            }
+        }
+    }
+
+    for(::std::size_t i = 0; i < failedCount; ++i)
+    {
+        findContext(failed[i]->type)->state.store(State::Uninitialized, ::std::memory_order_release);
+    }
+
+    if(decided)
+    {
+        if(result == Status::Success)
+        {
+            const Backend& winner = *async.backends[async.winner];
+
+            publishTable(winner, async.mode, async.tables[async.winner]);
+            findContext(winner.type)->state.store(State::Initialized, ::std::memory_order_release);
+        }
+
+        // Auto claimed the backends that are not compiled in too
+        for(const RenderType type : g_autoOrder)
+        {
+            if(async.automatic && !findBackend(type))
+            {
+                findContext(type)->state.store(State::Uninitialized, ::std::memory_order_release);
+            }
+        }
+
+        if(async.callback)
+        {
+            g_inInitCallback = true;
+            async.callback(async.context, result);
+            g_inInitCallback = false;
+        }
+    }
+
+    for(::std::size_t i = 0; i < discardedCount; ++i)
+    {
+        discardTable(*discarded[i], discardedTables[i]);
+        findContext(discarded[i]->type)->state.store(State::Uninitialized, ::std::memory_order_release);
+    }
+
+    bool last;
+    {
+        const ::std::lock_guard<::std::mutex> lock(async.mutex);
+        last = --async.running == 0;
+    }
+
+    if(last)
+    {
+        delete &async;
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_initWorkersMutex);
+    --g_initWorkers;
+    g_initWorkersIdle.notify_all();
+}
+
+#ifdef _WIN32
+static DWORD WINAPI runInitTask(LPVOID argument)
+#else
+static void* runInitTask(void* argument)
+#endif
+{
+    const AsyncInit::Task& task = *static_cast<AsyncInit::Task*>(argument);
+    AsyncInit& async = *task.init;
+    const ::std::size_t index = task.index;
+
+    KIERO_TRACE_SPAN(Init, "initAsync", RenderType, async.backends[index]->type);
+
+    Table table;
+    const Status status = buildTable(*async.backends[index], async.mode, table);
+
+    finishInitTask(async, index, table, status);
+
+#ifdef _WIN32
+    return 0;
+#else
+    return nullptr;
+#endif
+}
+
+// Plain OS threads, they are only created here and never joined
+static bool startInitTask(AsyncInit::Task& task)
+{
+#ifdef _WIN32
+    const HANDLE thread = ::CreateThread(nullptr, 0, runInitTask, &task, 0, nullptr);
+    if(!thread)
+    {
+        return false;
+    }
+
+    ::CloseHandle(thread);
+    return true;
+#else
+    pthread_t thread;
+    if(::pthread_create(&thread, nullptr, runInitTask, &task) != 0)
+    {
+        return false;
+    }
+
+    (void) ::pthread_detach(thread);
+    return true;
+#endif
+}
+
+Status initAsync(const RenderType renderType, const InitMode mode, const InitCallback callback, void* const context)
+{
+    if(renderType == RenderType::None)
+    {
+        return init(renderType, mode);
+    }
+
+    const bool automatic = renderType == RenderType::Auto;
+    Context* const requested = findContext(renderType);
+
+    if(!automatic && !requested)
+    {
+        return Status::NotSupportedError;
+    }
+
+    // Ends the claim when nothing was started
+    const auto release = [automatic, requested]
+    {
+        if(automatic)
+        {
+            settleAuto(RenderType::None);
+        }
+        else
+        {
+            requested->state.store(State::Uninitialized, ::std::memory_order_release);
+        }
+    };
+
+    State expected = State::Uninitialized;
+    if(automatic ? !claimAuto() : !requested->state.compare_exchange_strong(expected, State::Initializing, ::std::memory_order_acquire))
+    {
+        return Status::AlreadyInitializedError;
+    }
+
+    AsyncInit* const async = new(::std::nothrow) AsyncInit();
+    if(!async)
+    {
+        release();
+        return Status::UnknownError;
+    }
+
+    async->mode = mode;
+    async->callback = callback;
+    async->context = context;
+    async->automatic = automatic;
+
+    for(const RenderType type : g_autoOrder)
+    {
+        const Backend* backend = findBackend(type);
+        if(backend && (async->automatic || type == renderType))
+        {
+            async->backends[async->count++] = backend;
+        }
+    }
+
+    const ::std::size_t count = async->count;
+    if(count == 0)
+    {
+        delete async;
+        release();
+        return Status::NotSupportedError;
+    }
+
+    async->running = count;
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_initWorkersMutex);
+        g_initWorkers += static_cast<::std::uint32_t>(count);
+    }
+
+    // async may be freed as soon as the last task was started
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        AsyncInit::Task& task = async->tasks[i];
+        task.init = async;
+        task.index = i;
+
+        if(!startInitTask(task))
+        {
+            finishInitTask(*async, i, Table { }, Status::UnknownError);
+        }
+    }
+
+    return Status::Success;
+}
+
+#if !KIERO_USE_MINHOOK || !defined(_WIN32)
+// Several indices or backends may share one function (e.g. the IUnknown methods, or
+// IDXGISwapChain::Present of D3D10 and D3D11), it can only be hooked once. Called with
+// g_registryMutex held.
+static bool isHooked(const void* const target)
+{
+    for(const Context& context : g_contexts)
+    {
+        for(::std::uint16_t i = 0; i < context.methodsCount; ++i)
+        {
+#if !KIERO_USE_MINHOOK
+            if(context.hooks && context.hooks[i] && context.hooks[i]->target == target)
+            {
+                return true;
+            }
+#endif
+#ifndef _WIN32
+            if(context.gotHooks && context.gotHooks[i] && context.gotHooks[i]->target == target)
+            {
+                return true;
+            }
+#endif
+        }
+    }
+
+    return false;
+}
+#endif
+
+#if !KIERO_USE_MINHOOK
+static Status createHook(Context& context, const ::std::uint16_t index, void** const original, void* const function, detail::Hook*& result)
+{
+    if(!context.hooks)
+    {
+        context.hooks = new(::std::nothrow) detail::Hook* [context.methodsCount]();
+        if(!context.hooks)
+        {
+            return Status::UnknownError;
+        }
+    }
+
+    void* target = context.methodsTable[index];
+    if(isHooked(target))
+    {
+        return Status::UnknownError;
+    }
+
+    auto* hook = new(::std::nothrow) detail::Hook;
+    if(!hook)
+    {
+        return Status::UnknownError;
+    }
+
+    Status status = detail::createHook(target, function, *hook, g_hookMode == HookMode::DrainedDetour);
+    if(status != Status::Success)
+    {
+        delete hook;
+        return status;
+    }
+
+    *original = hook->trampoline;
+    result = hook;
+
+    return Status::Success;
+}
+
+static void destroyHook(detail::Hook* const hook)
+{
+    detail::destroyHook(*hook);
+    delete hook;
+}
+
+// Frees disabled hooks. Their trampolines stay with the targets, so the calls still running a
+// detour are not waited for, from inside a detour as well. Drained hooks are waited for up to
+// a second, the ones still running then are left to drainHooks.
+static void releaseHooks(detail::Hook* const* const hooks, const ::std::size_t count)
+{
+    KIERO_TRACE_SPAN(Hook, "releaseHooks", Count, count);
+
+    (void) detail::destroyHooks(hooks, count);
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        delete hooks[i];
+    }
+}
+#endif
+
+#ifndef _WIN32
+static Status createGotHook(Context& context, const ::std::uint16_t index, void** const original, void* const function, detail::GotHook*& result)
+{
+    if(!context.gotHooks)
+    {
+        context.gotHooks = new(::std::nothrow) detail::GotHook* [context.methodsCount]();
+        if(!context.gotHooks)
+        {
+            return Status::UnknownError;
+        }
+    }
+
+    void* target = context.methodsTable[index];
+    if(isHooked(target))
+    {
+        return Status::UnknownError;
+    }
+
+    auto* hook = new(::std::nothrow) detail::GotHook;
+    if(!hook)
+    {
+        return Status::UnknownError;
+    }
+
+    Status status = detail::createGotHook(target, function, *hook);
+    if(status != Status::Success)
+    {
+        delete hook;
+        return status;
+    }
+
+    // Only calls through the import tables are redirected, the function itself stays callable
+    *original = target;
+    result = hook;
+
+    return Status::Success;
+}
+
+static void destroyGotHook(detail::GotHook* const hook)
+{
+    detail::disableGotHook(*hook);
+    delete hook;
+}
+
+static Status bindImportTable(Context& context, const ::std::uint16_t index, void** const original, void* const function)
+{
+    detail::GotHook* hook = nullptr;
+
+    Status status = createGotHook(context, index, original, function, hook);
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    status = detail::enableGotHooks(&hook, 1, nullptr);
+    if(status != Status::Success)
+    {
+        destroyGotHook(hook);
+        return status;
+    }
+
+    context.gotHooks[index] = hook;
+
+    return Status::Success;
+}
+
+static Status bindManyImportTable(Context& context, const ::std::span<Binding> bindings)
+{
+    const ::std::size_t count = bindings.size();
+
+    auto* hooks = new(::std::nothrow) detail::GotHook* [count]();
+    auto* created = new(::std::nothrow) detail::GotHook* [count];
+    auto* results = new(::std::nothrow) Status [count];
+
+    if(!hooks || !created || !results)
+    {
+        delete[] hooks;
+        delete[] created;
+        delete[] results;
+
+        for(Binding& binding : bindings)
+        {
+            binding.status = Status::UnknownError;
+        }
+
+        return Status::UnknownError;
+    }
+
+    ::std::size_t createdCount = 0;
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        Binding& binding = bindings[i];
+        if(!isValidBinding(context, binding.index, binding.original, binding.function))
+        {
+            binding.status = Status::UnknownError;
+            continue;
+        }
+
+        binding.status = resolveMethod(context, binding.index);
+        if(binding.status != Status::Success)
+        {
+            continue;
+        }
+
+        bool duplicate = false;
+        for(::std::size_t j = 0; j < i; ++j)
+        {
+            duplicate |= hooks[j] && hooks[j]->target == context.methodsTable[binding.index];
+        }
+
+        binding.status = duplicate ? Status::UnknownError : createGotHook(context, binding.index, binding.original, binding.function, hooks[i]);
+
+        if(hooks[i])
+        {
+            created[createdCount++] = hooks[i];
+        }
+    }
+
+    // One walk of the loaded objects for the whole batch
+    (void) detail::enableGotHooks(created, createdCount, results);
+
+    Status overall = Status::Success;
+
+    for(::std::size_t i = 0, j = 0; i < count; ++i)
+    {
+        Binding& binding = bindings[i];
+
+        if(hooks[i])
+        {
+            binding.status = results[j++];
+
+            if(binding.status == Status::Success)
+            {
+                context.gotHooks[binding.index] = hooks[i];
+            }
+            else
+            {
+                destroyGotHook(hooks[i]);
+            }
+        }
+
+        if(binding.status != Status::Success)
+        {
+            overall = Status::UnknownError;
+        }
+    }
+
+    delete[] hooks;
+    delete[] created;
+    delete[] results;
+
+    return overall;
+}
+#endif
+
+// Called once the context moved to ShuttingDown
+static void shutdownContext(Context& context, const RenderType renderType)
+{
+    KIERO_TRACE_SPAN(Init, "shutdown", RenderType, renderType);
+
+    // A bind resolving without the registry lock finishes first, later ones see ShuttingDown
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_resolveMutex);
+    }
+
+    detail::releaseSubscribers(renderType);
+    detail::releaseTiming(renderType);
+
+#if !KIERO_USE_MINHOOK
+    detail::Hook** hooks = nullptr;
+#endif
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+#ifndef _WIN32
+        if(context.gotHooks)
+        {
+            for(::std::uint16_t i = 0; i < context.methodsCount; ++i)
+            {
+                if(context.gotHooks[i])
+                {
+                    destroyGotHook(context.gotHooks[i]);
+                }
+            }
+
+            delete[] context.gotHooks;
+            context.gotHooks = nullptr;
+        }
+#endif
+
+#if KIERO_USE_MINHOOK
+        // Only this backend's targets, MH_ALL_HOOKS would take the other backends' too
+        for(::std::uint16_t i = 0; i < context.methodsCount; ++i)
+        {
+            if(context.methodsTable[i])
+            {
+                MH_DisableHook(context.methodsTable[i]);
+            }
+        }
+#else
+        if(context.hooks)
+        {
+            (void) detail::disableHooks(context.hooks, context.methodsCount, nullptr);
+
+            hooks = context.hooks;
+            context.hooks = nullptr;
+        }
+#endif
+    }
+
+#if !KIERO_USE_MINHOOK
+    if(hooks)
+    {
+        releaseHooks(hooks, context.methodsCount);
+        delete[] hooks;
+    }
+#endif
+
+    // After the hooks are gone, they may point into code only kept loaded by the backend
+    if(context.backend->release)
+    {
+        context.backend->release();
+    }
+
+    void** methodsTable = context.methodsTable;
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+        context.methodsTable = nullptr;
+        context.methodsCount = 0;
+        context.backend = nullptr;
+        context.resolvedGroups = 0;
+
+        // The first backend still published takes over as the primary one
+        if(g_renderType.load(::std::memory_order_relaxed) == renderType)
+        {
+            RenderType primary = RenderType::None;
+            for(const RenderType type : g_autoOrder)
+            {
+                if(findContext(type)->backend)
+                {
+                    primary = type;
+                    break;
+                }
+            }
+
+            g_renderType.store(primary, ::std::memory_order_release);
+        }
+    }
+
+    delete[] methodsTable;
+}
+
+void shutdown(const RenderType renderType)
+{
+    Context* const context = findContext(renderType);
+    if(!context)
+    {
+        return;
+    }
+
+    State expected = State::Initialized;
+    if(!context->state.compare_exchange_strong(expected, State::ShuttingDown, ::std::memory_order_acquire))
+    {
+        return;
+    }
+
+    shutdownContext(*context, renderType);
+
+    // initAsync workers may still be releasing the backends that lost, a callback calling
+    // shutdown waits for the others only
+    {
+        ::std::unique_lock<::std::mutex> lock(g_initWorkersMutex);
+        g_initWorkersIdle.wait(lock, [] { return g_initWorkers == (g_inInitCallback ? 1u : 0u); });
+    }
+
+    context->state.store(State::Uninitialized, ::std::memory_order_release);
+}
+
+void shutdown()
+{
+    detail::releaseShadowTables();
+
+    for(const RenderType type : g_autoOrder)
+    {
+        shutdown(type);
+    }
+}
+
+void setCacheDirectory(const char* const directory)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_cacheMutex);
+
+    const ::std::size_t length = directory ? ::std::strlen(directory) : 0;
+    if(length >= sizeof(g_cacheDirectory))
+    {
+        g_cacheDirectory[0] = '\0';
+        return;
+    }
+
+    (void) ::std::memcpy(g_cacheDirectory, directory ? directory : "", length + 1);
+}
+
+Status setHookMode(const HookMode mode, const ::std::span<const char* const> modules)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+#if KIERO_USE_MINHOOK || !KIERO_DETOUR_SUPPORTED || !(defined(_WIN32) || defined(__linux__))
+    if(mode == HookMode::DrainedDetour)
+    {
+        return Status::NotSupportedError;
+    }
+#endif
+
+#ifdef _WIN32
+    if(mode == HookMode::ImportTable)
+    {
+        return Status::NotSupportedError;
+    }
+#else
+    if(!detail::setGotModules(modules))
+    {
+        return Status::UnknownError;
+    }
+#endif
+
+    g_hookMode = mode;
+
+    return Status::Success;
+}
+
+Status drainHooks(const ::std::uint32_t timeoutMilliseconds)
+{
+#if !KIERO_USE_MINHOOK
+    return detail::drainHooks(timeoutMilliseconds);
+#else
+    (void) timeoutMilliseconds;
+    return Status::Success;
+#endif
+}
+
+void updateImportTable()
+{
+#ifndef _WIN32
+    detail::updateGotHooks();
+#endif
+}
+
+// Called with g_registryMutex held while the context is initialized
+static Status bindLocked(Context& context, const ::std::uint16_t index, void** const original, void* const function)
+{
+    if(!isValidBinding(context, index, original, function))
+    {
+        return Status::UnknownError;
+    }
+
+    Status status = resolveMethod(context, index);
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    if(context.backend->bind)
+    {
+        return context.backend->bind(index, original, function);
+    }
+
+#ifndef _WIN32
+    if(g_hookMode == HookMode::ImportTable)
+    {
+        return bindImportTable(context, index, original, function);
+    }
+#endif
+
+#if KIERO_USE_MINHOOK
+    void* target = context.methodsTable[index];
+    if(MH_CreateHook(target, function, original) != MH_OK || MH_EnableHook(target) != MH_OK)
+    {
+        return Status::UnknownError;
+    }
+#else
+    detail::Hook* hook = nullptr;
+
+    status = createHook(context, index, original, function, hook);
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    status = detail::enableHook(*hook);
+    if(status != Status::Success)
+    {
+        destroyHook(hook);
+        return status;
+    }
+
+    context.hooks[index] = hook;
+#endif
+
+    return Status::Success;
+}
+
+Status bind(const RenderType renderType, const ::std::uint16_t index, void** const original, void* const function)
+{
+    KIERO_TRACE_SPAN(Hook, "bind", Index, index);
+
+    Context* const context = findContext(renderType);
+    if(context)
+    {
+        (void) resolveMethod(*context, index);
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+    if(!context || context->state.load(::std::memory_order_acquire) != State::Initialized)
+    {
+        return Status::NotInitializedError;
+    }
+
+    return bindLocked(*context, index, original, function);
+}
+
+Status bind(const ::std::uint16_t index, void** const original, void* const function)
+{
+    return bind(getRenderType(), index, original, function);
+}
+
+void unbind(const RenderType renderType, const ::std::uint16_t index)
+{
+    KIERO_TRACE_SPAN(Hook, "unbind", Index, index);
+
+    Context* const context = findContext(renderType);
+    if(!context || context->state.load(::std::memory_order_acquire) != State::Initialized || index >= context->methodsCount)
+    {
+        return;
+    }
+
+    detail::releaseSubscribers(renderType, index);
+    detail::releaseTiming(renderType, index);
+
+#if !KIERO_USE_MINHOOK
+    detail::Hook* hook = nullptr;
+#endif
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+        if(context->state.load(::std::memory_order_acquire) != State::Initialized)
+        {
+            return;
+        }
+
+        if(context->backend->unbind)
+        {
+            context->backend->unbind(index);
+            return;
+        }
+
+#ifndef _WIN32
+        if(context->gotHooks && context->gotHooks[index])
+        {
+            destroyGotHook(context->gotHooks[index]);
+            context->gotHooks[index] = nullptr;
+            return;
+        }
+#endif
+
+#if KIERO_USE_MINHOOK
+        MH_DisableHook(context->methodsTable[index]);
+#else
+        if(context->hooks && context->hooks[index])
+        {
+            hook = context->hooks[index];
+            context->hooks[index] = nullptr;
+
+            (void) detail::disableHook(*hook);
+        }
+#endif
+    }
+
+#if !KIERO_USE_MINHOOK
+    if(hook)
+    {
+        releaseHooks(&hook, 1);
+    }
+#endif
+}
+
+void unbind(const ::std::uint16_t index)
+{
+    unbind(getRenderType(), index);
+}
+
+Status bindMany(const RenderType renderType, const ::std::span<Binding> bindings)
+{
+    KIERO_TRACE_SPAN(Hook, "bindMany", Count, bindings.size());
+
+    Context* const context = findContext(renderType);
+    if(context)
+    {
+        for(const Binding& binding : bindings)
+        {
+            (void) resolveMethod(*context, binding.index);
+        }
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+    if(!context || context->state.load(::std::memory_order_acquire) != State::Initialized)
+    {
+        for(Binding& binding : bindings)
+        {
+            binding.status = Status::NotInitializedError;
+        }
+
+        return Status::NotInitializedError;
+    }
+
+    Status overall = Status::Success;
+
+    // Nothing to batch when no code is patched
+    if(context->backend->bind)
+    {
+        for(Binding& binding : bindings)
+        {
+            binding.status = bindLocked(*context, binding.index, binding.original, binding.function);
+
+            if(binding.status != Status::Success)
+            {
+                overall = Status::UnknownError;
+            }
+        }
+
+        return overall;
+    }
+
+#ifndef _WIN32
+    if(g_hookMode == HookMode::ImportTable)
+    {
+        return bindManyImportTable(*context, bindings);
+    }
+#endif
+
+#if KIERO_USE_MINHOOK
+    // MinHook batches queued hooks into one thread suspension itself
+    for(Binding& binding : bindings)
+    {
+        if(!isValidBinding(*context, binding.index, binding.original, binding.function))
+        {
+            binding.status = Status::UnknownError;
+            continue;
+        }
+
+        binding.status = resolveMethod(*context, binding.index);
+        if(binding.status != Status::Success)
+        {
+            continue;
+        }
+
+        void* target = context->methodsTable[binding.index];
+        binding.status = MH_CreateHook(target, binding.function, binding.original) == MH_OK && MH_QueueEnableHook(target) == MH_OK ? Status::Success : Status::UnknownError;
+    }
+
+    const bool applied = MH_ApplyQueued() == MH_OK;
+
+    for(Binding& binding : bindings)
+    {
+        if(!applied)
+        {
+            binding.status = Status::UnknownError;
+        }
+
+        if(binding.status != Status::Success)
+        {
+            overall = Status::UnknownError;
+        }
+    }
+#else
+    const ::std::size_t count = bindings.size();
+
+    auto* hooks = new(::std::nothrow) detail::Hook* [count]();
+    auto* results = new(::std::nothrow) Status [count];
+
+    if(!hooks || !results)
+    {
+        delete[] hooks;
+        delete[] results;
+
+        for(Binding& binding : bindings)
+        {
+            binding.status = Status::UnknownError;
+        }
+
+        return Status::UnknownError;
+    }
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        Binding& binding = bindings[i];
+        if(!isValidBinding(*context, binding.index, binding.original, binding.function))
+        {
+            binding.status = Status::UnknownError;
+            continue;
+        }
+
+        binding.status = resolveMethod(*context, binding.index);
+        if(binding.status != Status::Success)
+        {
+            continue;
+        }
+
+        // The same target twice in one batch
+        bool duplicate = false;
+        for(::std::size_t j = 0; j < i; ++j)
+        {
+            duplicate |= hooks[j] && hooks[j]->target == context->methodsTable[binding.index];
+        }
+
+        binding.status = duplicate ? Status::UnknownError : createHook(*context, binding.index, binding.original, binding.function, hooks[i]);
+    }
+
+    (void) detail::enableHooks(hooks, count, results);
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        Binding& binding = bindings[i];
+
+        if(hooks[i])
+        {
+            binding.status = results[i];
+
+            if(binding.status == Status::Success)
+            {
+                context->hooks[binding.index] = hooks[i];
+            }
+            else
+            {
+                destroyHook(hooks[i]);
+            }
+        }
+
+        if(binding.status != Status::Success)
+        {
+            overall = Status::UnknownError;
+        }
+    }
+
+    delete[] hooks;
+    delete[] results;
+#endif
+
+    return overall;
+}
+
+Status bindMany(const ::std::span<Binding> bindings)
+{
+    return bindMany(getRenderType(), bindings);
+}
+
+void unbindMany(const RenderType renderType, const ::std::span<const ::std::uint16_t> indices)
+{
+    KIERO_TRACE_SPAN(Hook, "unbindMany", Count, indices.size());
+
+    Context* const context = findContext(renderType);
+    if(!context || context->state.load(::std::memory_order_acquire) != State::Initialized)
+    {
+        return;
+    }
+
+    // Indices out of the table are ignored like by unbind
+    for(const ::std::uint16_t index : indices)
+    {
+        if(index >= context->methodsCount)
+        {
+            for(const ::std::uint16_t valid : indices)
+            {
+                if(valid < context->methodsCount)
+                {
+                    unbind(renderType, valid);
+                }
+            }
+
+            return;
+        }
+    }
+
+    for(const ::std::uint16_t index : indices)
+    {
+        detail::releaseSubscribers(renderType, index);
+        detail::releaseTiming(renderType, index);
+    }
+
+#if !KIERO_USE_MINHOOK
+    const ::std::size_t count = indices.size();
+
+    auto* hooks = new(::std::nothrow) detail::Hook* [count]();
+    if(!hooks)
+    {
+        for(const ::std::uint16_t index : indices)
+        {
+            unbind(renderType, index);
+        }
+
+        return;
+    }
+#endif
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+        if(context->state.load(::std::memory_order_acquire) != State::Initialized)
+        {
+#if !KIERO_USE_MINHOOK
+            delete[] hooks;
+#endif
+            return;
+        }
+
+        if(context->backend->unbind)
+        {
+            for(const ::std::uint16_t index : indices)
+            {
+                context->backend->unbind(index);
+            }
+
+#if !KIERO_USE_MINHOOK
+            delete[] hooks;
+#endif
+            return;
+        }
+
+#ifndef _WIN32
+        if(context->gotHooks)
+        {
+            for(const ::std::uint16_t index : indices)
+            {
+                if(context->gotHooks[index])
+                {
+                    destroyGotHook(context->gotHooks[index]);
+                    context->gotHooks[index] = nullptr;
+                }
+            }
+        }
+#endif
+
+#if KIERO_USE_MINHOOK
+        for(const ::std::uint16_t index : indices)
+        {
+            MH_QueueDisableHook(context->methodsTable[index]);
+        }
+
+        MH_ApplyQueued();
+#else
+        for(::std::size_t i = 0; context->hooks && i < count; ++i)
+        {
+            hooks[i] = context->hooks[indices[i]];
+            context->hooks[indices[i]] = nullptr;
+        }
+
+        (void) detail::disableHooks(hooks, count, nullptr);
+#endif
+    }
+
+#if !KIERO_USE_MINHOOK
+    releaseHooks(hooks, count);
+    delete[] hooks;
+#endif
+}
+
+void unbindMany(const ::std::span<const ::std::uint16_t> indices)
+{
+    unbindMany(getRenderType(), indices);
+}
+
+[[nodiscard]] RenderType getRenderType() noexcept
+{
+    return g_renderType.load(::std::memory_order_acquire);
+}
+
+[[nodiscard]] void** getMethodsTable(const RenderType renderType) noexcept
+{
+    const Context* const context = findContext(renderType);
+    return context && context->state.load(::std::memory_order_acquire) == State::Initialized ? context->methodsTable : nullptr;
+}
+
+[[nodiscard]] void** getMethodsTable() noexcept
+{
+    return getMethodsTable(getRenderType());
+}
+
+[[nodiscard]] void* getMethod(const RenderType renderType, const ::std::uint16_t index)
+{
+    Context* const context = findContext(renderType);
+    if(!context || context->state.load(::std::memory_order_acquire) != State::Initialized || index >= context->methodsCount || resolveMethod(*context, index) != Status::Success)
+    {
+        return nullptr;
+    }
+
+    return context->methodsTable[index];
+}
+
+[[nodiscard]] void* getMethod(const ::std::uint16_t index)
+{
+    return getMethod(getRenderType(), index);
+}
+
+namespace detail
+{
+
+#if !KIERO_USE_MINHOOK && KIERO_DETOUR_SUPPORTED
+Status rerouteHook(const RenderType renderType, const ::std::uint16_t index, const HookRoute* const expected, const HookRoute* const route, HookRoute& current)
+{
+    Context* const context = findContext(renderType);
+    if(!context)
+    {
+        return Status::NotInitializedError;
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_registryMutex);
+
+    if(context->backend && context->backend->bind)
+    {
+        return Status::NotSupportedError;
+    }
+
+#ifndef _WIN32
+    if(context->gotHooks && index < context->methodsCount && context->gotHooks[index])
+    {
+        return Status::NotSupportedError;
+    }
+#endif
+
+    Hook* const hook = context->hooks && index < context->methodsCount ? context->hooks[index] : nullptr;
+    if(!hook)
+    {
+        return Status::NotInitializedError;
+    }
+
+    current = { hook->detour, hook->route, detail::trampolineCopy(*hook) };
+
+    if(!route)
+    {
+        return Status::Success;
+    }
+
+    if(expected && (current.detour != expected->detour || current.original != expected->original))
+    {
+        return Status::UnknownError;
+    }
+
+    // The copy first, a detour reached through the new route may call it right away
+    const Status status = detail::routeTrampoline(*hook, route->original);
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    (void) redirectHook(*hook, route->detour);
+    return Status::Success;
+}
+#else
+Status rerouteHook(const RenderType, const ::std::uint16_t, const HookRoute* const, const HookRoute* const, HookRoute&)
+{
+    return Status::NotSupportedError;
+}
+#endif
+
+}
+
+}
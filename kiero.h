@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 #define KIERO_VERSION "1.3.0"
 
@@ -28,8 +29,20 @@
     #define KIERO_INCLUDE_VULKAN 0 // 1 if you need Vulkan hook
 #endif
 
+#ifndef KIERO_VULKAN_DEVICE_FUNCTIONS
+    #define KIERO_VULKAN_DEVICE_FUNCTIONS 1 // 0 to hook the loader's exported trampolines instead of the driver's device-level functions
+#endif
+
+#ifndef KIERO_VULKAN_LAYER
+    #define KIERO_VULKAN_LAYER   0 // 1 when building the VkLayer_kiero implicit layer, Vulkan binds then redirect the layer's entries
+#endif
+
 #ifndef KIERO_USE_MINHOOK
-    #define KIERO_USE_MINHOOK    0 // 1 if you will use kiero::bind function
+    #define KIERO_USE_MINHOOK    0 // 1 to route kiero::bind through MinHook instead of the built-in detour engine
+#endif
+
+#ifndef KIERO_TRACE
+    #define KIERO_TRACE          0 // 1 to compile in the spans kiero_trace.h records
 #endif
 
 namespace kiero
@@ -43,6 +56,8 @@ namespace kiero
 		AlreadyInitializedError = -4,
 		NotInitializedError = -5,
 
+		TimeoutError = -6,
+
 		Success = 0,
 	};
 
@@ -61,12 +76,145 @@ namespace kiero
 		Auto
 	};
 
-	Status init(const RenderType renderType);
-	void shutdown();
+	enum class InitMode
+	{
+		Eager, // build the whole methods table in init
+		Lazy,  // build each interface's slice of the table when one of its indices is first used
+	};
+
+	struct Binding
+	{
+		::std::uint16_t index;
+		void** original;
+		void* function;
+
+		Status status; // set by bindMany
+	};
+
+	enum class HookMode
+	{
+		Detour,        // patch the first instructions of the function
+		ImportTable,   // rewrite the GOT entries of the objects importing it (Linux only)
+		DrainedDetour, // Detour whose unbind and shutdown wait for the calls still in it, see drainHooks
+	};
 
+	// Auto picks the first backend in the order D3D9, D3D10, D3D11, D3D12, OpenGL, Vulkan whose
+	// runtime is loaded and whose table builds, and only while no backend is initialized. Any
+	// number of other backends can be initialized next to one, each at most once. The first
+	// one initialized is the primary one (getRenderType), the functions without a render type
+	// address it.
+	Status init(const RenderType renderType, const InitMode mode = InitMode::Eager);
+
+	// Shuts down every backend, or one. When the primary one goes the first one left in the
+	// Auto order takes over.
+	void shutdown();
+	void shutdown(const RenderType renderType);
+
+	// Receives the result of initAsync on one of its worker threads
+	using InitCallback = void (*)(void* const context, const Status status);
+
+	// init on worker threads, returns without waiting for them. Auto builds the table of every
+	// candidate backend at once and finishes as soon as the one init would pick is ready, the
+	// tables that lost are released in the background (shutdown waits for that). Returns
+	// Success once started, the callback is then called exactly once, otherwise not at all.
+	// Does not wait for the workers to start, so it may be called from DllMain.
+	Status initAsync(const RenderType renderType, const InitMode mode = InitMode::Eager, const InitCallback callback = nullptr, void* const context = nullptr);
+
+	// For processes that load several runtimes (e.g. an OpenGL game whose overlay pulls in Vulkan)
+	// where Auto would guess: initializes every loaded backend lazily, counts the calls of their
+	// frame boundaries (kiero_frame.h) for up to timeoutMilliseconds and keeps the backend that
+	// presents (the first one to reach a few frames, or the busiest one by the timeout) as the
+	// primary one, the others are shut down. D3D10 and D3D11 present through the same function,
+	// it is counted for D3D10 when both are loaded. Only while no backend is initialized, fails
+	// with TimeoutError when nothing presented. x86-64 only, must not be called from a detour.
+	Status initDetect(const ::std::uint32_t timeoutMilliseconds, RenderType* const detected = nullptr);
+
+	// Lets init load the methods table from <directory>/kiero-<version>-<type>.cache instead of
+	// creating a device, and write it there once the table is complete. The file is ignored
+	// when any module it points into was updated. nullptr (the default) disables the cache.
+	void setCacheDirectory(const char* const directory);
+
+	// Applies to the following binds. ImportTable leaves the function's code untouched and only
+	// redirects calls made through the import table of the objects whose path contains one of
+	// modules (all objects when empty). Objects loaded later are patched by the next bind,
+	// unbind, frame boundary (kiero::FrameScope, the thunks and subscribers) or
+	// updateImportTable.
+	Status setHookMode(const HookMode mode, const ::std::span<const char* const> modules = { });
+
+	// Unbinding a DrainedDetour hook waits up to a second, with the other threads briefly
+	// frozen every millisecond, until no thread runs its detour, trampoline or stub (judged
+	// from the instruction pointers and stacks), then frees its trampoline and stub: the
+	// detour's module may be unloaded afterwards. A hook unbound from inside its own detour,
+	// or still running by then, is left pending. drainHooks waits for the pending ones up to
+	// timeoutMilliseconds, Success once none is left. Only with the built-in detour engine on
+	// Windows and Linux, setHookMode fails with NotSupportedError elsewhere.
+	Status drainHooks(const ::std::uint32_t timeoutMilliseconds = 1000);
+
+	// Applies the ImportTable binds to the objects loaded since they were made, e.g. after
+	// dlopen of a module calling a hooked function, without waiting for the next frame
+	// boundary. Cheap when nothing was loaded.
+	void updateImportTable();
+
+	// On the primary backend, or the given one. Backends sharing a function (e.g. the
+	// IDXGISwapChain::Present of D3D10 and D3D11) can only hook it once.
 	Status bind(const ::std::uint16_t index, void** const original, void* const function);
+	Status bind(const RenderType renderType, const ::std::uint16_t index, void** const original, void* const function);
 	void unbind(const ::std::uint16_t index);
-
+	void unbind(const RenderType renderType, const ::std::uint16_t index);
+
+	// Installs/removes all hooks in a single patch pass, see Binding::status for per entry results
+	Status bindMany(const ::std::span<Binding> bindings);
+	Status bindMany(const RenderType renderType, const ::std::span<Binding> bindings);
+	void unbindMany(const ::std::span<const ::std::uint16_t> indices);
+	void unbindMany(const RenderType renderType, const ::std::span<const ::std::uint16_t> indices);
+
+	// Hooks one object only by pointing its vptr to a private copy of its vtable, no code is
+	// patched and kiero::init is not required. index is the slot in the object's own vtable
+	// (for the D3D tables: the methods table index minus the offset of its interface). A shadow
+	// is only trusted while the object's vptr still points to it: a new object allocated where a
+	// bound one was destroyed is bound afresh, and unbinding never writes the vptr of an object
+	// that stopped using its shadow. shutdown() does not touch the instances still bound, which
+	// may be gone: their shadows call the original functions from then on and are never freed.
+	// Fails with UnknownError for a null object, original or function.
+	Status bindInstance(void* const object, const ::std::uint16_t index, void** const original, void* const function);
+	void unbindInstance(void* const object, const ::std::uint16_t index);
+
+	// The primary backend, None when none is initialized
 	[[nodiscard]] RenderType getRenderType() noexcept;
-	[[nodiscard]] void** getMethodsTable() noexcept;
+	[[nodiscard]] void** getMethodsTable() noexcept; // entries of unresolved lazy groups are null
+	[[nodiscard]] void** getMethodsTable(const RenderType renderType) noexcept;
+
+	// Resolves the index's group first when init was lazy
+	[[nodiscard]] void* getMethod(const ::std::uint16_t index);
+	[[nodiscard]] void* getMethod(const RenderType renderType, const ::std::uint16_t index);
+
+	// One slot of a methods table, kiero_methods.h names all of them (e.g.
+	// kiero::d3d11::IDXGISwapChain::Present)
+	template<RenderType Type, ::std::uint16_t Index>
+	struct Method
+	{
+		static constexpr RenderType renderType = Type;
+		static constexpr ::std::uint16_t index = Index;
+	};
+
+	// The function type of a slot, specialized for every slot by kiero_signatures.h
+	template<RenderType Type, ::std::uint16_t Index>
+	struct MethodSignature;
+
+	template<typename M>
+	using MethodFunction = typename MethodSignature<M::renderType, M::index>::Type;
+
+	// The detour must have the slot's exact type and original receives a function of that type:
+	// kiero::bind<kiero::d3d11::IDXGISwapChain::Present>(hkPresent, oPresent)
+	template<typename M>
+	Status bind(const MethodFunction<M> function, MethodFunction<M>& original)
+	{
+		return bind(M::renderType, M::index, reinterpret_cast<void**>(&original), reinterpret_cast<void*>(function));
+	}
+
+	template<typename M>
+	void unbind()
+	{
+		unbind(M::renderType, M::index);
+	}
 }
@@ -0,0 +1,497 @@
+#include "kiero_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# include <Windows.h>
+#else
+# include <elf.h>
+# include <fcntl.h>
+# include <link.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace kiero::detail
+{
+
+namespace
+{
+
+constexpr char CacheMagic[8] = { 'K', 'I', 'E', 'R', 'O', 'M', 'T', 'C' };
+constexpr ::std::uint32_t CacheVersion = 2;
+
+constexpr ::std::size_t MaxModules = 32;
+constexpr ::std::size_t MaxNameLength = 260;
+constexpr ::std::size_t MaxIdentitySize = 32;
+
+struct CacheHeader
+{
+    char magic[8];
+    ::std::uint32_t version;
+    ::std::uint32_t renderType;
+    ::std::uint32_t methodsCount;
+    ::std::uint32_t modulesCount;
+    ::std::uint32_t options;
+    ::std::uint32_t reserved;
+    ::std::uint64_t hash; // FNV-1a over everything after the header
+};
+
+struct CacheModule
+{
+    char name[MaxNameLength];
+    ::std::uint32_t identitySize;
+    ::std::uint8_t identity[MaxIdentitySize];
+};
+
+struct CacheEntry
+{
+    ::std::uint32_t module;
+    ::std::uint32_t reserved;
+    ::std::uint64_t offset;
+};
+
+struct Module
+{
+    ::std::uintptr_t base;
+    CacheModule description;
+};
+
+[[nodiscard]] ::std::uint64_t hashBytes(const void* const data, const ::std::size_t size, ::std::uint64_t hash = 14695981039346656037ull) noexcept
+{
+    const auto* const bytes = static_cast<const ::std::uint8_t*>(data);
+    for(::std::size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+
+    return hash;
+}
+
+#ifdef _WIN32
+
+void readIdentity(const HMODULE handle, CacheModule& description) noexcept
+{
+    const auto* const base = reinterpret_cast<const ::std::uint8_t*>(handle);
+    const auto* const dosHeader = reinterpret_cast<const IMAGE_DOS_HEADER*>(base);
+    const auto* const ntHeaders = reinterpret_cast<const IMAGE_NT_HEADERS*>(base + dosHeader->e_lfanew);
+
+    const ::std::uint32_t identity[] = { ntHeaders->FileHeader.TimeDateStamp, ntHeaders->OptionalHeader.CheckSum, ntHeaders->OptionalHeader.SizeOfImage };
+
+    description.identitySize = sizeof(identity);
+    (void) ::std::memcpy(description.identity, identity, sizeof(identity));
+}
+
+bool findModuleByAddress(const void* const address, Module& module) noexcept
+{
+    HMODULE handle;
+    if(!::GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, static_cast<LPCSTR>(address), &handle))
+    {
+        return false;
+    }
+
+    module = Module { };
+    module.base = reinterpret_cast<::std::uintptr_t>(handle);
+
+    const DWORD length = ::GetModuleFileNameA(handle, module.description.name, MaxNameLength);
+    if(length == 0 || length >= MaxNameLength)
+    {
+        return false;
+    }
+
+    readIdentity(handle, module.description);
+    return true;
+}
+
+bool findModuleByName(const char* const name, Module& module) noexcept
+{
+    const HMODULE handle = ::GetModuleHandleA(name);
+    if(!handle)
+    {
+        return false;
+    }
+
+    module = Module { };
+    module.base = reinterpret_cast<::std::uintptr_t>(handle);
+    (void) ::std::memcpy(module.description.name, name, ::std::strlen(name) + 1);
+
+    readIdentity(handle, module.description);
+    return true;
+}
+
+#else
+
+// NT_GNU_BUILD_ID when the object has one, size/mtime/inode of its file otherwise
+void readIdentity(const dl_phdr_info& info, CacheModule& description) noexcept
+{
+    for(ElfW(Half) i = 0; i < info.dlpi_phnum; ++i)
+    {
+        const ElfW(Phdr)& header = info.dlpi_phdr[i];
+        if(header.p_type != PT_NOTE)
+        {
+            continue;
+        }
+
+        const auto* p = reinterpret_cast<const ::std::uint8_t*>(info.dlpi_addr + header.p_vaddr);
+        const auto* const end = p + header.p_memsz;
+
+        while(p + sizeof(ElfW(Nhdr)) <= end)
+        {
+            const auto* const note = reinterpret_cast<const ElfW(Nhdr)*>(p);
+            const auto* const name = p + sizeof(ElfW(Nhdr));
+            const auto* const desc = name + ((note->n_namesz + 3) & ~3u);
+
+            if(note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 && ::std::memcmp(name, "GNU", 4) == 0)
+            {
+                description.identitySize = note->n_descsz < MaxIdentitySize ? note->n_descsz : MaxIdentitySize;
+                (void) ::std::memcpy(description.identity, desc, description.identitySize);
+                return;
+            }
+
+            p = desc + ((note->n_descsz + 3) & ~3u);
+        }
+    }
+
+    struct stat status;
+    if(::stat(info.dlpi_name, &status) == 0)
+    {
+        const ::std::uint64_t identity[] = { static_cast<::std::uint64_t>(status.st_size), static_cast<::std::uint64_t>(status.st_mtime), static_cast<::std::uint64_t>(status.st_ino) };
+
+        description.identitySize = sizeof(identity);
+        (void) ::std::memcpy(description.identity, identity, sizeof(identity));
+    }
+}
+
+struct ModuleQuery
+{
+    const void* address;
+    const char* name;
+    Module* module;
+    bool found;
+};
+
+int queryModule(dl_phdr_info* const info, const ::std::size_t, void* const context) noexcept
+{
+    auto& query = *static_cast<ModuleQuery*>(context);
+    const char* const name = info->dlpi_name ? info->dlpi_name : "";
+
+    bool matches = false;
+
+    if(query.name)
+    {
+        matches = ::std::strcmp(name, query.name) == 0;
+    }
+    else
+    {
+        const ::std::uintptr_t address = reinterpret_cast<::std::uintptr_t>(query.address);
+        for(ElfW(Half) i = 0; i < info->dlpi_phnum && !matches; ++i)
+        {
+            const ElfW(Phdr)& header = info->dlpi_phdr[i];
+            const ::std::uintptr_t start = info->dlpi_addr + header.p_vaddr;
+
+            matches = header.p_type == PT_LOAD && address >= start && address < start + header.p_memsz;
+        }
+    }
+
+    if(!matches)
+    {
+        return 0;
+    }
+
+    const ::std::size_t length = ::std::strlen(name);
+    if(length >= MaxNameLength)
+    {
+        return 1;
+    }
+
+    Module& module = *query.module;
+    module = Module { };
+    module.base = info->dlpi_addr;
+    (void) ::std::memcpy(module.description.name, name, length + 1);
+
+    readIdentity(*info, module.description);
+    query.found = true;
+
+    return 1;
+}
+
+bool findModuleByAddress(const void* const address, Module& module) noexcept
+{
+    ModuleQuery query { address, nullptr, &module, false };
+    (void) ::dl_iterate_phdr(queryModule, &query);
+    return query.found;
+}
+
+bool findModuleByName(const char* const name, Module& module) noexcept
+{
+    ModuleQuery query { nullptr, name, &module, false };
+    (void) ::dl_iterate_phdr(queryModule, &query);
+    return query.found;
+}
+
+#endif
+
+// Read-only view of a whole file
+class MappedFile
+{
+public:
+    explicit MappedFile(const char* const path) noexcept
+    {
+#ifdef _WIN32
+        m_file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(m_file == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        LARGE_INTEGER size;
+        if(!::GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+        {
+            return;
+        }
+
+        m_mapping = ::CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(m_mapping)
+        {
+            m_data = ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+            m_size = m_data ? static_cast<::std::size_t>(size.QuadPart) : 0;
+        }
+#else
+        const int file = ::open(path, O_RDONLY | O_CLOEXEC);
+        if(file < 0)
+        {
+            return;
+        }
+
+        struct stat status;
+        if(::fstat(file, &status) == 0 && status.st_size > 0)
+        {
+            void* const data = ::mmap(nullptr, static_cast<::std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if(data != MAP_FAILED)
+            {
+                m_data = data;
+                m_size = static_cast<::std::size_t>(status.st_size);
+            }
+        }
+
+        ::close(file);
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifdef _WIN32
+        if(m_data)
+        {
+            ::UnmapViewOfFile(m_data);
+        }
+
+        if(m_mapping)
+        {
+            ::CloseHandle(m_mapping);
+        }
+
+        if(m_file != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_file);
+        }
+#else
+        if(m_data)
+        {
+            ::munmap(m_data, m_size);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const ::std::uint8_t* data() const noexcept
+    {
+        return static_cast<const ::std::uint8_t*>(m_data);
+    }
+
+    [[nodiscard]] ::std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#endif
+    void* m_data = nullptr;
+    ::std::size_t m_size = 0;
+};
+
+} // namespace
+
+bool loadMethodsCache(const char* const path, const RenderType renderType, const ::std::uint32_t options, void** const methods, const ::std::uint16_t count) noexcept
+{
+    const MappedFile file(path);
+
+    CacheHeader header;
+    if(file.size() < sizeof(header))
+    {
+        return false;
+    }
+
+    (void) ::std::memcpy(&header, file.data(), sizeof(header));
+
+    if(::std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0 || header.version != CacheVersion ||
+       header.renderType != static_cast<::std::uint32_t>(renderType) || header.options != options || header.methodsCount != count || header.modulesCount > MaxModules)
+    {
+        return false;
+    }
+
+    const ::std::size_t payload = header.modulesCount * sizeof(CacheModule) + count * sizeof(CacheEntry);
+    if(file.size() != sizeof(header) + payload || hashBytes(file.data() + sizeof(header), payload) != header.hash)
+    {
+        return false;
+    }
+
+    const auto* const modules = reinterpret_cast<const CacheModule*>(file.data() + sizeof(header));
+    const auto* const entries = reinterpret_cast<const CacheEntry*>(modules + header.modulesCount);
+
+    // Every module must be loaded and be the very same image
+    ::std::uintptr_t bases[MaxModules];
+
+    for(::std::uint32_t i = 0; i < header.modulesCount; ++i)
+    {
+        CacheModule description = modules[i];
+        description.name[MaxNameLength - 1] = '\0';
+
+        Module module;
+        if(!findModuleByName(description.name, module) || module.description.identitySize != description.identitySize ||
+           description.identitySize == 0 || ::std::memcmp(module.description.identity, description.identity, description.identitySize) != 0)
+        {
+            return false;
+        }
+
+        bases[i] = module.base;
+    }
+
+    for(::std::uint16_t i = 0; i < count; ++i)
+    {
+        if(entries[i].module >= header.modulesCount)
+        {
+            return false;
+        }
+    }
+
+    for(::std::uint16_t i = 0; i < count; ++i)
+    {
+        methods[i] = reinterpret_cast<void*>(bases[entries[i].module] + entries[i].offset);
+    }
+
+    return true;
+}
+
+bool saveMethodsCache(const char* const path, const RenderType renderType, const ::std::uint32_t options, void* const* const methods, const ::std::uint16_t count) noexcept
+{
+    auto* const entries = new(::std::nothrow) CacheEntry [count];
+    auto* const modules = new(::std::nothrow) Module [MaxModules];
+
+    if(!entries || !modules)
+    {
+        delete[] entries;
+        delete[] modules;
+        return false;
+    }
+
+    ::std::uint32_t modulesCount = 0;
+    bool complete = true;
+
+    for(::std::uint16_t i = 0; i < count; ++i)
+    {
+        // An entry the runtime did not export may be exported once another module is loaded,
+        // only a table without holes is worth keeping
+        Module module;
+        if(!methods[i] || !findModuleByAddress(methods[i], module) || module.description.identitySize == 0)
+        {
+            complete = false;
+            break;
+        }
+
+        ::std::uint32_t index = 0;
+        while(index < modulesCount && modules[index].base != module.base)
+        {
+            ++index;
+        }
+
+        if(index == modulesCount)
+        {
+            if(modulesCount == MaxModules)
+            {
+                complete = false;
+                break;
+            }
+
+            modules[modulesCount++] = module;
+        }
+
+        entries[i] = CacheEntry { index, 0, reinterpret_cast<::std::uintptr_t>(methods[i]) - module.base };
+    }
+
+    bool saved = false;
+
+    if(complete)
+    {
+        CacheHeader header { };
+        (void) ::std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+        header.version = CacheVersion;
+        header.renderType = static_cast<::std::uint32_t>(renderType);
+        header.methodsCount = count;
+        header.modulesCount = modulesCount;
+        header.options = options;
+
+        header.hash = hashBytes(nullptr, 0);
+        for(::std::uint32_t i = 0; i < modulesCount; ++i)
+        {
+            header.hash = hashBytes(&modules[i].description, sizeof(CacheModule), header.hash);
+        }
+
+        header.hash = hashBytes(entries, count * sizeof(CacheEntry), header.hash);
+
+        // Write next to the cache and rename so readers never see a partial file
+        char temporary[1024];
+        if(::std::snprintf(temporary, sizeof(temporary), "%s.tmp", path) < static_cast<int>(sizeof(temporary)))
+        {
+            if(::std::FILE* const file = ::std::fopen(temporary, "wb"))
+            {
+                saved = ::std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+                for(::std::uint32_t i = 0; i < modulesCount && saved; ++i)
+                {
+                    saved = ::std::fwrite(&modules[i].description, sizeof(CacheModule), 1, file) == 1;
+                }
+
+                saved = saved && ::std::fwrite(entries, sizeof(CacheEntry), count, file) == count;
+                saved = ::std::fclose(file) == 0 && saved;
+
+#ifdef _WIN32
+                saved = saved && ::MoveFileExA(temporary, path, MOVEFILE_REPLACE_EXISTING);
+#else
+                saved = saved && ::rename(temporary, path) == 0;
+#endif
+
+                if(!saved)
+                {
+                    (void) ::std::remove(temporary);
+                }
+            }
+        }
+    }
+
+    delete[] entries;
+    delete[] modules;
+
+    return saved;
+}
+
+}
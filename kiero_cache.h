@@ -0,0 +1,16 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <cstdint>
+
+namespace kiero::detail
+{
+	// The methods table stored as offsets into the modules that own each entry. Every
+	// module is identified by its PE timestamp/checksum/size or its ELF build-id, so a
+	// driver or runtime update invalidates the cache by itself. options are the build options
+	// that shape the table, a cache saved under others is not loaded. Tables with null
+	// entries are not saved.
+	bool loadMethodsCache(const char* const path, const RenderType renderType, const ::std::uint32_t options, void** const methods, const ::std::uint16_t count) noexcept;
+	bool saveMethodsCache(const char* const path, const RenderType renderType, const ::std::uint32_t options, void* const* const methods, const ::std::uint16_t count) noexcept;
+}
@@ -0,0 +1,681 @@
+#include "kiero_census.h"
+#include "kiero_detour.h"
+#include "kiero_epoch.h"
+#include "kiero_methods.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+# include <Windows.h>
+#endif
+
+namespace kiero
+{
+
+#if KIERO_DETOUR_SUPPORTED
+
+namespace
+{
+
+// A thread that presented counts into a block of its own with a plain increment, reached
+// through a TLS slot at a fixed offset from the thread pointer. Every other thread counts into
+// one of the shared shards, picked by a hash of its thread pointer, with a locked increment
+// since threads may share a shard.
+constexpr ::std::uint32_t ShardBits = 4;
+constexpr ::std::uint32_t Shards = 1u << ShardBits;
+
+constexpr ::std::size_t StubSize = 80;
+constexpr ::std::size_t CodePage = 4096; // x86-64, the originals start on a page of their own
+
+constexpr ::std::size_t MaxMethodsCount = ::std::max({ ::std::size(d3d9::Names), ::std::size(d3d10::Names), ::std::size(d3d11::Names),
+    ::std::size(d3d12::Names), ::std::size(opengl::Names), ::std::size(vulkan::Names) });
+
+// One per thread that ever presented during a census. Only its thread increments it, and its
+// counts only ever grow: blocks are never freed, a thread that exited gives its block to the
+// next one, and a census subtracts what the blocks held when it started.
+struct alignas(64) ThreadCounters
+{
+    ::std::uint64_t counts[MaxMethodsCount];
+
+    ::std::atomic<bool> used { true };
+    ThreadCounters* next = nullptr;
+};
+
+::std::atomic<ThreadCounters*> g_threadCounters { nullptr };
+
+#ifdef _WIN32
+// A TlsAlloc index below 64 lives at gs:[0x1480 + index * 8] of the TEB
+DWORD g_tlsIndex = TLS_OUT_OF_INDEXES;
+#else
+// Static TLS, at the same offset from the thread pointer on every thread
+thread_local ThreadCounters* g_threadCounts __attribute__((tls_model("initial-exec"))) = nullptr;
+#endif
+
+// Gives the block back when its thread exits, only constructed on the thread's first block
+struct ThreadCountersOwner
+{
+    ThreadCounters* counters = nullptr;
+
+    ~ThreadCountersOwner()
+    {
+        if(counters)
+        {
+#ifdef _WIN32
+            ::TlsSetValue(g_tlsIndex, nullptr);
+#else
+            g_threadCounts = nullptr;
+#endif
+            counters->used.store(false, ::std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadCountersOwner g_threadCountersOwner;
+
+// The displacement of the stubs' TLS load, false when the slot cannot be reached that way
+[[nodiscard]] bool threadSlot(::std::int32_t& displacement) noexcept
+{
+#ifdef _WIN32
+    if(g_tlsIndex == TLS_OUT_OF_INDEXES)
+    {
+        g_tlsIndex = ::TlsAlloc();
+    }
+
+    if(g_tlsIndex >= 64)
+    {
+        return false;
+    }
+
+    displacement = static_cast<::std::int32_t>(0x1480 + g_tlsIndex * 8);
+    return true;
+#else
+    ::std::uintptr_t threadPointer;
+    asm("mov %%fs:0, %0" : "=r"(threadPointer));
+
+    const ::std::intptr_t offset = reinterpret_cast<::std::intptr_t>(&g_threadCounts) - static_cast<::std::intptr_t>(threadPointer);
+    if(offset < INT32_MIN || offset > INT32_MAX)
+    {
+        return false;
+    }
+
+    displacement = static_cast<::std::int32_t>(offset);
+    return true;
+#endif
+}
+
+void attachThread() noexcept
+{
+#ifdef _WIN32
+    if(g_tlsIndex >= 64 || ::TlsGetValue(g_tlsIndex))
+    {
+        return;
+    }
+#else
+    if(g_threadCounts)
+    {
+        return;
+    }
+#endif
+
+    ThreadCounters* counters = nullptr;
+
+    for(ThreadCounters* record = g_threadCounters.load(::std::memory_order_acquire); record; record = record->next)
+    {
+        bool used = false;
+        if(!record->used.load(::std::memory_order_relaxed) && record->used.compare_exchange_strong(used, true, ::std::memory_order_acquire))
+        {
+            counters = record;
+            break;
+        }
+    }
+
+    if(!counters)
+    {
+        counters = new(::std::nothrow) ThreadCounters { };
+        if(!counters)
+        {
+            return;
+        }
+
+        counters->next = g_threadCounters.load(::std::memory_order_relaxed);
+        while(!g_threadCounters.compare_exchange_weak(counters->next, counters, ::std::memory_order_release, ::std::memory_order_relaxed))
+        {
+        }
+    }
+
+    g_threadCountersOwner.counters = counters;
+
+#ifdef _WIN32
+    ::TlsSetValue(g_tlsIndex, counters);
+#else
+    g_threadCounts = counters;
+#endif
+}
+
+// What a call may still reach after the census stopped, kept per render type and reused by
+// its next census: a call past the patch still runs the stub, and nothing waits for it
+struct CensusCode
+{
+    ::std::uint32_t stride;    // counters per shard, whole cache lines
+    ::std::uint64_t* counters; // [Shards][stride], only ever grow
+
+    ::std::uint8_t* code; // the stubs, then the writable page of their originals
+    ::std::size_t codeSize;
+    ::std::size_t stubsSize;
+    void** originals;
+};
+
+CensusCode g_censusCode[static_cast<::std::size_t>(RenderType::Auto)] = { };
+
+struct Census
+{
+    RenderType renderType;
+    ::std::uint16_t methodsCount;
+    const char* const* names;
+
+    ::std::uint32_t stride;
+    ::std::uint64_t* counters;
+    ::std::uint64_t* baseline; // [methodsCount] what the counters held at the start
+
+    ::std::uint16_t* indices; // the bound slots, ascending
+    ::std::uint16_t count;
+
+    // Written by the presenting threads between two increments of sequence, an odd sequence
+    // is a write in progress and doubles as the writers' lock
+    ::std::uint32_t sequence;
+    ::std::uint64_t frames;
+    ::std::uint64_t* previous;  // [count] totals at the latest boundary
+    ::std::uint64_t* lastFrame; // [count]
+};
+
+// Serializes startCensus and stopCensus, the presenting threads only read g_census
+::std::mutex g_censusMutex;
+::std::atomic<Census*> g_census { nullptr };
+
+struct Names
+{
+    const char* const* names;
+    ::std::uint16_t count;
+};
+
+template<::std::size_t N>
+[[nodiscard]] constexpr Names makeNames(const char* const (&names)[N]) noexcept
+{
+    return { names, static_cast<::std::uint16_t>(N) };
+}
+
+[[nodiscard]] Names tableNames(const RenderType renderType) noexcept
+{
+    switch(renderType)
+    {
+    case RenderType::D3D9:
+        return makeNames(d3d9::Names);
+    case RenderType::D3D10:
+        return makeNames(d3d10::Names);
+    case RenderType::D3D11:
+        return makeNames(d3d11::Names);
+    case RenderType::D3D12:
+        return makeNames(d3d12::Names);
+    case RenderType::OpenGL:
+        return makeNames(opengl::Names);
+    case RenderType::Vulkan:
+        return makeNames(vulkan::Names);
+    default:
+        return { nullptr, 0 };
+    }
+}
+
+// Signature-free detour: any arguments pass through untouched since only r11, which no calling
+// convention passes arguments in, and the flags are clobbered
+//   mov r11, fs:[slot] / gs:[slot]    the thread's block, xor r11d, r11d without the TLS slot
+//   test r11, r11
+//   jz shared
+//   inc qword ptr [r11 + index * 8]
+//   jmp qword ptr [rip + originals[index]]
+// shared:
+//   mov r11, fs:[0] / gs:[0x30]       the thread pointer (SysV TCB / Windows TEB self pointer)
+//   imul r11, r11, 0x9E3779B1
+//   shr r11, 64 - ShardBits           the shard
+//   imul r11, r11, stride * 8
+//   add r11, qword ptr [rip + 11]     &counters[0][index]
+//   lock inc qword ptr [r11]
+//   jmp qword ptr [rip + originals[index]]
+void writeStub(::std::uint8_t* const code, const CensusCode& census, const ::std::uint16_t index, const bool tls, const ::std::int32_t slot) noexcept
+{
+    ::std::uint8_t stub[StubSize] = {
+#ifdef _WIN32
+        0x65, 0x4C, 0x8B, 0x1C, 0x25, 0, 0, 0, 0,
+#else
+        0x64, 0x4C, 0x8B, 0x1C, 0x25, 0, 0, 0, 0,
+#endif
+        0x4D, 0x85, 0xDB,
+        0x74, 0x0D,
+        0x49, 0xFF, 0x83, 0, 0, 0, 0,
+        0xFF, 0x25, 0, 0, 0, 0,
+#ifdef _WIN32
+        0x65, 0x4C, 0x8B, 0x1C, 0x25, 0x30, 0x00, 0x00, 0x00,
+#else
+        0x64, 0x4C, 0x8B, 0x1C, 0x25, 0x00, 0x00, 0x00, 0x00,
+#endif
+        0x4D, 0x69, 0xDB, 0xB1, 0x79, 0x37, 0x9E,
+        0x49, 0xC1, 0xEB, 64 - ShardBits,
+        0x4D, 0x69, 0xDB, 0, 0, 0, 0,
+        0x4C, 0x03, 0x1D, 11, 0, 0, 0,
+        0xF0, 0x49, 0xFF, 0x03,
+        0xFF, 0x25, 0, 0, 0, 0,
+        0xCC,
+    };
+
+    if(tls)
+    {
+        ::std::memcpy(stub + 5, &slot, sizeof(slot));
+    }
+    else
+    {
+        // xor r11d, r11d and a 6 byte nop
+        constexpr ::std::uint8_t clear[] = { 0x45, 0x31, 0xDB, 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00 };
+        ::std::memcpy(stub, clear, sizeof(clear));
+    }
+
+    const ::std::int32_t offset = static_cast<::std::int32_t>(index * sizeof(::std::uint64_t));
+    const ::std::uint32_t stride = census.stride * sizeof(::std::uint64_t);
+    const ::std::uint64_t counter = reinterpret_cast<::std::uintptr_t>(census.counters + index);
+
+    const ::std::intptr_t original = reinterpret_cast<::std::intptr_t>(census.originals + index);
+    const ::std::int32_t owned = static_cast<::std::int32_t>(original - reinterpret_cast<::std::intptr_t>(code + 27));
+    const ::std::int32_t shared = static_cast<::std::int32_t>(original - reinterpret_cast<::std::intptr_t>(code + 71));
+
+    ::std::memcpy(stub + 17, &offset, sizeof(offset));
+    ::std::memcpy(stub + 23, &owned, sizeof(owned));
+    ::std::memcpy(stub + 50, &stride, sizeof(stride));
+    ::std::memcpy(stub + 67, &shared, sizeof(shared));
+    ::std::memcpy(stub + 72, &counter, sizeof(counter));
+    ::std::memcpy(code, stub, StubSize);
+}
+
+[[nodiscard]] ::std::uint64_t threadCalls(const ::std::uint16_t index) noexcept
+{
+    ::std::uint64_t calls = 0;
+
+    for(ThreadCounters* record = g_threadCounters.load(::std::memory_order_acquire); record; record = record->next)
+    {
+        calls += ::std::atomic_ref<::std::uint64_t>(record->counts[index]).load(::std::memory_order_relaxed);
+    }
+
+    return calls;
+}
+
+[[nodiscard]] ::std::uint64_t countCalls(const Census& census, const ::std::uint16_t slot) noexcept
+{
+    ::std::uint64_t calls = 0;
+
+    for(::std::uint32_t shard = 0; shard < Shards; ++shard)
+    {
+        calls += ::std::atomic_ref<::std::uint64_t>(census.counters[shard * census.stride + slot]).load(::std::memory_order_relaxed);
+    }
+
+    return calls + threadCalls(slot);
+}
+
+// Allocates the stubs of a render type on its first census
+[[nodiscard]] const CensusCode* censusCode(const RenderType renderType, const ::std::uint16_t methodsCount) noexcept
+{
+    CensusCode& census = g_censusCode[static_cast<::std::size_t>(renderType)];
+    if(census.code)
+    {
+        return &census;
+    }
+
+    const ::std::uint32_t stride = (methodsCount + 7u) & ~7u;
+    const ::std::size_t stubsSize = (methodsCount * StubSize + CodePage - 1) & ~(CodePage - 1);
+    const ::std::size_t codeSize = stubsSize + ((methodsCount * sizeof(void*) + CodePage - 1) & ~(CodePage - 1));
+
+    const ::std::size_t countersSize = Shards * stride * sizeof(::std::uint64_t);
+    auto* const counters = static_cast<::std::uint64_t*>(::operator new[](countersSize, ::std::align_val_t { 64 }, ::std::nothrow));
+    if(!counters)
+    {
+        return nullptr;
+    }
+
+    // The stubs use absolute addresses for everything but their originals, any pages do
+    auto* const code = static_cast<::std::uint8_t*>(detail::allocateCode(reinterpret_cast<const void*>(&writeStub), codeSize));
+    if(!code)
+    {
+        ::operator delete[](counters, ::std::align_val_t { 64 });
+        return nullptr;
+    }
+
+    ::std::memset(counters, 0, countersSize);
+
+    census = { stride, counters, code, codeSize, stubsSize, reinterpret_cast<void**>(code + stubsSize) };
+
+    ::std::int32_t slot = 0;
+    const bool tls = threadSlot(slot);
+
+    for(::std::uint16_t i = 0; i < methodsCount; ++i)
+    {
+        writeStub(code + i * StubSize, census, i, tls, slot);
+    }
+
+    detail::sealCode(code, stubsSize);
+    return &census;
+}
+
+void destroyCensus(void* const pointer) noexcept
+{
+    auto* const census = static_cast<Census*>(pointer);
+
+    delete[] census->baseline;
+    delete[] census->indices;
+    delete[] census->previous;
+    delete[] census->lastFrame;
+    delete census;
+}
+
+void stopLocked() noexcept
+{
+    Census* const census = g_census.exchange(nullptr, ::std::memory_order_acq_rel);
+    if(!census)
+    {
+        return;
+    }
+
+    unbindMany(census->renderType, { census->indices, census->count });
+
+    // A frame boundary may still be aggregating
+    detail::retire(census, destroyCensus);
+}
+
+}
+
+Status startCensus(const RenderType renderType)
+{
+    const Names names = tableNames(renderType);
+    if(!names.names || !getMethodsTable(renderType))
+    {
+        return Status::NotInitializedError;
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_censusMutex);
+
+    stopLocked();
+
+    auto* census = new(::std::nothrow) Census { };
+    if(!census)
+    {
+        return Status::UnknownError;
+    }
+
+    census->renderType = renderType;
+    census->methodsCount = names.count;
+    census->names = names.names;
+    census->baseline = new(::std::nothrow) ::std::uint64_t[names.count];
+    census->indices = new(::std::nothrow) ::std::uint16_t[names.count];
+    census->previous = new(::std::nothrow) ::std::uint64_t[names.count]();
+    census->lastFrame = new(::std::nothrow) ::std::uint64_t[names.count]();
+
+    auto* bindings = new(::std::nothrow) Binding[names.count];
+
+    const CensusCode* const code = census->baseline && census->indices && census->previous && census->lastFrame && bindings
+        ? censusCode(renderType, names.count) : nullptr;
+
+    if(!code)
+    {
+        delete[] bindings;
+        destroyCensus(census);
+        return Status::UnknownError;
+    }
+
+    census->stride = code->stride;
+    census->counters = code->counters;
+
+    // No stub of this census runs yet, the counters of earlier ones and the blocks of threads
+    // that presented before keep counting from here
+    for(::std::uint16_t i = 0; i < names.count; ++i)
+    {
+        census->baseline[i] = countCalls(*census, i);
+        bindings[i] = { i, code->originals + i, code->code + i * StubSize, Status::Success };
+    }
+
+    // Slots bound already, unresolved ones and functions shared with an earlier slot fail and
+    // stay uncounted
+    (void) bindMany(renderType, { bindings, names.count });
+
+    for(::std::uint16_t i = 0; i < names.count; ++i)
+    {
+        if(bindings[i].status == Status::Success)
+        {
+            census->indices[census->count++] = i;
+        }
+    }
+
+    delete[] bindings;
+
+    if(census->count == 0)
+    {
+        destroyCensus(census);
+        return Status::UnknownError;
+    }
+
+    g_census.store(census, ::std::memory_order_release);
+    return Status::Success;
+}
+
+Status startCensus()
+{
+    return startCensus(getRenderType());
+}
+
+void stopCensus()
+{
+    const ::std::lock_guard<::std::mutex> lock(g_censusMutex);
+    stopLocked();
+}
+
+::std::size_t getCensus(const ::std::span<CensusEntry> entries, ::std::uint64_t* const frames)
+{
+    if(frames)
+    {
+        *frames = 0;
+    }
+
+    // Keeps stopCensus from freeing the census under the copy
+    const ::std::lock_guard<::std::mutex> lock(g_censusMutex);
+
+    const Census* const census = g_census.load(::std::memory_order_acquire);
+    if(!census)
+    {
+        return 0;
+    }
+
+    const ::std::size_t copied = entries.size() < census->count ? entries.size() : census->count;
+
+    using Word = ::std::atomic_ref<const ::std::uint32_t>;
+    using Count = ::std::atomic_ref<const ::std::uint64_t>;
+
+    for(;;)
+    {
+        const ::std::uint32_t begin = Word(census->sequence).load(::std::memory_order_acquire);
+        if(begin & 1)
+        {
+            ::std::this_thread::yield();
+            continue;
+        }
+
+        for(::std::size_t i = 0; i < copied; ++i)
+        {
+            entries[i].lastFrame = Count(census->lastFrame[i]).load(::std::memory_order_relaxed);
+        }
+
+        if(frames)
+        {
+            *frames = Count(census->frames).load(::std::memory_order_relaxed);
+        }
+
+        ::std::atomic_thread_fence(::std::memory_order_acquire);
+        if(Word(census->sequence).load(::std::memory_order_relaxed) == begin)
+        {
+            break;
+        }
+    }
+
+    for(::std::size_t i = 0; i < copied; ++i)
+    {
+        const ::std::uint16_t index = census->indices[i];
+
+        entries[i].index = index;
+        entries[i].name = census->names[index];
+        entries[i].total = countCalls(*census, index) - census->baseline[index];
+    }
+
+    return census->count;
+}
+
+namespace detail
+{
+
+void recordCensusFrame() noexcept
+{
+    if(!g_census.load(::std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // stopCensus retires the census
+    const EpochGuard guard;
+    if(!guard)
+    {
+        return;
+    }
+
+    Census* const census = g_census.load(::std::memory_order_acquire);
+    if(!census)
+    {
+        return;
+    }
+
+    // The presenting thread issues most of the calls, from now on without a locked increment
+    attachThread();
+
+    // Threads presenting at once take turns
+    ::std::atomic_ref<::std::uint32_t> sequence(census->sequence);
+    ::std::uint32_t begin = sequence.load(::std::memory_order_relaxed);
+
+    while((begin & 1) || !sequence.compare_exchange_weak(begin, begin + 1, ::std::memory_order_relaxed))
+    {
+        if(begin & 1)
+        {
+            ::std::this_thread::yield();
+            begin = sequence.load(::std::memory_order_relaxed);
+        }
+    }
+
+    // Orders the odd sequence before the fields, and the previous writer's fields before ours
+    ::std::atomic_thread_fence(::std::memory_order_acq_rel);
+
+    for(::std::uint16_t i = 0; i < census->count; ++i)
+    {
+        const ::std::uint64_t total = countCalls(*census, census->indices[i]) - census->baseline[census->indices[i]];
+
+        // previous is read by copyCensusCalls too
+        ::std::atomic_ref<::std::uint64_t>(census->lastFrame[i]).store(total - census->previous[i], ::std::memory_order_relaxed);
+        ::std::atomic_ref<::std::uint64_t>(census->previous[i]).store(total, ::std::memory_order_relaxed);
+    }
+
+    ::std::atomic_ref<::std::uint64_t> frames(census->frames);
+    frames.store(frames.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+
+    sequence.store(begin + 2, ::std::memory_order_release);
+}
+
+::std::uint32_t copyCensusCalls(::std::uint64_t* const calls, const ::std::uint32_t capacity) noexcept
+{
+    if(!g_census.load(::std::memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    const EpochGuard guard;
+    if(!guard)
+    {
+        return 0;
+    }
+
+    const Census* const census = g_census.load(::std::memory_order_acquire);
+    if(!census)
+    {
+        return 0;
+    }
+
+    const ::std::uint32_t slots = census->methodsCount < capacity ? census->methodsCount : capacity;
+
+    ::std::uint16_t counted = 0;
+    for(::std::uint32_t slot = 0; slot < slots; ++slot)
+    {
+        ::std::uint64_t total = 0;
+        if(counted < census->count && census->indices[counted] == slot)
+        {
+            total = ::std::atomic_ref<const ::std::uint64_t>(census->previous[counted++]).load(::std::memory_order_relaxed);
+        }
+
+        // calls is shared memory that other processes read while it is written
+        ::std::atomic_ref<::std::uint64_t>(calls[slot]).store(total, ::std::memory_order_relaxed);
+    }
+
+    return slots;
+}
+
+}
+
+#else
+
+Status startCensus(const RenderType)
+{
+    return Status::NotSupportedError;
+}
+
+Status startCensus()
+{
+    return Status::NotSupportedError;
+}
+
+void stopCensus()
+{
+}
+
+::std::size_t getCensus(const ::std::span<CensusEntry>, ::std::uint64_t* const frames)
+{
+    if(frames)
+    {
+        *frames = 0;
+    }
+
+    return 0;
+}
+
+namespace detail
+{
+
+void recordCensusFrame() noexcept
+{
+}
+
+::std::uint32_t copyCensusCalls(::std::uint64_t* const, const ::std::uint32_t) noexcept
+{
+    return 0;
+}
+
+}
+
+#endif
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace kiero
+{
+	struct CensusEntry
+	{
+		::std::uint16_t index;
+		const char* name;          // from METHODSTABLE.txt, COM methods with their interface
+		::std::uint64_t lastFrame; // calls between the two latest frame boundaries
+		::std::uint64_t total;     // calls since startCensus
+	};
+
+	// Counts the calls of every method of the primary backend's table, or the given one's,
+	// without writing a detour for any of them: each resolved slot that is not bound yet is
+	// bound to a counting stub generated at runtime, which bumps its counter and jumps on to
+	// the original. A thread that passed a frame boundary counts into counters of its own, about
+	// a nanosecond per call, the others into shards shared by thread pointer hash with a locked
+	// increment. Every outermost FrameScope (kiero_frame.h) closes a frame of the census. Bind
+	// your own hooks first, the slots the census holds cannot be bound until stopCensus. The
+	// stubs follow the hook mode, a census of HookMode::ImportTable costs no entry gate but
+	// stopCensus can then not wait for a call still inside a stub. A single census at a time,
+	// starting again replaces it. x86-64 only, must not be called from a detour.
+	Status startCensus();
+	Status startCensus(const RenderType renderType);
+
+	// Unbinds the stubs and drops the counts, without waiting for the calls still inside them.
+	// Must not be called from a detour.
+	void stopCensus();
+
+	// Copies the counted slots in index order, as many as entries holds. Returns the number of
+	// counted slots, 0 without a census. frames receives the frame boundaries since startCensus.
+	// Any thread may call it, the counting threads never wait for it.
+	::std::size_t getCensus(const ::std::span<CensusEntry> entries, ::std::uint64_t* const frames = nullptr);
+
+	namespace detail
+	{
+		// Called by the outermost FrameScope of a thread, moves the counts since the previous
+		// boundary into CensusEntry::lastFrame
+		void recordCensusFrame() noexcept;
+
+		// Called by publishPresent, stores the totals of the latest boundary into calls by slot
+		// index, 0 for the slots not counted. Returns the methods count of the census' render
+		// type, at most capacity, 0 without a census.
+		::std::uint32_t copyCensusCalls(::std::uint64_t* const calls, const ::std::uint32_t capacity) noexcept;
+	}
+}
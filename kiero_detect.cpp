@@ -0,0 +1,272 @@
+#include "kiero.h"
+#include "kiero_detour.h"
+#include "kiero_methods.h"
+#include "kiero_trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <thread>
+
+namespace kiero
+{
+
+#if KIERO_DETOUR_SUPPORTED
+
+namespace
+{
+
+// Frames a backend has to present before it is picked without waiting for the timeout
+constexpr ::std::uint64_t DetectFrames = 3;
+
+constexpr RenderType g_detectOrder[] = {
+    RenderType::D3D9, RenderType::D3D10, RenderType::D3D11, RenderType::D3D12, RenderType::OpenGL, RenderType::Vulkan,
+};
+
+struct Boundary
+{
+    RenderType renderType;
+    ::std::uint16_t index;
+};
+
+// The calls kiero_frame.h's isFrameBoundary lists
+static_assert(opengl::MethodsCount - opengl::SwapBuffers::Offset == 2, "g_boundaries misses an OpenGL swap function");
+
+constexpr Boundary g_boundaries[] = {
+    { RenderType::D3D9, d3d9::IDirect3DDevice9::Present::index },
+    { RenderType::D3D9, d3d9::IDirect3DDevice9::EndScene::index },
+    { RenderType::D3D10, d3d10::IDXGISwapChain::Present::index },
+    { RenderType::D3D11, d3d11::IDXGISwapChain::Present::index },
+    { RenderType::D3D12, d3d12::IDXGISwapChain::Present::index },
+    { RenderType::OpenGL, opengl::SwapBuffers::Offset },
+    { RenderType::OpenGL, opengl::SwapBuffers::Offset + 1 },
+    { RenderType::Vulkan, vulkan::vkQueuePresentKHR::index },
+};
+
+constexpr ::std::size_t BoundariesCount = ::std::size(g_boundaries);
+
+// Read by the probe's stub, which counts the call and jumps on to original
+struct Probe
+{
+    ::std::uint64_t calls;
+    void* original;
+    bool bound;
+};
+
+// Signature-free detour: any arguments pass through untouched since only r11, which no calling
+// convention passes arguments in, is clobbered
+//   mov r11, &probe.calls
+//   lock inc qword ptr [r11]
+//   mov r11, &probe.original
+//   jmp qword ptr [r11]
+constexpr ::std::size_t StubSize = 32;
+
+void writeStub(::std::uint8_t* const code, Probe& probe) noexcept
+{
+    const ::std::uint64_t calls = reinterpret_cast<::std::uintptr_t>(&probe.calls);
+    const ::std::uint64_t original = reinterpret_cast<::std::uintptr_t>(&probe.original);
+
+    ::std::uint8_t stub[StubSize] = {
+        0x49, 0xBB, 0, 0, 0, 0, 0, 0, 0, 0,
+        0xF0, 0x49, 0xFF, 0x03,
+        0x49, 0xBB, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x41, 0xFF, 0x23,
+        0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    };
+
+    ::std::memcpy(stub + 2, &calls, sizeof(calls));
+    ::std::memcpy(stub + 16, &original, sizeof(original));
+    ::std::memcpy(code, stub, StubSize);
+}
+
+// Kept and reused by the next detection: a call past the patch may still run a stub, and
+// nothing waits for it
+Probe g_probes[BoundariesCount];
+::std::uint8_t* g_probeCode = nullptr;
+
+[[nodiscard]] ::std::size_t orderIndex(const RenderType renderType) noexcept
+{
+    ::std::size_t i = 0;
+    while(g_detectOrder[i] != renderType)
+    {
+        ++i;
+    }
+
+    return i;
+}
+
+}
+
+Status initDetect(const ::std::uint32_t timeoutMilliseconds, RenderType* const detected)
+{
+    KIERO_TRACE_SPAN(Init, "initDetect");
+
+    constexpr ::std::size_t TypesCount = ::std::size(g_detectOrder);
+
+    if(detected)
+    {
+        *detected = RenderType::None;
+    }
+
+    if(getRenderType() != RenderType::None)
+    {
+        return Status::AlreadyInitializedError;
+    }
+
+    bool initialized[TypesCount] = { };
+    bool any = false;
+    Status status = Status::NotSupportedError;
+
+    const auto shutdownAllBut = [&initialized](const RenderType kept)
+    {
+        for(::std::size_t i = 0; i < TypesCount; ++i)
+        {
+            if(initialized[i] && g_detectOrder[i] != kept)
+            {
+                shutdown(g_detectOrder[i]);
+            }
+        }
+    };
+
+    // Lazily, only the groups of the boundaries get built
+    for(::std::size_t i = 0; i < TypesCount; ++i)
+    {
+        const Status result = init(g_detectOrder[i], InitMode::Lazy);
+        if(result == Status::AlreadyInitializedError)
+        {
+            shutdownAllBut(RenderType::None);
+            return result;
+        }
+
+        initialized[i] = result == Status::Success;
+        any |= initialized[i];
+
+        if(result != Status::Success && result != Status::ModuleNotFoundError && status == Status::NotSupportedError)
+        {
+            status = result;
+        }
+    }
+
+    if(!any)
+    {
+        return status;
+    }
+
+    if(!g_probeCode)
+    {
+        // The stubs use absolute addresses, any free pages do. Near our own code there are some
+        // even where sanitizers reserve most of the address space around the heap.
+        auto* const code = static_cast<::std::uint8_t*>(detail::allocateCode(reinterpret_cast<const void*>(&writeStub), BoundariesCount * StubSize));
+        if(!code)
+        {
+            shutdownAllBut(RenderType::None);
+            return Status::UnknownError;
+        }
+
+        for(::std::size_t i = 0; i < BoundariesCount; ++i)
+        {
+            writeStub(code + i * StubSize, g_probes[i]);
+        }
+
+        detail::sealCode(code, BoundariesCount * StubSize);
+        g_probeCode = code;
+    }
+
+    Probe* const probes = g_probes;
+    ::std::uint8_t* const code = g_probeCode;
+
+    for(::std::size_t i = 0; i < BoundariesCount; ++i)
+    {
+        ::std::atomic_ref<::std::uint64_t>(probes[i].calls).store(0, ::std::memory_order_relaxed);
+        probes[i].bound = false;
+    }
+
+    // A boundary its runtime does not export, or one shared with a backend earlier in the
+    // order, stays unbound
+    for(::std::size_t i = 0; i < BoundariesCount; ++i)
+    {
+        const Boundary& boundary = g_boundaries[i];
+        if(initialized[orderIndex(boundary.renderType)])
+        {
+            probes[i].bound = bind(boundary.renderType, boundary.index, &probes[i].original, code + i * StubSize) == Status::Success;
+        }
+    }
+
+    const auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::milliseconds(timeoutMilliseconds);
+    RenderType winner = RenderType::None;
+
+    for(;;)
+    {
+        ::std::uint64_t frames[TypesCount] = { };
+        for(::std::size_t i = 0; i < BoundariesCount; ++i)
+        {
+            frames[orderIndex(g_boundaries[i].renderType)] += ::std::atomic_ref<::std::uint64_t>(probes[i].calls).load(::std::memory_order_relaxed);
+        }
+
+        const bool expired = ::std::chrono::steady_clock::now() >= deadline;
+        ::std::uint64_t most = 0;
+
+        for(::std::size_t i = 0; i < TypesCount; ++i)
+        {
+            if(expired ? frames[i] > most : frames[i] >= DetectFrames)
+            {
+                winner = g_detectOrder[i];
+                most = frames[i];
+
+                if(!expired)
+                {
+                    break;
+                }
+            }
+        }
+
+        if(winner != RenderType::None || expired)
+        {
+            break;
+        }
+
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+    }
+
+    for(::std::size_t i = 0; i < BoundariesCount; ++i)
+    {
+        if(probes[i].bound)
+        {
+            unbind(g_boundaries[i].renderType, g_boundaries[i].index);
+        }
+    }
+
+    shutdownAllBut(winner);
+
+    if(winner == RenderType::None)
+    {
+        return Status::TimeoutError;
+    }
+
+    if(detected)
+    {
+        *detected = winner;
+    }
+
+    return Status::Success;
+}
+
+#else
+
+Status initDetect(const ::std::uint32_t, RenderType* const detected)
+{
+    if(detected)
+    {
+        *detected = RenderType::None;
+    }
+
+    return Status::NotSupportedError;
+}
+
+#endif
+
+}
@@ -0,0 +1,2939 @@
+#include "kiero_detour.h"
+#include "kiero_trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# include <Windows.h>
+# include <TlHelp32.h>
+# include <intrin.h>
+#else
+# include <cerrno>
+# include <csignal>
+# include <fcntl.h>
+# include <sched.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# ifdef __linux__
+#  include <link.h>
+#  include <linux/futex.h>
+#  include <linux/memfd.h>
+#  include <ucontext.h>
+# endif
+#endif
+
+namespace kiero::detail
+{
+
+bool decode(const void* const code, Instruction& instruction) noexcept
+{
+    const auto* const start = static_cast<const ::std::uint8_t*>(code);
+    const ::std::uint8_t* p = start;
+
+    bool operandSize16 = false;
+    bool addressSize32 = false;
+    bool rex = false;
+    bool rexW = false;
+
+    for(;; ++p)
+    {
+        if(*p == 0x66)
+        {
+            operandSize16 = true;
+        }
+        else if(*p == 0x67)
+        {
+            addressSize32 = true;
+        }
+        else if(*p != 0xF0 && *p != 0xF2 && *p != 0xF3 && *p != 0x26 && *p != 0x2E && *p != 0x36 && *p != 0x3E && *p != 0x64 && *p != 0x65)
+        {
+            break;
+        }
+
+        if(p - start >= 14)
+        {
+            return false;
+        }
+    }
+
+    if((*p & 0xF0) == 0x40)
+    {
+        rex = true;
+        rexW = (*p & 0x08) != 0;
+        ++p;
+    }
+
+    // 0 = one byte map, 1 = 0F, 2 = 0F 38, 3 = 0F 3A
+    ::std::uint8_t map = 0;
+    bool vex = false;
+
+    if(*p == 0xC4 || *p == 0xC5 || *p == 0x62)
+    {
+        // VEX and EVEX, all of them carry a ModRM byte
+        if(*p == 0xC5)
+        {
+            map = 1;
+            p += 2;
+        }
+        else if(*p == 0xC4)
+        {
+            map = p[1] & 0x1F;
+            rexW = (p[2] & 0x80) != 0;
+            p += 3;
+        }
+        else
+        {
+            map = p[1] & 0x07;
+            rexW = (p[2] & 0x80) != 0;
+            p += 4;
+        }
+
+        if(map < 1 || map > 3)
+        {
+            return false;
+        }
+
+        vex = true;
+    }
+    else if(*p == 0x0F)
+    {
+        ++p;
+
+        if(*p == 0x38)
+        {
+            map = 2;
+            ++p;
+        }
+        else if(*p == 0x3A)
+        {
+            map = 3;
+            ++p;
+        }
+        else
+        {
+            map = 1;
+        }
+    }
+
+    const ::std::uint8_t opcode = *p++;
+    const ::std::size_t immZ = operandSize16 ? 2 : 4;
+
+    Instruction result;
+    result.opcode = opcode;
+
+    bool hasModRM = false;
+    ::std::size_t immediate = 0;
+
+    if(map == 0)
+    {
+        if(opcode < 0x40)
+        {
+            switch(opcode & 0x07)
+            {
+            case 0: case 1: case 2: case 3:
+                hasModRM = true;
+                break;
+            case 4:
+                immediate = 1;
+                break;
+            case 5:
+                immediate = immZ;
+                break;
+            default:
+                return false; // push/pop segment, BCD adjust and escapes
+            }
+        }
+        else if(opcode < 0x50)
+        {
+            return false; // a second REX prefix
+        }
+        else if(opcode < 0x60)
+        {
+        }
+        else if(opcode < 0x70)
+        {
+            switch(opcode)
+            {
+            case 0x63:
+                hasModRM = true;
+                break;
+            case 0x68:
+                immediate = immZ;
+                break;
+            case 0x69:
+                hasModRM = true;
+                immediate = immZ;
+                break;
+            case 0x6A:
+                immediate = 1;
+                break;
+            case 0x6B:
+                hasModRM = true;
+                immediate = 1;
+                break;
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+                break;
+            default:
+                return false;
+            }
+        }
+        else if(opcode < 0x80)
+        {
+            result.kind = InstructionKind::Jcc;
+            immediate = 1;
+        }
+        else if(opcode < 0x90)
+        {
+            if(opcode == 0x82)
+            {
+                return false;
+            }
+
+            hasModRM = true;
+            immediate = opcode == 0x81 ? immZ : (opcode == 0x80 || opcode == 0x83) ? 1 : 0;
+        }
+        else if(opcode < 0xA0)
+        {
+            if(opcode == 0x9A)
+            {
+                return false;
+            }
+
+            if(opcode == 0x90 && !rex)
+            {
+                result.kind = InstructionKind::Nop;
+            }
+        }
+        else if(opcode < 0xB0)
+        {
+            if(opcode <= 0xA3)
+            {
+                immediate = addressSize32 ? 4 : 8;
+            }
+            else if(opcode == 0xA8)
+            {
+                immediate = 1;
+            }
+            else if(opcode == 0xA9)
+            {
+                immediate = immZ;
+            }
+        }
+        else if(opcode < 0xC0)
+        {
+            immediate = opcode < 0xB8 ? 1 : rexW ? 8 : immZ;
+        }
+        else
+        {
+            switch(opcode)
+            {
+            case 0xC0: case 0xC1: case 0xC6:
+                hasModRM = true;
+                immediate = 1;
+                break;
+            case 0xC7:
+                if(p[0] == 0xF8)
+                {
+                    return false; // xbegin, relative fallback address
+                }
+
+                hasModRM = true;
+                immediate = immZ;
+                break;
+            case 0xC2: case 0xCA:
+                result.kind = InstructionKind::Return;
+                immediate = 2;
+                break;
+            case 0xC3: case 0xCB: case 0xCF:
+                result.kind = InstructionKind::Return;
+                break;
+            case 0xC8:
+                immediate = 3;
+                break;
+            case 0xC9:
+                break;
+            case 0xCC:
+                result.kind = InstructionKind::Nop;
+                break;
+            case 0xCD:
+                immediate = 1;
+                break;
+            case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+            case 0xD8: case 0xD9: case 0xDA: case 0xDB: case 0xDC: case 0xDD: case 0xDE: case 0xDF:
+                hasModRM = true;
+                break;
+            case 0xD7:
+                break;
+            case 0xE0: case 0xE1: case 0xE2: case 0xE3:
+                result.kind = InstructionKind::Loop;
+                immediate = 1;
+                break;
+            case 0xE4: case 0xE5: case 0xE6: case 0xE7:
+                immediate = 1;
+                break;
+            case 0xE8:
+                result.kind = InstructionKind::Call;
+                immediate = 4;
+                break;
+            case 0xE9:
+                result.kind = InstructionKind::Jmp;
+                immediate = 4;
+                break;
+            case 0xEB:
+                result.kind = InstructionKind::Jmp;
+                immediate = 1;
+                break;
+            case 0xEC: case 0xED: case 0xEE: case 0xEF:
+            case 0xF1: case 0xF4: case 0xF5:
+            case 0xF8: case 0xF9: case 0xFA: case 0xFB: case 0xFC: case 0xFD:
+                break;
+            case 0xF6: case 0xF7: case 0xFE: case 0xFF:
+                hasModRM = true;
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    else if(map == 1)
+    {
+        if(vex)
+        {
+            hasModRM = opcode != 0x77;
+            immediate = ((opcode >= 0x70 && opcode <= 0x73) || opcode == 0xC2 || (opcode >= 0xC4 && opcode <= 0xC6)) ? 1 : 0;
+        }
+        else if(opcode >= 0x80 && opcode <= 0x8F)
+        {
+            result.kind = InstructionKind::Jcc;
+            immediate = 4;
+        }
+        else
+        {
+            switch(opcode)
+            {
+            case 0x04: case 0x0A: case 0x0C: case 0x24: case 0x25: case 0x26: case 0x27:
+            case 0x39: case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F:
+            case 0x7A: case 0x7B: case 0xA6: case 0xA7:
+                return false;
+            case 0x05: case 0x06: case 0x07: case 0x08: case 0x09: case 0x0B: case 0x0E:
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x77: case 0xA0: case 0xA1: case 0xA2: case 0xA8: case 0xA9: case 0xAA:
+            case 0xC8: case 0xC9: case 0xCA: case 0xCB: case 0xCC: case 0xCD: case 0xCE: case 0xCF:
+                break;
+            case 0x0F: case 0x70: case 0x71: case 0x72: case 0x73: case 0xA4: case 0xAC:
+            case 0xBA: case 0xC2: case 0xC4: case 0xC5: case 0xC6:
+                hasModRM = true;
+                immediate = 1;
+                break;
+            case 0x1F:
+                hasModRM = true;
+                result.kind = InstructionKind::Nop;
+                break;
+            default:
+                hasModRM = true;
+                break;
+            }
+        }
+    }
+    else
+    {
+        hasModRM = true;
+        immediate = map == 3 ? 1 : 0;
+    }
+
+    if(hasModRM)
+    {
+        const ::std::uint8_t modrm = *p++;
+        const ::std::uint8_t mod = modrm >> 6;
+        const ::std::uint8_t reg = (modrm >> 3) & 0x07;
+        const ::std::uint8_t rm = modrm & 0x07;
+
+        if(mod != 3)
+        {
+            if(rm == 4)
+            {
+                const ::std::uint8_t sib = *p++;
+                if(mod == 0 && (sib & 0x07) == 5)
+                {
+                    p += 4;
+                }
+            }
+            else if(mod == 0 && rm == 5)
+            {
+                result.dispOffset = static_cast<::std::uint8_t>(p - start);
+                p += 4;
+            }
+
+            if(mod == 1)
+            {
+                p += 1;
+            }
+            else if(mod == 2)
+            {
+                p += 4;
+            }
+        }
+
+        if(map == 0)
+        {
+            if(opcode == 0xF6 && reg < 2)
+            {
+                immediate = 1;
+            }
+            else if(opcode == 0xF7 && reg < 2)
+            {
+                immediate = immZ;
+            }
+            else if(opcode == 0xFF && (reg == 4 || reg == 5))
+            {
+                result.kind = InstructionKind::Indirect;
+            }
+        }
+    }
+
+    p += immediate;
+
+    const ::std::ptrdiff_t length = p - start;
+    if(length > 15)
+    {
+        return false;
+    }
+
+    result.length = static_cast<::std::uint8_t>(length);
+
+    if(result.kind == InstructionKind::Jmp || result.kind == InstructionKind::Jcc || result.kind == InstructionKind::Call || result.kind == InstructionKind::Loop)
+    {
+        ::std::intptr_t displacement;
+        if(immediate == 1)
+        {
+            displacement = static_cast<::std::int8_t>(p[-1]);
+        }
+        else
+        {
+            ::std::int32_t value;
+            (void) ::std::memcpy(&value, p - 4, sizeof(value));
+            displacement = value;
+        }
+
+        result.branchTarget = reinterpret_cast<::std::intptr_t>(p) + displacement;
+    }
+
+    instruction = result;
+    return true;
+}
+
+#ifndef _WIN32
+
+bool forEachMapping(const MappingCallback callback, void* const context) noexcept
+{
+    const int file = ::open("/proc/self/maps", O_RDONLY | O_CLOEXEC);
+    if(file < 0)
+    {
+        return false;
+    }
+
+    const auto parseHex = [](const char* p, const char* const end, ::std::uintptr_t& value)
+    {
+        value = 0;
+        for(; p < end && ((*p >= '0' && *p <= '9') || ((*p | 0x20) >= 'a' && (*p | 0x20) <= 'f')); ++p)
+        {
+            value = (value << 4) | static_cast<::std::uintptr_t>(*p <= '9' ? *p - '0' : (*p | 0x20) - 'a' + 10);
+        }
+
+        return p;
+    };
+
+    char buffer[4096];
+    ::std::size_t used = 0;
+    bool done = false;
+    bool stopped = false;
+
+    while(!done && !stopped)
+    {
+        const ::ssize_t count = ::read(file, buffer + used, sizeof(buffer) - used);
+        done = count <= 0;
+        used += count > 0 ? static_cast<::std::size_t>(count) : 0;
+
+        ::std::size_t lineStart = 0;
+        for(::std::size_t i = 0; i < used && !stopped; ++i)
+        {
+            if(buffer[i] != '\n' && !(done && i + 1 == used))
+            {
+                continue;
+            }
+
+            // "start-end perms offset dev inode path"
+            const char* const end = buffer + i;
+            Mapping mapping { };
+
+            const char* p = parseHex(buffer + lineStart, end, mapping.start);
+            p = parseHex(p + 1, end, mapping.end);
+
+            if(p + 4 < end)
+            {
+                mapping.readable = p[1] == 'r';
+                mapping.writable = p[2] == 'w';
+                mapping.executable = p[3] == 'x';
+            }
+
+            if(mapping.end > mapping.start)
+            {
+                stopped = !callback(context, mapping);
+            }
+
+            lineStart = i + 1;
+        }
+
+        if(lineStart == 0 && used == sizeof(buffer))
+        {
+            lineStart = used; // a line longer than the buffer, skip it
+        }
+
+        used -= lineStart;
+        (void) ::std::memmove(buffer, buffer + lineStart, used);
+    }
+
+    ::close(file);
+    return true;
+}
+
+#endif
+
+#if KIERO_DETOUR_SUPPORTED
+
+namespace
+{
+
+// Keep a little slack so a whole trampoline stays inside rel32 reach
+constexpr ::std::intptr_t NearRange = 0x7FFF0000;
+
+[[nodiscard]] bool fitsRel32(const ::std::intptr_t value) noexcept
+{
+    return value >= INT32_MIN && value <= INT32_MAX;
+}
+
+[[nodiscard]] ::std::size_t pageSize() noexcept
+{
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+    return systemInfo.dwPageSize;
+#else
+    return static_cast<::std::size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+#ifdef _WIN32
+
+// Calls place with the free allocation granules closest to near until it maps one
+template<typename Place>
+void* placeNear(const void* const near, const ::std::size_t size, const Place& place) noexcept
+{
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+
+    const ::std::uintptr_t granularity = systemInfo.dwAllocationGranularity;
+    const ::std::uintptr_t origin = reinterpret_cast<::std::uintptr_t>(near);
+    const ::std::uintptr_t lowest = reinterpret_cast<::std::uintptr_t>(systemInfo.lpMinimumApplicationAddress);
+    const ::std::uintptr_t highest = reinterpret_cast<::std::uintptr_t>(systemInfo.lpMaximumApplicationAddress);
+
+    const ::std::uintptr_t minAddress = origin > lowest + NearRange ? origin - NearRange : lowest;
+    const ::std::uintptr_t maxAddress = origin < highest - NearRange ? origin + NearRange : highest;
+
+    MEMORY_BASIC_INFORMATION info;
+
+    // Search downwards first, the module itself usually follows its own image
+    for(::std::uintptr_t address = (origin & ~(granularity - 1)) - granularity; address >= minAddress && address < origin; )
+    {
+        if(!::VirtualQuery(reinterpret_cast<void*>(address), &info, sizeof(info)))
+        {
+            break;
+        }
+
+        if(info.State == MEM_FREE)
+        {
+            void* const memory = place(reinterpret_cast<void*>(address));
+            if(memory)
+            {
+                return memory;
+            }
+        }
+
+        const ::std::uintptr_t base = reinterpret_cast<::std::uintptr_t>(info.AllocationBase ? info.AllocationBase : info.BaseAddress);
+        address = ((base < address ? base : address) & ~(granularity - 1)) - granularity;
+    }
+
+    for(::std::uintptr_t address = (origin & ~(granularity - 1)) + granularity; address + size <= maxAddress; )
+    {
+        if(!::VirtualQuery(reinterpret_cast<void*>(address), &info, sizeof(info)))
+        {
+            break;
+        }
+
+        if(info.State == MEM_FREE)
+        {
+            void* const memory = place(reinterpret_cast<void*>(address));
+            if(memory)
+            {
+                return memory;
+            }
+        }
+
+        address = (reinterpret_cast<::std::uintptr_t>(info.BaseAddress) + info.RegionSize + granularity - 1) & ~(granularity - 1);
+    }
+
+    return nullptr;
+}
+
+void* allocateNear(const void* const near, const ::std::size_t size) noexcept
+{
+    return placeNear(near, size, [size](void* const address)
+    {
+        return ::VirtualAlloc(address, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    });
+}
+
+void releaseNear(void* const memory, const ::std::size_t) noexcept
+{
+    ::VirtualFree(memory, 0, MEM_RELEASE);
+}
+
+// An r-x view of a fresh section within rel32 reach of near, whose last writableTail bytes are
+// rw- instead, and a writable alias of the section anywhere: code other threads may run is
+// written through the alias, no page is ever writable and executable at once. A view only
+// becomes writable when mapped so, its code part is sealed before anything is written to it.
+void* allocateAliased(const void* const near, const ::std::size_t size, const ::std::size_t writableTail, void*& alias) noexcept
+{
+    const HANDLE section = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_EXECUTE_READWRITE, 0, static_cast<DWORD>(size), nullptr);
+    if(!section)
+    {
+        return nullptr;
+    }
+
+    const DWORD access = writableTail ? FILE_MAP_WRITE | FILE_MAP_EXECUTE : FILE_MAP_READ | FILE_MAP_EXECUTE;
+
+    alias = ::MapViewOfFile(section, FILE_MAP_WRITE, 0, 0, size);
+    void* code = alias ? placeNear(near, size, [section, access, size](void* const address)
+    {
+        return ::MapViewOfFileEx(section, access, 0, 0, size, address);
+    }) : nullptr;
+
+    ::CloseHandle(section);
+
+    DWORD oldProtection;
+    if(code && writableTail && (!::VirtualProtect(code, size - writableTail, PAGE_EXECUTE_READ, &oldProtection)
+        || !::VirtualProtect(static_cast<::std::uint8_t*>(code) + size - writableTail, writableTail, PAGE_READWRITE, &oldProtection)))
+    {
+        ::UnmapViewOfFile(code);
+        code = nullptr;
+    }
+
+    if(!code && alias)
+    {
+        ::UnmapViewOfFile(alias);
+        alias = nullptr;
+    }
+
+    return code;
+}
+
+void releaseAliased(void* const code, void* const alias, const ::std::size_t) noexcept
+{
+    ::UnmapViewOfFile(code);
+    ::UnmapViewOfFile(alias);
+}
+
+#else
+
+struct NearGap
+{
+    ::std::uintptr_t origin;
+    ::std::uintptr_t size;
+    ::std::uintptr_t page;
+    ::std::uintptr_t minAddress;
+    ::std::uintptr_t maxAddress;
+
+    ::std::uintptr_t previousEnd = 0;
+    ::std::uintptr_t best = 0;
+    ::std::uintptr_t bestDistance = UINTPTR_MAX;
+
+    void consider(::std::uintptr_t gapStart, ::std::uintptr_t gapEnd) noexcept
+    {
+        gapStart = gapStart < minAddress ? minAddress : gapStart;
+        gapEnd = gapEnd > maxAddress ? maxAddress : gapEnd;
+        gapStart = (gapStart + page - 1) & ~(page - 1);
+        gapEnd &= ~(page - 1);
+
+        if(gapStart >= gapEnd || gapEnd - gapStart < size)
+        {
+            return;
+        }
+
+        const ::std::uintptr_t candidate = gapEnd <= origin ? gapEnd - size : gapStart;
+        const ::std::uintptr_t distance = candidate < origin ? origin - candidate : candidate - origin;
+
+        if(distance < bestDistance)
+        {
+            best = candidate;
+            bestDistance = distance;
+        }
+    }
+};
+
+// Finds the free gap closest to origin
+::std::uintptr_t findNearGap(const ::std::uintptr_t origin, const ::std::size_t size, const ::std::uintptr_t page) noexcept
+{
+    NearGap gap { origin, size, page, origin > NearRange + page * 16 ? origin - NearRange : page * 16, origin + NearRange };
+
+    const bool scanned = forEachMapping([](void* const context, const Mapping& mapping)
+    {
+        auto& gap = *static_cast<NearGap*>(context);
+        gap.consider(gap.previousEnd, mapping.start);
+        gap.previousEnd = mapping.end;
+        return true;
+    }, &gap);
+
+    if(!scanned)
+    {
+        return 0;
+    }
+
+    gap.consider(gap.previousEnd, gap.maxAddress);
+    return gap.best;
+}
+
+void* mapNear(const void* const near, const ::std::size_t size, const int protection, const int flags, const int file) noexcept
+{
+    const ::std::uintptr_t origin = reinterpret_cast<::std::uintptr_t>(near);
+    const ::std::uintptr_t page = pageSize();
+
+    // Another thread may map the gap between the scan and the mmap
+    for(int attempt = 0; attempt < 4; ++attempt)
+    {
+        const ::std::uintptr_t address = findNearGap(origin, size, page);
+        if(!address)
+        {
+            return nullptr;
+        }
+
+#ifdef MAP_FIXED_NOREPLACE
+        void* const memory = ::mmap(reinterpret_cast<void*>(address), size, protection, flags | MAP_FIXED_NOREPLACE, file, 0);
+#else
+        void* const memory = ::mmap(reinterpret_cast<void*>(address), size, protection, flags, file, 0);
+#endif
+        if(memory == MAP_FAILED)
+        {
+            continue;
+        }
+
+        const ::std::uintptr_t result = reinterpret_cast<::std::uintptr_t>(memory);
+        if(result + NearRange >= origin + size && result <= origin + NearRange - size)
+        {
+            return memory;
+        }
+
+        ::munmap(memory, size);
+    }
+
+    return nullptr;
+}
+
+void* allocateNear(const void* const near, const ::std::size_t size) noexcept
+{
+    return mapNear(near, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1);
+}
+
+void releaseNear(void* const memory, const ::std::size_t size) noexcept
+{
+    ::munmap(memory, size);
+}
+
+// An r-x view of a fresh memfd within rel32 reach of near, whose last writableTail bytes are
+// rw- instead, and a writable alias of it anywhere: code other threads may run is written
+// through the alias, no page is ever writable and executable at once.
+void* allocateAliased(const void* const near, const ::std::size_t size, const ::std::size_t writableTail, void*& alias) noexcept
+{
+    alias = nullptr;
+
+#ifdef __linux__
+    const int file = static_cast<int>(::syscall(SYS_memfd_create, "kiero", MFD_CLOEXEC));
+#else
+    const int file = -1;
+#endif
+
+    if(file < 0)
+    {
+        return nullptr;
+    }
+
+    void* code = nullptr;
+
+    if(::ftruncate(file, static_cast<::off_t>(size)) == 0)
+    {
+        void* const view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if(view != MAP_FAILED)
+        {
+            code = mapNear(near, size, PROT_READ | PROT_EXEC, MAP_SHARED, file);
+
+            if(code && writableTail && ::mprotect(static_cast<::std::uint8_t*>(code) + size - writableTail, writableTail, PROT_READ | PROT_WRITE) != 0)
+            {
+                ::munmap(code, size);
+                code = nullptr;
+            }
+
+            if(code)
+            {
+                alias = view;
+            }
+            else
+            {
+                ::munmap(view, size);
+            }
+        }
+    }
+
+    ::close(file);
+    return code;
+}
+
+void releaseAliased(void* const code, void* const alias, const ::std::size_t size) noexcept
+{
+    ::munmap(code, size);
+    ::munmap(alias, size);
+}
+
+#endif
+
+} // namespace
+
+void* allocateCode(const void* const near, const ::std::size_t size) noexcept
+{
+    const ::std::size_t page = pageSize();
+    return allocateNear(near, (size + page - 1) & ~(page - 1));
+}
+
+void releaseCode(void* const code, const ::std::size_t size) noexcept
+{
+    const ::std::size_t page = pageSize();
+    releaseNear(code, (size + page - 1) & ~(page - 1));
+}
+
+void sealCode(void* const code, const ::std::size_t size) noexcept
+{
+#ifdef _WIN32
+    DWORD oldProtection;
+    ::VirtualProtect(code, size, PAGE_EXECUTE_READ, &oldProtection);
+    ::FlushInstructionCache(::GetCurrentProcess(), code, size);
+#else
+    ::mprotect(code, size, PROT_READ | PROT_EXEC);
+    __builtin___clear_cache(static_cast<char*>(code), static_cast<char*>(code) + size);
+#endif
+}
+
+namespace
+{
+
+// Trampolines are carved out of slabs reserved near their targets, one MaxTrampolineSize slot
+// each, instead of taking a page (an allocation granule on Windows) of their own. A slab is
+// r-x for good and written through its writable alias (stub pages the same), so writing costs
+// no protection change and the slab's other trampolines may run meanwhile. A slot freed by a
+// drained hook is reused, a slab whose last slot is freed is released.
+constexpr ::std::size_t SlabSize = 0x10000;
+
+// A slot starts with the head, a 5 byte nop or a jump to the route's absolute jump at the end
+// of the slot, "jmp [rip+2]; int3; int3; dq route"
+constexpr ::std::size_t TrampolineHead = 5;
+constexpr ::std::size_t RouteOffset = MaxTrampolineSize - 16;
+constexpr ::std::uint8_t HeadNop[TrampolineHead] = { 0x0F, 0x1F, 0x44, 0x00, 0x00 };
+
+constexpr ::std::size_t SlabSlots = SlabSize / MaxTrampolineSize;
+
+struct Slab
+{
+    ::std::uintptr_t code;
+    ::std::uintptr_t alias; // the same memory, writable
+    ::std::uint64_t free[SlabSlots / 64]; // set bits are free slots
+    ::std::uint32_t used;
+
+    Slab* next;
+};
+
+::std::mutex g_slabsMutex;
+Slab* g_slabs = nullptr;
+
+[[nodiscard]] bool slabReaches(const Slab& slab, const ::std::uintptr_t origin) noexcept
+{
+    return slab.code + NearRange >= origin + SlabSize && slab.code <= origin + NearRange - SlabSize;
+}
+
+[[nodiscard]] Slab* findSlab(const ::std::uintptr_t address) noexcept
+{
+    Slab* slab = g_slabs;
+    while(slab && (address < slab->code || address >= slab->code + SlabSize))
+    {
+        slab = slab->next;
+    }
+
+    return slab;
+}
+
+void releaseSlab(Slab* const slab) noexcept
+{
+    for(Slab** link = &g_slabs; *link; link = &(*link)->next)
+    {
+        if(*link == slab)
+        {
+            *link = slab->next;
+            break;
+        }
+    }
+
+    releaseAliased(reinterpret_cast<void*>(slab->code), reinterpret_cast<void*>(slab->alias), SlabSize);
+    delete slab;
+}
+
+void flushCode(void* const code, const ::std::size_t size) noexcept
+{
+#ifdef _WIN32
+    ::FlushInstructionCache(::GetCurrentProcess(), code, size);
+#else
+    __builtin___clear_cache(static_cast<char*>(code), static_cast<char*>(code) + size);
+#endif
+}
+
+// A free slot within rel32 reach of near, null when none could be reserved
+void* allocateTrampoline(const void* const near) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_slabsMutex);
+
+    const ::std::uintptr_t origin = reinterpret_cast<::std::uintptr_t>(near);
+
+    Slab* slab = g_slabs;
+    while(slab && (slab->used == SlabSlots || !slabReaches(*slab, origin)))
+    {
+        slab = slab->next;
+    }
+
+    if(!slab)
+    {
+        slab = new(::std::nothrow) Slab;
+        void* alias = nullptr;
+        void* const code = slab ? allocateAliased(near, SlabSize, 0, alias) : nullptr;
+
+        if(!code)
+        {
+            delete slab;
+            return nullptr;
+        }
+
+        slab->code = reinterpret_cast<::std::uintptr_t>(code);
+        slab->alias = reinterpret_cast<::std::uintptr_t>(alias);
+        ::std::fill(::std::begin(slab->free), ::std::end(slab->free), UINT64_MAX);
+        slab->used = 0;
+        slab->next = g_slabs;
+        g_slabs = slab;
+    }
+
+    ::std::size_t word = 0;
+    while(slab->free[word] == 0)
+    {
+        ++word;
+    }
+
+    const ::std::size_t bit = static_cast<::std::size_t>(::std::countr_zero(slab->free[word]));
+    slab->free[word] &= ~(::std::uint64_t(1) << bit);
+    ++slab->used;
+
+    return reinterpret_cast<void*>(slab->code + (word * 64 + bit) * MaxTrampolineSize);
+}
+
+// Where the slab's alias maps trampoline
+[[nodiscard]] ::std::uint8_t* writableSlot(const void* const trampoline) noexcept
+{
+    const Slab* const slab = findSlab(reinterpret_cast<::std::uintptr_t>(trampoline));
+    assert(slab != nullptr);
+
+    return reinterpret_cast<::std::uint8_t*>(slab->alias + (reinterpret_cast<::std::uintptr_t>(trampoline) - slab->code));
+}
+
+void writeTrampoline(void* const trampoline, const ::std::uint8_t* const code, const ::std::size_t size) noexcept
+{
+    assert(size <= MaxTrampolineSize);
+
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_slabsMutex);
+        (void) ::std::memcpy(writableSlot(trampoline), code, size);
+    }
+
+    flushCode(trampoline, size);
+}
+
+void freeTrampoline(void* const trampoline) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_slabsMutex);
+
+    Slab* const slab = findSlab(reinterpret_cast<::std::uintptr_t>(trampoline));
+    assert(slab != nullptr);
+
+    const ::std::size_t slot = (reinterpret_cast<::std::uintptr_t>(trampoline) - slab->code) / MaxTrampolineSize;
+    slab->free[slot / 64] |= ::std::uint64_t(1) << (slot % 64);
+
+    if(--slab->used == 0)
+    {
+        releaseSlab(slab);
+    }
+}
+
+[[nodiscard]] bool compareExchange128(::std::uint64_t* const destination, ::std::uint64_t* const expected, const ::std::uint64_t* const desired) noexcept
+{
+#ifdef _MSC_VER
+    return _InterlockedCompareExchange128(reinterpret_cast<volatile long long*>(destination), static_cast<long long>(desired[1]), static_cast<long long>(desired[0]), reinterpret_cast<long long*>(expected)) != 0;
+#else
+    bool exchanged;
+    __asm__ __volatile__(
+        "lock cmpxchg16b %[destination]"
+        : [destination] "+m"(*reinterpret_cast<volatile unsigned __int128*>(destination)), "=@ccz"(exchanged), "+a"(expected[0]), "+d"(expected[1])
+        : "b"(desired[0]), "c"(desired[1])
+        : "memory"
+    );
+    return exchanged;
+#endif
+}
+
+// jmp rel32
+void emitJmp(::std::uint8_t* const out, const ::std::intptr_t from, const ::std::intptr_t to) noexcept
+{
+    const ::std::int32_t displacement = static_cast<::std::int32_t>(to - (from + 5));
+    out[0] = 0xE9;
+    (void) ::std::memcpy(out + 1, &displacement, sizeof(displacement));
+}
+
+// jmp [rip+0]; dq to
+void emitAbsoluteJmp(::std::uint8_t* const out, const ::std::intptr_t to) noexcept
+{
+    constexpr ::std::uint8_t code[] = { 0xFF, 0x25, 0x00, 0x00, 0x00, 0x00 };
+    (void) ::std::memcpy(out, code, sizeof(code));
+    (void) ::std::memcpy(out + sizeof(code), &to, sizeof(to));
+}
+
+// The head swaps atomically, a slot is 16 byte aligned. The route's address is written first,
+// the head may jump to it already.
+void writeRoute(void* const trampoline, void* const route) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_slabsMutex);
+
+    // The alias has the slot's alignment, the head still swaps atomically through it
+    ::std::uint8_t* const code = writableSlot(trampoline);
+    ::std::uint8_t head[TrampolineHead];
+
+    if(route)
+    {
+        constexpr ::std::uint8_t jump[] = { 0xFF, 0x25, 0x02, 0x00, 0x00, 0x00, 0xCC, 0xCC };
+        (void) ::std::memcpy(code + RouteOffset, jump, sizeof(jump));
+        ::std::atomic_ref<void*>(*reinterpret_cast<void**>(code + RouteOffset + sizeof(jump))).store(route, ::std::memory_order_relaxed);
+
+        const ::std::intptr_t base = reinterpret_cast<::std::intptr_t>(trampoline);
+        emitJmp(head, base, base + static_cast<::std::intptr_t>(RouteOffset));
+    }
+    else
+    {
+        (void) ::std::memcpy(head, HeadNop, sizeof(head));
+    }
+
+    writeCode(code, head, sizeof(head));
+    flushCode(trampoline, MaxTrampolineSize);
+}
+
+// Patched targets jump to a stub of their own, "jmp [rip+disp32]" through its entry: the detour
+// while the hook is enabled, the trampoline once disabled, so a hooked call reaches the detour
+// with one indirect jump. Stubs fill the code page of a pair placed within rel32 reach of their
+// targets, each entry sits at the stub's offset in the writable page after it. Calls are not
+// tracked, so nothing they may reach is freed before a drain: a target keeps its stub across
+// binds, and its trampoline for as long as the code it copies is unchanged. A call that passed
+// the patch before its hook was disabled may still run the detour and call the trampoline.
+constexpr ::std::size_t StubSize = sizeof(void*);
+
+// The bytes a trampoline copies, the patch rounded up to whole instructions
+constexpr ::std::size_t MaxRelocatedSize = 32;
+
+// Drained hooks free their stubs, every stub's code is the same jump through its own entry so a
+// freed one is reused as it is. x86-64 pages are 4 KiB.
+constexpr ::std::size_t MaxStubsPerPage = 4096 / StubSize;
+
+struct StubPage
+{
+    ::std::uintptr_t code; // the stubs, followed by the page of their entries
+    ::std::size_t size;
+    ::std::uint64_t freed[MaxStubsPerPage / 64]; // set bits are freed stubs below size
+    ::std::uint32_t used;
+    ::std::uintptr_t alias; // the code page, writable
+    StubPage* next;
+};
+
+struct TargetStub
+{
+    ::std::uintptr_t target;
+    ::std::uintptr_t code;
+    void** entry;
+
+    void* trampoline; // null until a hook of the target was created
+    ::std::uint8_t relocatedSize;
+    ::std::uint8_t relocated[MaxRelocatedSize];
+
+    TargetStub* next;
+};
+
+::std::mutex g_stubsMutex;
+StubPage* g_stubPages = nullptr;
+TargetStub* g_targetStubs = nullptr;
+
+// Where calls already past the patch go
+void routeStub(const Hook& hook, void* const function) noexcept
+{
+    ::std::atomic_ref<void*>(*hook.entry).store(function, ::std::memory_order_release);
+}
+
+struct GateWriter
+{
+    ::std::uint8_t* out;
+    ::std::size_t size = 0;
+
+    enum Register : ::std::uint8_t { Rax, Rcx, Rdx, Rbx, Rsp, Rbp, Rsi, Rdi, R8, R9, R10, R11 };
+
+    void emit(const ::std::initializer_list<::std::uint8_t> bytes) noexcept
+    {
+        for(const ::std::uint8_t byte : bytes)
+        {
+            out[size++] = byte;
+        }
+    }
+
+    void emit32(const ::std::uint32_t value) noexcept
+    {
+        (void) ::std::memcpy(out + size, &value, sizeof(value));
+        size += sizeof(value);
+    }
+
+    void emit64(const ::std::uint64_t value) noexcept
+    {
+        (void) ::std::memcpy(out + size, &value, sizeof(value));
+        size += sizeof(value);
+    }
+
+    // mov [rsp+offset], reg / mov reg, [rsp+offset]
+    void store(const Register reg, const ::std::uint32_t offset) noexcept
+    {
+        emit({ static_cast<::std::uint8_t>(0x48 | (reg >= R8 ? 4 : 0)), 0x89, static_cast<::std::uint8_t>(0x84 | (reg & 7) << 3), 0x24 });
+        emit32(offset);
+    }
+
+    void load(const Register reg, const ::std::uint32_t offset) noexcept
+    {
+        emit({ static_cast<::std::uint8_t>(0x48 | (reg >= R8 ? 4 : 0)), 0x8B, static_cast<::std::uint8_t>(0x84 | (reg & 7) << 3), 0x24 });
+        emit32(offset);
+    }
+
+    // movdqu [rsp+offset], xmm / movdqu xmm, [rsp+offset], xmm0-xmm7
+    void storeXmm(const ::std::uint8_t xmm, const ::std::uint32_t offset) noexcept
+    {
+        emit({ 0xF3, 0x0F, 0x7F, static_cast<::std::uint8_t>(0x84 | xmm << 3), 0x24 });
+        emit32(offset);
+    }
+
+    void loadXmm(const ::std::uint8_t xmm, const ::std::uint32_t offset) noexcept
+    {
+        emit({ 0xF3, 0x0F, 0x6F, static_cast<::std::uint8_t>(0x84 | xmm << 3), 0x24 });
+        emit32(offset);
+    }
+
+    // mov destination, source
+    void move(const Register destination, const Register source) noexcept
+    {
+        emit({ static_cast<::std::uint8_t>(0x48 | (source >= R8 ? 4 : 0) | (destination >= R8 ? 1 : 0)), 0x89, static_cast<::std::uint8_t>(0xC0 | (source & 7) << 3 | (destination & 7)) });
+    }
+
+    // mov rax, function; call rax
+    void call(const void* const function) noexcept
+    {
+        emit({ 0x48, 0xB8 });
+        emit64(reinterpret_cast<::std::uint64_t>(function));
+        emit({ 0xFF, 0xD0 });
+    }
+
+    void callR11() noexcept
+    {
+        emit({ 0x41, 0xFF, 0xD3 });
+    }
+
+    void pop(const Register reg) noexcept
+    {
+        emit({ 0x41, static_cast<::std::uint8_t>(0x58 | (reg & 7)) });
+    }
+
+    void push(const Register reg) noexcept
+    {
+        emit({ 0x41, static_cast<::std::uint8_t>(0x50 | (reg & 7)) });
+    }
+
+    // jc rel32, returns where to patch the displacement
+    [[nodiscard]] ::std::size_t jumpIfCarry() noexcept
+    {
+        emit({ 0x0F, 0x82 });
+        emit32(0);
+        return size - sizeof(::std::uint32_t);
+    }
+
+    void land(const ::std::size_t jump) noexcept
+    {
+        const ::std::uint32_t displacement = static_cast<::std::uint32_t>(size - (jump + sizeof(::std::uint32_t)));
+        (void) ::std::memcpy(out + jump, &displacement, sizeof(displacement));
+    }
+
+    void adjustStack(const ::std::int32_t delta) noexcept
+    {
+        // sub rsp, imm32 / add rsp, imm32
+        emit({ 0x48, 0x81, static_cast<::std::uint8_t>(delta < 0 ? 0xEC : 0xC4) });
+        emit32(static_cast<::std::uint32_t>(delta < 0 ? -delta : delta));
+    }
+};
+
+} // namespace
+
+// Entered with the key in r11. Once the return address is popped rsp is aligned as it was at
+// the caller's call, and the detour finds its stack arguments (and the Win64 home space) where
+// they were.
+::std::size_t writeGate(::std::uint8_t* const out, const GateEnter enter, const GateExit exit) noexcept
+{
+    using Register = GateWriter::Register;
+    using enum GateWriter::Register;
+
+    GateWriter writer { out };
+
+    writer.pop(R10); // return address
+
+#ifdef _WIN32
+    constexpr Register arguments[] = { Rcx, Rdx, R8, R9 };
+    constexpr ::std::uint8_t xmmArguments = 4;
+    constexpr ::std::uint32_t home = 0x20;
+    constexpr Register first = Rcx;
+    constexpr Register second = Rdx;
+#else
+    constexpr Register arguments[] = { Rdi, Rsi, Rdx, Rcx, R8, R9, Rax }; // al counts vector arguments
+    constexpr ::std::uint8_t xmmArguments = 8;
+    constexpr ::std::uint32_t home = 0;
+    constexpr Register first = Rdi;
+    constexpr Register second = Rsi;
+#endif
+
+    constexpr ::std::uint32_t returnSlot = home + static_cast<::std::uint32_t>(::std::size(arguments)) * 8;
+    constexpr ::std::uint32_t xmmBase = (returnSlot + 8 + 15) & ~15u;
+    constexpr ::std::int32_t frame = static_cast<::std::int32_t>(xmmBase + xmmArguments * 16);
+
+    writer.adjustStack(-frame);
+    writer.store(R10, returnSlot);
+
+    for(::std::size_t i = 0; i < ::std::size(arguments); ++i)
+    {
+        writer.store(arguments[i], home + static_cast<::std::uint32_t>(i) * 8);
+    }
+
+    for(::std::uint8_t i = 0; i < xmmArguments; ++i)
+    {
+        writer.storeXmm(i, xmmBase + i * 16);
+    }
+
+    writer.move(first, R11);
+    writer.move(second, R10);
+    writer.call(reinterpret_cast<const void*>(enter));
+    writer.move(R11, Rax);
+
+    // btr r11, 63, the loads below leave the carry alone
+    static_assert(UntrackedCall == ::std::uintptr_t { 1 } << 63);
+    writer.emit({ 0x49, 0x0F, 0xBA, 0xF3, 0x3F });
+
+    for(::std::size_t i = 0; i < ::std::size(arguments); ++i)
+    {
+        writer.load(arguments[i], home + static_cast<::std::uint32_t>(i) * 8);
+    }
+
+    for(::std::uint8_t i = 0; i < xmmArguments; ++i)
+    {
+        writer.loadXmm(i, xmmBase + i * 16);
+    }
+
+    const ::std::size_t untracked = writer.jumpIfCarry();
+
+    writer.adjustStack(frame);
+    writer.callR11();
+
+    // Keep the return value (rax/rdx, xmm0/xmm1) across exit
+    constexpr ::std::int32_t resultFrame = static_cast<::std::int32_t>(home + 0x30);
+
+    writer.adjustStack(-resultFrame);
+    writer.store(Rax, home);
+    writer.store(Rdx, home + 8);
+    writer.storeXmm(0, home + 0x10);
+    writer.storeXmm(1, home + 0x20);
+
+    writer.call(reinterpret_cast<const void*>(exit));
+    writer.move(R11, Rax);
+
+    writer.load(Rax, home);
+    writer.load(Rdx, home + 8);
+    writer.loadXmm(0, home + 0x10);
+    writer.loadXmm(1, home + 0x20);
+    writer.adjustStack(resultFrame);
+
+    // push r11; ret, a return keeps the return predictor in step with the caller
+    writer.emit({ 0x41, 0x53, 0xC3 });
+
+    // The function returns straight to the caller
+    writer.land(untracked);
+    writer.load(R10, returnSlot);
+    writer.adjustStack(frame);
+    writer.push(R10);
+    writer.emit({ 0x41, 0xFF, 0xE3 }); // jmp r11
+
+    return writer.size;
+}
+
+namespace
+{
+
+// A stub within rel32 reach of origin leading back to it, 0 when none could be placed. Under
+// g_stubsMutex.
+[[nodiscard]] ::std::uintptr_t allocateStub(const ::std::uintptr_t origin) noexcept
+{
+    const ::std::size_t page = pageSize();
+    assert(page == MaxStubsPerPage * StubSize);
+
+    const auto reaches = [origin](const ::std::uintptr_t address)
+    {
+        return fitsRel32(static_cast<::std::intptr_t>(address) - static_cast<::std::intptr_t>(origin + 5));
+    };
+
+    StubPage* stubPage = nullptr;
+    ::std::uintptr_t address = 0;
+
+    for(StubPage* candidate = g_stubPages; candidate && !address; candidate = candidate->next)
+    {
+        stubPage = candidate;
+
+        for(::std::size_t word = 0; word < ::std::size(stubPage->freed) && !address; ++word)
+        {
+            if(stubPage->freed[word] && reaches(stubPage->code))
+            {
+                const ::std::size_t bit = static_cast<::std::size_t>(::std::countr_zero(stubPage->freed[word]));
+                stubPage->freed[word] &= ~(::std::uint64_t(1) << bit);
+                address = stubPage->code + (word * 64 + bit) * StubSize;
+            }
+        }
+
+        if(!address && stubPage->size + StubSize <= page && reaches(stubPage->code + stubPage->size))
+        {
+            address = stubPage->code + stubPage->size;
+            stubPage->size += StubSize;
+
+            // jmp [rip + page - 6], the entry at the same offset one page on
+            const ::std::int32_t displacement = static_cast<::std::int32_t>(page - 6);
+            ::std::uint8_t code[StubSize] = { 0xFF, 0x25, 0, 0, 0, 0, 0xCC, 0xCC };
+            (void) ::std::memcpy(code + 2, &displacement, sizeof(displacement));
+
+            // The other stubs of the page may be running meanwhile
+            (void) ::std::memcpy(reinterpret_cast<void*>(stubPage->alias + (address - stubPage->code)), code, StubSize);
+            flushCode(reinterpret_cast<void*>(address), StubSize);
+        }
+    }
+
+    if(!address)
+    {
+        auto* const fresh = new(::std::nothrow) StubPage { };
+        void* alias = nullptr;
+        void* const code = fresh ? allocateAliased(reinterpret_cast<const void*>(origin), page * 2, page, alias) : nullptr;
+
+        if(!code)
+        {
+            delete fresh;
+            return 0;
+        }
+
+        fresh->code = reinterpret_cast<::std::uintptr_t>(code);
+        fresh->alias = reinterpret_cast<::std::uintptr_t>(alias);
+        fresh->next = g_stubPages;
+        g_stubPages = fresh;
+
+        return allocateStub(origin);
+    }
+
+    ++stubPage->used;
+    ::std::atomic_ref<void*>(*reinterpret_cast<void**>(address + page)).store(reinterpret_cast<void*>(origin), ::std::memory_order_release);
+
+    return address;
+}
+
+void freeStub(const ::std::uintptr_t address) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_stubsMutex);
+    const ::std::size_t page = pageSize();
+
+    for(StubPage** link = &g_stubPages; *link; link = &(*link)->next)
+    {
+        StubPage* const stubPage = *link;
+        if(address < stubPage->code || address >= stubPage->code + page)
+        {
+            continue;
+        }
+
+        const ::std::size_t slot = (address - stubPage->code) / StubSize;
+        stubPage->freed[slot / 64] |= ::std::uint64_t(1) << (slot % 64);
+
+        if(--stubPage->used == 0)
+        {
+            *link = stubPage->next;
+            releaseAliased(reinterpret_cast<void*>(stubPage->code), reinterpret_cast<void*>(stubPage->alias), page * 2);
+            delete stubPage;
+        }
+
+        return;
+    }
+}
+
+// The stub target keeps across hooks, null when none could be placed within rel32 reach of it
+[[nodiscard]] TargetStub* findStub(void* const target) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_stubsMutex);
+
+    const ::std::uintptr_t origin = reinterpret_cast<::std::uintptr_t>(target);
+
+    for(TargetStub* stub = g_targetStubs; stub; stub = stub->next)
+    {
+        if(stub->target == origin)
+        {
+            return stub;
+        }
+    }
+
+    auto* stub = new(::std::nothrow) TargetStub { };
+    const ::std::uintptr_t address = stub ? allocateStub(origin) : 0;
+
+    if(!address)
+    {
+        delete stub;
+        return nullptr;
+    }
+
+    stub->target = origin;
+    stub->code = address;
+    stub->entry = reinterpret_cast<void**>(address + pageSize());
+    stub->next = g_targetStubs;
+    g_targetStubs = stub;
+
+    return stub;
+}
+
+// The trampoline target keeps, null when it copied other bytes than the target holds now. The
+// copy of the same bytes at the same place comes out the same.
+[[nodiscard]] void* keptTrampoline(const TargetStub& stub, const ::std::uint8_t* const source, const ::std::size_t size) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_stubsMutex);
+
+    if(!stub.trampoline || stub.relocatedSize != size || ::std::memcmp(stub.relocated, source, size) != 0)
+    {
+        return nullptr;
+    }
+
+    return stub.trampoline;
+}
+
+// A trampoline the target kept before stays allocated, a detour may still call it
+void keepTrampoline(TargetStub& stub, void* const trampoline, const ::std::uint8_t* const source, const ::std::size_t size) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_stubsMutex);
+
+    stub.trampoline = trampoline;
+    stub.relocatedSize = static_cast<::std::uint8_t>(size);
+    (void) ::std::memcpy(stub.relocated, source, size);
+}
+
+// A frozen thread sitting on a copied instruction must continue on its twin
+void moveInstructionPointer(::std::uintptr_t& ip, Hook* const* const hooks, const ::std::size_t count, const bool enable) noexcept
+{
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        const Hook* const hook = hooks[i];
+        if(!hook || hook->enabled == enable)
+        {
+            continue;
+        }
+
+        const ::std::uintptr_t target = reinterpret_cast<::std::uintptr_t>(hook->target);
+        const ::std::uintptr_t trampoline = reinterpret_cast<::std::uintptr_t>(hook->trampoline);
+
+        for(::std::size_t j = 0; j < hook->ipCount; ++j)
+        {
+            const ::std::uintptr_t from = enable ? target + hook->oldIps[j] : trampoline + hook->newIps[j];
+            const ::std::uintptr_t to = enable ? trampoline + hook->newIps[j] : target + hook->oldIps[j];
+
+            if(ip == from)
+            {
+                ip = to;
+                return;
+            }
+        }
+    }
+}
+
+#ifdef _WIN32
+
+struct FrozenThreads
+{
+    HANDLE* handles = nullptr;
+    ::std::size_t count = 0;
+    bool complete = false; // every other thread was suspended
+};
+
+// Suspends every other thread. The handles are allocated first, a suspended thread may hold
+// the heap's lock.
+void freezeThreads(FrozenThreads& frozen) noexcept
+{
+    const HANDLE snapshot = ::CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+    if(snapshot == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    const DWORD processId = ::GetCurrentProcessId();
+    const DWORD threadId = ::GetCurrentThreadId();
+
+    THREADENTRY32 entry;
+    entry.dwSize = sizeof(entry);
+
+    ::std::size_t threads = 0;
+    for(BOOL more = ::Thread32First(snapshot, &entry); more; more = ::Thread32Next(snapshot, &entry))
+    {
+        threads += entry.th32OwnerProcessID == processId && entry.th32ThreadID != threadId ? 1 : 0;
+    }
+
+    frozen.handles = threads ? new(::std::nothrow) HANDLE [threads] : nullptr;
+    frozen.complete = !threads || frozen.handles;
+
+    for(BOOL more = ::Thread32First(snapshot, &entry); more && frozen.count < threads && frozen.handles; more = ::Thread32Next(snapshot, &entry))
+    {
+        if(entry.th32OwnerProcessID != processId || entry.th32ThreadID == threadId)
+        {
+            continue;
+        }
+
+        const HANDLE thread = ::OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_SET_CONTEXT, FALSE, entry.th32ThreadID);
+        if(!thread)
+        {
+            continue; // exited meanwhile
+        }
+
+        if(::SuspendThread(thread) == static_cast<DWORD>(-1))
+        {
+            ::CloseHandle(thread);
+            frozen.complete = false;
+            continue;
+        }
+
+        frozen.handles[frozen.count++] = thread;
+    }
+
+    ::CloseHandle(snapshot);
+}
+
+// Calls visit with the instruction pointer, which it may move, and the stack pointer of every
+// frozen thread
+template<typename Visit>
+void forEachFrozen(FrozenThreads& frozen, Visit&& visit) noexcept
+{
+    for(::std::size_t i = 0; i < frozen.count; ++i)
+    {
+        CONTEXT context;
+        context.ContextFlags = CONTEXT_CONTROL;
+        if(!::GetThreadContext(frozen.handles[i], &context))
+        {
+            frozen.complete = false;
+            continue;
+        }
+
+        ::std::uintptr_t ip = context.Rip;
+        visit(ip, static_cast<::std::uintptr_t>(context.Rsp));
+
+        if(ip != context.Rip)
+        {
+            context.Rip = ip;
+            ::SetThreadContext(frozen.handles[i], &context);
+        }
+    }
+}
+
+void unfreezeThreads(FrozenThreads& frozen) noexcept
+{
+    for(::std::size_t i = 0; i < frozen.count; ++i)
+    {
+        ::ResumeThread(frozen.handles[i]);
+        ::CloseHandle(frozen.handles[i]);
+    }
+
+    delete[] frozen.handles;
+    frozen = FrozenThreads { };
+}
+
+#elif defined(__linux__)
+
+// Other threads are frozen by a signal whose handler parks them until they are thawed, the
+// freezer reads and moves their instruction pointers in the contexts the handlers received.
+// Nothing may be allocated or locked while they are frozen, a frozen thread may hold the lock.
+// Threads that block the signal, or a process handling it itself, are not frozen.
+struct FrozenThread
+{
+    ::pid_t id;
+    ::std::atomic<::ucontext_t*> context; // set by its handler
+};
+
+struct FrozenThreads
+{
+    FrozenThread* threads = nullptr;
+    ::std::size_t count = 0;
+    bool complete = false; // every other thread was frozen
+};
+
+constexpr ::std::chrono::milliseconds FreezeTimeout { 50 };
+
+::std::mutex g_freezeMutex;
+int g_freezeSignal = 0; // under g_freezeMutex, -1 when the process handles it itself
+
+// The freeze in progress for the handlers, how many of them run, arrivals and thaws
+::std::atomic<FrozenThreads*> g_freeze { nullptr };
+::std::atomic<::std::uint32_t> g_freezeHandlers { 0 };
+::std::atomic<::std::uint32_t> g_freezeArrivals { 0 };
+::std::atomic<::std::uint32_t> g_freezeThaws { 0 };
+
+void futexWait(::std::atomic<::std::uint32_t>& word, const ::std::uint32_t value, const ::timespec* const timeout) noexcept
+{
+    (void) ::syscall(SYS_futex, reinterpret_cast<::std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, value, timeout, nullptr, 0);
+}
+
+void futexWake(::std::atomic<::std::uint32_t>& word, const int count) noexcept
+{
+    (void) ::syscall(SYS_futex, reinterpret_cast<::std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+// Async signal safe: atomics and syscalls only. A handler running after its freeze ended
+// finds no freeze, or none listing it, and returns.
+void onFreezeSignal(int, ::siginfo_t*, void* const context) noexcept
+{
+    const int error = errno;
+
+    g_freezeHandlers.fetch_add(1, ::std::memory_order_seq_cst);
+
+    const ::std::uint32_t thaws = g_freezeThaws.load(::std::memory_order_seq_cst);
+    FrozenThreads* const freeze = g_freeze.load(::std::memory_order_seq_cst);
+
+    if(freeze)
+    {
+        const ::pid_t self = static_cast<::pid_t>(::syscall(SYS_gettid));
+
+        for(::std::size_t i = 0; i < freeze->count; ++i)
+        {
+            ::ucontext_t* expected = nullptr;
+            if(freeze->threads[i].id != self || !freeze->threads[i].context.compare_exchange_strong(expected, static_cast<::ucontext_t*>(context)))
+            {
+                continue;
+            }
+
+            g_freezeArrivals.fetch_add(1, ::std::memory_order_seq_cst);
+            futexWake(g_freezeArrivals, 1);
+
+            while(g_freezeThaws.load(::std::memory_order_acquire) == thaws)
+            {
+                futexWait(g_freezeThaws, thaws, nullptr);
+            }
+
+            break;
+        }
+    }
+
+    g_freezeHandlers.fetch_sub(1, ::std::memory_order_release);
+    errno = error;
+}
+
+// Under g_freezeMutex
+[[nodiscard]] bool installFreezeSignal() noexcept
+{
+    if(g_freezeSignal == 0)
+    {
+        const int signal = SIGRTMAX - 3;
+
+        struct sigaction previous { };
+        struct sigaction action { };
+        action.sa_sigaction = onFreezeSignal;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        ::sigemptyset(&action.sa_mask);
+
+        const bool free = ::sigaction(signal, nullptr, &previous) == 0 && !(previous.sa_flags & SA_SIGINFO) && previous.sa_handler == SIG_DFL;
+        g_freezeSignal = free && ::sigaction(signal, &action, nullptr) == 0 ? signal : -1;
+    }
+
+    return g_freezeSignal > 0;
+}
+
+// Calls visit with the id of every other thread, without allocating
+template<typename Visit>
+[[nodiscard]] bool forEachThread(Visit&& visit) noexcept
+{
+    const int directory = ::open("/proc/self/task", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(directory < 0)
+    {
+        return false;
+    }
+
+    const ::pid_t self = static_cast<::pid_t>(::syscall(SYS_gettid));
+
+    // linux_dirent64: d_ino, d_off, d_reclen, d_type, d_name
+    alignas(8) char buffer[4096];
+    ::ssize_t size;
+
+    while((size = ::syscall(SYS_getdents64, directory, buffer, sizeof(buffer))) > 0)
+    {
+        for(::ssize_t offset = 0; offset < size; )
+        {
+            ::std::uint16_t length;
+            (void) ::std::memcpy(&length, buffer + offset + 16, sizeof(length));
+
+            ::pid_t id = 0;
+            for(const char* name = buffer + offset + 19; *name >= '0' && *name <= '9'; ++name)
+            {
+                id = id * 10 + (*name - '0');
+            }
+
+            if(id > 0 && id != self)
+            {
+                visit(id);
+            }
+
+            offset += length;
+        }
+    }
+
+    ::close(directory);
+    return size == 0;
+}
+
+void freezeThreads(FrozenThreads& frozen) noexcept
+{
+    g_freezeMutex.lock();
+
+    ::std::size_t threads = 0;
+    if(!installFreezeSignal() || !forEachThread([&](::pid_t) { ++threads; }))
+    {
+        return;
+    }
+
+    if(threads == 0)
+    {
+        frozen.complete = true;
+        return;
+    }
+
+    // Threads started from now on are not frozen, they have not reached the targets yet
+    frozen.threads = new(::std::nothrow) FrozenThread [threads + 16];
+    if(!frozen.threads)
+    {
+        return;
+    }
+
+    frozen.complete = forEachThread([&](const ::pid_t id)
+    {
+        if(frozen.count < threads + 16)
+        {
+            frozen.threads[frozen.count].id = id;
+            frozen.threads[frozen.count].context.store(nullptr, ::std::memory_order_relaxed);
+            ++frozen.count;
+        }
+    });
+
+    g_freezeArrivals.store(0, ::std::memory_order_relaxed);
+    g_freeze.store(&frozen, ::std::memory_order_seq_cst);
+
+    ::std::uint32_t signaled = 0;
+    const ::pid_t process = ::getpid();
+
+    for(::std::size_t i = 0; i < frozen.count; ++i)
+    {
+        // A thread gone meanwhile is not waited for
+        signaled += ::syscall(SYS_tgkill, process, frozen.threads[i].id, g_freezeSignal) == 0 ? 1 : 0;
+    }
+
+    const auto deadline = ::std::chrono::steady_clock::now() + FreezeTimeout;
+
+    for(;;)
+    {
+        const ::std::uint32_t arrivals = g_freezeArrivals.load(::std::memory_order_seq_cst);
+        const auto remaining = deadline - ::std::chrono::steady_clock::now();
+
+        if(arrivals >= signaled || remaining <= ::std::chrono::steady_clock::duration::zero())
+        {
+            frozen.complete = frozen.complete && arrivals >= signaled;
+            break;
+        }
+
+        const auto nanoseconds = ::std::chrono::duration_cast<::std::chrono::nanoseconds>(remaining).count();
+        const ::timespec timeout { static_cast<::time_t>(nanoseconds / 1'000'000'000), static_cast<long>(nanoseconds % 1'000'000'000) };
+        futexWait(g_freezeArrivals, arrivals, &timeout);
+    }
+}
+
+// Calls visit with the instruction pointer, which it may move, and the stack pointer of every
+// frozen thread
+template<typename Visit>
+void forEachFrozen(FrozenThreads& frozen, Visit&& visit) noexcept
+{
+    for(::std::size_t i = 0; i < frozen.count; ++i)
+    {
+        ::ucontext_t* const context = frozen.threads[i].context.load(::std::memory_order_acquire);
+        if(!context)
+        {
+            continue;
+        }
+
+        ::std::uintptr_t ip = static_cast<::std::uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+        visit(ip, static_cast<::std::uintptr_t>(context->uc_mcontext.gregs[REG_RSP]));
+        context->uc_mcontext.gregs[REG_RIP] = static_cast<greg_t>(ip);
+    }
+}
+
+void unfreezeThreads(FrozenThreads& frozen) noexcept
+{
+    if(frozen.count)
+    {
+        // Late handlers see no freeze, those that found it are waited for before it is freed
+        g_freeze.store(nullptr, ::std::memory_order_seq_cst);
+        g_freezeThaws.fetch_add(1, ::std::memory_order_seq_cst);
+        futexWake(g_freezeThaws, INT32_MAX);
+
+        while(g_freezeHandlers.load(::std::memory_order_acquire) != 0)
+        {
+            ::sched_yield();
+        }
+    }
+
+    delete[] frozen.threads;
+    frozen = FrozenThreads { };
+
+    g_freezeMutex.unlock();
+}
+
+#else
+
+struct FrozenThreads
+{
+    bool complete = false;
+};
+
+void freezeThreads(FrozenThreads&) noexcept
+{
+}
+
+template<typename Visit>
+void forEachFrozen(FrozenThreads&, Visit&&) noexcept
+{
+}
+
+void unfreezeThreads(FrozenThreads&) noexcept
+{
+}
+
+#endif
+
+// The end of the stack sp points into, 0 when unknown
+[[nodiscard]] ::std::uintptr_t stackEnd(const ::std::uintptr_t sp) noexcept
+{
+#ifdef _WIN32
+    // The committed part of a stack runs from its guard page to its top
+    MEMORY_BASIC_INFORMATION info;
+    if(!::VirtualQuery(reinterpret_cast<void*>(sp), &info, sizeof(info)) || info.State != MEM_COMMIT)
+    {
+        return 0;
+    }
+
+    return reinterpret_cast<::std::uintptr_t>(info.BaseAddress) + info.RegionSize;
+#else
+    struct Search
+    {
+        ::std::uintptr_t sp;
+        ::std::uintptr_t end;
+    };
+
+    Search search { sp, 0 };
+    (void) forEachMapping([](void* const context, const Mapping& mapping)
+    {
+        Search& search = *static_cast<Search*>(context);
+        if(search.sp >= mapping.start && search.sp < mapping.end)
+        {
+            search.end = mapping.end;
+        }
+
+        return search.sp >= mapping.end;
+    }, &search);
+
+    return search.end;
+#endif
+}
+
+// The code of the function at address, from its .pdata entry on Windows, and on Linux from its
+// FDE in .eh_frame_hdr up to the next function's. A page when neither knows the function.
+void functionRange(const void* const function, ::std::uintptr_t& begin, ::std::uintptr_t& end) noexcept
+{
+    ::std::uintptr_t address = reinterpret_cast<::std::uintptr_t>(function);
+
+    // Through an incremental linking thunk to the function itself
+    if(*reinterpret_cast<const ::std::uint8_t*>(address) == 0xE9)
+    {
+        ::std::int32_t displacement;
+        (void) ::std::memcpy(&displacement, reinterpret_cast<const void*>(address + 1), sizeof(displacement));
+        address += 5 + static_cast<::std::intptr_t>(displacement);
+    }
+
+    begin = address;
+    end = address + pageSize();
+
+#ifdef _WIN32
+    DWORD64 imageBase;
+    const RUNTIME_FUNCTION* const entry = ::RtlLookupFunctionEntry(address, &imageBase, nullptr);
+    if(entry)
+    {
+        begin = static_cast<::std::uintptr_t>(imageBase + entry->BeginAddress);
+        end = static_cast<::std::uintptr_t>(imageBase + entry->EndAddress);
+    }
+#elif defined(__linux__)
+    struct Search
+    {
+        ::std::uintptr_t address;
+        ::std::uintptr_t& begin;
+        ::std::uintptr_t& end;
+    };
+
+    Search search { address, begin, end };
+    (void) ::dl_iterate_phdr([](::dl_phdr_info* const info, ::std::size_t, void* const context)
+    {
+        Search& search = *static_cast<Search*>(context);
+
+        const ::std::uint8_t* header = nullptr;
+        ::std::uintptr_t segmentEnd = 0;
+
+        for(::std::size_t i = 0; i < info->dlpi_phnum; ++i)
+        {
+            const ElfW(Phdr)& segment = info->dlpi_phdr[i];
+            const ::std::uintptr_t start = info->dlpi_addr + segment.p_vaddr;
+
+            if(segment.p_type == PT_LOAD && (segment.p_flags & PF_X) && search.address >= start && search.address < start + segment.p_memsz)
+            {
+                segmentEnd = start + segment.p_memsz;
+            }
+            else if(segment.p_type == PT_GNU_EH_FRAME)
+            {
+                header = reinterpret_cast<const ::std::uint8_t*>(start);
+            }
+        }
+
+        if(!segmentEnd)
+        {
+            return 0;
+        }
+
+        // version 1, eh_frame_ptr as a 4 byte value, fde_count as udata4 and a table of
+        // datarel sdata4 pairs sorted by initial location
+        constexpr ::std::uint8_t Udata4 = 0x03;
+        constexpr ::std::uint8_t DatarelSdata4 = 0x3B;
+
+        if(!header || header[0] != 1 || (header[1] & 0x07) != Udata4 || header[2] != Udata4 || header[3] != DatarelSdata4)
+        {
+            return 1;
+        }
+
+        ::std::uint32_t count;
+        (void) ::std::memcpy(&count, header + 8, sizeof(count));
+
+        const auto location = [header](const ::std::uint32_t index)
+        {
+            ::std::int32_t offset;
+            (void) ::std::memcpy(&offset, header + 12 + index * 8, sizeof(offset));
+            return reinterpret_cast<::std::uintptr_t>(header) + static_cast<::std::intptr_t>(offset);
+        };
+
+        // The last entry starting at or before the address
+        ::std::uint32_t low = 0;
+        ::std::uint32_t high = count;
+        while(low < high)
+        {
+            const ::std::uint32_t middle = low + (high - low) / 2;
+            if(location(middle) <= search.address)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        if(low > 0)
+        {
+            search.begin = location(low - 1);
+            search.end = low < count ? location(low) : segmentEnd;
+        }
+
+        return 1;
+    }, &search);
+#endif
+}
+
+// Targets sharing pages share one protection change
+struct PatchRun
+{
+    ::std::uintptr_t start;
+    ::std::uintptr_t end;
+    ::std::size_t first; // into the sorted order
+    ::std::size_t last;
+
+    ::std::uintptr_t covered; // by the mappings read so far
+
+    ::std::uint32_t protection;
+    bool writable;
+};
+
+#ifndef _WIN32
+
+// One pass over the maps for the protection of every run, sorted and disjoint. A run not wholly
+// mapped, or spanning mappings protected differently, is left unwritable.
+void readProtections(PatchRun* const runs, const ::std::size_t count) noexcept
+{
+    struct Search
+    {
+        PatchRun* runs;
+        ::std::size_t count;
+        ::std::size_t next;
+    };
+
+    // writable marks the runs still being covered, covered how far
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        runs[i].covered = runs[i].start;
+        runs[i].writable = true;
+    }
+
+    Search search { runs, count, 0 };
+    const bool scanned = forEachMapping([](void* const context, const Mapping& mapping)
+    {
+        Search& search = *static_cast<Search*>(context);
+
+        const ::std::uint32_t protection = (mapping.readable ? PROT_READ : 0) | (mapping.writable ? PROT_WRITE : 0) | (mapping.executable ? PROT_EXEC : 0);
+
+        while(search.next < search.count && search.runs[search.next].end <= mapping.start)
+        {
+            ++search.next;
+        }
+
+        for(::std::size_t k = search.next; k < search.count && search.runs[k].start < mapping.end; ++k)
+        {
+            PatchRun& run = search.runs[k];
+            if(!run.writable)
+            {
+                continue;
+            }
+
+            const bool first = run.covered == run.start;
+            if(first ? mapping.start > run.start : mapping.start != run.covered || protection != run.protection)
+            {
+                run.writable = false;
+                continue;
+            }
+
+            run.protection = protection;
+            run.covered = ::std::min(mapping.end, run.end);
+        }
+
+        return search.next < search.count;
+    }, &search);
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        runs[i].writable = scanned && runs[i].writable && runs[i].covered == runs[i].end;
+    }
+}
+
+#endif
+
+void unprotectRuns(PatchRun* const runs, const ::std::size_t count) noexcept
+{
+#ifdef _WIN32
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        runs[i].writable = unprotectCode(reinterpret_cast<void*>(runs[i].start), runs[i].end - runs[i].start, runs[i].protection);
+    }
+#else
+    readProtections(runs, count);
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        runs[i].writable = runs[i].writable && ::mprotect(reinterpret_cast<void*>(runs[i].start), runs[i].end - runs[i].start, PROT_READ | PROT_WRITE | PROT_EXEC) == 0;
+    }
+#endif
+}
+
+Status setHooks(Hook* const* const hooks, const ::std::size_t count, Status* const results, const bool enable) noexcept
+{
+    KIERO_TRACE_SPAN(Hook, enable ? "enableHooks" : "disableHooks", Count, count);
+
+    // Walk the targets by address so hooks sharing pages share one protection change
+    auto* const order = new(::std::nothrow) ::std::size_t [count];
+    auto* const runs = new(::std::nothrow) PatchRun [count];
+    auto* const patched = new(::std::nothrow) Hook* [count];
+
+    if(!order || !runs || !patched)
+    {
+        delete[] order;
+        delete[] runs;
+        delete[] patched;
+        return Status::UnknownError;
+    }
+
+    ::std::size_t used = 0;
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        if(hooks[i])
+        {
+            order[used++] = i;
+        }
+        else if(results)
+        {
+            results[i] = Status::UnknownError;
+        }
+    }
+
+    ::std::sort(order, order + used, [hooks](const ::std::size_t left, const ::std::size_t right)
+    {
+        return hooks[left]->target < hooks[right]->target;
+    });
+
+    const ::std::uintptr_t page = pageSize();
+    ::std::size_t runCount = 0;
+
+    for(::std::size_t i = 0; i < used; )
+    {
+        const ::std::uintptr_t first = reinterpret_cast<::std::uintptr_t>(hooks[order[i]]->target);
+        const ::std::uintptr_t start = first & ~(page - 1);
+        ::std::uintptr_t end = (first + hooks[order[i]]->patchSize + page - 1) & ~(page - 1);
+
+        ::std::size_t j = i + 1;
+        for(; j < used; ++j)
+        {
+            const ::std::uintptr_t next = reinterpret_cast<::std::uintptr_t>(hooks[order[j]]->target);
+            if((next & ~(page - 1)) > end)
+            {
+                break;
+            }
+
+            end = ::std::max(end, (next + hooks[order[j]]->patchSize + page - 1) & ~(page - 1));
+        }
+
+        runs[runCount++] = PatchRun { start, end, i, j, start, 0, false };
+        i = j;
+    }
+
+    unprotectRuns(runs, runCount);
+
+    Status overall = used == count ? Status::Success : Status::UnknownError;
+    ::std::size_t patchedCount = 0;
+
+    for(::std::size_t i = 0; i < runCount; ++i)
+    {
+        for(::std::size_t k = runs[i].first; k < runs[i].last; ++k)
+        {
+            Hook* const hook = hooks[order[k]];
+            const bool change = hook->enabled != enable;
+
+            if(change && runs[i].writable)
+            {
+                patched[patchedCount++] = hook;
+            }
+
+            const Status status = change && !runs[i].writable ? Status::UnknownError : Status::Success;
+            overall = status == Status::Success ? overall : status;
+
+            if(results)
+            {
+                results[order[k]] = status;
+            }
+        }
+    }
+
+    // Other threads are stopped so none runs a half written prologue, those inside it go on
+    // from the twin of their instruction
+    FrozenThreads frozen;
+    if(patchedCount)
+    {
+        freezeThreads(frozen);
+        forEachFrozen(frozen, [&](::std::uintptr_t& ip, ::std::uintptr_t)
+        {
+            moveInstructionPointer(ip, patched, patchedCount, enable);
+        });
+    }
+
+    for(::std::size_t i = 0; i < patchedCount; ++i)
+    {
+        Hook& hook = *patched[i];
+
+        // The stub must lead to the detour before the first call reaches it
+        if(enable)
+        {
+            routeStub(hook, hook.detour);
+        }
+
+        writeCode(hook.target, enable ? hook.patch : hook.backup, hook.patchSize);
+        hook.enabled = enable;
+
+        // Threads already in the stub now run the original
+        if(!enable)
+        {
+            routeStub(hook, hook.trampoline);
+        }
+    }
+
+    if(patchedCount)
+    {
+        unfreezeThreads(frozen);
+    }
+
+    for(::std::size_t i = 0; i < runCount; ++i)
+    {
+        if(runs[i].writable)
+        {
+            protectCode(reinterpret_cast<void*>(runs[i].start), runs[i].end - runs[i].start, runs[i].protection);
+        }
+    }
+
+    delete[] order;
+    delete[] runs;
+    delete[] patched;
+    return overall;
+}
+
+// A drained hook that was disabled and waits for no thread to run it
+struct PendingDrain
+{
+    Hook hook;
+    bool running; // found running by the latest look
+    bool calling; // by the calling thread's own callers, waiting will not help
+    PendingDrain* next;
+};
+
+constexpr ::std::chrono::milliseconds DrainTimeout { 1000 };
+
+::std::mutex g_drainMutex;
+PendingDrain* g_pendingDrains = nullptr; // under g_drainMutex
+
+// Whether an instruction pointer at address runs the hook
+[[nodiscard]] bool runs(const Hook& hook, const ::std::uintptr_t address) noexcept
+{
+    const ::std::uintptr_t stub = reinterpret_cast<::std::uintptr_t>(hook.entry) - pageSize();
+    const ::std::uintptr_t trampoline = reinterpret_cast<::std::uintptr_t>(hook.trampoline);
+
+    return (address >= stub && address < stub + StubSize) || (address >= trampoline && address < trampoline + MaxTrampolineSize)
+        || (address >= hook.detourBegin && address < hook.detourEnd);
+}
+
+// Whether a stack word may be a return address into the hook. The stub calls nothing, and no
+// call returns to the first byte of the trampoline or the detour: pointers to them (the
+// original kept by the caller, the detour passed to bind) do not hold the hook up.
+[[nodiscard]] bool returnsInto(const Hook& hook, const ::std::uintptr_t address) noexcept
+{
+    const ::std::uintptr_t trampoline = reinterpret_cast<::std::uintptr_t>(hook.trampoline);
+    return (address > trampoline && address < trampoline + MaxTrampolineSize) || (address > hook.detourBegin && address < hook.detourEnd);
+}
+
+// Marks the pending hooks a thread at ip may still run, judging by ip and every word of its
+// stack from sp up. Stale words only make a hook wait longer.
+void markRunning(const ::std::uintptr_t ip, const ::std::uintptr_t sp, const bool calling) noexcept
+{
+    const ::std::uintptr_t end = stackEnd(sp);
+
+    const auto mark = [calling](const ::std::uintptr_t address, const bool stack)
+    {
+        for(PendingDrain* pending = g_pendingDrains; pending; pending = pending->next)
+        {
+            if(stack ? returnsInto(pending->hook, address) : runs(pending->hook, address))
+            {
+                pending->running = true;
+                pending->calling = pending->calling || calling;
+            }
+        }
+    };
+
+    // A stack it cannot find the end of may run any of them
+    if(!end)
+    {
+        for(PendingDrain* pending = g_pendingDrains; pending; pending = pending->next)
+        {
+            pending->running = true;
+        }
+
+        return;
+    }
+
+    if(ip)
+    {
+        mark(ip, false);
+    }
+
+    for(::std::uintptr_t word = (sp + 7) & ~static_cast<::std::uintptr_t>(7); word + sizeof(::std::uintptr_t) <= end; word += sizeof(::std::uintptr_t))
+    {
+        mark(*reinterpret_cast<const ::std::uintptr_t*>(word), true);
+    }
+}
+
+// Under g_drainMutex. Frees the pending hooks no thread runs, looking again until timeout.
+Status drainLocked(const ::std::chrono::milliseconds timeout, const ::std::uintptr_t callers) noexcept
+{
+    KIERO_TRACE_SPAN(Hook, "drainHooks");
+
+    const auto deadline = ::std::chrono::steady_clock::now() + timeout;
+
+    while(g_pendingDrains)
+    {
+        for(PendingDrain* pending = g_pendingDrains; pending; pending = pending->next)
+        {
+            pending->running = false;
+            pending->calling = false;
+        }
+
+        markRunning(0, callers, true);
+
+        // Looks at the other threads where they stand, nothing is allocated or locked meanwhile
+        FrozenThreads frozen;
+        freezeThreads(frozen);
+        forEachFrozen(frozen, [](::std::uintptr_t& ip, const ::std::uintptr_t sp)
+        {
+            markRunning(ip, sp, false);
+        });
+
+        const bool complete = frozen.complete;
+        unfreezeThreads(frozen);
+
+        bool waiting = false;
+        for(PendingDrain** link = &g_pendingDrains; *link; )
+        {
+            PendingDrain* const pending = *link;
+            if(!complete || pending->running)
+            {
+                waiting = waiting || !pending->calling;
+                link = &pending->next;
+                continue;
+            }
+
+            *link = pending->next;
+            freeTrampoline(pending->hook.trampoline);
+            freeStub(reinterpret_cast<::std::uintptr_t>(pending->hook.entry) - pageSize());
+            delete pending;
+        }
+
+        if(!g_pendingDrains)
+        {
+            break;
+        }
+
+        if(!waiting || ::std::chrono::steady_clock::now() >= deadline)
+        {
+            return Status::TimeoutError;
+        }
+
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+    }
+
+    return Status::Success;
+}
+
+} // namespace
+
+Status createHook(void* const target, void* const detour, Hook& hook, const bool drained) noexcept
+{
+    KIERO_TRACE_SPAN(Hook, "createHook");
+
+    const auto* const source = static_cast<const ::std::uint8_t*>(target);
+    const ::std::intptr_t origin = reinterpret_cast<::std::intptr_t>(target);
+
+    constexpr ::std::size_t patchSize = 5;
+
+    Instruction instructions[MaxRelocatedInstructions];
+    ::std::size_t offsets[MaxRelocatedInstructions];
+    ::std::size_t count = 0;
+    ::std::size_t relocated = 0;
+    ::std::size_t overwritten = 0;
+    bool finished = false;
+
+    while(overwritten < patchSize)
+    {
+        Instruction instruction;
+        if(!decode(source + overwritten, instruction))
+        {
+            return Status::NotSupportedError;
+        }
+
+        if(finished)
+        {
+            // The function already ended, only padding may be overwritten
+            if(instruction.kind != InstructionKind::Nop)
+            {
+                return Status::NotSupportedError;
+            }
+
+            overwritten += instruction.length;
+            continue;
+        }
+
+        if(instruction.kind == InstructionKind::Loop || count == MaxRelocatedInstructions)
+        {
+            return Status::NotSupportedError;
+        }
+
+        offsets[count] = overwritten;
+        instructions[count++] = instruction;
+        overwritten += instruction.length;
+        relocated = overwritten;
+
+        finished = instruction.kind == InstructionKind::Return || instruction.kind == InstructionKind::Indirect || instruction.kind == InstructionKind::Jmp;
+    }
+
+    // A jump to the target's stub, which jumps on to the detour. A drained hook's stub and
+    // trampoline are its own, freed once it drained.
+    TargetStub* const stub = drained ? nullptr : findStub(target);
+    ::std::uintptr_t stubCode = stub ? stub->code : 0;
+
+    if(drained)
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_stubsMutex);
+        stubCode = allocateStub(static_cast<::std::uintptr_t>(origin));
+    }
+
+    if(!stubCode)
+    {
+        return Status::UnknownError;
+    }
+
+    void* trampoline = stub ? keptTrampoline(*stub, source, relocated) : nullptr;
+    const bool fresh = !trampoline;
+
+    if(fresh)
+    {
+        trampoline = allocateTrampoline(target);
+        if(!trampoline)
+        {
+            if(drained)
+            {
+                freeStub(stubCode);
+            }
+
+            return Status::UnknownError;
+        }
+    }
+
+    const auto discard = [&]()
+    {
+        if(fresh)
+        {
+            freeTrampoline(trampoline);
+        }
+
+        if(drained)
+        {
+            freeStub(stubCode);
+        }
+    };
+
+    const ::std::intptr_t base = reinterpret_cast<::std::intptr_t>(trampoline);
+    const auto isInternal = [&](const ::std::intptr_t destination)
+    {
+        return destination >= origin && destination < origin + static_cast<::std::intptr_t>(relocated);
+    };
+
+    // First pass: pick a form for every instruction and lay the copies out after the head
+    ::std::size_t newOffsets[MaxRelocatedInstructions];
+    ::std::size_t size = TrampolineHead;
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        const Instruction& instruction = instructions[i];
+        const ::std::intptr_t destination = instruction.branchTarget;
+        const bool reachable = isInternal(destination) || fitsRel32(destination - (base + static_cast<::std::intptr_t>(size) + 6));
+
+        newOffsets[i] = size;
+
+        switch(instruction.kind)
+        {
+        case InstructionKind::Jmp:
+            size += reachable ? 5 : 14;
+            break;
+        case InstructionKind::Jcc:
+            size += reachable ? 6 : 16;
+            break;
+        case InstructionKind::Call:
+            size += reachable ? 5 : 16;
+            break;
+        default:
+            size += instruction.length;
+            break;
+        }
+    }
+
+    // The jump back sits right after the last relocated instruction
+    const ::std::size_t back = size;
+    if(!finished)
+    {
+        size += fitsRel32(origin + static_cast<::std::intptr_t>(relocated) - (base + static_cast<::std::intptr_t>(size) + 5)) ? 5 : 14;
+    }
+
+    if(size > RouteOffset)
+    {
+        discard();
+        return Status::NotSupportedError;
+    }
+
+    // Second pass: emit
+    ::std::uint8_t code[MaxTrampolineSize];
+    (void) ::std::memcpy(code, HeadNop, sizeof(HeadNop));
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        const Instruction& instruction = instructions[i];
+        ::std::uint8_t* const out = code + newOffsets[i];
+        const ::std::intptr_t at = base + static_cast<::std::intptr_t>(newOffsets[i]);
+        const ::std::size_t emitted = (i + 1 < count ? newOffsets[i + 1] : back) - newOffsets[i];
+
+        ::std::intptr_t destination = instruction.branchTarget;
+
+        if(instruction.kind == InstructionKind::Jmp || instruction.kind == InstructionKind::Jcc || instruction.kind == InstructionKind::Call)
+        {
+            if(isInternal(destination))
+            {
+                // Branch back into the copied prologue, follow the copy instead
+                ::std::size_t j = 0;
+                while(j < count && origin + static_cast<::std::intptr_t>(offsets[j]) != destination)
+                {
+                    ++j;
+                }
+
+                if(j == count)
+                {
+                    discard();
+                    return Status::NotSupportedError;
+                }
+
+                destination = base + static_cast<::std::intptr_t>(newOffsets[j]);
+            }
+        }
+
+        switch(instruction.kind)
+        {
+        case InstructionKind::Jmp:
+            if(emitted == 5)
+            {
+                emitJmp(out, at, destination);
+            }
+            else
+            {
+                emitAbsoluteJmp(out, destination);
+            }
+            break;
+        case InstructionKind::Jcc:
+        {
+            const ::std::uint8_t condition = instruction.opcode & 0x0F;
+            if(emitted == 6)
+            {
+                const ::std::int32_t displacement = static_cast<::std::int32_t>(destination - (at + 6));
+                out[0] = 0x0F;
+                out[1] = static_cast<::std::uint8_t>(0x80 | condition);
+                (void) ::std::memcpy(out + 2, &displacement, sizeof(displacement));
+            }
+            else
+            {
+                // Inverted jcc over an absolute jump
+                out[0] = static_cast<::std::uint8_t>(0x70 | (condition ^ 1));
+                out[1] = 14;
+                emitAbsoluteJmp(out + 2, destination);
+            }
+            break;
+        }
+        case InstructionKind::Call:
+            if(emitted == 5)
+            {
+                const ::std::int32_t displacement = static_cast<::std::int32_t>(destination - (at + 5));
+                out[0] = 0xE8;
+                (void) ::std::memcpy(out + 1, &displacement, sizeof(displacement));
+            }
+            else
+            {
+                // call [rip+2]; jmp +8; dq destination
+                constexpr ::std::uint8_t call[] = { 0xFF, 0x15, 0x02, 0x00, 0x00, 0x00, 0xEB, 0x08 };
+                (void) ::std::memcpy(out, call, sizeof(call));
+                (void) ::std::memcpy(out + sizeof(call), &destination, sizeof(destination));
+            }
+            break;
+        default:
+            (void) ::std::memcpy(out, source + offsets[i], instruction.length);
+
+            if(instruction.dispOffset)
+            {
+                ::std::int32_t displacement;
+                (void) ::std::memcpy(&displacement, out + instruction.dispOffset, sizeof(displacement));
+
+                const ::std::intptr_t moved = displacement + (origin + static_cast<::std::intptr_t>(offsets[i])) - at;
+                if(!fitsRel32(moved))
+                {
+                    discard();
+                    return Status::NotSupportedError;
+                }
+
+                displacement = static_cast<::std::int32_t>(moved);
+                (void) ::std::memcpy(out + instruction.dispOffset, &displacement, sizeof(displacement));
+            }
+            break;
+        }
+    }
+
+    if(!finished)
+    {
+        if(size - back == 5)
+        {
+            emitJmp(code + back, base + static_cast<::std::intptr_t>(back), origin + static_cast<::std::intptr_t>(relocated));
+        }
+        else
+        {
+            emitAbsoluteJmp(code + back, origin + static_cast<::std::intptr_t>(relocated));
+        }
+    }
+
+    if(fresh)
+    {
+        writeTrampoline(trampoline, code, size);
+
+        if(stub)
+        {
+            keepTrampoline(*stub, trampoline, source, relocated);
+        }
+    }
+
+    hook.target = target;
+    hook.detour = detour;
+    hook.trampoline = trampoline;
+    hook.patchSize = static_cast<::std::uint8_t>(patchSize);
+    hook.enabled = false;
+    hook.drained = drained;
+
+    hook.entry = reinterpret_cast<void**>(stubCode + pageSize());
+
+    if(drained)
+    {
+        functionRange(detour, hook.detourBegin, hook.detourEnd);
+    }
+
+    emitJmp(hook.patch, origin, static_cast<::std::intptr_t>(stubCode));
+
+    (void) ::std::memcpy(hook.backup, target, patchSize);
+
+    hook.ipCount = static_cast<::std::uint8_t>(count);
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        hook.oldIps[i] = static_cast<::std::uint8_t>(offsets[i]);
+        hook.newIps[i] = static_cast<::std::uint8_t>(newOffsets[i]);
+    }
+
+    return Status::Success;
+}
+
+Status enableHook(Hook& hook) noexcept
+{
+    Hook* const hooks[] = { &hook };
+    return hook.enabled ? Status::Success : setHooks(hooks, 1, nullptr, true);
+}
+
+Status disableHook(Hook& hook) noexcept
+{
+    Hook* const hooks[] = { &hook };
+    return hook.enabled ? setHooks(hooks, 1, nullptr, false) : Status::Success;
+}
+
+Status redirectHook(Hook& hook, void* const detour) noexcept
+{
+    hook.detour = detour;
+
+    if(hook.enabled)
+    {
+        routeStub(hook, detour);
+    }
+
+    return Status::Success;
+}
+
+Status routeTrampoline(Hook& hook, void* const route) noexcept
+{
+    if(hook.route == route)
+    {
+        return Status::Success;
+    }
+
+    writeRoute(hook.trampoline, route);
+    hook.route = route;
+    return Status::Success;
+}
+
+void* trampolineCopy(const Hook& hook) noexcept
+{
+    return static_cast<::std::uint8_t*>(hook.trampoline) + TrampolineHead;
+}
+
+Status enableHooks(Hook* const* const hooks, const ::std::size_t count, Status* const results) noexcept
+{
+    return setHooks(hooks, count, results, true);
+}
+
+Status disableHooks(Hook* const* const hooks, const ::std::size_t count, Status* const results) noexcept
+{
+    return setHooks(hooks, count, results, false);
+}
+
+Status destroyHooks(Hook* const* const hooks, const ::std::size_t count) noexcept
+{
+    // The callers' frames, the calling thread may run a drained detour itself
+#ifdef _MSC_VER
+    const ::std::uintptr_t callers = reinterpret_cast<::std::uintptr_t>(_AddressOfReturnAddress());
+#else
+    const ::std::uintptr_t callers = reinterpret_cast<::std::uintptr_t>(__builtin_frame_address(0));
+#endif
+
+    (void) disableHooks(hooks, count, nullptr);
+
+    const ::std::lock_guard<::std::mutex> lock(g_drainMutex);
+    bool drain = false;
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        if(!hooks[i])
+        {
+            continue;
+        }
+
+        Hook& hook = *hooks[i];
+
+        // A trampoline kept by the target runs its copy for the next hook
+        (void) routeTrampoline(hook, nullptr);
+
+        // A hook still patched in, or without the memory to wait for it, is left as it is
+        if(hook.drained && !hook.enabled)
+        {
+            auto* const pending = new(::std::nothrow) PendingDrain { hook, false, false, g_pendingDrains };
+            if(pending)
+            {
+                g_pendingDrains = pending;
+                drain = true;
+            }
+        }
+
+        hook = Hook { };
+    }
+
+    return drain ? drainLocked(DrainTimeout, callers) : Status::Success;
+}
+
+void destroyHook(Hook& hook) noexcept
+{
+    Hook* const hooks[] = { &hook };
+    (void) destroyHooks(hooks, 1);
+}
+
+Status drainHooks(const ::std::uint32_t timeoutMilliseconds) noexcept
+{
+#ifdef _MSC_VER
+    const ::std::uintptr_t callers = reinterpret_cast<::std::uintptr_t>(_AddressOfReturnAddress());
+#else
+    const ::std::uintptr_t callers = reinterpret_cast<::std::uintptr_t>(__builtin_frame_address(0));
+#endif
+
+    const ::std::lock_guard<::std::mutex> lock(g_drainMutex);
+    return drainLocked(::std::chrono::milliseconds(timeoutMilliseconds), callers);
+}
+
+void writeCode(void* const code, const ::std::uint8_t* const bytes, const ::std::size_t size) noexcept
+{
+    const ::std::uintptr_t address = reinterpret_cast<::std::uintptr_t>(code);
+    const ::std::uintptr_t block8 = address & ~static_cast<::std::uintptr_t>(7);
+    const ::std::uintptr_t block16 = address & ~static_cast<::std::uintptr_t>(15);
+
+    if(address + size <= block8 + 8)
+    {
+        auto* const word = reinterpret_cast<::std::uint64_t*>(block8);
+        ::std::atomic_ref<::std::uint64_t> atomic(*word);
+
+        ::std::uint64_t expected = atomic.load();
+        ::std::uint64_t desired;
+        do
+        {
+            desired = expected;
+            (void) ::std::memcpy(reinterpret_cast<::std::uint8_t*>(&desired) + (address - block8), bytes, size);
+        }
+        while(!atomic.compare_exchange_weak(expected, desired));
+    }
+    else if(address + size <= block16 + 16)
+    {
+        auto* const words = reinterpret_cast<::std::uint64_t*>(block16);
+
+        ::std::uint64_t expected[2];
+        ::std::uint64_t desired[2];
+        (void) ::std::memcpy(expected, words, sizeof(expected));
+        do
+        {
+            (void) ::std::memcpy(desired, expected, sizeof(desired));
+            (void) ::std::memcpy(reinterpret_cast<::std::uint8_t*>(desired) + (address - block16), bytes, size);
+        }
+        while(!compareExchange128(words, expected, desired));
+    }
+    else if(size > 2 && (address & 15) != 15)
+    {
+        // Park arriving threads on a "jmp $" while the tail is written
+        constexpr ::std::uint8_t spin[] = { 0xEB, 0xFE };
+
+        writeCode(code, spin, sizeof(spin));
+        (void) ::std::memcpy(static_cast<::std::uint8_t*>(code) + 2, bytes + 2, size - 2);
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        writeCode(code, bytes, 2);
+    }
+    else
+    {
+        (void) ::std::memcpy(code, bytes, size);
+    }
+
+    flushCode(code, size);
+}
+
+bool unprotectCode(void* const code, const ::std::size_t size, ::std::uint32_t& oldProtection) noexcept
+{
+#ifdef _WIN32
+    DWORD protection;
+    if(!::VirtualProtect(code, size, PAGE_EXECUTE_READWRITE, &protection))
+    {
+        return false;
+    }
+
+    oldProtection = protection;
+    return true;
+#else
+    const ::std::uintptr_t page = pageSize();
+    const ::std::uintptr_t start = reinterpret_cast<::std::uintptr_t>(code) & ~(page - 1);
+    const ::std::uintptr_t end = (reinterpret_cast<::std::uintptr_t>(code) + size + page - 1) & ~(page - 1);
+
+    PatchRun run { start, end, 0, 0, start, 0, false };
+    unprotectRuns(&run, 1);
+
+    oldProtection = run.protection;
+    return run.writable;
+#endif
+}
+
+void protectCode(void* const code, const ::std::size_t size, const ::std::uint32_t oldProtection) noexcept
+{
+#ifdef _WIN32
+    DWORD protection;
+    ::VirtualProtect(code, size, oldProtection, &protection);
+#else
+    const ::std::uintptr_t page = pageSize();
+    const ::std::uintptr_t start = reinterpret_cast<::std::uintptr_t>(code) & ~(page - 1);
+    const ::std::uintptr_t end = (reinterpret_cast<::std::uintptr_t>(code) + size + page - 1) & ~(page - 1);
+
+    ::mprotect(reinterpret_cast<void*>(start), end - start, static_cast<int>(oldProtection));
+#endif
+}
+
+#else
+
+Status createHook(void* const, void* const, Hook&, const bool) noexcept
+{
+    return Status::NotSupportedError;
+}
+
+Status enableHook(Hook&) noexcept
+{
+    return Status::NotSupportedError;
+}
+
+Status disableHook(Hook&) noexcept
+{
+    return Status::NotSupportedError;
+}
+
+Status enableHooks(Hook* const* const, const ::std::size_t count, Status* const results) noexcept
+{
+    for(::std::size_t i = 0; results && i < count; ++i)
+    {
+        results[i] = Status::NotSupportedError;
+    }
+
+    return Status::NotSupportedError;
+}
+
+Status disableHooks(Hook* const* const hooks, const ::std::size_t count, Status* const results) noexcept
+{
+    return enableHooks(hooks, count, results);
+}
+
+Status destroyHooks(Hook* const* const hooks, const ::std::size_t count) noexcept
+{
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        if(hooks[i])
+        {
+            *hooks[i] = Hook { };
+        }
+    }
+
+    return Status::Success;
+}
+
+void destroyHook(Hook& hook) noexcept
+{
+    hook = Hook { };
+}
+
+Status drainHooks(const ::std::uint32_t) noexcept
+{
+    return Status::Success;
+}
+
+void writeCode(void* const code, const ::std::uint8_t* const bytes, const ::std::size_t size) noexcept
+{
+    (void) ::std::memcpy(code, bytes, size);
+}
+
+bool unprotectCode(void* const, const ::std::size_t, ::std::uint32_t&) noexcept
+{
+    return false;
+}
+
+void protectCode(void* const, const ::std::size_t, const ::std::uint32_t) noexcept
+{
+}
+
+#endif
+
+}
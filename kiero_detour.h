@@ -0,0 +1,167 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #define KIERO_DETOUR_SUPPORTED 1
+#else
+    #define KIERO_DETOUR_SUPPORTED 0 // the built-in engine only understands x86-64 code
+#endif
+
+namespace kiero::detail
+{
+	enum class InstructionKind : ::std::uint8_t
+	{
+		Plain,
+
+		Jmp,      // jmp rel8/rel32
+		Jcc,      // jcc rel8/rel32
+		Call,     // call rel32
+		Loop,     // loop/loope/loopne/jrcxz, no rel32 form exists
+
+		Return,   // ret/retf/iret
+		Indirect, // jmp r/m, ends the flow like a return
+		Nop,      // nop/int3 padding
+	};
+
+	struct Instruction
+	{
+		::std::uint8_t length = 0;
+		::std::uint8_t opcode = 0;        // last opcode byte
+		::std::uint8_t dispOffset = 0;    // offset of the RIP-relative disp32, 0 if none
+		InstructionKind kind = InstructionKind::Plain;
+		::std::intptr_t branchTarget = 0; // absolute destination of relative branches
+	};
+
+	// Decodes one x86-64 instruction located at code. Returns false for encodings
+	// the length disassembler does not know.
+	bool decode(const void* const code, Instruction& instruction) noexcept;
+
+	constexpr ::std::size_t MaxPatchSize = 14;
+	constexpr ::std::size_t MaxTrampolineSize = 128;
+	constexpr ::std::size_t MaxRelocatedInstructions = 16;
+
+	struct Hook
+	{
+		void* target = nullptr;
+		void* detour = nullptr;
+		void* trampoline = nullptr;
+
+		::std::uint8_t patchSize = 0;
+		::std::uint8_t patch[MaxPatchSize] { };
+		::std::uint8_t backup[MaxPatchSize] { };
+
+		// Instruction boundaries in the target and their copies in the trampoline,
+		// used to move a suspended thread out of the patched range.
+		::std::uint8_t ipCount = 0;
+		::std::uint8_t oldIps[MaxRelocatedInstructions] { };
+		::std::uint8_t newIps[MaxRelocatedInstructions] { };
+
+		bool enabled = false;
+		bool drained = false; // freed by destroyHooks once no thread runs it
+
+		void** entry = nullptr; // the stub's jump slot
+		void* route = nullptr;  // where the trampoline's head jumps, null while it runs the copy
+
+		// The detour's code, a drained hook waits for no thread to run it
+		::std::uintptr_t detourBegin = 0;
+		::std::uintptr_t detourEnd = 0;
+	};
+
+	// Builds the trampoline for target without touching the target itself. The target is
+	// patched with a jump to a stub near it, which jumps on to the detour through the hook's
+	// entry, calls are not tracked. Trampolines share near-target slabs of MaxTrampolineSize
+	// slots, a target keeps its stub and, while the bytes it copies are unchanged, its slot
+	// across hooks. A trampoline starts with a 5 byte nop its route replaces, then the copy.
+	// A drained hook gets a stub and a trampoline of its own instead, see destroyHooks.
+	Status createHook(void* const target, void* const detour, Hook& hook, const bool drained = false) noexcept;
+
+	// Patches the target / restores the original bytes with the other threads frozen, one
+	// frozen inside the patched range goes on from its instruction's copy in the trampoline.
+	// Calls already past the patch keep running, a disabled hook's stub leads to its trampoline.
+	Status enableHook(Hook& hook) noexcept;
+	Status disableHook(Hook& hook) noexcept;
+
+	// Patches/restores every hook in one pass: targets sharing pages are unprotected
+	// together and the other threads are frozen once for the batch, by suspending them on
+	// Windows and by a signal on Linux.
+	// results receives one status per hook and may be null.
+	Status enableHooks(Hook* const* const hooks, const ::std::size_t count, Status* const results) noexcept;
+	Status disableHooks(Hook* const* const hooks, const ::std::size_t count, Status* const results) noexcept;
+
+	// Disables the hooks if necessary. Their trampolines and stubs stay with the targets, a
+	// detour still running may call the trampoline, so a hook can be destroyed right away.
+	// Drained hooks are waited for instead, up to a second: with the other threads frozen, a
+	// hook is still running while a thread's instruction pointer points into its stub, its
+	// trampoline or its detour, or a word of its stack past the start of the trampoline or the
+	// detour. Stacks of the calling thread's callers count as well. Hooks that drained have their stub and trampoline freed, and their detour
+	// may be unloaded. The others are left to drainHooks, and TimeoutError is returned.
+	Status destroyHooks(Hook* const* const hooks, const ::std::size_t count) noexcept;
+	void destroyHook(Hook& hook) noexcept;
+
+	// Frees the drained hooks destroyHooks left behind once no thread runs them, waiting up to
+	// timeoutMilliseconds. Success when none is left.
+	Status drainHooks(const ::std::uint32_t timeoutMilliseconds) noexcept;
+
+	// Overwrites code with size bytes, atomically whenever the range fits in one
+	// aligned 16 byte block. The caller is responsible for the page protection.
+	void writeCode(void* const code, const ::std::uint8_t* const bytes, const ::std::size_t size) noexcept;
+
+	// Makes the pages of code writable and executable. oldProtection receives their protection,
+	// read from /proc/self/maps on Linux, where a range spanning pages protected differently
+	// fails.
+	bool unprotectCode(void* const code, const ::std::size_t size, ::std::uint32_t& oldProtection) noexcept;
+	void protectCode(void* const code, const ::std::size_t size, const ::std::uint32_t oldProtection) noexcept;
+
+#if KIERO_DETOUR_SUPPORTED
+	// Writable pages within rel32 reach of near for code generated at runtime, sealCode makes
+	// them read-only and executable. size is rounded up to whole pages by all three.
+	[[nodiscard]] void* allocateCode(const void* const near, const ::std::size_t size) noexcept;
+	void sealCode(void* const code, const ::std::size_t size) noexcept;
+	void releaseCode(void* const code, const ::std::size_t size) noexcept;
+
+	// Writes a gate for code that must run after the function it calls: entered with a key in
+	// r11, it calls enter(key, return address), calls the function enter returned with the
+	// caller's arguments, then returns to the address exit returned. A function returned with
+	// UntrackedCall set is jumped to with the caller's return address put back instead, and exit
+	// is not called. It pops the caller's return address and has no unwind information,
+	// exceptions must not cross it. Returns its size, at most MaxGateSize bytes.
+	using GateEnter = void* (*)(const ::std::uintptr_t key, void* const returnAddress) noexcept;
+	using GateExit = void* (*)() noexcept;
+
+	constexpr ::std::size_t MaxGateSize = 512;
+	constexpr ::std::uintptr_t UntrackedCall = ::std::uintptr_t { 1 } << 63; // never set in a user space address
+
+	::std::size_t writeGate(::std::uint8_t* const out, const GateEnter enter, const GateExit exit) noexcept;
+
+	// Makes the hook's stub jump to detour from now on, calls already inside the previous
+	// detour finish in it
+	Status redirectHook(Hook& hook, void* const detour) noexcept;
+
+	// Makes the hook's trampoline jump to route instead of running its copy of the target's
+	// code, null runs the copy again. Calls already past the head finish as they went, the copy
+	// stays callable through trampolineCopy. Destroying the hook clears the route.
+	Status routeTrampoline(Hook& hook, void* const route) noexcept;
+	[[nodiscard]] void* trampolineCopy(const Hook& hook) noexcept;
+#endif
+
+#ifndef _WIN32
+	struct Mapping
+	{
+		::std::uintptr_t start;
+		::std::uintptr_t end;
+
+		bool readable;
+		bool writable;
+		bool executable;
+	};
+
+	// Calls callback for every mapping in /proc/self/maps in address order until it
+	// returns false. Returns false when the maps could not be read.
+	using MappingCallback = bool (*)(void* const context, const Mapping& mapping);
+	bool forEachMapping(const MappingCallback callback, void* const context) noexcept;
+#endif
+}
@@ -0,0 +1,218 @@
+#include "kiero_epoch.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace kiero
+{
+
+namespace
+{
+
+// One per thread that ever entered a section. Records are recycled when their thread exits but
+// never freed, so writers can walk the list without synchronizing with thread exit.
+struct ThreadRecord
+{
+    ::std::atomic<::std::uint64_t> epoch { 0 }; // 0 outside of a section
+    ::std::uint32_t depth = 0;
+
+    ::std::atomic<bool> used { true };
+    ThreadRecord* next = nullptr;
+};
+
+struct Retired
+{
+    void* pointer;
+    void (*deleter)(void*);
+    ::std::uint64_t epoch; // the global epoch before the object was retired
+
+    Retired* next;
+};
+
+::std::atomic<::std::uint64_t> g_epoch { 1 };
+::std::atomic<ThreadRecord*> g_records { nullptr };
+
+::std::mutex g_retiredMutex;
+Retired* g_retired = nullptr;
+
+thread_local ThreadRecord* g_threadRecord = nullptr;
+
+// Gives the record back when its thread exits, only constructed on the thread's first section
+struct RecordOwner
+{
+    ~RecordOwner()
+    {
+        if(g_threadRecord)
+        {
+            g_threadRecord->used.store(false, ::std::memory_order_release);
+            g_threadRecord = nullptr;
+        }
+    }
+};
+
+thread_local RecordOwner g_threadRecordOwner;
+
+[[nodiscard]] ThreadRecord* acquireRecord() noexcept
+{
+    for(ThreadRecord* record = g_records.load(::std::memory_order_acquire); record; record = record->next)
+    {
+        bool used = false;
+        if(!record->used.load(::std::memory_order_relaxed) && record->used.compare_exchange_strong(used, true, ::std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto* record = new(::std::nothrow) ThreadRecord;
+    if(!record)
+    {
+        return nullptr;
+    }
+
+    record->next = g_records.load(::std::memory_order_relaxed);
+    while(!g_records.compare_exchange_weak(record->next, record, ::std::memory_order_release, ::std::memory_order_relaxed))
+    {
+    }
+
+    return record;
+}
+
+// The oldest epoch a reader is still in, UINT64_MAX when there is none
+[[nodiscard]] ::std::uint64_t oldestReader() noexcept
+{
+    // Pairs with the fence in enterEpoch: either the reader's announcement is seen here, or the
+    // reader sees the pointer unpublished before this scan
+    ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+
+    ::std::uint64_t oldest = UINT64_MAX;
+
+    for(ThreadRecord* record = g_records.load(::std::memory_order_acquire); record; record = record->next)
+    {
+        const ::std::uint64_t epoch = record->epoch.load(::std::memory_order_acquire);
+        if(epoch != 0 && epoch < oldest)
+        {
+            oldest = epoch;
+        }
+    }
+
+    return oldest;
+}
+
+// Unlinks the retired objects older than epoch, they are freed outside of the lock
+[[nodiscard]] Retired* collect(const ::std::uint64_t epoch) noexcept
+{
+    Retired* collected = nullptr;
+
+    for(Retired** link = &g_retired; *link;)
+    {
+        Retired* retired = *link;
+
+        if(retired->epoch < epoch)
+        {
+            *link = retired->next;
+            retired->next = collected;
+            collected = retired;
+        }
+        else
+        {
+            link = &retired->next;
+        }
+    }
+
+    return collected;
+}
+
+void release(Retired* retired) noexcept
+{
+    while(retired)
+    {
+        Retired* next = retired->next;
+
+        retired->deleter(retired->pointer);
+        delete retired;
+
+        retired = next;
+    }
+}
+
+}
+
+namespace detail
+{
+
+bool enterEpoch() noexcept
+{
+    ThreadRecord* record = g_threadRecord;
+
+    if(!record)
+    {
+        // Touching the owner registers its destructor for this thread
+        (void) &g_threadRecordOwner;
+
+        record = acquireRecord();
+        if(!record)
+        {
+            return false;
+        }
+
+        g_threadRecord = record;
+    }
+
+    if(record->depth++ == 0)
+    {
+        record->epoch.store(g_epoch.load(::std::memory_order_acquire), ::std::memory_order_relaxed);
+
+        // The announcement must be visible before the section reads any shared pointer
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+    }
+
+    return true;
+}
+
+void exitEpoch() noexcept
+{
+    ThreadRecord* record = g_threadRecord;
+    assert(record && record->depth > 0);
+
+    if(--record->depth == 0)
+    {
+        record->epoch.store(0, ::std::memory_order_release);
+    }
+}
+
+[[nodiscard]] bool inEpoch() noexcept
+{
+    return g_threadRecord && g_threadRecord->depth > 0;
+}
+
+void retire(void* const pointer, void (*const deleter)(void*)) noexcept
+{
+    // Readers entering from now on announce a later epoch and cannot see pointer
+    const ::std::uint64_t epoch = g_epoch.fetch_add(1, ::std::memory_order_seq_cst);
+
+    // Leaking beats waiting, a reader may be blocked in a hooked call
+    auto* retired = new(::std::nothrow) Retired { pointer, deleter, epoch, nullptr };
+    if(!retired)
+    {
+        return;
+    }
+
+    Retired* collected = nullptr;
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_retiredMutex);
+
+        retired->next = g_retired;
+        g_retired = retired;
+
+        collected = collect(oldestReader());
+    }
+
+    release(collected);
+}
+
+}
+
+}
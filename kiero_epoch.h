@@ -0,0 +1,34 @@
+#pragma once
+
+namespace kiero::detail
+{
+	// Epoch based reclamation. A reader announces the global epoch while it may hold pointers to
+	// shared objects, a writer that unpublished an object retires it and it is freed once every
+	// reader announced before the retirement has left. Sections nest and never block. Entering
+	// fails only when the thread's first section cannot allocate its record, the caller must
+	// then do without the shared objects (and not exit).
+	[[nodiscard]] bool enterEpoch() noexcept;
+	void exitEpoch() noexcept;
+
+	// Whether the calling thread is inside a section
+	[[nodiscard]] bool inEpoch() noexcept;
+
+	struct EpochGuard
+	{
+		EpochGuard() noexcept : entered(enterEpoch()) { }
+		~EpochGuard() { if(entered) exitEpoch(); }
+
+		EpochGuard(const EpochGuard&) = delete;
+		EpochGuard& operator=(const EpochGuard&) = delete;
+
+		explicit operator bool() const noexcept { return entered; }
+
+		const bool entered;
+	};
+
+	// Calls deleter(pointer) once no reader can still see pointer, freeing what became safe
+	// along the way. Never waits: what a reader may still see stays until a later retire finds
+	// it free, and pointer is leaked if its own record cannot be allocated. Must be called after
+	// pointer was unpublished.
+	void retire(void* const pointer, void (*const deleter)(void*)) noexcept;
+}
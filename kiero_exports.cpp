@@ -0,0 +1,248 @@
+#include "kiero_exports.h"
+#include "kiero_trace.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# include <Windows.h>
+#else
+# include <dlfcn.h>
+# include <elf.h>
+# include <link.h>
+#endif
+
+namespace kiero::detail
+{
+
+namespace
+{
+
+class ExportMatcher
+{
+public:
+    ExportMatcher(const char* const* const names, const ExportName* const entries, const ::std::size_t count,
+        void** const methods, const ::std::uint16_t begin, const ::std::uint16_t end) noexcept
+        : m_names(names)
+        , m_entries(entries)
+        , m_count(count)
+        , m_methods(methods)
+        , m_begin(begin)
+        , m_end(end)
+    {
+    }
+
+    void match(const ::std::uint32_t hash, const char* const name, void* const address) noexcept
+    {
+        const ExportName* entry = ::std::lower_bound(m_entries, m_entries + m_count, hash, [](const ExportName& e, const ::std::uint32_t h) { return e.hash < h; });
+
+        for(; entry != m_entries + m_count && entry->hash == hash; ++entry)
+        {
+            if(entry->index >= m_begin && entry->index < m_end && !m_methods[entry->index] && ::std::strcmp(m_names[entry->index], name) == 0)
+            {
+                m_methods[entry->index] = address;
+                ++m_written;
+            }
+        }
+    }
+
+    // Asks find(hash, name) for each wanted name instead, for modules that have a hash table
+    template<typename Find>
+    void probe(const Find& find) noexcept
+    {
+        for(::std::size_t i = 0; i < m_count; ++i)
+        {
+            const ExportName& entry = m_entries[i];
+
+            if(entry.index >= m_begin && entry.index < m_end && !m_methods[entry.index])
+            {
+                if(void* const address = find(entry.hash, m_names[entry.index]))
+                {
+                    m_methods[entry.index] = address;
+                    ++m_written;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] ::std::size_t written() const noexcept
+    {
+        return m_written;
+    }
+
+private:
+    const char* const* m_names;
+    const ExportName* m_entries;
+    ::std::size_t m_count;
+
+    void** m_methods;
+    ::std::uint16_t m_begin;
+    ::std::uint16_t m_end;
+
+    ::std::size_t m_written = 0;
+};
+
+#ifdef _WIN32
+void matchExports(const HMODULE module, ExportMatcher& matcher) noexcept
+{
+    const auto* base = reinterpret_cast<const ::std::uint8_t*>(module);
+
+    const auto* dosHeader = reinterpret_cast<const IMAGE_DOS_HEADER*>(base);
+    const auto* ntHeaders = reinterpret_cast<const IMAGE_NT_HEADERS*>(base + dosHeader->e_lfanew);
+    const IMAGE_DATA_DIRECTORY& directory = ntHeaders->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+
+    if(!directory.VirtualAddress || !directory.Size)
+    {
+        return;
+    }
+
+    const auto* exports = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY*>(base + directory.VirtualAddress);
+    const auto* nameRvas = reinterpret_cast<const DWORD*>(base + exports->AddressOfNames);
+    const auto* ordinals = reinterpret_cast<const WORD*>(base + exports->AddressOfNameOrdinals);
+    const auto* functionRvas = reinterpret_cast<const DWORD*>(base + exports->AddressOfFunctions);
+
+    for(DWORD i = 0; i < exports->NumberOfNames; ++i)
+    {
+        const DWORD functionRva = functionRvas[ordinals[i]];
+
+        // Forwarders point to a "module.name" string inside the export directory
+        if(functionRva >= directory.VirtualAddress && functionRva < directory.VirtualAddress + directory.Size)
+        {
+            continue;
+        }
+
+        const auto* name = reinterpret_cast<const char*>(base + nameRvas[i]);
+        matcher.match(hashExportName(name), name, const_cast<::std::uint8_t*>(base + functionRva));
+    }
+}
+#else
+void matchExports(void* const handle, ExportMatcher& matcher) noexcept
+{
+    const link_map* map = nullptr;
+    if(::dlinfo(handle, RTLD_DI_LINKMAP, &map) != 0 || !map || !map->l_ld)
+    {
+        return;
+    }
+
+    const ::std::uintptr_t base = map->l_addr;
+    const auto pointer = [base](const ElfW(Addr) value) { return value < base ? base + value : value; };
+
+    const ElfW(Sym)* symbols = nullptr;
+    const char* strings = nullptr;
+    const ::std::uint16_t* versions = nullptr;
+    const ::std::uint32_t* gnuHash = nullptr;
+    const ::std::uint32_t* sysvHash = nullptr;
+
+    for(const ElfW(Dyn)* entry = map->l_ld; entry->d_tag != DT_NULL; ++entry)
+    {
+        switch(entry->d_tag)
+        {
+        case DT_SYMTAB:
+            symbols = reinterpret_cast<const ElfW(Sym)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_STRTAB:
+            strings = reinterpret_cast<const char*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_VERSYM:
+            versions = reinterpret_cast<const ::std::uint16_t*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_GNU_HASH:
+            gnuHash = reinterpret_cast<const ::std::uint32_t*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_HASH:
+            sysvHash = reinterpret_cast<const ::std::uint32_t*>(pointer(entry->d_un.d_ptr));
+            break;
+        default:
+            break;
+        }
+    }
+
+    if(!symbols || !strings || (!gnuHash && !sysvHash))
+    {
+        return;
+    }
+
+    // Local or hidden (non default) versions and undefined imports never satisfy dlsym either
+    const auto isExported = [symbols, versions](const ::std::uint32_t i)
+    {
+        const ElfW(Sym)& symbol = symbols[i];
+        return symbol.st_shndx != SHN_UNDEF && ELF64_ST_TYPE(symbol.st_info) == STT_FUNC && !(versions && ((versions[i] & 0x8000) || versions[i] == VER_NDX_LOCAL));
+    };
+
+    if(!gnuHash)
+    {
+        // nbuckets, nchains: one chain entry per symbol, walk them all
+        for(::std::uint32_t i = 1; i < sysvHash[1]; ++i)
+        {
+            if(isExported(i))
+            {
+                const char* const name = strings + symbols[i].st_name;
+                matcher.match(hashExportName(name), name, reinterpret_cast<void*>(base + symbols[i].st_value));
+            }
+        }
+
+        return;
+    }
+
+    // nbuckets, symoffset, bloom size, bloom shift, bloom words, buckets, chains. Chains hold
+    // the symbols' hashes with the lowest bit marking the end of each chain.
+    const ::std::uint32_t bucketsCount = gnuHash[0];
+    const ::std::uint32_t symbolsOffset = gnuHash[1];
+    const ::std::uint32_t* buckets = gnuHash + 4 + gnuHash[2] * (sizeof(ElfW(Addr)) / sizeof(::std::uint32_t));
+    const ::std::uint32_t* chains = buckets + bucketsCount;
+
+    if(!bucketsCount)
+    {
+        return;
+    }
+
+    matcher.probe([&](const ::std::uint32_t hash, const char* const name) -> void*
+    {
+        ::std::uint32_t i = buckets[hash % bucketsCount];
+        if(i < symbolsOffset)
+        {
+            return nullptr;
+        }
+
+        for(;; ++i)
+        {
+            const ::std::uint32_t chain = chains[i - symbolsOffset];
+
+            if((chain | 1) == (hash | 1) && isExported(i) && ::std::strcmp(strings + symbols[i].st_name, name) == 0)
+            {
+                return reinterpret_cast<void*>(base + symbols[i].st_value);
+            }
+
+            if(chain & 1)
+            {
+                return nullptr;
+            }
+        }
+    });
+}
+#endif
+
+} // namespace
+
+::std::size_t resolveExports(void* const module, const char* const* const names, const ExportName* const entries, const ::std::size_t count,
+    void** const methods, const ::std::uint16_t begin, const ::std::uint16_t end) noexcept
+{
+    if(!module)
+    {
+        return 0;
+    }
+
+    KIERO_TRACE_SPAN(Init, "resolveExports", Count, end - begin);
+
+    ExportMatcher matcher(names, entries, count, methods, begin, end);
+
+#ifdef _WIN32
+    matchExports(static_cast<HMODULE>(module), matcher);
+#else
+    matchExports(module, matcher);
+#endif
+
+    return matcher.written();
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace kiero::detail
+{
+	// The GNU symbol hash (djb2), the one ELF objects index their exports with in .gnu.hash
+	[[nodiscard]] constexpr ::std::uint32_t hashExportName(const char* name) noexcept
+	{
+		::std::uint32_t hash = 5381;
+
+		while(*name)
+		{
+			hash = hash * 33 + static_cast<unsigned char>(*name++);
+		}
+
+		return hash;
+	}
+
+	struct ExportName
+	{
+		::std::uint32_t hash;
+		::std::uint16_t index; // in the names array the set was made from
+	};
+
+	// A names array hashed and sorted by hash at compile time
+	template<::std::size_t N>
+	struct ExportNames
+	{
+		const char* const* names;
+		ExportName entries[N];
+	};
+
+	template<::std::size_t N>
+	[[nodiscard]] consteval ExportNames<N> makeExportNames(const char* const (&names)[N])
+	{
+		ExportNames<N> set { names, { } };
+
+		for(::std::size_t i = 0; i < N; ++i)
+		{
+			set.entries[i] = ExportName { hashExportName(names[i]), static_cast<::std::uint16_t>(i) };
+		}
+
+		::std::sort(set.entries, set.entries + N, [](const ExportName& a, const ExportName& b) { return a.hash < b.hash; });
+
+		return set;
+	}
+
+	// Stores the address of every export of module (a HMODULE, or a dlopen handle) matching one
+	// of names into methods[index], without the loader's per-name lookup. PE export tables are
+	// walked once, ELF objects are probed through .gnu.hash with the precomputed hashes. Only
+	// the indices in [begin, end) whose entry is still null are written, so modules can be
+	// chained by priority. Forwarded (PE) and IFUNC (ELF) exports are skipped. Returns the
+	// number of entries written.
+	::std::size_t resolveExports(void* const module, const char* const* const names, const ExportName* const entries, const ::std::size_t count,
+		void** const methods, const ::std::uint16_t begin, const ::std::uint16_t end) noexcept;
+
+	template<::std::size_t N>
+	::std::size_t resolveExports(void* const module, const ExportNames<N>& set, void** const methods, const ::std::uint16_t begin = 0, const ::std::uint16_t end = N) noexcept
+	{
+		return resolveExports(module, set.names, set.entries, N, methods, begin, end);
+	}
+}
@@ -0,0 +1,222 @@
+#include "kiero_frame.h"
+#include "kiero_census.h"
+#include "kiero_got.h"
+#include "kiero_limiter.h"
+#include "kiero_stats.h"
+#include "kiero_telemetry.h"
+#include "kiero_trace.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace kiero
+{
+
+namespace
+{
+
+constexpr ::std::size_t MinBlockSize = 64 * 1024;
+
+struct alignas(::std::max_align_t) Block
+{
+    Block* next;
+    ::std::size_t size; // usable bytes after the header
+    ::std::size_t used;
+};
+
+// Blocks of one lifetime, the newest first. Allocations only ever come from the newest.
+struct Region
+{
+    Block* blocks;
+};
+
+// Plain data so the thread_local needs no guard, the owner below frees the blocks
+struct FrameArena
+{
+    Region frame;
+    Region buffered[2]; // NextFrame allocations of the even and the odd frames
+    ::std::uint64_t index;
+    ::std::uint32_t depth;
+
+#if KIERO_TRACE
+    ::std::int64_t traceBegin; // of the outermost scope, 0 when it is not traced
+#endif
+};
+
+thread_local FrameArena g_frameArena;
+
+void releaseBlocks(Block* block) noexcept
+{
+    while(block)
+    {
+        Block* next = block->next;
+        ::operator delete(block);
+        block = next;
+    }
+}
+
+// Frees the thread's blocks when it exits, only constructed once the thread allocates a block
+struct FrameArenaOwner
+{
+    ~FrameArenaOwner()
+    {
+        releaseBlocks(g_frameArena.frame.blocks);
+        releaseBlocks(g_frameArena.buffered[0].blocks);
+        releaseBlocks(g_frameArena.buffered[1].blocks);
+        g_frameArena = FrameArena { };
+    }
+};
+
+thread_local FrameArenaOwner g_frameArenaOwner;
+
+[[nodiscard]] Block* allocateBlock(const ::std::size_t size) noexcept
+{
+    // Touching the owner registers its destructor for this thread
+    (void) &g_frameArenaOwner;
+
+    auto* block = static_cast<Block*>(::operator new(sizeof(Block) + size, ::std::nothrow));
+    if(block)
+    {
+        block->next = nullptr;
+        block->size = size;
+        block->used = 0;
+    }
+
+    return block;
+}
+
+[[nodiscard]] void* allocate(Region& region, const ::std::size_t size, const ::std::size_t alignment) noexcept
+{
+    Block* block = region.blocks;
+
+    if(block)
+    {
+        const ::std::uintptr_t data = reinterpret_cast<::std::uintptr_t>(block + 1);
+        const ::std::uintptr_t address = (data + block->used + alignment - 1) & ~(alignment - 1);
+
+        if(address + size <= data + block->size)
+        {
+            block->used = address + size - data;
+            return reinterpret_cast<void*>(address);
+        }
+    }
+
+    // Grow geometrically so a frame needs few blocks, reset merges them anyway
+    ::std::size_t blockSize = block ? block->size * 2 : MinBlockSize;
+    while(blockSize < size + alignment)
+    {
+        blockSize *= 2;
+    }
+
+    Block* const grown = allocateBlock(blockSize);
+    if(!grown)
+    {
+        return nullptr;
+    }
+
+    grown->next = block;
+    region.blocks = grown;
+
+    return allocate(region, size, alignment);
+}
+
+// Forgets every allocation. A region that needed several blocks is merged into one as large
+// as all of them, so the next frame of the same size allocates nothing from the heap.
+void reset(Region& region) noexcept
+{
+    Block* block = region.blocks;
+    if(!block)
+    {
+        return;
+    }
+
+    if(!block->next)
+    {
+        block->used = 0;
+        return;
+    }
+
+    ::std::size_t size = 0;
+    for(Block* counted = block; counted; counted = counted->next)
+    {
+        size += counted->size;
+    }
+
+    releaseBlocks(block);
+
+    // On failure the next allocation grows the region again
+    region.blocks = allocateBlock(size);
+}
+
+}
+
+void* frameAllocate(const ::std::size_t size, const ::std::size_t alignment, const FrameLifetime lifetime) noexcept
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    FrameArena& arena = g_frameArena;
+    Region& region = lifetime == FrameLifetime::Frame ? arena.frame : arena.buffered[arena.index & 1];
+
+    return allocate(region, size, alignment);
+}
+
+void endFrame() noexcept
+{
+    FrameArena& arena = g_frameArena;
+
+    ++arena.index;
+
+    // The buffered region of the new frame holds the allocations of the frame before the last
+    reset(arena.frame);
+    reset(arena.buffered[arena.index & 1]);
+}
+
+::std::uint64_t getFrameIndex() noexcept
+{
+    return g_frameArena.index;
+}
+
+FrameScope::FrameScope() noexcept
+{
+    if(g_frameArena.depth++ == 0)
+    {
+#if KIERO_TRACE
+        g_frameArena.traceBegin = detail::isTracing(detail::TraceCategory::Frame) ? detail::traceTime() : 0;
+#endif
+
+        const ::std::int64_t time = detail::beginPresent();
+        const ::std::uint32_t interval = detail::recordPresent(time);
+        detail::recordCensusFrame();
+        detail::publishPresent(time, interval);
+
+#ifndef _WIN32
+        detail::followGotLoads();
+#endif
+    }
+}
+
+FrameScope::~FrameScope()
+{
+    FrameArena& arena = g_frameArena;
+    assert(arena.depth > 0);
+
+    if(--arena.depth == 0)
+    {
+        endFrame();
+        detail::endPresent();
+
+#if KIERO_TRACE
+        // Spans the whole boundary call, the limiter's waits included
+        if(arena.traceBegin != 0)
+        {
+            detail::recordTrace(detail::TraceCategory::Frame, "frameBoundary", arena.traceBegin, detail::traceTime(), detail::TraceArgument::Frame,
+                static_cast<::std::int32_t>(arena.index - 1));
+            arena.traceBegin = 0;
+        }
+#endif
+    }
+}
+
+}
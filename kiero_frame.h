@@ -0,0 +1,110 @@
+#pragma once
+
+#include "kiero_methods.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace kiero
+{
+	enum class FrameLifetime
+	{
+		Frame,     // released when the calling thread's frame ends
+		NextFrame, // double buffered, released when the frame after it ends
+	};
+
+	// Bump allocates from the calling thread's frame arena, without locks and without freeing
+	// anything until the frame ends. Returns null when out of memory. Nothing allocated here
+	// is destroyed, the arena only suits trivially destructible data or objects whose
+	// destructor does not matter.
+	[[nodiscard]] void* frameAllocate(const ::std::size_t size, const ::std::size_t alignment = alignof(::std::max_align_t), const FrameLifetime lifetime = FrameLifetime::Frame) noexcept;
+
+	// Ends the calling thread's frame: its Frame allocations and the NextFrame allocations of
+	// the frame before are released. Called by FrameScope, the thunks and the dispatchers of
+	// the frame boundaries.
+	void endFrame() noexcept;
+
+	// The number of frames the calling thread ended
+	[[nodiscard]] ::std::uint64_t getFrameIndex() noexcept;
+
+	// Ends the frame when the outermost scope of the thread is left. The frame limiter
+	// (kiero_limiter.h) waits in both ends, kiero_stats.h and kiero_telemetry.h record the
+	// boundary, kiero_census.h closes its frame. Put one at the top of a detour bound to a frame boundary with kiero::bind:
+	//
+	//   HRESULT __stdcall hkPresent(IDXGISwapChain* swapChain, UINT syncInterval, UINT flags)
+	//   {
+	//     kiero::FrameScope frame;
+	//     auto* vertices = static_cast<ImDrawVert*>(kiero::frameAllocate(count * sizeof(ImDrawVert)));
+	//     ...
+	//     return oPresent(swapChain, syncInterval, flags);
+	//   }
+	struct FrameScope
+	{
+		FrameScope() noexcept;
+		~FrameScope();
+
+		FrameScope(const FrameScope&) = delete;
+		FrameScope& operator=(const FrameScope&) = delete;
+	};
+
+	// The calls ending a frame, bindThunk and subscribe end the frame after them on their own
+	template<typename M>
+	inline constexpr bool isFrameBoundary =
+		::std::is_same_v<M, d3d9::IDirect3DDevice9::Present> ||
+		::std::is_same_v<M, d3d9::IDirect3DDevice9::EndScene> ||
+		::std::is_same_v<M, d3d10::IDXGISwapChain::Present> ||
+		::std::is_same_v<M, d3d11::IDXGISwapChain::Present> ||
+		::std::is_same_v<M, d3d12::IDXGISwapChain::Present> ||
+		(M::renderType == RenderType::OpenGL && M::index >= opengl::SwapBuffers::Offset) ||
+		::std::is_same_v<M, vulkan::vkQueuePresentKHR>;
+
+	// A standard allocator over the frame arena, deallocate does nothing:
+	//
+	//   ::std::vector<ImDrawVert, kiero::FrameAllocator<ImDrawVert>> vertices;
+	template<typename T, FrameLifetime Lifetime = FrameLifetime::Frame>
+	struct FrameAllocator
+	{
+		using value_type = T;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = FrameAllocator<U, Lifetime>;
+		};
+
+		FrameAllocator() noexcept = default;
+
+		template<typename U>
+		FrameAllocator(const FrameAllocator<U, Lifetime>&) noexcept
+		{
+		}
+
+		[[nodiscard]] T* allocate(const ::std::size_t count)
+		{
+			if(count > SIZE_MAX / sizeof(T))
+			{
+				throw ::std::bad_array_new_length();
+			}
+
+			void* const memory = frameAllocate(count * sizeof(T), alignof(T), Lifetime);
+			if(!memory)
+			{
+				throw ::std::bad_alloc();
+			}
+
+			return static_cast<T*>(memory);
+		}
+
+		void deallocate(T* const, const ::std::size_t) noexcept
+		{
+		}
+
+		template<typename U>
+		bool operator==(const FrameAllocator<U, Lifetime>&) const noexcept
+		{
+			return true;
+		}
+	};
+}
@@ -0,0 +1,755 @@
+#include "kiero_got.h"
+#include "kiero_trace.h"
+
+#ifndef _WIN32
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <new>
+
+#include <dlfcn.h>
+#include <elf.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__x86_64__)
+# define KIERO_R_JUMP_SLOT R_X86_64_JUMP_SLOT
+# define KIERO_R_GLOB_DAT  R_X86_64_GLOB_DAT
+#elif defined(__aarch64__)
+# define KIERO_R_JUMP_SLOT R_AARCH64_JUMP_SLOT
+# define KIERO_R_GLOB_DAT  R_AARCH64_GLOB_DAT
+#else
+# error "GOT hooks only know the x86-64 and AArch64 relocation types"
+#endif
+
+namespace kiero::detail
+{
+
+namespace
+{
+
+::std::mutex g_gotMutex;
+
+GotHook* g_gotHooks = nullptr;
+
+// NUL separated names, terminated by an empty one. Null when every object is patched.
+char* g_gotModules = nullptr;
+char g_executablePath[4096] = { };
+
+// dlpi_adds and dlpi_subs when the enabled hooks were last applied, objects were loaded or
+// unloaded since when they moved
+unsigned long long g_gotAdds = 0;
+unsigned long long g_gotSubs = 0;
+
+// Whether any hook is enabled, read by the frame boundaries without the lock
+::std::atomic<bool> g_gotFollowing { false };
+
+struct ObjectTables
+{
+    ::std::uintptr_t base = 0;
+    const ElfW(Sym)* symbols = nullptr;
+    const char* strings = nullptr;
+    ::std::size_t stringsSize = 0;
+
+    const ElfW(Rela)* relocations[2] = { }; // DT_JMPREL, DT_RELA
+    ::std::size_t relocationsSize[2] = { };
+    ::std::size_t relativeCount = 0;        // leading R_*_RELATIVE entries of DT_RELA, skipped
+    bool rela = true;
+
+    const ElfW(Half)* versions = nullptr;   // DT_VERSYM, per symbol
+    const ElfW(Verneed)* needs = nullptr;
+    ::std::size_t needsCount = 0;
+    const ElfW(Verdef)* definitions = nullptr;
+    ::std::size_t definitionsCount = 0;
+
+    ::std::uintptr_t relroStart = 0;
+    ::std::uintptr_t relroEnd = 0;
+
+    ::std::uintptr_t start = UINTPTR_MAX; // span of the PT_LOAD segments
+    ::std::uintptr_t end = 0;
+};
+
+void readDynamic(const ::std::uintptr_t base, const ElfW(Dyn)* const dynamic, ObjectTables& tables) noexcept
+{
+    // glibc relocates the pointers of the dynamic section in place, other loaders (and the vDSO) don't
+    const auto pointer = [base](const ElfW(Addr) value) { return value < base ? base + value : value; };
+
+    tables.base = base;
+
+    for(const ElfW(Dyn)* entry = dynamic; entry->d_tag != DT_NULL; ++entry)
+    {
+        switch(entry->d_tag)
+        {
+        case DT_SYMTAB:
+            tables.symbols = reinterpret_cast<const ElfW(Sym)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_STRTAB:
+            tables.strings = reinterpret_cast<const char*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_STRSZ:
+            tables.stringsSize = entry->d_un.d_val;
+            break;
+        case DT_JMPREL:
+            tables.relocations[0] = reinterpret_cast<const ElfW(Rela)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_PLTRELSZ:
+            tables.relocationsSize[0] = entry->d_un.d_val;
+            break;
+        case DT_PLTREL:
+            tables.rela = entry->d_un.d_val == DT_RELA;
+            break;
+        case DT_RELA:
+            tables.relocations[1] = reinterpret_cast<const ElfW(Rela)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_RELASZ:
+            tables.relocationsSize[1] = entry->d_un.d_val;
+            break;
+        case DT_RELACOUNT:
+            tables.relativeCount = entry->d_un.d_val;
+            break;
+        case DT_VERSYM:
+            tables.versions = reinterpret_cast<const ElfW(Half)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_VERNEED:
+            tables.needs = reinterpret_cast<const ElfW(Verneed)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_VERNEEDNUM:
+            tables.needsCount = entry->d_un.d_val;
+            break;
+        case DT_VERDEF:
+            tables.definitions = reinterpret_cast<const ElfW(Verdef)*>(pointer(entry->d_un.d_ptr));
+            break;
+        case DT_VERDEFNUM:
+            tables.definitionsCount = entry->d_un.d_val;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+bool readTables(const dl_phdr_info& info, ObjectTables& tables) noexcept
+{
+    const ElfW(Dyn)* dynamic = nullptr;
+    const ::std::uintptr_t base = info.dlpi_addr;
+
+    for(ElfW(Half) i = 0; i < info.dlpi_phnum; ++i)
+    {
+        const ElfW(Phdr)& header = info.dlpi_phdr[i];
+
+        if(header.p_type == PT_DYNAMIC)
+        {
+            dynamic = reinterpret_cast<const ElfW(Dyn)*>(base + header.p_vaddr);
+        }
+        else if(header.p_type == PT_GNU_RELRO)
+        {
+            const ::std::uintptr_t pageSize = static_cast<::std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+
+            tables.relroStart = (base + header.p_vaddr) & ~(pageSize - 1);
+            tables.relroEnd = (base + header.p_vaddr + header.p_memsz) & ~(pageSize - 1); // the partial page stays writable
+        }
+        else if(header.p_type == PT_LOAD)
+        {
+            tables.start = ::std::min<::std::uintptr_t>(tables.start, base + header.p_vaddr);
+            tables.end = ::std::max<::std::uintptr_t>(tables.end, base + header.p_vaddr + header.p_memsz);
+        }
+    }
+
+    if(!dynamic)
+    {
+        return false;
+    }
+
+    readDynamic(base, dynamic, tables);
+
+    return tables.rela && tables.symbols && tables.strings;
+}
+
+// The version the object's import of symbol asks for, null when it asks for none. False when
+// the version index is not one the object needs.
+bool findNeededVersion(const ObjectTables& tables, const ::std::size_t symbol, const char*& version) noexcept
+{
+    version = nullptr;
+
+    const ElfW(Half) index = tables.versions ? tables.versions[symbol] & 0x7fff : 0;
+    if(index <= VER_NDX_GLOBAL)
+    {
+        return true;
+    }
+
+    const ElfW(Verneed)* need = tables.needs;
+
+    for(::std::size_t i = 0; need && i < tables.needsCount; ++i)
+    {
+        const auto* aux = reinterpret_cast<const ElfW(Vernaux)*>(reinterpret_cast<const char*>(need) + need->vn_aux);
+
+        for(ElfW(Half) j = 0; j < need->vn_cnt; ++j)
+        {
+            if(aux->vna_other == index)
+            {
+                version = aux->vna_name < tables.stringsSize ? tables.strings + aux->vna_name : nullptr;
+                return version != nullptr;
+            }
+
+            aux = reinterpret_cast<const ElfW(Vernaux)*>(reinterpret_cast<const char*>(aux) + aux->vna_next);
+        }
+
+        need = need->vn_next ? reinterpret_cast<const ElfW(Verneed)*>(reinterpret_cast<const char*>(need) + need->vn_next) : nullptr;
+    }
+
+    return false;
+}
+
+// The version the defining object gives symbol, empty when it gives none (or a hidden one)
+void findDefinedVersion(const ObjectTables& tables, const ::std::size_t symbol, char (&version)[MaxVersionLength]) noexcept
+{
+    version[0] = '\0';
+
+    const ElfW(Half) index = tables.versions ? tables.versions[symbol] : 0;
+    if((index & 0x8000) || index <= VER_NDX_GLOBAL)
+    {
+        return;
+    }
+
+    const ElfW(Verdef)* definition = tables.definitions;
+
+    for(::std::size_t i = 0; definition && i < tables.definitionsCount; ++i)
+    {
+        if(definition->vd_ndx == index && definition->vd_cnt)
+        {
+            const auto* const aux = reinterpret_cast<const ElfW(Verdaux)*>(reinterpret_cast<const char*>(definition) + definition->vd_aux);
+
+            if(aux->vda_name < tables.stringsSize && ::std::strlen(tables.strings + aux->vda_name) < MaxVersionLength)
+            {
+                (void) ::std::strcpy(version, tables.strings + aux->vda_name);
+            }
+
+            return;
+        }
+
+        definition = definition->vd_next ? reinterpret_cast<const ElfW(Verdef)*>(reinterpret_cast<const char*>(definition) + definition->vd_next) : nullptr;
+    }
+}
+
+// Where a lazily bound JUMP_SLOT will go once called: lazy binding looks the global scope up
+// first, and the hook looked it up for either kind of import before the pass (dlsym can't be
+// called under dl_iterate_phdr). Imports only the object's local scope resolves, or asking for
+// another version, are left alone, as are those of an object defining the symbol itself
+// (DT_SYMBOLIC and RTLD_DEEPBIND bind to that).
+bool bindsToTarget(const ObjectTables& tables, const ::std::size_t symbol, const GotHook& hook) noexcept
+{
+    const ElfW(Sym)& entry = tables.symbols[symbol];
+    if(entry.st_shndx != SHN_UNDEF && reinterpret_cast<void*>(tables.base + entry.st_value) != hook.target)
+    {
+        return false;
+    }
+
+    const char* version = nullptr;
+    if(!findNeededVersion(tables, symbol, version))
+    {
+        return false;
+    }
+
+    if(!version)
+    {
+        return hook.lookup == hook.target;
+    }
+
+    return hook.version[0] && ::std::strcmp(version, hook.version) == 0 && hook.versionedLookup == hook.target;
+}
+
+// Makes the RELRO pages writable the first time a slot inside them is written
+class RelroWindow
+{
+public:
+    explicit RelroWindow(const ObjectTables& tables) noexcept
+        : m_tables(tables)
+    {
+    }
+
+    ~RelroWindow()
+    {
+        if(m_unprotected)
+        {
+            ::mprotect(reinterpret_cast<void*>(m_tables.relroStart), m_tables.relroEnd - m_tables.relroStart, PROT_READ);
+        }
+    }
+
+    RelroWindow(const RelroWindow&) = delete;
+    RelroWindow& operator=(const RelroWindow&) = delete;
+
+    bool write(void** const slot, void* const value) noexcept
+    {
+        const auto address = reinterpret_cast<::std::uintptr_t>(slot);
+
+        if(!m_unprotected && address >= m_tables.relroStart && address < m_tables.relroEnd)
+        {
+            if(::mprotect(reinterpret_cast<void*>(m_tables.relroStart), m_tables.relroEnd - m_tables.relroStart, PROT_READ | PROT_WRITE) != 0)
+            {
+                return false;
+            }
+
+            m_unprotected = true;
+        }
+
+        ::std::atomic_ref<void*>(*slot).store(value, ::std::memory_order_release);
+        return true;
+    }
+
+private:
+    const ObjectTables& m_tables;
+    bool m_unprotected = false;
+};
+
+bool isSelected(const char* name) noexcept
+{
+    if(!g_gotModules)
+    {
+        return true;
+    }
+
+    if(!name || !name[0])
+    {
+        name = g_executablePath;
+    }
+
+    for(const char* module = g_gotModules; *module; module += ::std::strlen(module) + 1)
+    {
+        if(::std::strstr(name, module))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool reserveSlot(GotHook& hook) noexcept
+{
+    if(hook.slotsCount < hook.slotsCapacity)
+    {
+        return true;
+    }
+
+    const ::std::size_t capacity = hook.slotsCapacity ? hook.slotsCapacity * 2 : 8;
+
+    auto* const slots = new(::std::nothrow) GotSlot [capacity];
+    if(!slots)
+    {
+        return false;
+    }
+
+    if(hook.slotsCount)
+    {
+        (void) ::std::memcpy(slots, hook.slots, hook.slotsCount * sizeof(GotSlot));
+    }
+
+    delete[] hook.slots;
+    hook.slots = slots;
+    hook.slotsCapacity = capacity;
+
+    return true;
+}
+
+struct PatchPass
+{
+    GotHook* const* hooks;
+    ::std::size_t count;
+};
+
+int patchObject(dl_phdr_info* const info, const ::std::size_t, void* const context) noexcept
+{
+    const auto& pass = *static_cast<const PatchPass*>(context);
+
+    if(!isSelected(info->dlpi_name))
+    {
+        return 0;
+    }
+
+    ObjectTables tables;
+    if(!readTables(*info, tables))
+    {
+        return 0;
+    }
+
+    RelroWindow window(tables);
+
+    for(::std::size_t i = 0; i < ::std::size(tables.relocations); ++i)
+    {
+        const ElfW(Rela)* const relocations = tables.relocations[i];
+        const ::std::size_t relocationsCount = tables.relocationsSize[i] / sizeof(ElfW(Rela));
+
+        for(::std::size_t j = i == 1 ? tables.relativeCount : 0; relocations && j < relocationsCount; ++j)
+        {
+            const ElfW(Rela)& relocation = relocations[j];
+            const auto type = ELF64_R_TYPE(relocation.r_info);
+            const auto symbol = ELF64_R_SYM(relocation.r_info);
+
+            if((type != KIERO_R_JUMP_SLOT && type != KIERO_R_GLOB_DAT) || symbol == 0 || tables.symbols[symbol].st_name >= tables.stringsSize)
+            {
+                continue;
+            }
+
+            const char* const name = tables.strings + tables.symbols[symbol].st_name;
+
+            for(::std::size_t k = 0; k < pass.count; ++k)
+            {
+                GotHook& hook = *pass.hooks[k];
+
+                if(::std::strcmp(name, hook.symbol) != 0)
+                {
+                    continue;
+                }
+
+                auto** const slot = reinterpret_cast<void**>(info->dlpi_addr + relocation.r_offset);
+                void* const value = *slot;
+
+                // A JUMP_SLOT pointing into its own object was never called, it still holds the lazy binding stub
+                const auto address = reinterpret_cast<::std::uintptr_t>(value);
+                const bool unbound = type == KIERO_R_JUMP_SLOT && address >= tables.start && address < tables.end && bindsToTarget(tables, symbol, hook);
+
+                if(value != hook.function && (value == hook.target || unbound) && reserveSlot(hook) && window.write(slot, hook.function))
+                {
+                    hook.slots[hook.slotsCount++] = GotSlot { slot, value, info->dlpi_addr, info->dlpi_phdr, true };
+                }
+
+                break;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int restoreObject(dl_phdr_info* const info, const ::std::size_t, void* const context) noexcept
+{
+    const auto& hook = *static_cast<const GotHook*>(context);
+
+    ObjectTables tables;
+    if(!readTables(*info, tables))
+    {
+        return 0;
+    }
+
+    RelroWindow window(tables);
+
+    // Only slots of objects that are still loaded, the others went away with their object
+    for(::std::size_t i = 0; i < hook.slotsCount; ++i)
+    {
+        const GotSlot& slot = hook.slots[i];
+        const auto address = reinterpret_cast<::std::uintptr_t>(slot.address);
+
+        if(slot.base == info->dlpi_addr && slot.headers == info->dlpi_phdr && address >= tables.start && address < tables.end && *slot.address == hook.function)
+        {
+            (void) window.write(slot.address, slot.previous);
+        }
+    }
+
+    return 0;
+}
+
+// What the imports of each hook's symbol bind to, for unbound slots
+void lookUpTargets(GotHook* const* const hooks, const ::std::size_t count) noexcept
+{
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        GotHook& hook = *hooks[i];
+
+        hook.lookup = ::dlsym(RTLD_DEFAULT, hook.symbol);
+        hook.versionedLookup = hook.version[0] ? ::dlvsym(RTLD_DEFAULT, hook.symbol, hook.version) : nullptr;
+    }
+}
+
+void runPass(GotHook* const* const hooks, const ::std::size_t count) noexcept
+{
+    lookUpTargets(hooks, count);
+
+    PatchPass pass { hooks, count };
+    (void) ::dl_iterate_phdr(patchObject, &pass);
+}
+
+void restoreHook(GotHook& hook) noexcept
+{
+    (void) ::dl_iterate_phdr(restoreObject, &hook);
+
+    delete[] hook.slots;
+    hook.slots = nullptr;
+    hook.slotsCount = 0;
+    hook.slotsCapacity = 0;
+}
+
+void unlinkHook(GotHook& hook) noexcept
+{
+    for(GotHook** link = &g_gotHooks; *link; link = &(*link)->next)
+    {
+        if(*link == &hook)
+        {
+            *link = hook.next;
+            break;
+        }
+    }
+
+    hook.next = nullptr;
+}
+
+struct LoadCounts
+{
+    unsigned long long adds;
+    unsigned long long subs;
+};
+
+int readCounts(dl_phdr_info* const info, const ::std::size_t, void* const context) noexcept
+{
+    // Every object reports the same counts, the first one is enough
+    *static_cast<LoadCounts*>(context) = { info->dlpi_adds, info->dlpi_subs };
+    return 1;
+}
+
+int markLoaded(dl_phdr_info* const info, const ::std::size_t, void* const context) noexcept
+{
+    for(GotHook* hook = static_cast<GotHook*>(context); hook; hook = hook->next)
+    {
+        for(::std::size_t i = 0; i < hook->slotsCount; ++i)
+        {
+            GotSlot& slot = hook->slots[i];
+            if(slot.base == info->dlpi_addr && slot.headers == info->dlpi_phdr)
+            {
+                slot.loaded = true;
+            }
+        }
+    }
+
+    return 0;
+}
+
+// Drops the slots of the objects unloaded since, an object loaded at the same address later
+// must not get their previous values back
+void forgetUnloaded() noexcept
+{
+    for(GotHook* hook = g_gotHooks; hook; hook = hook->next)
+    {
+        for(::std::size_t i = 0; i < hook->slotsCount; ++i)
+        {
+            hook->slots[i].loaded = false;
+        }
+    }
+
+    (void) ::dl_iterate_phdr(markLoaded, g_gotHooks);
+
+    for(GotHook* hook = g_gotHooks; hook; hook = hook->next)
+    {
+        const GotSlot* const end = ::std::remove_if(hook->slots, hook->slots + hook->slotsCount, [](const GotSlot& slot) { return !slot.loaded; });
+        hook->slotsCount = static_cast<::std::size_t>(end - hook->slots);
+    }
+}
+
+// Applies the enabled hooks to the objects loaded since the last time, the slots already
+// patched are skipped, and forgets the slots of the objects unloaded. Costs one
+// dl_iterate_phdr step when nothing was loaded or unloaded.
+void followLoads() noexcept
+{
+    LoadCounts counts { };
+    (void) ::dl_iterate_phdr(readCounts, &counts);
+
+    if(counts.subs != g_gotSubs)
+    {
+        forgetUnloaded();
+        g_gotSubs = counts.subs;
+    }
+
+    const unsigned long long adds = counts.adds;
+    if(adds == g_gotAdds)
+    {
+        return;
+    }
+
+    ::std::size_t count = 0;
+    for(GotHook* hook = g_gotHooks; hook; hook = hook->next)
+    {
+        ++count;
+    }
+
+    if(!count)
+    {
+        g_gotAdds = adds;
+        return;
+    }
+
+    // Retried on the next call when out of memory
+    auto* const hooks = new(::std::nothrow) GotHook* [count];
+    if(!hooks)
+    {
+        return;
+    }
+
+    count = 0;
+    for(GotHook* hook = g_gotHooks; hook; hook = hook->next)
+    {
+        hooks[count++] = hook;
+    }
+
+    runPass(hooks, count);
+    delete[] hooks;
+
+    g_gotAdds = adds;
+}
+
+} // namespace
+
+Status createGotHook(void* const target, void* const function, GotHook& hook) noexcept
+{
+    Dl_info info;
+    if(!::dladdr(target, &info) || !info.dli_sname || info.dli_saddr != target)
+    {
+        return Status::NotSupportedError;
+    }
+
+    const ::std::size_t length = ::std::strlen(info.dli_sname);
+    if(length >= MaxSymbolLength)
+    {
+        return Status::NotSupportedError;
+    }
+
+    (void) ::std::memcpy(hook.symbol, info.dli_sname, length + 1);
+    hook.target = target;
+    hook.function = function;
+
+    // Versioned imports bind to the target only when asking for its version
+    void* entry = nullptr;
+    void* object = nullptr;
+
+    if(::dladdr1(target, &info, &entry, RTLD_DL_SYMENT) && entry && ::dladdr1(target, &info, &object, RTLD_DL_LINKMAP) && object)
+    {
+        const auto* const symbol = static_cast<const ElfW(Sym)*>(entry);
+        const auto* const map = static_cast<const link_map*>(object);
+
+        ObjectTables tables;
+        readDynamic(map->l_addr, map->l_ld, tables);
+
+        if(tables.symbols && tables.strings && symbol >= tables.symbols)
+        {
+            findDefinedVersion(tables, static_cast<::std::size_t>(symbol - tables.symbols), hook.version);
+        }
+    }
+
+    return Status::Success;
+}
+
+Status enableGotHooks(GotHook* const* const hooks, const ::std::size_t count, Status* const results) noexcept
+{
+    KIERO_TRACE_SPAN(Hook, "enableGotHooks", Count, count);
+
+    const ::std::lock_guard<::std::mutex> lock(g_gotMutex);
+
+    // The hooks enabled already catch up first, this pass only covers the new ones
+    followLoads();
+    runPass(hooks, count);
+
+    Status overall = Status::Success;
+
+    for(::std::size_t i = 0; i < count; ++i)
+    {
+        GotHook& hook = *hooks[i];
+        const Status status = hook.slotsCount ? Status::Success : Status::ModuleNotFoundError;
+
+        if(status == Status::Success)
+        {
+            hook.next = g_gotHooks;
+            g_gotHooks = &hook;
+            g_gotFollowing.store(true, ::std::memory_order_relaxed);
+        }
+        else
+        {
+            overall = status;
+        }
+
+        if(results)
+        {
+            results[i] = status;
+        }
+    }
+
+    return overall;
+}
+
+void disableGotHook(GotHook& hook) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_gotMutex);
+
+    unlinkHook(hook);
+    restoreHook(hook);
+
+    followLoads();
+    g_gotFollowing.store(g_gotHooks != nullptr, ::std::memory_order_relaxed);
+}
+
+void updateGotHooks() noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_gotMutex);
+
+    followLoads();
+}
+
+void followGotLoads() noexcept
+{
+    if(!g_gotFollowing.load(::std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // A frame never waits for a bind, the next one catches up
+    const ::std::unique_lock<::std::mutex> lock(g_gotMutex, ::std::try_to_lock);
+    if(lock.owns_lock())
+    {
+        followLoads();
+    }
+}
+
+bool setGotModules(const ::std::span<const char* const> modules) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_gotMutex);
+
+    delete[] g_gotModules;
+    g_gotModules = nullptr;
+
+    if(modules.empty())
+    {
+        return true;
+    }
+
+    ::std::size_t size = 1;
+    for(const char* const module : modules)
+    {
+        size += ::std::strlen(module) + 1;
+    }
+
+    g_gotModules = new(::std::nothrow) char [size];
+    if(!g_gotModules)
+    {
+        return false;
+    }
+
+    char* p = g_gotModules;
+    for(const char* const module : modules)
+    {
+        const ::std::size_t length = ::std::strlen(module) + 1;
+        (void) ::std::memcpy(p, module, length);
+        p += length;
+    }
+
+    *p = '\0';
+
+    // dl_iterate_phdr reports the executable without a name
+    const ::ssize_t length = ::readlink("/proc/self/exe", g_executablePath, sizeof(g_executablePath) - 1);
+    g_executablePath[length > 0 ? length : 0] = '\0';
+
+    return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#ifndef _WIN32
+namespace kiero::detail
+{
+	constexpr ::std::size_t MaxSymbolLength = 128;
+	constexpr ::std::size_t MaxVersionLength = 64;
+
+	struct GotSlot
+	{
+		void** address;
+		void* previous;        // restored on disable
+		::std::uintptr_t base; // load address of the object owning the slot
+		const void* headers;   // and its program headers, together they tell the object apart
+		bool loaded;           // found by the latest look for unloaded objects
+	};
+
+	struct GotHook
+	{
+		char symbol[MaxSymbolLength] { };
+		char version[MaxVersionLength] { }; // of the target's symbol, empty when unversioned
+		void* target = nullptr;
+		void* function = nullptr;
+
+		// What an unversioned and a versioned import of symbol bind to, before each pass
+		void* lookup = nullptr;
+		void* versionedLookup = nullptr;
+
+		GotSlot* slots = nullptr;
+		::std::size_t slotsCount = 0;
+		::std::size_t slotsCapacity = 0;
+
+		GotHook* next = nullptr; // enabled hooks, re-applied to objects loaded later
+	};
+
+	// Looks up the exported symbol starting at target, nothing is patched yet. Fails with
+	// NotSupportedError when target is not the start of an exported symbol.
+	Status createGotHook(void* const target, void* const function, GotHook& hook) noexcept;
+
+	// Rewrites the JUMP_SLOT/GLOB_DAT entries naming each hook's symbol in every loaded object in
+	// a single pass. Only entries that resolve to the target are touched, a lazy entry still
+	// pointing to its binding stub when the global scope binds its import (of the target's
+	// version) to the target. results receives ModuleNotFoundError for hooks no loaded object
+	// imports, and may be null. dlopen is not hooked: the hooks enabled already are applied to
+	// the objects loaded since (dlpi_adds moved) by this, disableGotHook, updateGotHooks and
+	// every frame boundary (followGotLoads). The slots of objects unloaded since (dlpi_subs
+	// moved) are forgotten then.
+	Status enableGotHooks(GotHook* const* const hooks, const ::std::size_t count, Status* const results) noexcept;
+
+	// Restores the entries of objects that are still loaded and releases the slots
+	void disableGotHook(GotHook& hook) noexcept;
+
+	// Applies the enabled hooks to the objects loaded since they were last applied
+	void updateGotHooks() noexcept;
+
+	// Called by the outermost FrameScope of a thread, updateGotHooks unless no hook is enabled
+	// (one relaxed load) or a bind holds the lock (the next frame catches up)
+	void followGotLoads() noexcept;
+
+	// Limits patching to the objects whose path contains one of these names (the main executable
+	// is matched by its own path), all objects when empty. The names are copied.
+	bool setGotModules(const ::std::span<const char* const> modules) noexcept;
+}
+#endif
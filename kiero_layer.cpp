@@ -0,0 +1,483 @@
+#include "kiero_layer.h"
+
+#if KIERO_VULKAN_LAYER
+
+#if !defined(__x86_64__) || defined(_WIN32)
+# error "The Vulkan layer is only implemented for x86-64 Linux"
+#endif
+
+#include "kiero_vulkan.h"
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_layer.h>
+
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <string_view>
+
+// Shared with the stubs below
+#define KIERO_LAYER_SLOTS    137
+#define KIERO_LAYER_MAP_SIZE 256 // power of two, one entry per instance/device dispatch pointer ever seen
+
+#define KIERO_LAYER_STRINGIFY_(x) #x
+#define KIERO_LAYER_STRINGIFY(x) KIERO_LAYER_STRINGIFY_(x)
+
+namespace kiero::detail
+{
+
+static_assert(::std::size(g_vulkanMethodsNames) == KIERO_LAYER_SLOTS);
+
+// The next layer's (or the driver's) function of every slot for one instance or device. next comes
+// first, the dispatch stub jumps through next + 8 * index.
+struct LayerDispatch
+{
+    void* next[KIERO_LAYER_SLOTS];
+
+    VkInstance instance;
+    PFN_vkGetInstanceProcAddr getInstanceProcAddr;
+    PFN_vkGetDeviceProcAddr getDeviceProcAddr;
+};
+
+// Keyed by the loader's dispatch pointer, the first word of every dispatchable handle: queues and
+// command buffers share their device's, physical devices their instance's
+struct LayerMapEntry
+{
+    const void* key;
+    LayerDispatch* dispatch;
+};
+
+static_assert(sizeof(LayerMapEntry) == 16);
+
+}
+
+extern "C"
+{
+// Read by the stubs without locking: entries are only ever added and an entry's dispatch is
+// published before its key
+__attribute__((visibility("hidden"))) kiero::detail::LayerMapEntry kieroLayerMap[KIERO_LAYER_MAP_SIZE];
+__attribute__((visibility("hidden"))) void* kieroLayerHooks[KIERO_LAYER_SLOTS];
+
+__attribute__((visibility("hidden"))) extern const char kieroLayerEntries[];
+__attribute__((visibility("hidden"))) extern const char kieroLayerNexts[];
+}
+
+// kieroLayerEntries: a 32 byte stub per slot, jumps to the function bound to the slot if there is
+//                    one and down the chain otherwise. These are what the application calls.
+// kieroLayerNexts:   a 16 byte stub per slot going down the chain, handed out as `original`.
+//
+// kieroLayerDispatch looks up the LayerDispatch of the handle in rdi (every Vulkan command takes
+// a dispatchable handle first) and jumps to its next[r10 / 8]. Only rax, r10, r11 and the stack
+// are touched, so the arguments reach the next function as the application passed them.
+asm(
+    ".pushsection .text\n"
+    ".intel_syntax noprefix\n"
+
+    ".p2align 4\n"
+    "kieroLayerDispatch:\n"
+    "    push rbx\n"
+    "    mov r11, [rdi]\n"
+    "    mov rbx, r11\n"
+    "    and ebx, (" KIERO_LAYER_STRINGIFY(KIERO_LAYER_MAP_SIZE) " - 1) * 16\n"
+    "    lea rax, [rip + kieroLayerMap]\n"
+    "1:\n"
+    "    cmp r11, [rax + rbx]\n"
+    "    je 2f\n"
+    "    cmp qword ptr [rax + rbx], 0\n"
+    "    je 3f\n"
+    "    add ebx, 16\n"
+    "    and ebx, (" KIERO_LAYER_STRINGIFY(KIERO_LAYER_MAP_SIZE) " - 1) * 16\n"
+    "    jmp 1b\n"
+    "2:\n"
+    "    mov rax, [rax + rbx + 8]\n"
+    "    pop rbx\n"
+    "    jmp [rax + r10]\n"
+    "3:\n"
+    "    ud2\n" // a handle no instance or device of this layer created
+
+    ".p2align 5\n"
+    ".globl kieroLayerEntries\n"
+    ".hidden kieroLayerEntries\n"
+    "kieroLayerEntries:\n"
+    ".set kieroLayerSlot, 0\n"
+    ".rept " KIERO_LAYER_STRINGIFY(KIERO_LAYER_SLOTS) "\n"
+    "    mov r11, [rip + kieroLayerHooks + kieroLayerSlot * 8]\n"
+    "    test r11, r11\n"
+    "    jz 1f\n"
+    "    jmp r11\n"
+    "1:\n"
+    "    mov r10d, kieroLayerSlot * 8\n"
+    "    jmp kieroLayerDispatch\n"
+    "    .p2align 5\n"
+    "    .set kieroLayerSlot, kieroLayerSlot + 1\n"
+    ".endr\n"
+
+    ".globl kieroLayerNexts\n"
+    ".hidden kieroLayerNexts\n"
+    "kieroLayerNexts:\n"
+    ".set kieroLayerSlot, 0\n"
+    ".rept " KIERO_LAYER_STRINGIFY(KIERO_LAYER_SLOTS) "\n"
+    "    mov r10d, kieroLayerSlot * 8\n"
+    "    jmp kieroLayerDispatch\n"
+    "    .p2align 4\n"
+    "    .set kieroLayerSlot, kieroLayerSlot + 1\n"
+    ".endr\n"
+
+    ".att_syntax\n"
+    ".popsection\n"
+);
+
+namespace kiero::detail
+{
+
+namespace
+{
+
+constexpr ::std::size_t LayerEntrySize = 32;
+constexpr ::std::size_t LayerNextSize = 16;
+
+// Implemented by the layer itself (or answered by the loader), never redirected to a bound function
+constexpr ::std::string_view LayerManagedNames[] = {
+    "vkCreateInstance", "vkDestroyInstance", "vkGetInstanceProcAddr", "vkGetDeviceProcAddr", "vkCreateDevice", "vkDestroyDevice",
+    "vkEnumerateInstanceExtensionProperties", "vkEnumerateDeviceExtensionProperties", "vkEnumerateDeviceLayerProperties"
+};
+
+[[nodiscard]] constexpr int findSlot(const ::std::string_view name) noexcept
+{
+    for(::std::size_t i = 0; i < ::std::size(g_vulkanMethodsNames); ++i)
+    {
+        if(name == g_vulkanMethodsNames[i])
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    return -1;
+}
+
+constexpr int DestroyInstanceSlot = findSlot("vkDestroyInstance");
+constexpr int DestroyDeviceSlot = findSlot("vkDestroyDevice");
+
+::std::mutex g_layerMutex;
+
+[[nodiscard]] const void* getKey(const void* const handle) noexcept
+{
+    return *static_cast<const void* const*>(handle);
+}
+
+[[nodiscard]] ::std::size_t getMapIndex(const void* const key) noexcept
+{
+    return (reinterpret_cast<::std::uintptr_t>(key) >> 4) & (KIERO_LAYER_MAP_SIZE - 1);
+}
+
+LayerDispatch* findDispatch(const void* const handle) noexcept
+{
+    const void* const key = getKey(handle);
+
+    for(::std::size_t i = getMapIndex(key), probes = 0; probes < KIERO_LAYER_MAP_SIZE; i = (i + 1) & (KIERO_LAYER_MAP_SIZE - 1), ++probes)
+    {
+        const void* const entryKey = ::std::atomic_ref<const void*>(kieroLayerMap[i].key).load(::std::memory_order_acquire);
+        if(entryKey == key)
+        {
+            return kieroLayerMap[i].dispatch;
+        }
+
+        if(!entryKey)
+        {
+            break;
+        }
+    }
+
+    return nullptr;
+}
+
+bool insertDispatch(const void* const handle, const LayerDispatch& contents) noexcept
+{
+    const void* const key = getKey(handle);
+
+    const ::std::lock_guard<::std::mutex> lock(g_layerMutex);
+
+    for(::std::size_t i = getMapIndex(key), probes = 0; probes < KIERO_LAYER_MAP_SIZE; i = (i + 1) & (KIERO_LAYER_MAP_SIZE - 1), ++probes)
+    {
+        LayerMapEntry& entry = kieroLayerMap[i];
+
+        // The loader reuses the dispatch memory of destroyed objects, the map reuses their entry
+        if(entry.key == key)
+        {
+            *entry.dispatch = contents;
+            return true;
+        }
+
+        if(!entry.key)
+        {
+            entry.dispatch = new(::std::nothrow) LayerDispatch(contents);
+            if(!entry.dispatch)
+            {
+                return false;
+            }
+
+            ::std::atomic_ref<const void*>(entry.key).store(key, ::std::memory_order_release);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// The loader's link info for this layer, advanced so the next layer finds its own
+template<typename CreateInfo>
+CreateInfo* findLinkInfo(const void* const next, const VkStructureType type) noexcept
+{
+    for(auto* info = static_cast<const CreateInfo*>(next); info; info = static_cast<const CreateInfo*>(info->pNext))
+    {
+        if(info->sType == type && info->function == VK_LAYER_LINK_INFO && info->u.pLayerInfo)
+        {
+            return const_cast<CreateInfo*>(info);
+        }
+    }
+
+    return nullptr;
+}
+
+// Hands out the layer's entry for name when the chain below implements it
+PFN_vkVoidFunction getChainFunction(const LayerDispatch& dispatch, const char* const name, const PFN_vkVoidFunction next) noexcept
+{
+    const int slot = next ? findSlot(name) : -1;
+
+    if(slot >= 0 && dispatch.next[slot])
+    {
+        if(void* const entry = getLayerEntry(static_cast<::std::uint16_t>(slot)))
+        {
+            return reinterpret_cast<PFN_vkVoidFunction>(entry);
+        }
+    }
+
+    return next;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createInstance(const VkInstanceCreateInfo* const createInfo, const VkAllocationCallbacks* const allocator, VkInstance* const instance)
+{
+    auto* const link = findLinkInfo<VkLayerInstanceCreateInfo>(createInfo->pNext, VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO);
+    if(!link)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const PFN_vkGetInstanceProcAddr getInstanceProcAddr = link->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    link->u.pLayerInfo = link->u.pLayerInfo->pNext;
+
+    const auto nextCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(getInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+
+    const VkResult result = nextCreateInstance(createInfo, allocator, instance);
+    if(result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    LayerDispatch dispatch { };
+    dispatch.instance = *instance;
+    dispatch.getInstanceProcAddr = getInstanceProcAddr;
+    dispatch.getDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(getInstanceProcAddr(*instance, "vkGetDeviceProcAddr"));
+
+    for(::std::size_t i = 0; i < KIERO_LAYER_SLOTS; ++i)
+    {
+        dispatch.next[i] = reinterpret_cast<void*>(getInstanceProcAddr(*instance, g_vulkanMethodsNames[i]));
+    }
+
+    if(!insertDispatch(*instance, dispatch))
+    {
+        reinterpret_cast<PFN_vkDestroyInstance>(dispatch.next[DestroyInstanceSlot])(*instance, allocator);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyInstance(const VkInstance instance, const VkAllocationCallbacks* const allocator)
+{
+    if(const LayerDispatch* const dispatch = instance ? findDispatch(instance) : nullptr)
+    {
+        reinterpret_cast<PFN_vkDestroyInstance>(dispatch->next[DestroyInstanceSlot])(instance, allocator);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createDevice(const VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* const createInfo, const VkAllocationCallbacks* const allocator, VkDevice* const device)
+{
+    auto* const link = findLinkInfo<VkLayerDeviceCreateInfo>(createInfo->pNext, VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO);
+    const LayerDispatch* const instanceDispatch = findDispatch(physicalDevice);
+
+    if(!link || !instanceDispatch)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    const PFN_vkGetInstanceProcAddr getInstanceProcAddr = link->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    const PFN_vkGetDeviceProcAddr getDeviceProcAddr = link->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+    link->u.pLayerInfo = link->u.pLayerInfo->pNext;
+
+    const auto nextCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(getInstanceProcAddr(instanceDispatch->instance, "vkCreateDevice"));
+
+    const VkResult result = nextCreateDevice(physicalDevice, createInfo, allocator, device);
+    if(result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    LayerDispatch dispatch { };
+    dispatch.instance = instanceDispatch->instance;
+    dispatch.getInstanceProcAddr = getInstanceProcAddr;
+    dispatch.getDeviceProcAddr = getDeviceProcAddr;
+
+    for(::std::size_t i = 0; i < KIERO_LAYER_SLOTS; ++i)
+    {
+        dispatch.next[i] = reinterpret_cast<void*>(getDeviceProcAddr(*device, g_vulkanMethodsNames[i]));
+    }
+
+    if(!insertDispatch(*device, dispatch))
+    {
+        reinterpret_cast<PFN_vkDestroyDevice>(dispatch.next[DestroyDeviceSlot])(*device, allocator);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyDevice(const VkDevice device, const VkAllocationCallbacks* const allocator)
+{
+    if(const LayerDispatch* const dispatch = device ? findDispatch(device) : nullptr)
+    {
+        reinterpret_cast<PFN_vkDestroyDevice>(dispatch->next[DestroyDeviceSlot])(device, allocator);
+    }
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getDeviceProcAddr(const VkDevice device, const char* const name)
+{
+    const ::std::string_view function = name;
+
+    if(function == "vkGetDeviceProcAddr")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(getDeviceProcAddr);
+    }
+
+    if(function == "vkDestroyDevice")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(destroyDevice);
+    }
+
+    const LayerDispatch* const dispatch = device ? findDispatch(device) : nullptr;
+    return dispatch ? getChainFunction(*dispatch, name, dispatch->getDeviceProcAddr(device, name)) : nullptr;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr(const VkInstance instance, const char* const name)
+{
+    const ::std::string_view function = name;
+
+    if(function == "vkGetInstanceProcAddr")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(getInstanceProcAddr);
+    }
+
+    if(function == "vkCreateInstance")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(createInstance);
+    }
+
+    if(function == "vkDestroyInstance")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(destroyInstance);
+    }
+
+    if(function == "vkCreateDevice")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(createDevice);
+    }
+
+    if(function == "vkGetDeviceProcAddr")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(getDeviceProcAddr);
+    }
+
+    if(function == "vkDestroyDevice")
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(destroyDevice);
+    }
+
+    const LayerDispatch* const dispatch = instance ? findDispatch(instance) : nullptr;
+    return dispatch ? getChainFunction(*dispatch, name, dispatch->getInstanceProcAddr(instance, name)) : nullptr;
+}
+
+} // namespace
+
+void* getLayerEntry(const ::std::uint16_t index) noexcept
+{
+    if(index >= KIERO_LAYER_SLOTS)
+    {
+        return nullptr;
+    }
+
+    for(const ::std::string_view name : LayerManagedNames)
+    {
+        if(name == g_vulkanMethodsNames[index])
+        {
+            return nullptr;
+        }
+    }
+
+    return const_cast<char*>(kieroLayerEntries + index * LayerEntrySize);
+}
+
+Status bindLayerSlot(const ::std::uint16_t index, void** const original, void* const function) noexcept
+{
+    if(!getLayerEntry(index))
+    {
+        return Status::NotSupportedError;
+    }
+
+    ::std::atomic_ref<void*> hook(kieroLayerHooks[index]);
+    if(hook.load(::std::memory_order_relaxed))
+    {
+        return Status::UnknownError;
+    }
+
+    *original = const_cast<char*>(kieroLayerNexts + index * LayerNextSize);
+
+    void* expected = nullptr;
+    return hook.compare_exchange_strong(expected, function, ::std::memory_order_release) ? Status::Success : Status::UnknownError;
+}
+
+void unbindLayerSlot(const ::std::uint16_t index) noexcept
+{
+    if(index < KIERO_LAYER_SLOTS)
+    {
+        ::std::atomic_ref<void*>(kieroLayerHooks[index]).store(nullptr, ::std::memory_order_release);
+    }
+}
+
+void releaseLayerSlots() noexcept
+{
+    for(::std::uint16_t i = 0; i < KIERO_LAYER_SLOTS; ++i)
+    {
+        unbindLayerSlot(i);
+    }
+}
+
+}
+
+extern "C" VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVersion(VkNegotiateLayerInterface* const versionStruct)
+{
+    if(!versionStruct || versionStruct->sType != LAYER_NEGOTIATE_INTERFACE_STRUCT || versionStruct->loaderLayerInterfaceVersion < 2)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    versionStruct->loaderLayerInterfaceVersion = 2;
+    versionStruct->pfnGetInstanceProcAddr = kiero::detail::getInstanceProcAddr;
+    versionStruct->pfnGetDeviceProcAddr = kiero::detail::getDeviceProcAddr;
+    versionStruct->pfnGetPhysicalDeviceProcAddr = nullptr;
+
+    return VK_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <cstdint>
+
+#if KIERO_VULKAN_LAYER
+namespace kiero::detail
+{
+	// Entry point the layer hands out for a Vulkan methods table index. It jumps to the function
+	// bound to the index, or down the chain of the dispatchable object it is called with. Null for
+	// the functions the layer implements itself (instance/device creation and proc addr queries).
+	[[nodiscard]] void* getLayerEntry(const ::std::uint16_t index) noexcept;
+
+	// original receives a stub calling the next layer/driver of whatever object it is called with
+	Status bindLayerSlot(const ::std::uint16_t index, void** const original, void* const function) noexcept;
+	void unbindLayerSlot(const ::std::uint16_t index) noexcept;
+	void releaseLayerSlots() noexcept;
+}
+#endif
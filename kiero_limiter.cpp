@@ -0,0 +1,251 @@
+#include "kiero_limiter.h"
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef _WIN32
+# include <Windows.h>
+#else
+# include <cerrno>
+# include <time.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+# include <immintrin.h>
+# define KIERO_SPIN_PAUSE() _mm_pause()
+#else
+# include <thread>
+# define KIERO_SPIN_PAUSE() ::std::this_thread::yield()
+#endif
+
+namespace kiero
+{
+
+namespace
+{
+
+// Sleeps end this much before the deadline at least, the rest is spun
+constexpr ::std::int64_t SpinMargin = 50'000;
+
+// Bounds of the expected sleep overshoot, it starts at the upper one
+constexpr ::std::int64_t MinSlack = 20'000;
+#ifdef _WIN32
+constexpr ::std::int64_t MaxSlack = 2'000'000;
+#else
+constexpr ::std::int64_t MaxSlack = 1'000'000;
+#endif
+
+// Added to the predicted frame time so a slightly slower frame still makes its deadline
+constexpr ::std::int64_t PredictionMargin = 250'000;
+
+::std::atomic<::std::int64_t> g_interval { 0 }; // nanoseconds, 0 when off
+::std::atomic<FrameLimitMode> g_mode { FrameLimitMode::Present };
+
+// Plain data so the thread_local needs no guard
+struct Pacer
+{
+    ::std::int64_t interval;   // the interval deadline belongs to
+    ::std::int64_t deadline;   // of the next boundary call, 0 before the first one
+    ::std::int64_t frameStart; // when the current frame's work started
+    ::std::int64_t predicted;  // decaying maximum of the frames' work
+    ::std::int64_t slack;      // expected sleep overshoot, 0 until the first sleep
+#ifdef _WIN32
+    HANDLE timer;
+#endif
+};
+
+thread_local Pacer g_pacer;
+
+#ifdef _WIN32
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+# define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+// Closes the thread's timer when it exits, only constructed once the thread sleeps
+struct TimerOwner
+{
+    ~TimerOwner()
+    {
+        if(g_pacer.timer)
+        {
+            ::CloseHandle(g_pacer.timer);
+            g_pacer.timer = nullptr;
+        }
+    }
+};
+
+thread_local TimerOwner g_timerOwner;
+
+[[nodiscard]] ::std::int64_t now() noexcept
+{
+    static const ::std::int64_t frequency = []
+    {
+        LARGE_INTEGER value;
+        ::QueryPerformanceFrequency(&value);
+        return static_cast<::std::int64_t>(value.QuadPart);
+    }();
+
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+
+    const ::std::int64_t ticks = counter.QuadPart;
+    return ticks / frequency * 1'000'000'000 + ticks % frequency * 1'000'000'000 / frequency;
+}
+
+void sleepUntil(Pacer& pacer, const ::std::int64_t until) noexcept
+{
+    if(!pacer.timer)
+    {
+        // Touching the owner registers its destructor for this thread
+        (void) &g_timerOwner;
+
+        // The high resolution timer exists since Windows 10 1803, older versions get the
+        // scheduler tick
+        pacer.timer = ::CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    }
+
+    const ::std::int64_t remaining = until - now();
+    if(remaining <= 0)
+    {
+        return;
+    }
+
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -(remaining / 100); // relative, in 100 ns units
+
+    if(pacer.timer && ::SetWaitableTimerEx(pacer.timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+    {
+        ::WaitForSingleObject(pacer.timer, INFINITE);
+    }
+    else
+    {
+        ::Sleep(static_cast<DWORD>(remaining / 1'000'000));
+    }
+}
+
+#else
+
+[[nodiscard]] ::std::int64_t now() noexcept
+{
+    timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<::std::int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+}
+
+void sleepUntil(Pacer&, const ::std::int64_t until) noexcept
+{
+    timespec time;
+    time.tv_sec = static_cast<time_t>(until / 1'000'000'000);
+    time.tv_nsec = static_cast<long>(until % 1'000'000'000);
+
+    // Absolute, so an interrupted sleep simply resumes. Any other error would repeat forever,
+    // the caller spins the rest instead.
+    while(::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR)
+    {
+    }
+}
+
+#endif
+
+// Returns the time the wait ended at
+::std::int64_t waitUntil(Pacer& pacer, const ::std::int64_t deadline) noexcept
+{
+    if(pacer.slack == 0)
+    {
+        pacer.slack = MaxSlack;
+    }
+
+    ::std::int64_t time = now();
+
+    // Sleep while the expected overshoot still fits, learning how late the wakeups are
+    while(deadline - time > pacer.slack + SpinMargin)
+    {
+        const ::std::int64_t wakeup = deadline - pacer.slack - SpinMargin;
+        sleepUntil(pacer, wakeup);
+
+        time = now();
+
+        const ::std::int64_t overshoot = time > wakeup ? time - wakeup : 0;
+        ::std::int64_t slack = overshoot > pacer.slack ? overshoot : pacer.slack - pacer.slack / 16;
+        slack = slack < MinSlack ? MinSlack : slack;
+        pacer.slack = slack > MaxSlack ? MaxSlack : slack;
+    }
+
+    while(time < deadline)
+    {
+        KIERO_SPIN_PAUSE();
+        time = now();
+    }
+
+    return time;
+}
+
+}
+
+void setFrameLimit(const double framesPerSecond, const FrameLimitMode mode) noexcept
+{
+    g_mode.store(mode, ::std::memory_order_relaxed);
+    g_interval.store(framesPerSecond > 0.0 ? static_cast<::std::int64_t>(1'000'000'000.0 / framesPerSecond) : 0, ::std::memory_order_relaxed);
+}
+
+namespace detail
+{
+
+::std::int64_t beginPresent() noexcept
+{
+    const ::std::int64_t interval = g_interval.load(::std::memory_order_relaxed);
+
+    Pacer& pacer = g_pacer;
+    const ::std::int64_t time = now();
+
+    if(interval == 0 || pacer.interval != interval || pacer.deadline == 0)
+    {
+        // The first frame paced presents right away and starts the cadence
+        pacer.interval = interval;
+        pacer.deadline = interval == 0 ? 0 : time;
+        pacer.frameStart = time;
+        pacer.predicted = 0;
+        return time;
+    }
+
+    // Rises with a slower frame at once and forgets it over a few dozen frames
+    const ::std::int64_t work = time - pacer.frameStart;
+    pacer.predicted = work > pacer.predicted ? work : pacer.predicted - (pacer.predicted - work) / 64;
+
+    return waitUntil(pacer, pacer.deadline);
+}
+
+void endPresent() noexcept
+{
+    Pacer& pacer = g_pacer;
+    if(pacer.deadline == 0)
+    {
+        return;
+    }
+
+    const ::std::int64_t time = now();
+
+    // A missed deadline restarts the cadence from now
+    pacer.deadline += pacer.interval;
+    if(pacer.deadline < time)
+    {
+        pacer.deadline = time;
+    }
+
+    if(g_mode.load(::std::memory_order_relaxed) == FrameLimitMode::Predictive)
+    {
+        const ::std::int64_t start = pacer.deadline - pacer.predicted - PredictionMargin;
+        if(start > time)
+        {
+            pacer.frameStart = waitUntil(pacer, start);
+            return;
+        }
+    }
+
+    pacer.frameStart = now();
+}
+
+}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kiero
+{
+	enum class FrameLimitMode
+	{
+		Present,    // hold every frame boundary call until its deadline
+		Predictive, // also hold the return of the boundary call until the next deadline minus the
+		            // predicted frame time, so the next frame reads its input as late as possible
+	};
+
+	// Paces the frame boundaries (kiero_frame.h) of every presenting thread to framesPerSecond,
+	// 0 turns the limiter off. Waits sleep until shortly before the deadline and spin the rest,
+	// a frame that misses its deadline restarts the cadence instead of rushing to catch up.
+	void setFrameLimit(const double framesPerSecond, const FrameLimitMode mode = FrameLimitMode::Present) noexcept;
+
+	namespace detail
+	{
+		// Called by the outermost FrameScope of a thread around the boundary call. beginPresent
+		// returns the monotonic time in nanoseconds the call proceeds at.
+		[[nodiscard]] ::std::int64_t beginPresent() noexcept;
+		void endPresent() noexcept;
+	}
+}
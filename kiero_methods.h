@@ -0,0 +1,2309 @@
+// Generated from METHODSTABLE.txt by cmake/KieroMethodsTable.cmake, do not edit
+#pragma once
+
+#include "kiero.h"
+
+#include <cstdint>
+
+namespace kiero::d3d9
+{
+	inline constexpr ::std::uint16_t MethodsCount = 119;
+
+	namespace IDirect3DDevice9
+	{
+		inline constexpr ::std::uint16_t Offset = 0;
+		inline constexpr ::std::uint16_t Count = 119;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D9, 0>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D9, 1>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D9, 2>;
+		using TestCooperativeLevel = ::kiero::Method<::kiero::RenderType::D3D9, 3>;
+		using GetAvailableTextureMem = ::kiero::Method<::kiero::RenderType::D3D9, 4>;
+		using EvictManagedResources = ::kiero::Method<::kiero::RenderType::D3D9, 5>;
+		using GetDirect3D = ::kiero::Method<::kiero::RenderType::D3D9, 6>;
+		using GetDeviceCaps = ::kiero::Method<::kiero::RenderType::D3D9, 7>;
+		using GetDisplayMode = ::kiero::Method<::kiero::RenderType::D3D9, 8>;
+		using GetCreationParameters = ::kiero::Method<::kiero::RenderType::D3D9, 9>;
+		using SetCursorProperties = ::kiero::Method<::kiero::RenderType::D3D9, 10>;
+		using SetCursorPosition = ::kiero::Method<::kiero::RenderType::D3D9, 11>;
+		using ShowCursor = ::kiero::Method<::kiero::RenderType::D3D9, 12>;
+		using CreateAdditionalSwapChain = ::kiero::Method<::kiero::RenderType::D3D9, 13>;
+		using GetSwapChain = ::kiero::Method<::kiero::RenderType::D3D9, 14>;
+		using GetNumberOfSwapChains = ::kiero::Method<::kiero::RenderType::D3D9, 15>;
+		using Reset = ::kiero::Method<::kiero::RenderType::D3D9, 16>;
+		using Present = ::kiero::Method<::kiero::RenderType::D3D9, 17>;
+		using GetBackBuffer = ::kiero::Method<::kiero::RenderType::D3D9, 18>;
+		using GetRasterStatus = ::kiero::Method<::kiero::RenderType::D3D9, 19>;
+		using SetDialogBoxMode = ::kiero::Method<::kiero::RenderType::D3D9, 20>;
+		using SetGammaRamp = ::kiero::Method<::kiero::RenderType::D3D9, 21>;
+		using GetGammaRamp = ::kiero::Method<::kiero::RenderType::D3D9, 22>;
+		using CreateTexture = ::kiero::Method<::kiero::RenderType::D3D9, 23>;
+		using CreateVolumeTexture = ::kiero::Method<::kiero::RenderType::D3D9, 24>;
+		using CreateCubeTexture = ::kiero::Method<::kiero::RenderType::D3D9, 25>;
+		using CreateVertexBuffer = ::kiero::Method<::kiero::RenderType::D3D9, 26>;
+		using CreateIndexBuffer = ::kiero::Method<::kiero::RenderType::D3D9, 27>;
+		using CreateRenderTarget = ::kiero::Method<::kiero::RenderType::D3D9, 28>;
+		using CreateDepthStencilSurface = ::kiero::Method<::kiero::RenderType::D3D9, 29>;
+		using UpdateSurface = ::kiero::Method<::kiero::RenderType::D3D9, 30>;
+		using UpdateTexture = ::kiero::Method<::kiero::RenderType::D3D9, 31>;
+		using GetRenderTargetData = ::kiero::Method<::kiero::RenderType::D3D9, 32>;
+		using GetFrontBufferData = ::kiero::Method<::kiero::RenderType::D3D9, 33>;
+		using StretchRect = ::kiero::Method<::kiero::RenderType::D3D9, 34>;
+		using ColorFill = ::kiero::Method<::kiero::RenderType::D3D9, 35>;
+		using CreateOffscreenPlainSurface = ::kiero::Method<::kiero::RenderType::D3D9, 36>;
+		using SetRenderTarget = ::kiero::Method<::kiero::RenderType::D3D9, 37>;
+		using GetRenderTarget = ::kiero::Method<::kiero::RenderType::D3D9, 38>;
+		using SetDepthStencilSurface = ::kiero::Method<::kiero::RenderType::D3D9, 39>;
+		using GetDepthStencilSurface = ::kiero::Method<::kiero::RenderType::D3D9, 40>;
+		using BeginScene = ::kiero::Method<::kiero::RenderType::D3D9, 41>;
+		using EndScene = ::kiero::Method<::kiero::RenderType::D3D9, 42>;
+		using Clear = ::kiero::Method<::kiero::RenderType::D3D9, 43>;
+		using SetTransform = ::kiero::Method<::kiero::RenderType::D3D9, 44>;
+		using GetTransform = ::kiero::Method<::kiero::RenderType::D3D9, 45>;
+		using MultiplyTransform = ::kiero::Method<::kiero::RenderType::D3D9, 46>;
+		using SetViewport = ::kiero::Method<::kiero::RenderType::D3D9, 47>;
+		using GetViewport = ::kiero::Method<::kiero::RenderType::D3D9, 48>;
+		using SetMaterial = ::kiero::Method<::kiero::RenderType::D3D9, 49>;
+		using GetMaterial = ::kiero::Method<::kiero::RenderType::D3D9, 50>;
+		using SetLight = ::kiero::Method<::kiero::RenderType::D3D9, 51>;
+		using GetLight = ::kiero::Method<::kiero::RenderType::D3D9, 52>;
+		using LightEnable = ::kiero::Method<::kiero::RenderType::D3D9, 53>;
+		using GetLightEnable = ::kiero::Method<::kiero::RenderType::D3D9, 54>;
+		using SetClipPlane = ::kiero::Method<::kiero::RenderType::D3D9, 55>;
+		using GetClipPlane = ::kiero::Method<::kiero::RenderType::D3D9, 56>;
+		using SetRenderState = ::kiero::Method<::kiero::RenderType::D3D9, 57>;
+		using GetRenderState = ::kiero::Method<::kiero::RenderType::D3D9, 58>;
+		using CreateStateBlock = ::kiero::Method<::kiero::RenderType::D3D9, 59>;
+		using BeginStateBlock = ::kiero::Method<::kiero::RenderType::D3D9, 60>;
+		using EndStateBlock = ::kiero::Method<::kiero::RenderType::D3D9, 61>;
+		using SetClipStatus = ::kiero::Method<::kiero::RenderType::D3D9, 62>;
+		using GetClipStatus = ::kiero::Method<::kiero::RenderType::D3D9, 63>;
+		using GetTexture = ::kiero::Method<::kiero::RenderType::D3D9, 64>;
+		using SetTexture = ::kiero::Method<::kiero::RenderType::D3D9, 65>;
+		using GetTextureStageState = ::kiero::Method<::kiero::RenderType::D3D9, 66>;
+		using SetTextureStageState = ::kiero::Method<::kiero::RenderType::D3D9, 67>;
+		using GetSamplerState = ::kiero::Method<::kiero::RenderType::D3D9, 68>;
+		using SetSamplerState = ::kiero::Method<::kiero::RenderType::D3D9, 69>;
+		using ValidateDevice = ::kiero::Method<::kiero::RenderType::D3D9, 70>;
+		using SetPaletteEntries = ::kiero::Method<::kiero::RenderType::D3D9, 71>;
+		using GetPaletteEntries = ::kiero::Method<::kiero::RenderType::D3D9, 72>;
+		using SetCurrentTexturePalette = ::kiero::Method<::kiero::RenderType::D3D9, 73>;
+		using GetCurrentTexturePalette = ::kiero::Method<::kiero::RenderType::D3D9, 74>;
+		using SetScissorRect = ::kiero::Method<::kiero::RenderType::D3D9, 75>;
+		using GetScissorRect = ::kiero::Method<::kiero::RenderType::D3D9, 76>;
+		using SetSoftwareVertexProcessing = ::kiero::Method<::kiero::RenderType::D3D9, 77>;
+		using GetSoftwareVertexProcessing = ::kiero::Method<::kiero::RenderType::D3D9, 78>;
+		using SetNPatchMode = ::kiero::Method<::kiero::RenderType::D3D9, 79>;
+		using GetNPatchMode = ::kiero::Method<::kiero::RenderType::D3D9, 80>;
+		using DrawPrimitive = ::kiero::Method<::kiero::RenderType::D3D9, 81>;
+		using DrawIndexedPrimitive = ::kiero::Method<::kiero::RenderType::D3D9, 82>;
+		using DrawPrimitiveUP = ::kiero::Method<::kiero::RenderType::D3D9, 83>;
+		using DrawIndexedPrimitiveUP = ::kiero::Method<::kiero::RenderType::D3D9, 84>;
+		using ProcessVertices = ::kiero::Method<::kiero::RenderType::D3D9, 85>;
+		using CreateVertexDeclaration = ::kiero::Method<::kiero::RenderType::D3D9, 86>;
+		using SetVertexDeclaration = ::kiero::Method<::kiero::RenderType::D3D9, 87>;
+		using GetVertexDeclaration = ::kiero::Method<::kiero::RenderType::D3D9, 88>;
+		using SetFVF = ::kiero::Method<::kiero::RenderType::D3D9, 89>;
+		using GetFVF = ::kiero::Method<::kiero::RenderType::D3D9, 90>;
+		using CreateVertexShader = ::kiero::Method<::kiero::RenderType::D3D9, 91>;
+		using SetVertexShader = ::kiero::Method<::kiero::RenderType::D3D9, 92>;
+		using GetVertexShader = ::kiero::Method<::kiero::RenderType::D3D9, 93>;
+		using SetVertexShaderConstantF = ::kiero::Method<::kiero::RenderType::D3D9, 94>;
+		using GetVertexShaderConstantF = ::kiero::Method<::kiero::RenderType::D3D9, 95>;
+		using SetVertexShaderConstantI = ::kiero::Method<::kiero::RenderType::D3D9, 96>;
+		using GetVertexShaderConstantI = ::kiero::Method<::kiero::RenderType::D3D9, 97>;
+		using SetVertexShaderConstantB = ::kiero::Method<::kiero::RenderType::D3D9, 98>;
+		using GetVertexShaderConstantB = ::kiero::Method<::kiero::RenderType::D3D9, 99>;
+		using SetStreamSource = ::kiero::Method<::kiero::RenderType::D3D9, 100>;
+		using GetStreamSource = ::kiero::Method<::kiero::RenderType::D3D9, 101>;
+		using SetStreamSourceFreq = ::kiero::Method<::kiero::RenderType::D3D9, 102>;
+		using GetStreamSourceFreq = ::kiero::Method<::kiero::RenderType::D3D9, 103>;
+		using SetIndices = ::kiero::Method<::kiero::RenderType::D3D9, 104>;
+		using GetIndices = ::kiero::Method<::kiero::RenderType::D3D9, 105>;
+		using CreatePixelShader = ::kiero::Method<::kiero::RenderType::D3D9, 106>;
+		using SetPixelShader = ::kiero::Method<::kiero::RenderType::D3D9, 107>;
+		using GetPixelShader = ::kiero::Method<::kiero::RenderType::D3D9, 108>;
+		using SetPixelShaderConstantF = ::kiero::Method<::kiero::RenderType::D3D9, 109>;
+		using GetPixelShaderConstantF = ::kiero::Method<::kiero::RenderType::D3D9, 110>;
+		using SetPixelShaderConstantI = ::kiero::Method<::kiero::RenderType::D3D9, 111>;
+		using GetPixelShaderConstantI = ::kiero::Method<::kiero::RenderType::D3D9, 112>;
+		using SetPixelShaderConstantB = ::kiero::Method<::kiero::RenderType::D3D9, 113>;
+		using GetPixelShaderConstantB = ::kiero::Method<::kiero::RenderType::D3D9, 114>;
+		using DrawRectPatch = ::kiero::Method<::kiero::RenderType::D3D9, 115>;
+		using DrawTriPatch = ::kiero::Method<::kiero::RenderType::D3D9, 116>;
+		using DeletePatch = ::kiero::Method<::kiero::RenderType::D3D9, 117>;
+		using CreateQuery = ::kiero::Method<::kiero::RenderType::D3D9, 118>;
+	}
+
+	inline constexpr const char* const Names[] = {
+		"IDirect3DDevice9::QueryInterface",
+		"IDirect3DDevice9::AddRef",
+		"IDirect3DDevice9::Release",
+		"IDirect3DDevice9::TestCooperativeLevel",
+		"IDirect3DDevice9::GetAvailableTextureMem",
+		"IDirect3DDevice9::EvictManagedResources",
+		"IDirect3DDevice9::GetDirect3D",
+		"IDirect3DDevice9::GetDeviceCaps",
+		"IDirect3DDevice9::GetDisplayMode",
+		"IDirect3DDevice9::GetCreationParameters",
+		"IDirect3DDevice9::SetCursorProperties",
+		"IDirect3DDevice9::SetCursorPosition",
+		"IDirect3DDevice9::ShowCursor",
+		"IDirect3DDevice9::CreateAdditionalSwapChain",
+		"IDirect3DDevice9::GetSwapChain",
+		"IDirect3DDevice9::GetNumberOfSwapChains",
+		"IDirect3DDevice9::Reset",
+		"IDirect3DDevice9::Present",
+		"IDirect3DDevice9::GetBackBuffer",
+		"IDirect3DDevice9::GetRasterStatus",
+		"IDirect3DDevice9::SetDialogBoxMode",
+		"IDirect3DDevice9::SetGammaRamp",
+		"IDirect3DDevice9::GetGammaRamp",
+		"IDirect3DDevice9::CreateTexture",
+		"IDirect3DDevice9::CreateVolumeTexture",
+		"IDirect3DDevice9::CreateCubeTexture",
+		"IDirect3DDevice9::CreateVertexBuffer",
+		"IDirect3DDevice9::CreateIndexBuffer",
+		"IDirect3DDevice9::CreateRenderTarget",
+		"IDirect3DDevice9::CreateDepthStencilSurface",
+		"IDirect3DDevice9::UpdateSurface",
+		"IDirect3DDevice9::UpdateTexture",
+		"IDirect3DDevice9::GetRenderTargetData",
+		"IDirect3DDevice9::GetFrontBufferData",
+		"IDirect3DDevice9::StretchRect",
+		"IDirect3DDevice9::ColorFill",
+		"IDirect3DDevice9::CreateOffscreenPlainSurface",
+		"IDirect3DDevice9::SetRenderTarget",
+		"IDirect3DDevice9::GetRenderTarget",
+		"IDirect3DDevice9::SetDepthStencilSurface",
+		"IDirect3DDevice9::GetDepthStencilSurface",
+		"IDirect3DDevice9::BeginScene",
+		"IDirect3DDevice9::EndScene",
+		"IDirect3DDevice9::Clear",
+		"IDirect3DDevice9::SetTransform",
+		"IDirect3DDevice9::GetTransform",
+		"IDirect3DDevice9::MultiplyTransform",
+		"IDirect3DDevice9::SetViewport",
+		"IDirect3DDevice9::GetViewport",
+		"IDirect3DDevice9::SetMaterial",
+		"IDirect3DDevice9::GetMaterial",
+		"IDirect3DDevice9::SetLight",
+		"IDirect3DDevice9::GetLight",
+		"IDirect3DDevice9::LightEnable",
+		"IDirect3DDevice9::GetLightEnable",
+		"IDirect3DDevice9::SetClipPlane",
+		"IDirect3DDevice9::GetClipPlane",
+		"IDirect3DDevice9::SetRenderState",
+		"IDirect3DDevice9::GetRenderState",
+		"IDirect3DDevice9::CreateStateBlock",
+		"IDirect3DDevice9::BeginStateBlock",
+		"IDirect3DDevice9::EndStateBlock",
+		"IDirect3DDevice9::SetClipStatus",
+		"IDirect3DDevice9::GetClipStatus",
+		"IDirect3DDevice9::GetTexture",
+		"IDirect3DDevice9::SetTexture",
+		"IDirect3DDevice9::GetTextureStageState",
+		"IDirect3DDevice9::SetTextureStageState",
+		"IDirect3DDevice9::GetSamplerState",
+		"IDirect3DDevice9::SetSamplerState",
+		"IDirect3DDevice9::ValidateDevice",
+		"IDirect3DDevice9::SetPaletteEntries",
+		"IDirect3DDevice9::GetPaletteEntries",
+		"IDirect3DDevice9::SetCurrentTexturePalette",
+		"IDirect3DDevice9::GetCurrentTexturePalette",
+		"IDirect3DDevice9::SetScissorRect",
+		"IDirect3DDevice9::GetScissorRect",
+		"IDirect3DDevice9::SetSoftwareVertexProcessing",
+		"IDirect3DDevice9::GetSoftwareVertexProcessing",
+		"IDirect3DDevice9::SetNPatchMode",
+		"IDirect3DDevice9::GetNPatchMode",
+		"IDirect3DDevice9::DrawPrimitive",
+		"IDirect3DDevice9::DrawIndexedPrimitive",
+		"IDirect3DDevice9::DrawPrimitiveUP",
+		"IDirect3DDevice9::DrawIndexedPrimitiveUP",
+		"IDirect3DDevice9::ProcessVertices",
+		"IDirect3DDevice9::CreateVertexDeclaration",
+		"IDirect3DDevice9::SetVertexDeclaration",
+		"IDirect3DDevice9::GetVertexDeclaration",
+		"IDirect3DDevice9::SetFVF",
+		"IDirect3DDevice9::GetFVF",
+		"IDirect3DDevice9::CreateVertexShader",
+		"IDirect3DDevice9::SetVertexShader",
+		"IDirect3DDevice9::GetVertexShader",
+		"IDirect3DDevice9::SetVertexShaderConstantF",
+		"IDirect3DDevice9::GetVertexShaderConstantF",
+		"IDirect3DDevice9::SetVertexShaderConstantI",
+		"IDirect3DDevice9::GetVertexShaderConstantI",
+		"IDirect3DDevice9::SetVertexShaderConstantB",
+		"IDirect3DDevice9::GetVertexShaderConstantB",
+		"IDirect3DDevice9::SetStreamSource",
+		"IDirect3DDevice9::GetStreamSource",
+		"IDirect3DDevice9::SetStreamSourceFreq",
+		"IDirect3DDevice9::GetStreamSourceFreq",
+		"IDirect3DDevice9::SetIndices",
+		"IDirect3DDevice9::GetIndices",
+		"IDirect3DDevice9::CreatePixelShader",
+		"IDirect3DDevice9::SetPixelShader",
+		"IDirect3DDevice9::GetPixelShader",
+		"IDirect3DDevice9::SetPixelShaderConstantF",
+		"IDirect3DDevice9::GetPixelShaderConstantF",
+		"IDirect3DDevice9::SetPixelShaderConstantI",
+		"IDirect3DDevice9::GetPixelShaderConstantI",
+		"IDirect3DDevice9::SetPixelShaderConstantB",
+		"IDirect3DDevice9::GetPixelShaderConstantB",
+		"IDirect3DDevice9::DrawRectPatch",
+		"IDirect3DDevice9::DrawTriPatch",
+		"IDirect3DDevice9::DeletePatch",
+		"IDirect3DDevice9::CreateQuery",
+	};
+}
+
+namespace kiero::d3d10
+{
+	inline constexpr ::std::uint16_t MethodsCount = 116;
+
+	namespace IDXGISwapChain
+	{
+		inline constexpr ::std::uint16_t Offset = 0;
+		inline constexpr ::std::uint16_t Count = 18;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D10, 0>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D10, 1>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D10, 2>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D10, 3>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D10, 4>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D10, 5>;
+		using GetParent = ::kiero::Method<::kiero::RenderType::D3D10, 6>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D10, 7>;
+		using Present = ::kiero::Method<::kiero::RenderType::D3D10, 8>;
+		using GetBuffer = ::kiero::Method<::kiero::RenderType::D3D10, 9>;
+		using SetFullscreenState = ::kiero::Method<::kiero::RenderType::D3D10, 10>;
+		using GetFullscreenState = ::kiero::Method<::kiero::RenderType::D3D10, 11>;
+		using GetDesc = ::kiero::Method<::kiero::RenderType::D3D10, 12>;
+		using ResizeBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 13>;
+		using ResizeTarget = ::kiero::Method<::kiero::RenderType::D3D10, 14>;
+		using GetContainingOutput = ::kiero::Method<::kiero::RenderType::D3D10, 15>;
+		using GetFrameStatistics = ::kiero::Method<::kiero::RenderType::D3D10, 16>;
+		using GetLastPresentCount = ::kiero::Method<::kiero::RenderType::D3D10, 17>;
+	}
+
+	namespace ID3D10Device
+	{
+		inline constexpr ::std::uint16_t Offset = 18;
+		inline constexpr ::std::uint16_t Count = 98;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D10, 18>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D10, 19>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D10, 20>;
+		using VSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 21>;
+		using PSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D10, 22>;
+		using PSSetShader = ::kiero::Method<::kiero::RenderType::D3D10, 23>;
+		using PSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D10, 24>;
+		using VSSetShader = ::kiero::Method<::kiero::RenderType::D3D10, 25>;
+		using DrawIndexed = ::kiero::Method<::kiero::RenderType::D3D10, 26>;
+		using Draw = ::kiero::Method<::kiero::RenderType::D3D10, 27>;
+		using PSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 28>;
+		using IASetInputLayout = ::kiero::Method<::kiero::RenderType::D3D10, 29>;
+		using IASetVertexBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 30>;
+		using IASetIndexBuffer = ::kiero::Method<::kiero::RenderType::D3D10, 31>;
+		using DrawIndexedInstanced = ::kiero::Method<::kiero::RenderType::D3D10, 32>;
+		using DrawInstanced = ::kiero::Method<::kiero::RenderType::D3D10, 33>;
+		using GSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 34>;
+		using GSSetShader = ::kiero::Method<::kiero::RenderType::D3D10, 35>;
+		using IASetPrimitiveTopology = ::kiero::Method<::kiero::RenderType::D3D10, 36>;
+		using VSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D10, 37>;
+		using VSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D10, 38>;
+		using SetPredication = ::kiero::Method<::kiero::RenderType::D3D10, 39>;
+		using GSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D10, 40>;
+		using GSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D10, 41>;
+		using OMSetRenderTargets = ::kiero::Method<::kiero::RenderType::D3D10, 42>;
+		using OMSetBlendState = ::kiero::Method<::kiero::RenderType::D3D10, 43>;
+		using OMSetDepthStencilState = ::kiero::Method<::kiero::RenderType::D3D10, 44>;
+		using SOSetTargets = ::kiero::Method<::kiero::RenderType::D3D10, 45>;
+		using DrawAuto = ::kiero::Method<::kiero::RenderType::D3D10, 46>;
+		using RSSetState = ::kiero::Method<::kiero::RenderType::D3D10, 47>;
+		using RSSetViewports = ::kiero::Method<::kiero::RenderType::D3D10, 48>;
+		using RSSetScissorRects = ::kiero::Method<::kiero::RenderType::D3D10, 49>;
+		using CopySubresourceRegion = ::kiero::Method<::kiero::RenderType::D3D10, 50>;
+		using CopyResource = ::kiero::Method<::kiero::RenderType::D3D10, 51>;
+		using UpdateSubresource = ::kiero::Method<::kiero::RenderType::D3D10, 52>;
+		using ClearRenderTargetView = ::kiero::Method<::kiero::RenderType::D3D10, 53>;
+		using ClearDepthStencilView = ::kiero::Method<::kiero::RenderType::D3D10, 54>;
+		using GenerateMips = ::kiero::Method<::kiero::RenderType::D3D10, 55>;
+		using ResolveSubresource = ::kiero::Method<::kiero::RenderType::D3D10, 56>;
+		using VSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 57>;
+		using PSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D10, 58>;
+		using PSGetShader = ::kiero::Method<::kiero::RenderType::D3D10, 59>;
+		using PSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D10, 60>;
+		using VSGetShader = ::kiero::Method<::kiero::RenderType::D3D10, 61>;
+		using PSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 62>;
+		using IAGetInputLayout = ::kiero::Method<::kiero::RenderType::D3D10, 63>;
+		using IAGetVertexBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 64>;
+		using IAGetIndexBuffer = ::kiero::Method<::kiero::RenderType::D3D10, 65>;
+		using GSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D10, 66>;
+		using GSGetShader = ::kiero::Method<::kiero::RenderType::D3D10, 67>;
+		using IAGetPrimitiveTopology = ::kiero::Method<::kiero::RenderType::D3D10, 68>;
+		using VSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D10, 69>;
+		using VSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D10, 70>;
+		using GetPredication = ::kiero::Method<::kiero::RenderType::D3D10, 71>;
+		using GSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D10, 72>;
+		using GSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D10, 73>;
+		using OMGetRenderTargets = ::kiero::Method<::kiero::RenderType::D3D10, 74>;
+		using OMGetBlendState = ::kiero::Method<::kiero::RenderType::D3D10, 75>;
+		using OMGetDepthStencilState = ::kiero::Method<::kiero::RenderType::D3D10, 76>;
+		using SOGetTargets = ::kiero::Method<::kiero::RenderType::D3D10, 77>;
+		using RSGetState = ::kiero::Method<::kiero::RenderType::D3D10, 78>;
+		using RSGetViewports = ::kiero::Method<::kiero::RenderType::D3D10, 79>;
+		using RSGetScissorRects = ::kiero::Method<::kiero::RenderType::D3D10, 80>;
+		using GetDeviceRemovedReason = ::kiero::Method<::kiero::RenderType::D3D10, 81>;
+		using SetExceptionMode = ::kiero::Method<::kiero::RenderType::D3D10, 82>;
+		using GetExceptionMode = ::kiero::Method<::kiero::RenderType::D3D10, 83>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D10, 84>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D10, 85>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D10, 86>;
+		using ClearState = ::kiero::Method<::kiero::RenderType::D3D10, 87>;
+		using Flush = ::kiero::Method<::kiero::RenderType::D3D10, 88>;
+		using CreateBuffer = ::kiero::Method<::kiero::RenderType::D3D10, 89>;
+		using CreateTexture1D = ::kiero::Method<::kiero::RenderType::D3D10, 90>;
+		using CreateTexture2D = ::kiero::Method<::kiero::RenderType::D3D10, 91>;
+		using CreateTexture3D = ::kiero::Method<::kiero::RenderType::D3D10, 92>;
+		using CreateShaderResourceView = ::kiero::Method<::kiero::RenderType::D3D10, 93>;
+		using CreateRenderTargetView = ::kiero::Method<::kiero::RenderType::D3D10, 94>;
+		using CreateDepthStencilView = ::kiero::Method<::kiero::RenderType::D3D10, 95>;
+		using CreateInputLayout = ::kiero::Method<::kiero::RenderType::D3D10, 96>;
+		using CreateVertexShader = ::kiero::Method<::kiero::RenderType::D3D10, 97>;
+		using CreateGeometryShader = ::kiero::Method<::kiero::RenderType::D3D10, 98>;
+		using CreateGemoetryShaderWithStreamOutput = ::kiero::Method<::kiero::RenderType::D3D10, 99>;
+		using CreatePixelShader = ::kiero::Method<::kiero::RenderType::D3D10, 100>;
+		using CreateBlendState = ::kiero::Method<::kiero::RenderType::D3D10, 101>;
+		using CreateDepthStencilState = ::kiero::Method<::kiero::RenderType::D3D10, 102>;
+		using CreateRasterizerState = ::kiero::Method<::kiero::RenderType::D3D10, 103>;
+		using CreateSamplerState = ::kiero::Method<::kiero::RenderType::D3D10, 104>;
+		using CreateQuery = ::kiero::Method<::kiero::RenderType::D3D10, 105>;
+		using CreatePredicate = ::kiero::Method<::kiero::RenderType::D3D10, 106>;
+		using CreateCounter = ::kiero::Method<::kiero::RenderType::D3D10, 107>;
+		using CheckFormatSupport = ::kiero::Method<::kiero::RenderType::D3D10, 108>;
+		using CheckMultisampleQualityLevels = ::kiero::Method<::kiero::RenderType::D3D10, 109>;
+		using CheckCounterInfo = ::kiero::Method<::kiero::RenderType::D3D10, 110>;
+		using CheckCounter = ::kiero::Method<::kiero::RenderType::D3D10, 111>;
+		using GetCreationFlags = ::kiero::Method<::kiero::RenderType::D3D10, 112>;
+		using OpenSharedResource = ::kiero::Method<::kiero::RenderType::D3D10, 113>;
+		using SetTextFilterSize = ::kiero::Method<::kiero::RenderType::D3D10, 114>;
+		using GetTextFilterSize = ::kiero::Method<::kiero::RenderType::D3D10, 115>;
+	}
+
+	inline constexpr const char* const Names[] = {
+		"IDXGISwapChain::QueryInterface",
+		"IDXGISwapChain::AddRef",
+		"IDXGISwapChain::Release",
+		"IDXGISwapChain::SetPrivateData",
+		"IDXGISwapChain::SetPrivateDataInterface",
+		"IDXGISwapChain::GetPrivateData",
+		"IDXGISwapChain::GetParent",
+		"IDXGISwapChain::GetDevice",
+		"IDXGISwapChain::Present",
+		"IDXGISwapChain::GetBuffer",
+		"IDXGISwapChain::SetFullscreenState",
+		"IDXGISwapChain::GetFullscreenState",
+		"IDXGISwapChain::GetDesc",
+		"IDXGISwapChain::ResizeBuffers",
+		"IDXGISwapChain::ResizeTarget",
+		"IDXGISwapChain::GetContainingOutput",
+		"IDXGISwapChain::GetFrameStatistics",
+		"IDXGISwapChain::GetLastPresentCount",
+		"ID3D10Device::QueryInterface",
+		"ID3D10Device::AddRef",
+		"ID3D10Device::Release",
+		"ID3D10Device::VSSetConstantBuffers",
+		"ID3D10Device::PSSetShaderResources",
+		"ID3D10Device::PSSetShader",
+		"ID3D10Device::PSSetSamplers",
+		"ID3D10Device::VSSetShader",
+		"ID3D10Device::DrawIndexed",
+		"ID3D10Device::Draw",
+		"ID3D10Device::PSSetConstantBuffers",
+		"ID3D10Device::IASetInputLayout",
+		"ID3D10Device::IASetVertexBuffers",
+		"ID3D10Device::IASetIndexBuffer",
+		"ID3D10Device::DrawIndexedInstanced",
+		"ID3D10Device::DrawInstanced",
+		"ID3D10Device::GSSetConstantBuffers",
+		"ID3D10Device::GSSetShader",
+		"ID3D10Device::IASetPrimitiveTopology",
+		"ID3D10Device::VSSetShaderResources",
+		"ID3D10Device::VSSetSamplers",
+		"ID3D10Device::SetPredication",
+		"ID3D10Device::GSSetShaderResources",
+		"ID3D10Device::GSSetSamplers",
+		"ID3D10Device::OMSetRenderTargets",
+		"ID3D10Device::OMSetBlendState",
+		"ID3D10Device::OMSetDepthStencilState",
+		"ID3D10Device::SOSetTargets",
+		"ID3D10Device::DrawAuto",
+		"ID3D10Device::RSSetState",
+		"ID3D10Device::RSSetViewports",
+		"ID3D10Device::RSSetScissorRects",
+		"ID3D10Device::CopySubresourceRegion",
+		"ID3D10Device::CopyResource",
+		"ID3D10Device::UpdateSubresource",
+		"ID3D10Device::ClearRenderTargetView",
+		"ID3D10Device::ClearDepthStencilView",
+		"ID3D10Device::GenerateMips",
+		"ID3D10Device::ResolveSubresource",
+		"ID3D10Device::VSGetConstantBuffers",
+		"ID3D10Device::PSGetShaderResources",
+		"ID3D10Device::PSGetShader",
+		"ID3D10Device::PSGetSamplers",
+		"ID3D10Device::VSGetShader",
+		"ID3D10Device::PSGetConstantBuffers",
+		"ID3D10Device::IAGetInputLayout",
+		"ID3D10Device::IAGetVertexBuffers",
+		"ID3D10Device::IAGetIndexBuffer",
+		"ID3D10Device::GSGetConstantBuffers",
+		"ID3D10Device::GSGetShader",
+		"ID3D10Device::IAGetPrimitiveTopology",
+		"ID3D10Device::VSGetShaderResources",
+		"ID3D10Device::VSGetSamplers",
+		"ID3D10Device::GetPredication",
+		"ID3D10Device::GSGetShaderResources",
+		"ID3D10Device::GSGetSamplers",
+		"ID3D10Device::OMGetRenderTargets",
+		"ID3D10Device::OMGetBlendState",
+		"ID3D10Device::OMGetDepthStencilState",
+		"ID3D10Device::SOGetTargets",
+		"ID3D10Device::RSGetState",
+		"ID3D10Device::RSGetViewports",
+		"ID3D10Device::RSGetScissorRects",
+		"ID3D10Device::GetDeviceRemovedReason",
+		"ID3D10Device::SetExceptionMode",
+		"ID3D10Device::GetExceptionMode",
+		"ID3D10Device::GetPrivateData",
+		"ID3D10Device::SetPrivateData",
+		"ID3D10Device::SetPrivateDataInterface",
+		"ID3D10Device::ClearState",
+		"ID3D10Device::Flush",
+		"ID3D10Device::CreateBuffer",
+		"ID3D10Device::CreateTexture1D",
+		"ID3D10Device::CreateTexture2D",
+		"ID3D10Device::CreateTexture3D",
+		"ID3D10Device::CreateShaderResourceView",
+		"ID3D10Device::CreateRenderTargetView",
+		"ID3D10Device::CreateDepthStencilView",
+		"ID3D10Device::CreateInputLayout",
+		"ID3D10Device::CreateVertexShader",
+		"ID3D10Device::CreateGeometryShader",
+		"ID3D10Device::CreateGemoetryShaderWithStreamOutput",
+		"ID3D10Device::CreatePixelShader",
+		"ID3D10Device::CreateBlendState",
+		"ID3D10Device::CreateDepthStencilState",
+		"ID3D10Device::CreateRasterizerState",
+		"ID3D10Device::CreateSamplerState",
+		"ID3D10Device::CreateQuery",
+		"ID3D10Device::CreatePredicate",
+		"ID3D10Device::CreateCounter",
+		"ID3D10Device::CheckFormatSupport",
+		"ID3D10Device::CheckMultisampleQualityLevels",
+		"ID3D10Device::CheckCounterInfo",
+		"ID3D10Device::CheckCounter",
+		"ID3D10Device::GetCreationFlags",
+		"ID3D10Device::OpenSharedResource",
+		"ID3D10Device::SetTextFilterSize",
+		"ID3D10Device::GetTextFilterSize",
+	};
+}
+
+namespace kiero::d3d11
+{
+	inline constexpr ::std::uint16_t MethodsCount = 205;
+
+	namespace IDXGISwapChain
+	{
+		inline constexpr ::std::uint16_t Offset = 0;
+		inline constexpr ::std::uint16_t Count = 18;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D11, 0>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D11, 1>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D11, 2>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D11, 3>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D11, 4>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D11, 5>;
+		using GetParent = ::kiero::Method<::kiero::RenderType::D3D11, 6>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D11, 7>;
+		using Present = ::kiero::Method<::kiero::RenderType::D3D11, 8>;
+		using GetBuffer = ::kiero::Method<::kiero::RenderType::D3D11, 9>;
+		using SetFullscreenState = ::kiero::Method<::kiero::RenderType::D3D11, 10>;
+		using GetFullscreenState = ::kiero::Method<::kiero::RenderType::D3D11, 11>;
+		using GetDesc = ::kiero::Method<::kiero::RenderType::D3D11, 12>;
+		using ResizeBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 13>;
+		using ResizeTarget = ::kiero::Method<::kiero::RenderType::D3D11, 14>;
+		using GetContainingOutput = ::kiero::Method<::kiero::RenderType::D3D11, 15>;
+		using GetFrameStatistics = ::kiero::Method<::kiero::RenderType::D3D11, 16>;
+		using GetLastPresentCount = ::kiero::Method<::kiero::RenderType::D3D11, 17>;
+	}
+
+	namespace ID3D11Device
+	{
+		inline constexpr ::std::uint16_t Offset = 18;
+		inline constexpr ::std::uint16_t Count = 43;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D11, 18>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D11, 19>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D11, 20>;
+		using CreateBuffer = ::kiero::Method<::kiero::RenderType::D3D11, 21>;
+		using CreateTexture1D = ::kiero::Method<::kiero::RenderType::D3D11, 22>;
+		using CreateTexture2D = ::kiero::Method<::kiero::RenderType::D3D11, 23>;
+		using CreateTexture3D = ::kiero::Method<::kiero::RenderType::D3D11, 24>;
+		using CreateShaderResourceView = ::kiero::Method<::kiero::RenderType::D3D11, 25>;
+		using CreateUnorderedAccessView = ::kiero::Method<::kiero::RenderType::D3D11, 26>;
+		using CreateRenderTargetView = ::kiero::Method<::kiero::RenderType::D3D11, 27>;
+		using CreateDepthStencilView = ::kiero::Method<::kiero::RenderType::D3D11, 28>;
+		using CreateInputLayout = ::kiero::Method<::kiero::RenderType::D3D11, 29>;
+		using CreateVertexShader = ::kiero::Method<::kiero::RenderType::D3D11, 30>;
+		using CreateGeometryShader = ::kiero::Method<::kiero::RenderType::D3D11, 31>;
+		using CreateGeometryShaderWithStreamOutput = ::kiero::Method<::kiero::RenderType::D3D11, 32>;
+		using CreatePixelShader = ::kiero::Method<::kiero::RenderType::D3D11, 33>;
+		using CreateHullShader = ::kiero::Method<::kiero::RenderType::D3D11, 34>;
+		using CreateDomainShader = ::kiero::Method<::kiero::RenderType::D3D11, 35>;
+		using CreateComputeShader = ::kiero::Method<::kiero::RenderType::D3D11, 36>;
+		using CreateClassLinkage = ::kiero::Method<::kiero::RenderType::D3D11, 37>;
+		using CreateBlendState = ::kiero::Method<::kiero::RenderType::D3D11, 38>;
+		using CreateDepthStencilState = ::kiero::Method<::kiero::RenderType::D3D11, 39>;
+		using CreateRasterizerState = ::kiero::Method<::kiero::RenderType::D3D11, 40>;
+		using CreateSamplerState = ::kiero::Method<::kiero::RenderType::D3D11, 41>;
+		using CreateQuery = ::kiero::Method<::kiero::RenderType::D3D11, 42>;
+		using CreatePredicate = ::kiero::Method<::kiero::RenderType::D3D11, 43>;
+		using CreateCounter = ::kiero::Method<::kiero::RenderType::D3D11, 44>;
+		using CreateDeferredContext = ::kiero::Method<::kiero::RenderType::D3D11, 45>;
+		using OpenSharedResource = ::kiero::Method<::kiero::RenderType::D3D11, 46>;
+		using CheckFormatSupport = ::kiero::Method<::kiero::RenderType::D3D11, 47>;
+		using CheckMultisampleQualityLevels = ::kiero::Method<::kiero::RenderType::D3D11, 48>;
+		using CheckCounterInfo = ::kiero::Method<::kiero::RenderType::D3D11, 49>;
+		using CheckCounter = ::kiero::Method<::kiero::RenderType::D3D11, 50>;
+		using CheckFeatureSupport = ::kiero::Method<::kiero::RenderType::D3D11, 51>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D11, 52>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D11, 53>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D11, 54>;
+		using GetFeatureLevel = ::kiero::Method<::kiero::RenderType::D3D11, 55>;
+		using GetCreationFlags = ::kiero::Method<::kiero::RenderType::D3D11, 56>;
+		using GetDeviceRemovedReason = ::kiero::Method<::kiero::RenderType::D3D11, 57>;
+		using GetImmediateContext = ::kiero::Method<::kiero::RenderType::D3D11, 58>;
+		using SetExceptionMode = ::kiero::Method<::kiero::RenderType::D3D11, 59>;
+		using GetExceptionMode = ::kiero::Method<::kiero::RenderType::D3D11, 60>;
+	}
+
+	namespace ID3D11DeviceContext
+	{
+		inline constexpr ::std::uint16_t Offset = 61;
+		inline constexpr ::std::uint16_t Count = 115;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D11, 61>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D11, 62>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D11, 63>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D11, 64>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D11, 65>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D11, 66>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D11, 67>;
+		using VSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 68>;
+		using PSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 69>;
+		using PSSetShader = ::kiero::Method<::kiero::RenderType::D3D11, 70>;
+		using PSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 71>;
+		using VSSetShader = ::kiero::Method<::kiero::RenderType::D3D11, 72>;
+		using DrawIndexed = ::kiero::Method<::kiero::RenderType::D3D11, 73>;
+		using Draw = ::kiero::Method<::kiero::RenderType::D3D11, 74>;
+		using Map = ::kiero::Method<::kiero::RenderType::D3D11, 75>;
+		using Unmap = ::kiero::Method<::kiero::RenderType::D3D11, 76>;
+		using PSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 77>;
+		using IASetInputLayout = ::kiero::Method<::kiero::RenderType::D3D11, 78>;
+		using IASetVertexBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 79>;
+		using IASetIndexBuffer = ::kiero::Method<::kiero::RenderType::D3D11, 80>;
+		using DrawIndexedInstanced = ::kiero::Method<::kiero::RenderType::D3D11, 81>;
+		using DrawInstanced = ::kiero::Method<::kiero::RenderType::D3D11, 82>;
+		using GSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 83>;
+		using GSSetShader = ::kiero::Method<::kiero::RenderType::D3D11, 84>;
+		using IASetPrimitiveTopology = ::kiero::Method<::kiero::RenderType::D3D11, 85>;
+		using VSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 86>;
+		using VSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 87>;
+		using Begin = ::kiero::Method<::kiero::RenderType::D3D11, 88>;
+		using End = ::kiero::Method<::kiero::RenderType::D3D11, 89>;
+		using GetData = ::kiero::Method<::kiero::RenderType::D3D11, 90>;
+		using SetPredication = ::kiero::Method<::kiero::RenderType::D3D11, 91>;
+		using GSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 92>;
+		using GSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 93>;
+		using OMSetRenderTargets = ::kiero::Method<::kiero::RenderType::D3D11, 94>;
+		using OMSetRenderTargetsAndUnorderedAccessViews = ::kiero::Method<::kiero::RenderType::D3D11, 95>;
+		using OMSetBlendState = ::kiero::Method<::kiero::RenderType::D3D11, 96>;
+		using OMSetDepthStencilState = ::kiero::Method<::kiero::RenderType::D3D11, 97>;
+		using SOSetTargets = ::kiero::Method<::kiero::RenderType::D3D11, 98>;
+		using DrawAuto = ::kiero::Method<::kiero::RenderType::D3D11, 99>;
+		using DrawIndexedInstancedIndirect = ::kiero::Method<::kiero::RenderType::D3D11, 100>;
+		using DrawInstancedIndirect = ::kiero::Method<::kiero::RenderType::D3D11, 101>;
+		using Dispatch = ::kiero::Method<::kiero::RenderType::D3D11, 102>;
+		using DispatchIndirect = ::kiero::Method<::kiero::RenderType::D3D11, 103>;
+		using RSSetState = ::kiero::Method<::kiero::RenderType::D3D11, 104>;
+		using RSSetViewports = ::kiero::Method<::kiero::RenderType::D3D11, 105>;
+		using RSSetScissorRects = ::kiero::Method<::kiero::RenderType::D3D11, 106>;
+		using CopySubresourceRegion = ::kiero::Method<::kiero::RenderType::D3D11, 107>;
+		using CopyResource = ::kiero::Method<::kiero::RenderType::D3D11, 108>;
+		using UpdateSubresource = ::kiero::Method<::kiero::RenderType::D3D11, 109>;
+		using CopyStructureCount = ::kiero::Method<::kiero::RenderType::D3D11, 110>;
+		using ClearRenderTargetView = ::kiero::Method<::kiero::RenderType::D3D11, 111>;
+		using ClearUnorderedAccessViewUint = ::kiero::Method<::kiero::RenderType::D3D11, 112>;
+		using ClearUnorderedAccessViewFloat = ::kiero::Method<::kiero::RenderType::D3D11, 113>;
+		using ClearDepthStencilView = ::kiero::Method<::kiero::RenderType::D3D11, 114>;
+		using GenerateMips = ::kiero::Method<::kiero::RenderType::D3D11, 115>;
+		using SetResourceMinLOD = ::kiero::Method<::kiero::RenderType::D3D11, 116>;
+		using GetResourceMinLOD = ::kiero::Method<::kiero::RenderType::D3D11, 117>;
+		using ResolveSubresource = ::kiero::Method<::kiero::RenderType::D3D11, 118>;
+		using ExecuteCommandList = ::kiero::Method<::kiero::RenderType::D3D11, 119>;
+		using HSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 120>;
+		using HSSetShader = ::kiero::Method<::kiero::RenderType::D3D11, 121>;
+		using HSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 122>;
+		using HSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 123>;
+		using DSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 124>;
+		using DSSetShader = ::kiero::Method<::kiero::RenderType::D3D11, 125>;
+		using DSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 126>;
+		using DSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 127>;
+		using CSSetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 128>;
+		using CSSetUnorderedAccessViews = ::kiero::Method<::kiero::RenderType::D3D11, 129>;
+		using CSSetShader = ::kiero::Method<::kiero::RenderType::D3D11, 130>;
+		using CSSetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 131>;
+		using CSSetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 132>;
+		using VSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 133>;
+		using PSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 134>;
+		using PSGetShader = ::kiero::Method<::kiero::RenderType::D3D11, 135>;
+		using PSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 136>;
+		using VSGetShader = ::kiero::Method<::kiero::RenderType::D3D11, 137>;
+		using PSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 138>;
+		using IAGetInputLayout = ::kiero::Method<::kiero::RenderType::D3D11, 139>;
+		using IAGetVertexBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 140>;
+		using IAGetIndexBuffer = ::kiero::Method<::kiero::RenderType::D3D11, 141>;
+		using GSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 142>;
+		using GSGetShader = ::kiero::Method<::kiero::RenderType::D3D11, 143>;
+		using IAGetPrimitiveTopology = ::kiero::Method<::kiero::RenderType::D3D11, 144>;
+		using VSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 145>;
+		using VSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 146>;
+		using GetPredication = ::kiero::Method<::kiero::RenderType::D3D11, 147>;
+		using GSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 148>;
+		using GSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 149>;
+		using OMGetRenderTargets = ::kiero::Method<::kiero::RenderType::D3D11, 150>;
+		using OMGetRenderTargetsAndUnorderedAccessViews = ::kiero::Method<::kiero::RenderType::D3D11, 151>;
+		using OMGetBlendState = ::kiero::Method<::kiero::RenderType::D3D11, 152>;
+		using OMGetDepthStencilState = ::kiero::Method<::kiero::RenderType::D3D11, 153>;
+		using SOGetTargets = ::kiero::Method<::kiero::RenderType::D3D11, 154>;
+		using RSGetState = ::kiero::Method<::kiero::RenderType::D3D11, 155>;
+		using RSGetViewports = ::kiero::Method<::kiero::RenderType::D3D11, 156>;
+		using RSGetScissorRects = ::kiero::Method<::kiero::RenderType::D3D11, 157>;
+		using HSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 158>;
+		using HSGetShader = ::kiero::Method<::kiero::RenderType::D3D11, 159>;
+		using HSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 160>;
+		using HSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 161>;
+		using DSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 162>;
+		using DSGetShader = ::kiero::Method<::kiero::RenderType::D3D11, 163>;
+		using DSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 164>;
+		using DSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 165>;
+		using CSGetShaderResources = ::kiero::Method<::kiero::RenderType::D3D11, 166>;
+		using CSGetUnorderedAccessViews = ::kiero::Method<::kiero::RenderType::D3D11, 167>;
+		using CSGetShader = ::kiero::Method<::kiero::RenderType::D3D11, 168>;
+		using CSGetSamplers = ::kiero::Method<::kiero::RenderType::D3D11, 169>;
+		using CSGetConstantBuffers = ::kiero::Method<::kiero::RenderType::D3D11, 170>;
+		using ClearState = ::kiero::Method<::kiero::RenderType::D3D11, 171>;
+		using Flush = ::kiero::Method<::kiero::RenderType::D3D11, 172>;
+		using GetType = ::kiero::Method<::kiero::RenderType::D3D11, 173>;
+		using GetContextFlags = ::kiero::Method<::kiero::RenderType::D3D11, 174>;
+		using FinishCommandList = ::kiero::Method<::kiero::RenderType::D3D11, 175>;
+	}
+
+	namespace ID3D11DeviceContext1
+	{
+		inline constexpr ::std::uint16_t Offset = 176;
+		inline constexpr ::std::uint16_t Count = 19;
+
+		using CopySubresourceRegion1 = ::kiero::Method<::kiero::RenderType::D3D11, 176>;
+		using UpdateSubresource1 = ::kiero::Method<::kiero::RenderType::D3D11, 177>;
+		using DiscardResource = ::kiero::Method<::kiero::RenderType::D3D11, 178>;
+		using DiscardView = ::kiero::Method<::kiero::RenderType::D3D11, 179>;
+		using VSSetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 180>;
+		using HSSetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 181>;
+		using DSSetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 182>;
+		using GSSetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 183>;
+		using PSSetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 184>;
+		using CSSetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 185>;
+		using VSGetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 186>;
+		using HSGetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 187>;
+		using DSGetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 188>;
+		using GSGetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 189>;
+		using PSGetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 190>;
+		using CSGetConstantBuffers1 = ::kiero::Method<::kiero::RenderType::D3D11, 191>;
+		using SwapDeviceContextState = ::kiero::Method<::kiero::RenderType::D3D11, 192>;
+		using ClearView = ::kiero::Method<::kiero::RenderType::D3D11, 193>;
+		using DiscardView1 = ::kiero::Method<::kiero::RenderType::D3D11, 194>;
+	}
+
+	namespace ID3D11DeviceContext2
+	{
+		inline constexpr ::std::uint16_t Offset = 195;
+		inline constexpr ::std::uint16_t Count = 10;
+
+		using UpdateTileMappings = ::kiero::Method<::kiero::RenderType::D3D11, 195>;
+		using CopyTileMappings = ::kiero::Method<::kiero::RenderType::D3D11, 196>;
+		using CopyTiles = ::kiero::Method<::kiero::RenderType::D3D11, 197>;
+		using UpdateTiles = ::kiero::Method<::kiero::RenderType::D3D11, 198>;
+		using ResizeTilePool = ::kiero::Method<::kiero::RenderType::D3D11, 199>;
+		using TiledResourceBarrier = ::kiero::Method<::kiero::RenderType::D3D11, 200>;
+		using IsAnnotationEnabled = ::kiero::Method<::kiero::RenderType::D3D11, 201>;
+		using SetMarkerInt = ::kiero::Method<::kiero::RenderType::D3D11, 202>;
+		using BeginEventInt = ::kiero::Method<::kiero::RenderType::D3D11, 203>;
+		using EndEvent = ::kiero::Method<::kiero::RenderType::D3D11, 204>;
+	}
+
+	inline constexpr const char* const Names[] = {
+		"IDXGISwapChain::QueryInterface",
+		"IDXGISwapChain::AddRef",
+		"IDXGISwapChain::Release",
+		"IDXGISwapChain::SetPrivateData",
+		"IDXGISwapChain::SetPrivateDataInterface",
+		"IDXGISwapChain::GetPrivateData",
+		"IDXGISwapChain::GetParent",
+		"IDXGISwapChain::GetDevice",
+		"IDXGISwapChain::Present",
+		"IDXGISwapChain::GetBuffer",
+		"IDXGISwapChain::SetFullscreenState",
+		"IDXGISwapChain::GetFullscreenState",
+		"IDXGISwapChain::GetDesc",
+		"IDXGISwapChain::ResizeBuffers",
+		"IDXGISwapChain::ResizeTarget",
+		"IDXGISwapChain::GetContainingOutput",
+		"IDXGISwapChain::GetFrameStatistics",
+		"IDXGISwapChain::GetLastPresentCount",
+		"ID3D11Device::QueryInterface",
+		"ID3D11Device::AddRef",
+		"ID3D11Device::Release",
+		"ID3D11Device::CreateBuffer",
+		"ID3D11Device::CreateTexture1D",
+		"ID3D11Device::CreateTexture2D",
+		"ID3D11Device::CreateTexture3D",
+		"ID3D11Device::CreateShaderResourceView",
+		"ID3D11Device::CreateUnorderedAccessView",
+		"ID3D11Device::CreateRenderTargetView",
+		"ID3D11Device::CreateDepthStencilView",
+		"ID3D11Device::CreateInputLayout",
+		"ID3D11Device::CreateVertexShader",
+		"ID3D11Device::CreateGeometryShader",
+		"ID3D11Device::CreateGeometryShaderWithStreamOutput",
+		"ID3D11Device::CreatePixelShader",
+		"ID3D11Device::CreateHullShader",
+		"ID3D11Device::CreateDomainShader",
+		"ID3D11Device::CreateComputeShader",
+		"ID3D11Device::CreateClassLinkage",
+		"ID3D11Device::CreateBlendState",
+		"ID3D11Device::CreateDepthStencilState",
+		"ID3D11Device::CreateRasterizerState",
+		"ID3D11Device::CreateSamplerState",
+		"ID3D11Device::CreateQuery",
+		"ID3D11Device::CreatePredicate",
+		"ID3D11Device::CreateCounter",
+		"ID3D11Device::CreateDeferredContext",
+		"ID3D11Device::OpenSharedResource",
+		"ID3D11Device::CheckFormatSupport",
+		"ID3D11Device::CheckMultisampleQualityLevels",
+		"ID3D11Device::CheckCounterInfo",
+		"ID3D11Device::CheckCounter",
+		"ID3D11Device::CheckFeatureSupport",
+		"ID3D11Device::GetPrivateData",
+		"ID3D11Device::SetPrivateData",
+		"ID3D11Device::SetPrivateDataInterface",
+		"ID3D11Device::GetFeatureLevel",
+		"ID3D11Device::GetCreationFlags",
+		"ID3D11Device::GetDeviceRemovedReason",
+		"ID3D11Device::GetImmediateContext",
+		"ID3D11Device::SetExceptionMode",
+		"ID3D11Device::GetExceptionMode",
+		"ID3D11DeviceContext::QueryInterface",
+		"ID3D11DeviceContext::AddRef",
+		"ID3D11DeviceContext::Release",
+		"ID3D11DeviceContext::GetDevice",
+		"ID3D11DeviceContext::GetPrivateData",
+		"ID3D11DeviceContext::SetPrivateData",
+		"ID3D11DeviceContext::SetPrivateDataInterface",
+		"ID3D11DeviceContext::VSSetConstantBuffers",
+		"ID3D11DeviceContext::PSSetShaderResources",
+		"ID3D11DeviceContext::PSSetShader",
+		"ID3D11DeviceContext::PSSetSamplers",
+		"ID3D11DeviceContext::VSSetShader",
+		"ID3D11DeviceContext::DrawIndexed",
+		"ID3D11DeviceContext::Draw",
+		"ID3D11DeviceContext::Map",
+		"ID3D11DeviceContext::Unmap",
+		"ID3D11DeviceContext::PSSetConstantBuffers",
+		"ID3D11DeviceContext::IASetInputLayout",
+		"ID3D11DeviceContext::IASetVertexBuffers",
+		"ID3D11DeviceContext::IASetIndexBuffer",
+		"ID3D11DeviceContext::DrawIndexedInstanced",
+		"ID3D11DeviceContext::DrawInstanced",
+		"ID3D11DeviceContext::GSSetConstantBuffers",
+		"ID3D11DeviceContext::GSSetShader",
+		"ID3D11DeviceContext::IASetPrimitiveTopology",
+		"ID3D11DeviceContext::VSSetShaderResources",
+		"ID3D11DeviceContext::VSSetSamplers",
+		"ID3D11DeviceContext::Begin",
+		"ID3D11DeviceContext::End",
+		"ID3D11DeviceContext::GetData",
+		"ID3D11DeviceContext::SetPredication",
+		"ID3D11DeviceContext::GSSetShaderResources",
+		"ID3D11DeviceContext::GSSetSamplers",
+		"ID3D11DeviceContext::OMSetRenderTargets",
+		"ID3D11DeviceContext::OMSetRenderTargetsAndUnorderedAccessViews",
+		"ID3D11DeviceContext::OMSetBlendState",
+		"ID3D11DeviceContext::OMSetDepthStencilState",
+		"ID3D11DeviceContext::SOSetTargets",
+		"ID3D11DeviceContext::DrawAuto",
+		"ID3D11DeviceContext::DrawIndexedInstancedIndirect",
+		"ID3D11DeviceContext::DrawInstancedIndirect",
+		"ID3D11DeviceContext::Dispatch",
+		"ID3D11DeviceContext::DispatchIndirect",
+		"ID3D11DeviceContext::RSSetState",
+		"ID3D11DeviceContext::RSSetViewports",
+		"ID3D11DeviceContext::RSSetScissorRects",
+		"ID3D11DeviceContext::CopySubresourceRegion",
+		"ID3D11DeviceContext::CopyResource",
+		"ID3D11DeviceContext::UpdateSubresource",
+		"ID3D11DeviceContext::CopyStructureCount",
+		"ID3D11DeviceContext::ClearRenderTargetView",
+		"ID3D11DeviceContext::ClearUnorderedAccessViewUint",
+		"ID3D11DeviceContext::ClearUnorderedAccessViewFloat",
+		"ID3D11DeviceContext::ClearDepthStencilView",
+		"ID3D11DeviceContext::GenerateMips",
+		"ID3D11DeviceContext::SetResourceMinLOD",
+		"ID3D11DeviceContext::GetResourceMinLOD",
+		"ID3D11DeviceContext::ResolveSubresource",
+		"ID3D11DeviceContext::ExecuteCommandList",
+		"ID3D11DeviceContext::HSSetShaderResources",
+		"ID3D11DeviceContext::HSSetShader",
+		"ID3D11DeviceContext::HSSetSamplers",
+		"ID3D11DeviceContext::HSSetConstantBuffers",
+		"ID3D11DeviceContext::DSSetShaderResources",
+		"ID3D11DeviceContext::DSSetShader",
+		"ID3D11DeviceContext::DSSetSamplers",
+		"ID3D11DeviceContext::DSSetConstantBuffers",
+		"ID3D11DeviceContext::CSSetShaderResources",
+		"ID3D11DeviceContext::CSSetUnorderedAccessViews",
+		"ID3D11DeviceContext::CSSetShader",
+		"ID3D11DeviceContext::CSSetSamplers",
+		"ID3D11DeviceContext::CSSetConstantBuffers",
+		"ID3D11DeviceContext::VSGetConstantBuffers",
+		"ID3D11DeviceContext::PSGetShaderResources",
+		"ID3D11DeviceContext::PSGetShader",
+		"ID3D11DeviceContext::PSGetSamplers",
+		"ID3D11DeviceContext::VSGetShader",
+		"ID3D11DeviceContext::PSGetConstantBuffers",
+		"ID3D11DeviceContext::IAGetInputLayout",
+		"ID3D11DeviceContext::IAGetVertexBuffers",
+		"ID3D11DeviceContext::IAGetIndexBuffer",
+		"ID3D11DeviceContext::GSGetConstantBuffers",
+		"ID3D11DeviceContext::GSGetShader",
+		"ID3D11DeviceContext::IAGetPrimitiveTopology",
+		"ID3D11DeviceContext::VSGetShaderResources",
+		"ID3D11DeviceContext::VSGetSamplers",
+		"ID3D11DeviceContext::GetPredication",
+		"ID3D11DeviceContext::GSGetShaderResources",
+		"ID3D11DeviceContext::GSGetSamplers",
+		"ID3D11DeviceContext::OMGetRenderTargets",
+		"ID3D11DeviceContext::OMGetRenderTargetsAndUnorderedAccessViews",
+		"ID3D11DeviceContext::OMGetBlendState",
+		"ID3D11DeviceContext::OMGetDepthStencilState",
+		"ID3D11DeviceContext::SOGetTargets",
+		"ID3D11DeviceContext::RSGetState",
+		"ID3D11DeviceContext::RSGetViewports",
+		"ID3D11DeviceContext::RSGetScissorRects",
+		"ID3D11DeviceContext::HSGetShaderResources",
+		"ID3D11DeviceContext::HSGetShader",
+		"ID3D11DeviceContext::HSGetSamplers",
+		"ID3D11DeviceContext::HSGetConstantBuffers",
+		"ID3D11DeviceContext::DSGetShaderResources",
+		"ID3D11DeviceContext::DSGetShader",
+		"ID3D11DeviceContext::DSGetSamplers",
+		"ID3D11DeviceContext::DSGetConstantBuffers",
+		"ID3D11DeviceContext::CSGetShaderResources",
+		"ID3D11DeviceContext::CSGetUnorderedAccessViews",
+		"ID3D11DeviceContext::CSGetShader",
+		"ID3D11DeviceContext::CSGetSamplers",
+		"ID3D11DeviceContext::CSGetConstantBuffers",
+		"ID3D11DeviceContext::ClearState",
+		"ID3D11DeviceContext::Flush",
+		"ID3D11DeviceContext::GetType",
+		"ID3D11DeviceContext::GetContextFlags",
+		"ID3D11DeviceContext::FinishCommandList",
+		"ID3D11DeviceContext1::CopySubresourceRegion1",
+		"ID3D11DeviceContext1::UpdateSubresource1",
+		"ID3D11DeviceContext1::DiscardResource",
+		"ID3D11DeviceContext1::DiscardView",
+		"ID3D11DeviceContext1::VSSetConstantBuffers1",
+		"ID3D11DeviceContext1::HSSetConstantBuffers1",
+		"ID3D11DeviceContext1::DSSetConstantBuffers1",
+		"ID3D11DeviceContext1::GSSetConstantBuffers1",
+		"ID3D11DeviceContext1::PSSetConstantBuffers1",
+		"ID3D11DeviceContext1::CSSetConstantBuffers1",
+		"ID3D11DeviceContext1::VSGetConstantBuffers1",
+		"ID3D11DeviceContext1::HSGetConstantBuffers1",
+		"ID3D11DeviceContext1::DSGetConstantBuffers1",
+		"ID3D11DeviceContext1::GSGetConstantBuffers1",
+		"ID3D11DeviceContext1::PSGetConstantBuffers1",
+		"ID3D11DeviceContext1::CSGetConstantBuffers1",
+		"ID3D11DeviceContext1::SwapDeviceContextState",
+		"ID3D11DeviceContext1::ClearView",
+		"ID3D11DeviceContext1::DiscardView1",
+		"ID3D11DeviceContext2::UpdateTileMappings",
+		"ID3D11DeviceContext2::CopyTileMappings",
+		"ID3D11DeviceContext2::CopyTiles",
+		"ID3D11DeviceContext2::UpdateTiles",
+		"ID3D11DeviceContext2::ResizeTilePool",
+		"ID3D11DeviceContext2::TiledResourceBarrier",
+		"ID3D11DeviceContext2::IsAnnotationEnabled",
+		"ID3D11DeviceContext2::SetMarkerInt",
+		"ID3D11DeviceContext2::BeginEventInt",
+		"ID3D11DeviceContext2::EndEvent",
+	};
+}
+
+namespace kiero::d3d12
+{
+	inline constexpr ::std::uint16_t MethodsCount = 150;
+
+	namespace ID3D12Device
+	{
+		inline constexpr ::std::uint16_t Offset = 0;
+		inline constexpr ::std::uint16_t Count = 44;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D12, 0>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D12, 1>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D12, 2>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 3>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 4>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D12, 5>;
+		using SetName = ::kiero::Method<::kiero::RenderType::D3D12, 6>;
+		using GetNodeCount = ::kiero::Method<::kiero::RenderType::D3D12, 7>;
+		using CreateCommandQueue = ::kiero::Method<::kiero::RenderType::D3D12, 8>;
+		using CreateCommandAllocator = ::kiero::Method<::kiero::RenderType::D3D12, 9>;
+		using CreateGraphicsPipelineState = ::kiero::Method<::kiero::RenderType::D3D12, 10>;
+		using CreateComputePipelineState = ::kiero::Method<::kiero::RenderType::D3D12, 11>;
+		using CreateCommandList = ::kiero::Method<::kiero::RenderType::D3D12, 12>;
+		using CheckFeatureSupport = ::kiero::Method<::kiero::RenderType::D3D12, 13>;
+		using CreateDescriptorHeap = ::kiero::Method<::kiero::RenderType::D3D12, 14>;
+		using GetDescriptorHandleIncrementSize = ::kiero::Method<::kiero::RenderType::D3D12, 15>;
+		using CreateRootSignature = ::kiero::Method<::kiero::RenderType::D3D12, 16>;
+		using CreateConstantBufferView = ::kiero::Method<::kiero::RenderType::D3D12, 17>;
+		using CreateShaderResourceView = ::kiero::Method<::kiero::RenderType::D3D12, 18>;
+		using CreateUnorderedAccessView = ::kiero::Method<::kiero::RenderType::D3D12, 19>;
+		using CreateRenderTargetView = ::kiero::Method<::kiero::RenderType::D3D12, 20>;
+		using CreateDepthStencilView = ::kiero::Method<::kiero::RenderType::D3D12, 21>;
+		using CreateSampler = ::kiero::Method<::kiero::RenderType::D3D12, 22>;
+		using CopyDescriptors = ::kiero::Method<::kiero::RenderType::D3D12, 23>;
+		using CopyDescriptorsSimple = ::kiero::Method<::kiero::RenderType::D3D12, 24>;
+		using GetResourceAllocationInfo = ::kiero::Method<::kiero::RenderType::D3D12, 25>;
+		using GetCustomHeapProperties = ::kiero::Method<::kiero::RenderType::D3D12, 26>;
+		using CreateCommittedResource = ::kiero::Method<::kiero::RenderType::D3D12, 27>;
+		using CreateHeap = ::kiero::Method<::kiero::RenderType::D3D12, 28>;
+		using CreatePlacedResource = ::kiero::Method<::kiero::RenderType::D3D12, 29>;
+		using CreateReservedResource = ::kiero::Method<::kiero::RenderType::D3D12, 30>;
+		using CreateSharedHandle = ::kiero::Method<::kiero::RenderType::D3D12, 31>;
+		using OpenSharedHandle = ::kiero::Method<::kiero::RenderType::D3D12, 32>;
+		using OpenSharedHandleByName = ::kiero::Method<::kiero::RenderType::D3D12, 33>;
+		using MakeResident = ::kiero::Method<::kiero::RenderType::D3D12, 34>;
+		using Evict = ::kiero::Method<::kiero::RenderType::D3D12, 35>;
+		using CreateFence = ::kiero::Method<::kiero::RenderType::D3D12, 36>;
+		using GetDeviceRemovedReason = ::kiero::Method<::kiero::RenderType::D3D12, 37>;
+		using GetCopyableFootprints = ::kiero::Method<::kiero::RenderType::D3D12, 38>;
+		using CreateQueryHeap = ::kiero::Method<::kiero::RenderType::D3D12, 39>;
+		using SetStablePowerState = ::kiero::Method<::kiero::RenderType::D3D12, 40>;
+		using CreateCommandSignature = ::kiero::Method<::kiero::RenderType::D3D12, 41>;
+		using GetResourceTiling = ::kiero::Method<::kiero::RenderType::D3D12, 42>;
+		using GetAdapterLuid = ::kiero::Method<::kiero::RenderType::D3D12, 43>;
+	}
+
+	namespace ID3D12CommandQueue
+	{
+		inline constexpr ::std::uint16_t Offset = 44;
+		inline constexpr ::std::uint16_t Count = 19;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D12, 44>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D12, 45>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D12, 46>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 47>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 48>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D12, 49>;
+		using SetName = ::kiero::Method<::kiero::RenderType::D3D12, 50>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D12, 51>;
+		using UpdateTileMappings = ::kiero::Method<::kiero::RenderType::D3D12, 52>;
+		using CopyTileMappings = ::kiero::Method<::kiero::RenderType::D3D12, 53>;
+		using ExecuteCommandLists = ::kiero::Method<::kiero::RenderType::D3D12, 54>;
+		using SetMarker = ::kiero::Method<::kiero::RenderType::D3D12, 55>;
+		using BeginEvent = ::kiero::Method<::kiero::RenderType::D3D12, 56>;
+		using EndEvent = ::kiero::Method<::kiero::RenderType::D3D12, 57>;
+		using Signal = ::kiero::Method<::kiero::RenderType::D3D12, 58>;
+		using Wait = ::kiero::Method<::kiero::RenderType::D3D12, 59>;
+		using GetTimestampFrequency = ::kiero::Method<::kiero::RenderType::D3D12, 60>;
+		using GetClockCalibration = ::kiero::Method<::kiero::RenderType::D3D12, 61>;
+		using GetDesc = ::kiero::Method<::kiero::RenderType::D3D12, 62>;
+	}
+
+	namespace ID3D12CommandAllocator
+	{
+		inline constexpr ::std::uint16_t Offset = 63;
+		inline constexpr ::std::uint16_t Count = 9;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D12, 63>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D12, 64>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D12, 65>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 66>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 67>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D12, 68>;
+		using SetName = ::kiero::Method<::kiero::RenderType::D3D12, 69>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D12, 70>;
+		using Reset = ::kiero::Method<::kiero::RenderType::D3D12, 71>;
+	}
+
+	namespace ID3D12GraphicsCommandList
+	{
+		inline constexpr ::std::uint16_t Offset = 72;
+		inline constexpr ::std::uint16_t Count = 60;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D12, 72>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D12, 73>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D12, 74>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 75>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 76>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D12, 77>;
+		using SetName = ::kiero::Method<::kiero::RenderType::D3D12, 78>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D12, 79>;
+		using GetType = ::kiero::Method<::kiero::RenderType::D3D12, 80>;
+		using Close = ::kiero::Method<::kiero::RenderType::D3D12, 81>;
+		using Reset = ::kiero::Method<::kiero::RenderType::D3D12, 82>;
+		using ClearState = ::kiero::Method<::kiero::RenderType::D3D12, 83>;
+		using DrawInstanced = ::kiero::Method<::kiero::RenderType::D3D12, 84>;
+		using DrawIndexedInstanced = ::kiero::Method<::kiero::RenderType::D3D12, 85>;
+		using Dispatch = ::kiero::Method<::kiero::RenderType::D3D12, 86>;
+		using CopyBufferRegion = ::kiero::Method<::kiero::RenderType::D3D12, 87>;
+		using CopyTextureRegion = ::kiero::Method<::kiero::RenderType::D3D12, 88>;
+		using CopyResource = ::kiero::Method<::kiero::RenderType::D3D12, 89>;
+		using CopyTiles = ::kiero::Method<::kiero::RenderType::D3D12, 90>;
+		using ResolveSubresource = ::kiero::Method<::kiero::RenderType::D3D12, 91>;
+		using IASetPrimitiveTopology = ::kiero::Method<::kiero::RenderType::D3D12, 92>;
+		using RSSetViewports = ::kiero::Method<::kiero::RenderType::D3D12, 93>;
+		using RSSetScissorRects = ::kiero::Method<::kiero::RenderType::D3D12, 94>;
+		using OMSetBlendFactor = ::kiero::Method<::kiero::RenderType::D3D12, 95>;
+		using OMSetStencilRef = ::kiero::Method<::kiero::RenderType::D3D12, 96>;
+		using SetPipelineState = ::kiero::Method<::kiero::RenderType::D3D12, 97>;
+		using ResourceBarrier = ::kiero::Method<::kiero::RenderType::D3D12, 98>;
+		using ExecuteBundle = ::kiero::Method<::kiero::RenderType::D3D12, 99>;
+		using SetDescriptorHeaps = ::kiero::Method<::kiero::RenderType::D3D12, 100>;
+		using SetComputeRootSignature = ::kiero::Method<::kiero::RenderType::D3D12, 101>;
+		using SetGraphicsRootSignature = ::kiero::Method<::kiero::RenderType::D3D12, 102>;
+		using SetComputeRootDescriptorTable = ::kiero::Method<::kiero::RenderType::D3D12, 103>;
+		using SetGraphicsRootDescriptorTable = ::kiero::Method<::kiero::RenderType::D3D12, 104>;
+		using SetComputeRoot32BitConstant = ::kiero::Method<::kiero::RenderType::D3D12, 105>;
+		using SetGraphicsRoot32BitConstant = ::kiero::Method<::kiero::RenderType::D3D12, 106>;
+		using SetComputeRoot32BitConstants = ::kiero::Method<::kiero::RenderType::D3D12, 107>;
+		using SetGraphicsRoot32BitConstants = ::kiero::Method<::kiero::RenderType::D3D12, 108>;
+		using SetComputeRootConstantBufferView = ::kiero::Method<::kiero::RenderType::D3D12, 109>;
+		using SetGraphicsRootConstantBufferView = ::kiero::Method<::kiero::RenderType::D3D12, 110>;
+		using SetComputeRootShaderResourceView = ::kiero::Method<::kiero::RenderType::D3D12, 111>;
+		using SetGraphicsRootShaderResourceView = ::kiero::Method<::kiero::RenderType::D3D12, 112>;
+		using SetComputeRootUnorderedAccessView = ::kiero::Method<::kiero::RenderType::D3D12, 113>;
+		using SetGraphicsRootUnorderedAccessView = ::kiero::Method<::kiero::RenderType::D3D12, 114>;
+		using IASetIndexBuffer = ::kiero::Method<::kiero::RenderType::D3D12, 115>;
+		using IASetVertexBuffers = ::kiero::Method<::kiero::RenderType::D3D12, 116>;
+		using SOSetTargets = ::kiero::Method<::kiero::RenderType::D3D12, 117>;
+		using OMSetRenderTargets = ::kiero::Method<::kiero::RenderType::D3D12, 118>;
+		using ClearDepthStencilView = ::kiero::Method<::kiero::RenderType::D3D12, 119>;
+		using ClearRenderTargetView = ::kiero::Method<::kiero::RenderType::D3D12, 120>;
+		using ClearUnorderedAccessViewUint = ::kiero::Method<::kiero::RenderType::D3D12, 121>;
+		using ClearUnorderedAccessViewFloat = ::kiero::Method<::kiero::RenderType::D3D12, 122>;
+		using DiscardResource = ::kiero::Method<::kiero::RenderType::D3D12, 123>;
+		using BeginQuery = ::kiero::Method<::kiero::RenderType::D3D12, 124>;
+		using EndQuery = ::kiero::Method<::kiero::RenderType::D3D12, 125>;
+		using ResolveQueryData = ::kiero::Method<::kiero::RenderType::D3D12, 126>;
+		using SetPredication = ::kiero::Method<::kiero::RenderType::D3D12, 127>;
+		using SetMarker = ::kiero::Method<::kiero::RenderType::D3D12, 128>;
+		using BeginEvent = ::kiero::Method<::kiero::RenderType::D3D12, 129>;
+		using EndEvent = ::kiero::Method<::kiero::RenderType::D3D12, 130>;
+		using ExecuteIndirect = ::kiero::Method<::kiero::RenderType::D3D12, 131>;
+	}
+
+	namespace IDXGISwapChain
+	{
+		inline constexpr ::std::uint16_t Offset = 132;
+		inline constexpr ::std::uint16_t Count = 18;
+
+		using QueryInterface = ::kiero::Method<::kiero::RenderType::D3D12, 132>;
+		using AddRef = ::kiero::Method<::kiero::RenderType::D3D12, 133>;
+		using Release = ::kiero::Method<::kiero::RenderType::D3D12, 134>;
+		using SetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 135>;
+		using SetPrivateDataInterface = ::kiero::Method<::kiero::RenderType::D3D12, 136>;
+		using GetPrivateData = ::kiero::Method<::kiero::RenderType::D3D12, 137>;
+		using GetParent = ::kiero::Method<::kiero::RenderType::D3D12, 138>;
+		using GetDevice = ::kiero::Method<::kiero::RenderType::D3D12, 139>;
+		using Present = ::kiero::Method<::kiero::RenderType::D3D12, 140>;
+		using GetBuffer = ::kiero::Method<::kiero::RenderType::D3D12, 141>;
+		using SetFullscreenState = ::kiero::Method<::kiero::RenderType::D3D12, 142>;
+		using GetFullscreenState = ::kiero::Method<::kiero::RenderType::D3D12, 143>;
+		using GetDesc = ::kiero::Method<::kiero::RenderType::D3D12, 144>;
+		using ResizeBuffers = ::kiero::Method<::kiero::RenderType::D3D12, 145>;
+		using ResizeTarget = ::kiero::Method<::kiero::RenderType::D3D12, 146>;
+		using GetContainingOutput = ::kiero::Method<::kiero::RenderType::D3D12, 147>;
+		using GetFrameStatistics = ::kiero::Method<::kiero::RenderType::D3D12, 148>;
+		using GetLastPresentCount = ::kiero::Method<::kiero::RenderType::D3D12, 149>;
+	}
+
+	inline constexpr const char* const Names[] = {
+		"ID3D12Device::QueryInterface",
+		"ID3D12Device::AddRef",
+		"ID3D12Device::Release",
+		"ID3D12Device::GetPrivateData",
+		"ID3D12Device::SetPrivateData",
+		"ID3D12Device::SetPrivateDataInterface",
+		"ID3D12Device::SetName",
+		"ID3D12Device::GetNodeCount",
+		"ID3D12Device::CreateCommandQueue",
+		"ID3D12Device::CreateCommandAllocator",
+		"ID3D12Device::CreateGraphicsPipelineState",
+		"ID3D12Device::CreateComputePipelineState",
+		"ID3D12Device::CreateCommandList",
+		"ID3D12Device::CheckFeatureSupport",
+		"ID3D12Device::CreateDescriptorHeap",
+		"ID3D12Device::GetDescriptorHandleIncrementSize",
+		"ID3D12Device::CreateRootSignature",
+		"ID3D12Device::CreateConstantBufferView",
+		"ID3D12Device::CreateShaderResourceView",
+		"ID3D12Device::CreateUnorderedAccessView",
+		"ID3D12Device::CreateRenderTargetView",
+		"ID3D12Device::CreateDepthStencilView",
+		"ID3D12Device::CreateSampler",
+		"ID3D12Device::CopyDescriptors",
+		"ID3D12Device::CopyDescriptorsSimple",
+		"ID3D12Device::GetResourceAllocationInfo",
+		"ID3D12Device::GetCustomHeapProperties",
+		"ID3D12Device::CreateCommittedResource",
+		"ID3D12Device::CreateHeap",
+		"ID3D12Device::CreatePlacedResource",
+		"ID3D12Device::CreateReservedResource",
+		"ID3D12Device::CreateSharedHandle",
+		"ID3D12Device::OpenSharedHandle",
+		"ID3D12Device::OpenSharedHandleByName",
+		"ID3D12Device::MakeResident",
+		"ID3D12Device::Evict",
+		"ID3D12Device::CreateFence",
+		"ID3D12Device::GetDeviceRemovedReason",
+		"ID3D12Device::GetCopyableFootprints",
+		"ID3D12Device::CreateQueryHeap",
+		"ID3D12Device::SetStablePowerState",
+		"ID3D12Device::CreateCommandSignature",
+		"ID3D12Device::GetResourceTiling",
+		"ID3D12Device::GetAdapterLuid",
+		"ID3D12CommandQueue::QueryInterface",
+		"ID3D12CommandQueue::AddRef",
+		"ID3D12CommandQueue::Release",
+		"ID3D12CommandQueue::GetPrivateData",
+		"ID3D12CommandQueue::SetPrivateData",
+		"ID3D12CommandQueue::SetPrivateDataInterface",
+		"ID3D12CommandQueue::SetName",
+		"ID3D12CommandQueue::GetDevice",
+		"ID3D12CommandQueue::UpdateTileMappings",
+		"ID3D12CommandQueue::CopyTileMappings",
+		"ID3D12CommandQueue::ExecuteCommandLists",
+		"ID3D12CommandQueue::SetMarker",
+		"ID3D12CommandQueue::BeginEvent",
+		"ID3D12CommandQueue::EndEvent",
+		"ID3D12CommandQueue::Signal",
+		"ID3D12CommandQueue::Wait",
+		"ID3D12CommandQueue::GetTimestampFrequency",
+		"ID3D12CommandQueue::GetClockCalibration",
+		"ID3D12CommandQueue::GetDesc",
+		"ID3D12CommandAllocator::QueryInterface",
+		"ID3D12CommandAllocator::AddRef",
+		"ID3D12CommandAllocator::Release",
+		"ID3D12CommandAllocator::GetPrivateData",
+		"ID3D12CommandAllocator::SetPrivateData",
+		"ID3D12CommandAllocator::SetPrivateDataInterface",
+		"ID3D12CommandAllocator::SetName",
+		"ID3D12CommandAllocator::GetDevice",
+		"ID3D12CommandAllocator::Reset",
+		"ID3D12GraphicsCommandList::QueryInterface",
+		"ID3D12GraphicsCommandList::AddRef",
+		"ID3D12GraphicsCommandList::Release",
+		"ID3D12GraphicsCommandList::GetPrivateData",
+		"ID3D12GraphicsCommandList::SetPrivateData",
+		"ID3D12GraphicsCommandList::SetPrivateDataInterface",
+		"ID3D12GraphicsCommandList::SetName",
+		"ID3D12GraphicsCommandList::GetDevice",
+		"ID3D12GraphicsCommandList::GetType",
+		"ID3D12GraphicsCommandList::Close",
+		"ID3D12GraphicsCommandList::Reset",
+		"ID3D12GraphicsCommandList::ClearState",
+		"ID3D12GraphicsCommandList::DrawInstanced",
+		"ID3D12GraphicsCommandList::DrawIndexedInstanced",
+		"ID3D12GraphicsCommandList::Dispatch",
+		"ID3D12GraphicsCommandList::CopyBufferRegion",
+		"ID3D12GraphicsCommandList::CopyTextureRegion",
+		"ID3D12GraphicsCommandList::CopyResource",
+		"ID3D12GraphicsCommandList::CopyTiles",
+		"ID3D12GraphicsCommandList::ResolveSubresource",
+		"ID3D12GraphicsCommandList::IASetPrimitiveTopology",
+		"ID3D12GraphicsCommandList::RSSetViewports",
+		"ID3D12GraphicsCommandList::RSSetScissorRects",
+		"ID3D12GraphicsCommandList::OMSetBlendFactor",
+		"ID3D12GraphicsCommandList::OMSetStencilRef",
+		"ID3D12GraphicsCommandList::SetPipelineState",
+		"ID3D12GraphicsCommandList::ResourceBarrier",
+		"ID3D12GraphicsCommandList::ExecuteBundle",
+		"ID3D12GraphicsCommandList::SetDescriptorHeaps",
+		"ID3D12GraphicsCommandList::SetComputeRootSignature",
+		"ID3D12GraphicsCommandList::SetGraphicsRootSignature",
+		"ID3D12GraphicsCommandList::SetComputeRootDescriptorTable",
+		"ID3D12GraphicsCommandList::SetGraphicsRootDescriptorTable",
+		"ID3D12GraphicsCommandList::SetComputeRoot32BitConstant",
+		"ID3D12GraphicsCommandList::SetGraphicsRoot32BitConstant",
+		"ID3D12GraphicsCommandList::SetComputeRoot32BitConstants",
+		"ID3D12GraphicsCommandList::SetGraphicsRoot32BitConstants",
+		"ID3D12GraphicsCommandList::SetComputeRootConstantBufferView",
+		"ID3D12GraphicsCommandList::SetGraphicsRootConstantBufferView",
+		"ID3D12GraphicsCommandList::SetComputeRootShaderResourceView",
+		"ID3D12GraphicsCommandList::SetGraphicsRootShaderResourceView",
+		"ID3D12GraphicsCommandList::SetComputeRootUnorderedAccessView",
+		"ID3D12GraphicsCommandList::SetGraphicsRootUnorderedAccessView",
+		"ID3D12GraphicsCommandList::IASetIndexBuffer",
+		"ID3D12GraphicsCommandList::IASetVertexBuffers",
+		"ID3D12GraphicsCommandList::SOSetTargets",
+		"ID3D12GraphicsCommandList::OMSetRenderTargets",
+		"ID3D12GraphicsCommandList::ClearDepthStencilView",
+		"ID3D12GraphicsCommandList::ClearRenderTargetView",
+		"ID3D12GraphicsCommandList::ClearUnorderedAccessViewUint",
+		"ID3D12GraphicsCommandList::ClearUnorderedAccessViewFloat",
+		"ID3D12GraphicsCommandList::DiscardResource",
+		"ID3D12GraphicsCommandList::BeginQuery",
+		"ID3D12GraphicsCommandList::EndQuery",
+		"ID3D12GraphicsCommandList::ResolveQueryData",
+		"ID3D12GraphicsCommandList::SetPredication",
+		"ID3D12GraphicsCommandList::SetMarker",
+		"ID3D12GraphicsCommandList::BeginEvent",
+		"ID3D12GraphicsCommandList::EndEvent",
+		"ID3D12GraphicsCommandList::ExecuteIndirect",
+		"IDXGISwapChain::QueryInterface",
+		"IDXGISwapChain::AddRef",
+		"IDXGISwapChain::Release",
+		"IDXGISwapChain::SetPrivateData",
+		"IDXGISwapChain::SetPrivateDataInterface",
+		"IDXGISwapChain::GetPrivateData",
+		"IDXGISwapChain::GetParent",
+		"IDXGISwapChain::GetDevice",
+		"IDXGISwapChain::Present",
+		"IDXGISwapChain::GetBuffer",
+		"IDXGISwapChain::SetFullscreenState",
+		"IDXGISwapChain::GetFullscreenState",
+		"IDXGISwapChain::GetDesc",
+		"IDXGISwapChain::ResizeBuffers",
+		"IDXGISwapChain::ResizeTarget",
+		"IDXGISwapChain::GetContainingOutput",
+		"IDXGISwapChain::GetFrameStatistics",
+		"IDXGISwapChain::GetLastPresentCount",
+	};
+}
+
+namespace kiero::opengl
+{
+	inline constexpr ::std::uint16_t MethodsCount = 338;
+
+	namespace Functions
+	{
+		inline constexpr ::std::uint16_t Offset = 0;
+		inline constexpr ::std::uint16_t Count = 336;
+	}
+
+	namespace SwapBuffers
+	{
+		inline constexpr ::std::uint16_t Offset = 336;
+		inline constexpr ::std::uint16_t Count = 2;
+	}
+
+	using glAccum = ::kiero::Method<::kiero::RenderType::OpenGL, 0>;
+	using glAlphaFunc = ::kiero::Method<::kiero::RenderType::OpenGL, 1>;
+	using glAreTexturesResident = ::kiero::Method<::kiero::RenderType::OpenGL, 2>;
+	using glArrayElement = ::kiero::Method<::kiero::RenderType::OpenGL, 3>;
+	using glBegin = ::kiero::Method<::kiero::RenderType::OpenGL, 4>;
+	using glBindTexture = ::kiero::Method<::kiero::RenderType::OpenGL, 5>;
+	using glBitmap = ::kiero::Method<::kiero::RenderType::OpenGL, 6>;
+	using glBlendFunc = ::kiero::Method<::kiero::RenderType::OpenGL, 7>;
+	using glCallList = ::kiero::Method<::kiero::RenderType::OpenGL, 8>;
+	using glCallLists = ::kiero::Method<::kiero::RenderType::OpenGL, 9>;
+	using glClear = ::kiero::Method<::kiero::RenderType::OpenGL, 10>;
+	using glClearAccum = ::kiero::Method<::kiero::RenderType::OpenGL, 11>;
+	using glClearColor = ::kiero::Method<::kiero::RenderType::OpenGL, 12>;
+	using glClearDepth = ::kiero::Method<::kiero::RenderType::OpenGL, 13>;
+	using glClearIndex = ::kiero::Method<::kiero::RenderType::OpenGL, 14>;
+	using glClearStencil = ::kiero::Method<::kiero::RenderType::OpenGL, 15>;
+	using glClipPlane = ::kiero::Method<::kiero::RenderType::OpenGL, 16>;
+	using glColor3b = ::kiero::Method<::kiero::RenderType::OpenGL, 17>;
+	using glColor3bv = ::kiero::Method<::kiero::RenderType::OpenGL, 18>;
+	using glColor3d = ::kiero::Method<::kiero::RenderType::OpenGL, 19>;
+	using glColor3dv = ::kiero::Method<::kiero::RenderType::OpenGL, 20>;
+	using glColor3f = ::kiero::Method<::kiero::RenderType::OpenGL, 21>;
+	using glColor3fv = ::kiero::Method<::kiero::RenderType::OpenGL, 22>;
+	using glColor3i = ::kiero::Method<::kiero::RenderType::OpenGL, 23>;
+	using glColor3iv = ::kiero::Method<::kiero::RenderType::OpenGL, 24>;
+	using glColor3s = ::kiero::Method<::kiero::RenderType::OpenGL, 25>;
+	using glColor3sv = ::kiero::Method<::kiero::RenderType::OpenGL, 26>;
+	using glColor3ub = ::kiero::Method<::kiero::RenderType::OpenGL, 27>;
+	using glColor3ubv = ::kiero::Method<::kiero::RenderType::OpenGL, 28>;
+	using glColor3ui = ::kiero::Method<::kiero::RenderType::OpenGL, 29>;
+	using glColor3uiv = ::kiero::Method<::kiero::RenderType::OpenGL, 30>;
+	using glColor3us = ::kiero::Method<::kiero::RenderType::OpenGL, 31>;
+	using glColor3usv = ::kiero::Method<::kiero::RenderType::OpenGL, 32>;
+	using glColor4b = ::kiero::Method<::kiero::RenderType::OpenGL, 33>;
+	using glColor4bv = ::kiero::Method<::kiero::RenderType::OpenGL, 34>;
+	using glColor4d = ::kiero::Method<::kiero::RenderType::OpenGL, 35>;
+	using glColor4dv = ::kiero::Method<::kiero::RenderType::OpenGL, 36>;
+	using glColor4f = ::kiero::Method<::kiero::RenderType::OpenGL, 37>;
+	using glColor4fv = ::kiero::Method<::kiero::RenderType::OpenGL, 38>;
+	using glColor4i = ::kiero::Method<::kiero::RenderType::OpenGL, 39>;
+	using glColor4iv = ::kiero::Method<::kiero::RenderType::OpenGL, 40>;
+	using glColor4s = ::kiero::Method<::kiero::RenderType::OpenGL, 41>;
+	using glColor4sv = ::kiero::Method<::kiero::RenderType::OpenGL, 42>;
+	using glColor4ub = ::kiero::Method<::kiero::RenderType::OpenGL, 43>;
+	using glColor4ubv = ::kiero::Method<::kiero::RenderType::OpenGL, 44>;
+	using glColor4ui = ::kiero::Method<::kiero::RenderType::OpenGL, 45>;
+	using glColor4uiv = ::kiero::Method<::kiero::RenderType::OpenGL, 46>;
+	using glColor4us = ::kiero::Method<::kiero::RenderType::OpenGL, 47>;
+	using glColor4usv = ::kiero::Method<::kiero::RenderType::OpenGL, 48>;
+	using glColorMask = ::kiero::Method<::kiero::RenderType::OpenGL, 49>;
+	using glColorMaterial = ::kiero::Method<::kiero::RenderType::OpenGL, 50>;
+	using glColorPointer = ::kiero::Method<::kiero::RenderType::OpenGL, 51>;
+	using glCopyPixels = ::kiero::Method<::kiero::RenderType::OpenGL, 52>;
+	using glCopyTexImage1D = ::kiero::Method<::kiero::RenderType::OpenGL, 53>;
+	using glCopyTexImage2D = ::kiero::Method<::kiero::RenderType::OpenGL, 54>;
+	using glCopyTexSubImage1D = ::kiero::Method<::kiero::RenderType::OpenGL, 55>;
+	using glCopyTexSubImage2D = ::kiero::Method<::kiero::RenderType::OpenGL, 56>;
+	using glCullFace = ::kiero::Method<::kiero::RenderType::OpenGL, 57>;
+	using glDeleteLists = ::kiero::Method<::kiero::RenderType::OpenGL, 58>;
+	using glDeleteTextures = ::kiero::Method<::kiero::RenderType::OpenGL, 59>;
+	using glDepthFunc = ::kiero::Method<::kiero::RenderType::OpenGL, 60>;
+	using glDepthMask = ::kiero::Method<::kiero::RenderType::OpenGL, 61>;
+	using glDepthRange = ::kiero::Method<::kiero::RenderType::OpenGL, 62>;
+	using glDisable = ::kiero::Method<::kiero::RenderType::OpenGL, 63>;
+	using glDisableClientState = ::kiero::Method<::kiero::RenderType::OpenGL, 64>;
+	using glDrawArrays = ::kiero::Method<::kiero::RenderType::OpenGL, 65>;
+	using glDrawBuffer = ::kiero::Method<::kiero::RenderType::OpenGL, 66>;
+	using glDrawElements = ::kiero::Method<::kiero::RenderType::OpenGL, 67>;
+	using glDrawPixels = ::kiero::Method<::kiero::RenderType::OpenGL, 68>;
+	using glEdgeFlag = ::kiero::Method<::kiero::RenderType::OpenGL, 69>;
+	using glEdgeFlagPointer = ::kiero::Method<::kiero::RenderType::OpenGL, 70>;
+	using glEdgeFlagv = ::kiero::Method<::kiero::RenderType::OpenGL, 71>;
+	using glEnable = ::kiero::Method<::kiero::RenderType::OpenGL, 72>;
+	using glEnableClientState = ::kiero::Method<::kiero::RenderType::OpenGL, 73>;
+	using glEnd = ::kiero::Method<::kiero::RenderType::OpenGL, 74>;
+	using glEndList = ::kiero::Method<::kiero::RenderType::OpenGL, 75>;
+	using glEvalCoord1d = ::kiero::Method<::kiero::RenderType::OpenGL, 76>;
+	using glEvalCoord1dv = ::kiero::Method<::kiero::RenderType::OpenGL, 77>;
+	using glEvalCoord1f = ::kiero::Method<::kiero::RenderType::OpenGL, 78>;
+	using glEvalCoord1fv = ::kiero::Method<::kiero::RenderType::OpenGL, 79>;
+	using glEvalCoord2d = ::kiero::Method<::kiero::RenderType::OpenGL, 80>;
+	using glEvalCoord2dv = ::kiero::Method<::kiero::RenderType::OpenGL, 81>;
+	using glEvalCoord2f = ::kiero::Method<::kiero::RenderType::OpenGL, 82>;
+	using glEvalCoord2fv = ::kiero::Method<::kiero::RenderType::OpenGL, 83>;
+	using glEvalMesh1 = ::kiero::Method<::kiero::RenderType::OpenGL, 84>;
+	using glEvalMesh2 = ::kiero::Method<::kiero::RenderType::OpenGL, 85>;
+	using glEvalPoint1 = ::kiero::Method<::kiero::RenderType::OpenGL, 86>;
+	using glEvalPoint2 = ::kiero::Method<::kiero::RenderType::OpenGL, 87>;
+	using glFeedbackBuffer = ::kiero::Method<::kiero::RenderType::OpenGL, 88>;
+	using glFinish = ::kiero::Method<::kiero::RenderType::OpenGL, 89>;
+	using glFlush = ::kiero::Method<::kiero::RenderType::OpenGL, 90>;
+	using glFogf = ::kiero::Method<::kiero::RenderType::OpenGL, 91>;
+	using glFogfv = ::kiero::Method<::kiero::RenderType::OpenGL, 92>;
+	using glFogi = ::kiero::Method<::kiero::RenderType::OpenGL, 93>;
+	using glFogiv = ::kiero::Method<::kiero::RenderType::OpenGL, 94>;
+	using glFrontFace = ::kiero::Method<::kiero::RenderType::OpenGL, 95>;
+	using glFrustum = ::kiero::Method<::kiero::RenderType::OpenGL, 96>;
+	using glGenLists = ::kiero::Method<::kiero::RenderType::OpenGL, 97>;
+	using glGenTextures = ::kiero::Method<::kiero::RenderType::OpenGL, 98>;
+	using glGetBooleanv = ::kiero::Method<::kiero::RenderType::OpenGL, 99>;
+	using glGetClipPlane = ::kiero::Method<::kiero::RenderType::OpenGL, 100>;
+	using glGetDoublev = ::kiero::Method<::kiero::RenderType::OpenGL, 101>;
+	using glGetError = ::kiero::Method<::kiero::RenderType::OpenGL, 102>;
+	using glGetFloatv = ::kiero::Method<::kiero::RenderType::OpenGL, 103>;
+	using glGetIntegerv = ::kiero::Method<::kiero::RenderType::OpenGL, 104>;
+	using glGetLightfv = ::kiero::Method<::kiero::RenderType::OpenGL, 105>;
+	using glGetLightiv = ::kiero::Method<::kiero::RenderType::OpenGL, 106>;
+	using glGetMapdv = ::kiero::Method<::kiero::RenderType::OpenGL, 107>;
+	using glGetMapfv = ::kiero::Method<::kiero::RenderType::OpenGL, 108>;
+	using glGetMapiv = ::kiero::Method<::kiero::RenderType::OpenGL, 109>;
+	using glGetMaterialfv = ::kiero::Method<::kiero::RenderType::OpenGL, 110>;
+	using glGetMaterialiv = ::kiero::Method<::kiero::RenderType::OpenGL, 111>;
+	using glGetPixelMapfv = ::kiero::Method<::kiero::RenderType::OpenGL, 112>;
+	using glGetPixelMapuiv = ::kiero::Method<::kiero::RenderType::OpenGL, 113>;
+	using glGetPixelMapusv = ::kiero::Method<::kiero::RenderType::OpenGL, 114>;
+	using glGetPointerv = ::kiero::Method<::kiero::RenderType::OpenGL, 115>;
+	using glGetPolygonStipple = ::kiero::Method<::kiero::RenderType::OpenGL, 116>;
+	using glGetString = ::kiero::Method<::kiero::RenderType::OpenGL, 117>;
+	using glGetTexEnvfv = ::kiero::Method<::kiero::RenderType::OpenGL, 118>;
+	using glGetTexEnviv = ::kiero::Method<::kiero::RenderType::OpenGL, 119>;
+	using glGetTexGendv = ::kiero::Method<::kiero::RenderType::OpenGL, 120>;
+	using glGetTexGenfv = ::kiero::Method<::kiero::RenderType::OpenGL, 121>;
+	using glGetTexGeniv = ::kiero::Method<::kiero::RenderType::OpenGL, 122>;
+	using glGetTexImage = ::kiero::Method<::kiero::RenderType::OpenGL, 123>;
+	using glGetTexLevelParameterfv = ::kiero::Method<::kiero::RenderType::OpenGL, 124>;
+	using glGetTexLevelParameteriv = ::kiero::Method<::kiero::RenderType::OpenGL, 125>;
+	using glGetTexParameterfv = ::kiero::Method<::kiero::RenderType::OpenGL, 126>;
+	using glGetTexParameteriv = ::kiero::Method<::kiero::RenderType::OpenGL, 127>;
+	using glHint = ::kiero::Method<::kiero::RenderType::OpenGL, 128>;
+	using glIndexMask = ::kiero::Method<::kiero::RenderType::OpenGL, 129>;
+	using glIndexPointer = ::kiero::Method<::kiero::RenderType::OpenGL, 130>;
+	using glIndexd = ::kiero::Method<::kiero::RenderType::OpenGL, 131>;
+	using glIndexdv = ::kiero::Method<::kiero::RenderType::OpenGL, 132>;
+	using glIndexf = ::kiero::Method<::kiero::RenderType::OpenGL, 133>;
+	using glIndexfv = ::kiero::Method<::kiero::RenderType::OpenGL, 134>;
+	using glIndexi = ::kiero::Method<::kiero::RenderType::OpenGL, 135>;
+	using glIndexiv = ::kiero::Method<::kiero::RenderType::OpenGL, 136>;
+	using glIndexs = ::kiero::Method<::kiero::RenderType::OpenGL, 137>;
+	using glIndexsv = ::kiero::Method<::kiero::RenderType::OpenGL, 138>;
+	using glIndexub = ::kiero::Method<::kiero::RenderType::OpenGL, 139>;
+	using glIndexubv = ::kiero::Method<::kiero::RenderType::OpenGL, 140>;
+	using glInitNames = ::kiero::Method<::kiero::RenderType::OpenGL, 141>;
+	using glInterleavedArrays = ::kiero::Method<::kiero::RenderType::OpenGL, 142>;
+	using glIsEnabled = ::kiero::Method<::kiero::RenderType::OpenGL, 143>;
+	using glIsList = ::kiero::Method<::kiero::RenderType::OpenGL, 144>;
+	using glIsTexture = ::kiero::Method<::kiero::RenderType::OpenGL, 145>;
+	using glLightModelf = ::kiero::Method<::kiero::RenderType::OpenGL, 146>;
+	using glLightModelfv = ::kiero::Method<::kiero::RenderType::OpenGL, 147>;
+	using glLightModeli = ::kiero::Method<::kiero::RenderType::OpenGL, 148>;
+	using glLightModeliv = ::kiero::Method<::kiero::RenderType::OpenGL, 149>;
+	using glLightf = ::kiero::Method<::kiero::RenderType::OpenGL, 150>;
+	using glLightfv = ::kiero::Method<::kiero::RenderType::OpenGL, 151>;
+	using glLighti = ::kiero::Method<::kiero::RenderType::OpenGL, 152>;
+	using glLightiv = ::kiero::Method<::kiero::RenderType::OpenGL, 153>;
+	using glLineStipple = ::kiero::Method<::kiero::RenderType::OpenGL, 154>;
+	using glLineWidth = ::kiero::Method<::kiero::RenderType::OpenGL, 155>;
+	using glListBase = ::kiero::Method<::kiero::RenderType::OpenGL, 156>;
+	using glLoadIdentity = ::kiero::Method<::kiero::RenderType::OpenGL, 157>;
+	using glLoadMatrixd = ::kiero::Method<::kiero::RenderType::OpenGL, 158>;
+	using glLoadMatrixf = ::kiero::Method<::kiero::RenderType::OpenGL, 159>;
+	using glLoadName = ::kiero::Method<::kiero::RenderType::OpenGL, 160>;
+	using glLogicOp = ::kiero::Method<::kiero::RenderType::OpenGL, 161>;
+	using glMap1d = ::kiero::Method<::kiero::RenderType::OpenGL, 162>;
+	using glMap1f = ::kiero::Method<::kiero::RenderType::OpenGL, 163>;
+	using glMap2d = ::kiero::Method<::kiero::RenderType::OpenGL, 164>;
+	using glMap2f = ::kiero::Method<::kiero::RenderType::OpenGL, 165>;
+	using glMapGrid1d = ::kiero::Method<::kiero::RenderType::OpenGL, 166>;
+	using glMapGrid1f = ::kiero::Method<::kiero::RenderType::OpenGL, 167>;
+	using glMapGrid2d = ::kiero::Method<::kiero::RenderType::OpenGL, 168>;
+	using glMapGrid2f = ::kiero::Method<::kiero::RenderType::OpenGL, 169>;
+	using glMaterialf = ::kiero::Method<::kiero::RenderType::OpenGL, 170>;
+	using glMaterialfv = ::kiero::Method<::kiero::RenderType::OpenGL, 171>;
+	using glMateriali = ::kiero::Method<::kiero::RenderType::OpenGL, 172>;
+	using glMaterialiv = ::kiero::Method<::kiero::RenderType::OpenGL, 173>;
+	using glMatrixMode = ::kiero::Method<::kiero::RenderType::OpenGL, 174>;
+	using glMultMatrixd = ::kiero::Method<::kiero::RenderType::OpenGL, 175>;
+	using glMultMatrixf = ::kiero::Method<::kiero::RenderType::OpenGL, 176>;
+	using glNewList = ::kiero::Method<::kiero::RenderType::OpenGL, 177>;
+	using glNormal3b = ::kiero::Method<::kiero::RenderType::OpenGL, 178>;
+	using glNormal3bv = ::kiero::Method<::kiero::RenderType::OpenGL, 179>;
+	using glNormal3d = ::kiero::Method<::kiero::RenderType::OpenGL, 180>;
+	using glNormal3dv = ::kiero::Method<::kiero::RenderType::OpenGL, 181>;
+	using glNormal3f = ::kiero::Method<::kiero::RenderType::OpenGL, 182>;
+	using glNormal3fv = ::kiero::Method<::kiero::RenderType::OpenGL, 183>;
+	using glNormal3i = ::kiero::Method<::kiero::RenderType::OpenGL, 184>;
+	using glNormal3iv = ::kiero::Method<::kiero::RenderType::OpenGL, 185>;
+	using glNormal3s = ::kiero::Method<::kiero::RenderType::OpenGL, 186>;
+	using glNormal3sv = ::kiero::Method<::kiero::RenderType::OpenGL, 187>;
+	using glNormalPointer = ::kiero::Method<::kiero::RenderType::OpenGL, 188>;
+	using glOrtho = ::kiero::Method<::kiero::RenderType::OpenGL, 189>;
+	using glPassThrough = ::kiero::Method<::kiero::RenderType::OpenGL, 190>;
+	using glPixelMapfv = ::kiero::Method<::kiero::RenderType::OpenGL, 191>;
+	using glPixelMapuiv = ::kiero::Method<::kiero::RenderType::OpenGL, 192>;
+	using glPixelMapusv = ::kiero::Method<::kiero::RenderType::OpenGL, 193>;
+	using glPixelStoref = ::kiero::Method<::kiero::RenderType::OpenGL, 194>;
+	using glPixelStorei = ::kiero::Method<::kiero::RenderType::OpenGL, 195>;
+	using glPixelTransferf = ::kiero::Method<::kiero::RenderType::OpenGL, 196>;
+	using glPixelTransferi = ::kiero::Method<::kiero::RenderType::OpenGL, 197>;
+	using glPixelZoom = ::kiero::Method<::kiero::RenderType::OpenGL, 198>;
+	using glPointSize = ::kiero::Method<::kiero::RenderType::OpenGL, 199>;
+	using glPolygonMode = ::kiero::Method<::kiero::RenderType::OpenGL, 200>;
+	using glPolygonOffset = ::kiero::Method<::kiero::RenderType::OpenGL, 201>;
+	using glPolygonStipple = ::kiero::Method<::kiero::RenderType::OpenGL, 202>;
+	using glPopAttrib = ::kiero::Method<::kiero::RenderType::OpenGL, 203>;
+	using glPopClientAttrib = ::kiero::Method<::kiero::RenderType::OpenGL, 204>;
+	using glPopMatrix = ::kiero::Method<::kiero::RenderType::OpenGL, 205>;
+	using glPopName = ::kiero::Method<::kiero::RenderType::OpenGL, 206>;
+	using glPrioritizeTextures = ::kiero::Method<::kiero::RenderType::OpenGL, 207>;
+	using glPushAttrib = ::kiero::Method<::kiero::RenderType::OpenGL, 208>;
+	using glPushClientAttrib = ::kiero::Method<::kiero::RenderType::OpenGL, 209>;
+	using glPushMatrix = ::kiero::Method<::kiero::RenderType::OpenGL, 210>;
+	using glPushName = ::kiero::Method<::kiero::RenderType::OpenGL, 211>;
+	using glRasterPos2d = ::kiero::Method<::kiero::RenderType::OpenGL, 212>;
+	using glRasterPos2dv = ::kiero::Method<::kiero::RenderType::OpenGL, 213>;
+	using glRasterPos2f = ::kiero::Method<::kiero::RenderType::OpenGL, 214>;
+	using glRasterPos2fv = ::kiero::Method<::kiero::RenderType::OpenGL, 215>;
+	using glRasterPos2i = ::kiero::Method<::kiero::RenderType::OpenGL, 216>;
+	using glRasterPos2iv = ::kiero::Method<::kiero::RenderType::OpenGL, 217>;
+	using glRasterPos2s = ::kiero::Method<::kiero::RenderType::OpenGL, 218>;
+	using glRasterPos2sv = ::kiero::Method<::kiero::RenderType::OpenGL, 219>;
+	using glRasterPos3d = ::kiero::Method<::kiero::RenderType::OpenGL, 220>;
+	using glRasterPos3dv = ::kiero::Method<::kiero::RenderType::OpenGL, 221>;
+	using glRasterPos3f = ::kiero::Method<::kiero::RenderType::OpenGL, 222>;
+	using glRasterPos3fv = ::kiero::Method<::kiero::RenderType::OpenGL, 223>;
+	using glRasterPos3i = ::kiero::Method<::kiero::RenderType::OpenGL, 224>;
+	using glRasterPos3iv = ::kiero::Method<::kiero::RenderType::OpenGL, 225>;
+	using glRasterPos3s = ::kiero::Method<::kiero::RenderType::OpenGL, 226>;
+	using glRasterPos3sv = ::kiero::Method<::kiero::RenderType::OpenGL, 227>;
+	using glRasterPos4d = ::kiero::Method<::kiero::RenderType::OpenGL, 228>;
+	using glRasterPos4dv = ::kiero::Method<::kiero::RenderType::OpenGL, 229>;
+	using glRasterPos4f = ::kiero::Method<::kiero::RenderType::OpenGL, 230>;
+	using glRasterPos4fv = ::kiero::Method<::kiero::RenderType::OpenGL, 231>;
+	using glRasterPos4i = ::kiero::Method<::kiero::RenderType::OpenGL, 232>;
+	using glRasterPos4iv = ::kiero::Method<::kiero::RenderType::OpenGL, 233>;
+	using glRasterPos4s = ::kiero::Method<::kiero::RenderType::OpenGL, 234>;
+	using glRasterPos4sv = ::kiero::Method<::kiero::RenderType::OpenGL, 235>;
+	using glReadBuffer = ::kiero::Method<::kiero::RenderType::OpenGL, 236>;
+	using glReadPixels = ::kiero::Method<::kiero::RenderType::OpenGL, 237>;
+	using glRectd = ::kiero::Method<::kiero::RenderType::OpenGL, 238>;
+	using glRectdv = ::kiero::Method<::kiero::RenderType::OpenGL, 239>;
+	using glRectf = ::kiero::Method<::kiero::RenderType::OpenGL, 240>;
+	using glRectfv = ::kiero::Method<::kiero::RenderType::OpenGL, 241>;
+	using glRecti = ::kiero::Method<::kiero::RenderType::OpenGL, 242>;
+	using glRectiv = ::kiero::Method<::kiero::RenderType::OpenGL, 243>;
+	using glRects = ::kiero::Method<::kiero::RenderType::OpenGL, 244>;
+	using glRectsv = ::kiero::Method<::kiero::RenderType::OpenGL, 245>;
+	using glRenderMode = ::kiero::Method<::kiero::RenderType::OpenGL, 246>;
+	using glRotated = ::kiero::Method<::kiero::RenderType::OpenGL, 247>;
+	using glRotatef = ::kiero::Method<::kiero::RenderType::OpenGL, 248>;
+	using glScaled = ::kiero::Method<::kiero::RenderType::OpenGL, 249>;
+	using glScalef = ::kiero::Method<::kiero::RenderType::OpenGL, 250>;
+	using glScissor = ::kiero::Method<::kiero::RenderType::OpenGL, 251>;
+	using glSelectBuffer = ::kiero::Method<::kiero::RenderType::OpenGL, 252>;
+	using glShadeModel = ::kiero::Method<::kiero::RenderType::OpenGL, 253>;
+	using glStencilFunc = ::kiero::Method<::kiero::RenderType::OpenGL, 254>;
+	using glStencilMask = ::kiero::Method<::kiero::RenderType::OpenGL, 255>;
+	using glStencilOp = ::kiero::Method<::kiero::RenderType::OpenGL, 256>;
+	using glTexCoord1d = ::kiero::Method<::kiero::RenderType::OpenGL, 257>;
+	using glTexCoord1dv = ::kiero::Method<::kiero::RenderType::OpenGL, 258>;
+	using glTexCoord1f = ::kiero::Method<::kiero::RenderType::OpenGL, 259>;
+	using glTexCoord1fv = ::kiero::Method<::kiero::RenderType::OpenGL, 260>;
+	using glTexCoord1i = ::kiero::Method<::kiero::RenderType::OpenGL, 261>;
+	using glTexCoord1iv = ::kiero::Method<::kiero::RenderType::OpenGL, 262>;
+	using glTexCoord1s = ::kiero::Method<::kiero::RenderType::OpenGL, 263>;
+	using glTexCoord1sv = ::kiero::Method<::kiero::RenderType::OpenGL, 264>;
+	using glTexCoord2d = ::kiero::Method<::kiero::RenderType::OpenGL, 265>;
+	using glTexCoord2dv = ::kiero::Method<::kiero::RenderType::OpenGL, 266>;
+	using glTexCoord2f = ::kiero::Method<::kiero::RenderType::OpenGL, 267>;
+	using glTexCoord2fv = ::kiero::Method<::kiero::RenderType::OpenGL, 268>;
+	using glTexCoord2i = ::kiero::Method<::kiero::RenderType::OpenGL, 269>;
+	using glTexCoord2iv = ::kiero::Method<::kiero::RenderType::OpenGL, 270>;
+	using glTexCoord2s = ::kiero::Method<::kiero::RenderType::OpenGL, 271>;
+	using glTexCoord2sv = ::kiero::Method<::kiero::RenderType::OpenGL, 272>;
+	using glTexCoord3d = ::kiero::Method<::kiero::RenderType::OpenGL, 273>;
+	using glTexCoord3dv = ::kiero::Method<::kiero::RenderType::OpenGL, 274>;
+	using glTexCoord3f = ::kiero::Method<::kiero::RenderType::OpenGL, 275>;
+	using glTexCoord3fv = ::kiero::Method<::kiero::RenderType::OpenGL, 276>;
+	using glTexCoord3i = ::kiero::Method<::kiero::RenderType::OpenGL, 277>;
+	using glTexCoord3iv = ::kiero::Method<::kiero::RenderType::OpenGL, 278>;
+	using glTexCoord3s = ::kiero::Method<::kiero::RenderType::OpenGL, 279>;
+	using glTexCoord3sv = ::kiero::Method<::kiero::RenderType::OpenGL, 280>;
+	using glTexCoord4d = ::kiero::Method<::kiero::RenderType::OpenGL, 281>;
+	using glTexCoord4dv = ::kiero::Method<::kiero::RenderType::OpenGL, 282>;
+	using glTexCoord4f = ::kiero::Method<::kiero::RenderType::OpenGL, 283>;
+	using glTexCoord4fv = ::kiero::Method<::kiero::RenderType::OpenGL, 284>;
+	using glTexCoord4i = ::kiero::Method<::kiero::RenderType::OpenGL, 285>;
+	using glTexCoord4iv = ::kiero::Method<::kiero::RenderType::OpenGL, 286>;
+	using glTexCoord4s = ::kiero::Method<::kiero::RenderType::OpenGL, 287>;
+	using glTexCoord4sv = ::kiero::Method<::kiero::RenderType::OpenGL, 288>;
+	using glTexCoordPointer = ::kiero::Method<::kiero::RenderType::OpenGL, 289>;
+	using glTexEnvf = ::kiero::Method<::kiero::RenderType::OpenGL, 290>;
+	using glTexEnvfv = ::kiero::Method<::kiero::RenderType::OpenGL, 291>;
+	using glTexEnvi = ::kiero::Method<::kiero::RenderType::OpenGL, 292>;
+	using glTexEnviv = ::kiero::Method<::kiero::RenderType::OpenGL, 293>;
+	using glTexGend = ::kiero::Method<::kiero::RenderType::OpenGL, 294>;
+	using glTexGendv = ::kiero::Method<::kiero::RenderType::OpenGL, 295>;
+	using glTexGenf = ::kiero::Method<::kiero::RenderType::OpenGL, 296>;
+	using glTexGenfv = ::kiero::Method<::kiero::RenderType::OpenGL, 297>;
+	using glTexGeni = ::kiero::Method<::kiero::RenderType::OpenGL, 298>;
+	using glTexGeniv = ::kiero::Method<::kiero::RenderType::OpenGL, 299>;
+	using glTexImage1D = ::kiero::Method<::kiero::RenderType::OpenGL, 300>;
+	using glTexImage2D = ::kiero::Method<::kiero::RenderType::OpenGL, 301>;
+	using glTexParameterf = ::kiero::Method<::kiero::RenderType::OpenGL, 302>;
+	using glTexParameterfv = ::kiero::Method<::kiero::RenderType::OpenGL, 303>;
+	using glTexParameteri = ::kiero::Method<::kiero::RenderType::OpenGL, 304>;
+	using glTexParameteriv = ::kiero::Method<::kiero::RenderType::OpenGL, 305>;
+	using glTexSubImage1D = ::kiero::Method<::kiero::RenderType::OpenGL, 306>;
+	using glTexSubImage2D = ::kiero::Method<::kiero::RenderType::OpenGL, 307>;
+	using glTranslated = ::kiero::Method<::kiero::RenderType::OpenGL, 308>;
+	using glTranslatef = ::kiero::Method<::kiero::RenderType::OpenGL, 309>;
+	using glVertex2d = ::kiero::Method<::kiero::RenderType::OpenGL, 310>;
+	using glVertex2dv = ::kiero::Method<::kiero::RenderType::OpenGL, 311>;
+	using glVertex2f = ::kiero::Method<::kiero::RenderType::OpenGL, 312>;
+	using glVertex2fv = ::kiero::Method<::kiero::RenderType::OpenGL, 313>;
+	using glVertex2i = ::kiero::Method<::kiero::RenderType::OpenGL, 314>;
+	using glVertex2iv = ::kiero::Method<::kiero::RenderType::OpenGL, 315>;
+	using glVertex2s = ::kiero::Method<::kiero::RenderType::OpenGL, 316>;
+	using glVertex2sv = ::kiero::Method<::kiero::RenderType::OpenGL, 317>;
+	using glVertex3d = ::kiero::Method<::kiero::RenderType::OpenGL, 318>;
+	using glVertex3dv = ::kiero::Method<::kiero::RenderType::OpenGL, 319>;
+	using glVertex3f = ::kiero::Method<::kiero::RenderType::OpenGL, 320>;
+	using glVertex3fv = ::kiero::Method<::kiero::RenderType::OpenGL, 321>;
+	using glVertex3i = ::kiero::Method<::kiero::RenderType::OpenGL, 322>;
+	using glVertex3iv = ::kiero::Method<::kiero::RenderType::OpenGL, 323>;
+	using glVertex3s = ::kiero::Method<::kiero::RenderType::OpenGL, 324>;
+	using glVertex3sv = ::kiero::Method<::kiero::RenderType::OpenGL, 325>;
+	using glVertex4d = ::kiero::Method<::kiero::RenderType::OpenGL, 326>;
+	using glVertex4dv = ::kiero::Method<::kiero::RenderType::OpenGL, 327>;
+	using glVertex4f = ::kiero::Method<::kiero::RenderType::OpenGL, 328>;
+	using glVertex4fv = ::kiero::Method<::kiero::RenderType::OpenGL, 329>;
+	using glVertex4i = ::kiero::Method<::kiero::RenderType::OpenGL, 330>;
+	using glVertex4iv = ::kiero::Method<::kiero::RenderType::OpenGL, 331>;
+	using glVertex4s = ::kiero::Method<::kiero::RenderType::OpenGL, 332>;
+	using glVertex4sv = ::kiero::Method<::kiero::RenderType::OpenGL, 333>;
+	using glVertexPointer = ::kiero::Method<::kiero::RenderType::OpenGL, 334>;
+	using glViewport = ::kiero::Method<::kiero::RenderType::OpenGL, 335>;
+#ifdef _WIN32
+	using wglSwapBuffers = ::kiero::Method<::kiero::RenderType::OpenGL, 336>;
+#else
+	using glXSwapBuffers = ::kiero::Method<::kiero::RenderType::OpenGL, 336>;
+#endif
+	using eglSwapBuffers = ::kiero::Method<::kiero::RenderType::OpenGL, 337>;
+
+	inline constexpr const char* const Names[] = {
+		"glAccum",
+		"glAlphaFunc",
+		"glAreTexturesResident",
+		"glArrayElement",
+		"glBegin",
+		"glBindTexture",
+		"glBitmap",
+		"glBlendFunc",
+		"glCallList",
+		"glCallLists",
+		"glClear",
+		"glClearAccum",
+		"glClearColor",
+		"glClearDepth",
+		"glClearIndex",
+		"glClearStencil",
+		"glClipPlane",
+		"glColor3b",
+		"glColor3bv",
+		"glColor3d",
+		"glColor3dv",
+		"glColor3f",
+		"glColor3fv",
+		"glColor3i",
+		"glColor3iv",
+		"glColor3s",
+		"glColor3sv",
+		"glColor3ub",
+		"glColor3ubv",
+		"glColor3ui",
+		"glColor3uiv",
+		"glColor3us",
+		"glColor3usv",
+		"glColor4b",
+		"glColor4bv",
+		"glColor4d",
+		"glColor4dv",
+		"glColor4f",
+		"glColor4fv",
+		"glColor4i",
+		"glColor4iv",
+		"glColor4s",
+		"glColor4sv",
+		"glColor4ub",
+		"glColor4ubv",
+		"glColor4ui",
+		"glColor4uiv",
+		"glColor4us",
+		"glColor4usv",
+		"glColorMask",
+		"glColorMaterial",
+		"glColorPointer",
+		"glCopyPixels",
+		"glCopyTexImage1D",
+		"glCopyTexImage2D",
+		"glCopyTexSubImage1D",
+		"glCopyTexSubImage2D",
+		"glCullFace",
+		"glDeleteLists",
+		"glDeleteTextures",
+		"glDepthFunc",
+		"glDepthMask",
+		"glDepthRange",
+		"glDisable",
+		"glDisableClientState",
+		"glDrawArrays",
+		"glDrawBuffer",
+		"glDrawElements",
+		"glDrawPixels",
+		"glEdgeFlag",
+		"glEdgeFlagPointer",
+		"glEdgeFlagv",
+		"glEnable",
+		"glEnableClientState",
+		"glEnd",
+		"glEndList",
+		"glEvalCoord1d",
+		"glEvalCoord1dv",
+		"glEvalCoord1f",
+		"glEvalCoord1fv",
+		"glEvalCoord2d",
+		"glEvalCoord2dv",
+		"glEvalCoord2f",
+		"glEvalCoord2fv",
+		"glEvalMesh1",
+		"glEvalMesh2",
+		"glEvalPoint1",
+		"glEvalPoint2",
+		"glFeedbackBuffer",
+		"glFinish",
+		"glFlush",
+		"glFogf",
+		"glFogfv",
+		"glFogi",
+		"glFogiv",
+		"glFrontFace",
+		"glFrustum",
+		"glGenLists",
+		"glGenTextures",
+		"glGetBooleanv",
+		"glGetClipPlane",
+		"glGetDoublev",
+		"glGetError",
+		"glGetFloatv",
+		"glGetIntegerv",
+		"glGetLightfv",
+		"glGetLightiv",
+		"glGetMapdv",
+		"glGetMapfv",
+		"glGetMapiv",
+		"glGetMaterialfv",
+		"glGetMaterialiv",
+		"glGetPixelMapfv",
+		"glGetPixelMapuiv",
+		"glGetPixelMapusv",
+		"glGetPointerv",
+		"glGetPolygonStipple",
+		"glGetString",
+		"glGetTexEnvfv",
+		"glGetTexEnviv",
+		"glGetTexGendv",
+		"glGetTexGenfv",
+		"glGetTexGeniv",
+		"glGetTexImage",
+		"glGetTexLevelParameterfv",
+		"glGetTexLevelParameteriv",
+		"glGetTexParameterfv",
+		"glGetTexParameteriv",
+		"glHint",
+		"glIndexMask",
+		"glIndexPointer",
+		"glIndexd",
+		"glIndexdv",
+		"glIndexf",
+		"glIndexfv",
+		"glIndexi",
+		"glIndexiv",
+		"glIndexs",
+		"glIndexsv",
+		"glIndexub",
+		"glIndexubv",
+		"glInitNames",
+		"glInterleavedArrays",
+		"glIsEnabled",
+		"glIsList",
+		"glIsTexture",
+		"glLightModelf",
+		"glLightModelfv",
+		"glLightModeli",
+		"glLightModeliv",
+		"glLightf",
+		"glLightfv",
+		"glLighti",
+		"glLightiv",
+		"glLineStipple",
+		"glLineWidth",
+		"glListBase",
+		"glLoadIdentity",
+		"glLoadMatrixd",
+		"glLoadMatrixf",
+		"glLoadName",
+		"glLogicOp",
+		"glMap1d",
+		"glMap1f",
+		"glMap2d",
+		"glMap2f",
+		"glMapGrid1d",
+		"glMapGrid1f",
+		"glMapGrid2d",
+		"glMapGrid2f",
+		"glMaterialf",
+		"glMaterialfv",
+		"glMateriali",
+		"glMaterialiv",
+		"glMatrixMode",
+		"glMultMatrixd",
+		"glMultMatrixf",
+		"glNewList",
+		"glNormal3b",
+		"glNormal3bv",
+		"glNormal3d",
+		"glNormal3dv",
+		"glNormal3f",
+		"glNormal3fv",
+		"glNormal3i",
+		"glNormal3iv",
+		"glNormal3s",
+		"glNormal3sv",
+		"glNormalPointer",
+		"glOrtho",
+		"glPassThrough",
+		"glPixelMapfv",
+		"glPixelMapuiv",
+		"glPixelMapusv",
+		"glPixelStoref",
+		"glPixelStorei",
+		"glPixelTransferf",
+		"glPixelTransferi",
+		"glPixelZoom",
+		"glPointSize",
+		"glPolygonMode",
+		"glPolygonOffset",
+		"glPolygonStipple",
+		"glPopAttrib",
+		"glPopClientAttrib",
+		"glPopMatrix",
+		"glPopName",
+		"glPrioritizeTextures",
+		"glPushAttrib",
+		"glPushClientAttrib",
+		"glPushMatrix",
+		"glPushName",
+		"glRasterPos2d",
+		"glRasterPos2dv",
+		"glRasterPos2f",
+		"glRasterPos2fv",
+		"glRasterPos2i",
+		"glRasterPos2iv",
+		"glRasterPos2s",
+		"glRasterPos2sv",
+		"glRasterPos3d",
+		"glRasterPos3dv",
+		"glRasterPos3f",
+		"glRasterPos3fv",
+		"glRasterPos3i",
+		"glRasterPos3iv",
+		"glRasterPos3s",
+		"glRasterPos3sv",
+		"glRasterPos4d",
+		"glRasterPos4dv",
+		"glRasterPos4f",
+		"glRasterPos4fv",
+		"glRasterPos4i",
+		"glRasterPos4iv",
+		"glRasterPos4s",
+		"glRasterPos4sv",
+		"glReadBuffer",
+		"glReadPixels",
+		"glRectd",
+		"glRectdv",
+		"glRectf",
+		"glRectfv",
+		"glRecti",
+		"glRectiv",
+		"glRects",
+		"glRectsv",
+		"glRenderMode",
+		"glRotated",
+		"glRotatef",
+		"glScaled",
+		"glScalef",
+		"glScissor",
+		"glSelectBuffer",
+		"glShadeModel",
+		"glStencilFunc",
+		"glStencilMask",
+		"glStencilOp",
+		"glTexCoord1d",
+		"glTexCoord1dv",
+		"glTexCoord1f",
+		"glTexCoord1fv",
+		"glTexCoord1i",
+		"glTexCoord1iv",
+		"glTexCoord1s",
+		"glTexCoord1sv",
+		"glTexCoord2d",
+		"glTexCoord2dv",
+		"glTexCoord2f",
+		"glTexCoord2fv",
+		"glTexCoord2i",
+		"glTexCoord2iv",
+		"glTexCoord2s",
+		"glTexCoord2sv",
+		"glTexCoord3d",
+		"glTexCoord3dv",
+		"glTexCoord3f",
+		"glTexCoord3fv",
+		"glTexCoord3i",
+		"glTexCoord3iv",
+		"glTexCoord3s",
+		"glTexCoord3sv",
+		"glTexCoord4d",
+		"glTexCoord4dv",
+		"glTexCoord4f",
+		"glTexCoord4fv",
+		"glTexCoord4i",
+		"glTexCoord4iv",
+		"glTexCoord4s",
+		"glTexCoord4sv",
+		"glTexCoordPointer",
+		"glTexEnvf",
+		"glTexEnvfv",
+		"glTexEnvi",
+		"glTexEnviv",
+		"glTexGend",
+		"glTexGendv",
+		"glTexGenf",
+		"glTexGenfv",
+		"glTexGeni",
+		"glTexGeniv",
+		"glTexImage1D",
+		"glTexImage2D",
+		"glTexParameterf",
+		"glTexParameterfv",
+		"glTexParameteri",
+		"glTexParameteriv",
+		"glTexSubImage1D",
+		"glTexSubImage2D",
+		"glTranslated",
+		"glTranslatef",
+		"glVertex2d",
+		"glVertex2dv",
+		"glVertex2f",
+		"glVertex2fv",
+		"glVertex2i",
+		"glVertex2iv",
+		"glVertex2s",
+		"glVertex2sv",
+		"glVertex3d",
+		"glVertex3dv",
+		"glVertex3f",
+		"glVertex3fv",
+		"glVertex3i",
+		"glVertex3iv",
+		"glVertex3s",
+		"glVertex3sv",
+		"glVertex4d",
+		"glVertex4dv",
+		"glVertex4f",
+		"glVertex4fv",
+		"glVertex4i",
+		"glVertex4iv",
+		"glVertex4s",
+		"glVertex4sv",
+		"glVertexPointer",
+		"glViewport",
+#ifdef _WIN32
+		"wglSwapBuffers",
+#else
+		"glXSwapBuffers",
+#endif
+		"eglSwapBuffers",
+	};
+}
+
+namespace kiero::vulkan
+{
+	inline constexpr ::std::uint16_t MethodsCount = 137;
+
+	namespace Core
+	{
+		inline constexpr ::std::uint16_t Offset = 0;
+		inline constexpr ::std::uint16_t Count = 136;
+	}
+
+	namespace Present
+	{
+		inline constexpr ::std::uint16_t Offset = 136;
+		inline constexpr ::std::uint16_t Count = 1;
+	}
+
+	using vkCreateInstance = ::kiero::Method<::kiero::RenderType::Vulkan, 0>;
+	using vkDestroyInstance = ::kiero::Method<::kiero::RenderType::Vulkan, 1>;
+	using vkEnumeratePhysicalDevices = ::kiero::Method<::kiero::RenderType::Vulkan, 2>;
+	using vkGetPhysicalDeviceFeatures = ::kiero::Method<::kiero::RenderType::Vulkan, 3>;
+	using vkGetPhysicalDeviceFormatProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 4>;
+	using vkGetPhysicalDeviceImageFormatProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 5>;
+	using vkGetPhysicalDeviceProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 6>;
+	using vkGetPhysicalDeviceQueueFamilyProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 7>;
+	using vkGetPhysicalDeviceMemoryProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 8>;
+	using vkGetInstanceProcAddr = ::kiero::Method<::kiero::RenderType::Vulkan, 9>;
+	using vkGetDeviceProcAddr = ::kiero::Method<::kiero::RenderType::Vulkan, 10>;
+	using vkCreateDevice = ::kiero::Method<::kiero::RenderType::Vulkan, 11>;
+	using vkDestroyDevice = ::kiero::Method<::kiero::RenderType::Vulkan, 12>;
+	using vkEnumerateInstanceExtensionProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 13>;
+	using vkEnumerateDeviceExtensionProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 14>;
+	using vkEnumerateDeviceLayerProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 15>;
+	using vkGetDeviceQueue = ::kiero::Method<::kiero::RenderType::Vulkan, 16>;
+	using vkQueueSubmit = ::kiero::Method<::kiero::RenderType::Vulkan, 17>;
+	using vkQueueWaitIdle = ::kiero::Method<::kiero::RenderType::Vulkan, 18>;
+	using vkDeviceWaitIdle = ::kiero::Method<::kiero::RenderType::Vulkan, 19>;
+	using vkAllocateMemory = ::kiero::Method<::kiero::RenderType::Vulkan, 20>;
+	using vkFreeMemory = ::kiero::Method<::kiero::RenderType::Vulkan, 21>;
+	using vkMapMemory = ::kiero::Method<::kiero::RenderType::Vulkan, 22>;
+	using vkUnmapMemory = ::kiero::Method<::kiero::RenderType::Vulkan, 23>;
+	using vkFlushMappedMemoryRanges = ::kiero::Method<::kiero::RenderType::Vulkan, 24>;
+	using vkInvalidateMappedMemoryRanges = ::kiero::Method<::kiero::RenderType::Vulkan, 25>;
+	using vkGetDeviceMemoryCommitment = ::kiero::Method<::kiero::RenderType::Vulkan, 26>;
+	using vkBindBufferMemory = ::kiero::Method<::kiero::RenderType::Vulkan, 27>;
+	using vkBindImageMemory = ::kiero::Method<::kiero::RenderType::Vulkan, 28>;
+	using vkGetBufferMemoryRequirements = ::kiero::Method<::kiero::RenderType::Vulkan, 29>;
+	using vkGetImageMemoryRequirements = ::kiero::Method<::kiero::RenderType::Vulkan, 30>;
+	using vkGetImageSparseMemoryRequirements = ::kiero::Method<::kiero::RenderType::Vulkan, 31>;
+	using vkGetPhysicalDeviceSparseImageFormatProperties = ::kiero::Method<::kiero::RenderType::Vulkan, 32>;
+	using vkQueueBindSparse = ::kiero::Method<::kiero::RenderType::Vulkan, 33>;
+	using vkCreateFence = ::kiero::Method<::kiero::RenderType::Vulkan, 34>;
+	using vkDestroyFence = ::kiero::Method<::kiero::RenderType::Vulkan, 35>;
+	using vkResetFences = ::kiero::Method<::kiero::RenderType::Vulkan, 36>;
+	using vkGetFenceStatus = ::kiero::Method<::kiero::RenderType::Vulkan, 37>;
+	using vkWaitForFences = ::kiero::Method<::kiero::RenderType::Vulkan, 38>;
+	using vkCreateSemaphore = ::kiero::Method<::kiero::RenderType::Vulkan, 39>;
+	using vkDestroySemaphore = ::kiero::Method<::kiero::RenderType::Vulkan, 40>;
+	using vkCreateEvent = ::kiero::Method<::kiero::RenderType::Vulkan, 41>;
+	using vkDestroyEvent = ::kiero::Method<::kiero::RenderType::Vulkan, 42>;
+	using vkGetEventStatus = ::kiero::Method<::kiero::RenderType::Vulkan, 43>;
+	using vkSetEvent = ::kiero::Method<::kiero::RenderType::Vulkan, 44>;
+	using vkResetEvent = ::kiero::Method<::kiero::RenderType::Vulkan, 45>;
+	using vkCreateQueryPool = ::kiero::Method<::kiero::RenderType::Vulkan, 46>;
+	using vkDestroyQueryPool = ::kiero::Method<::kiero::RenderType::Vulkan, 47>;
+	using vkGetQueryPoolResults = ::kiero::Method<::kiero::RenderType::Vulkan, 48>;
+	using vkCreateBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 49>;
+	using vkDestroyBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 50>;
+	using vkCreateBufferView = ::kiero::Method<::kiero::RenderType::Vulkan, 51>;
+	using vkDestroyBufferView = ::kiero::Method<::kiero::RenderType::Vulkan, 52>;
+	using vkCreateImage = ::kiero::Method<::kiero::RenderType::Vulkan, 53>;
+	using vkDestroyImage = ::kiero::Method<::kiero::RenderType::Vulkan, 54>;
+	using vkGetImageSubresourceLayout = ::kiero::Method<::kiero::RenderType::Vulkan, 55>;
+	using vkCreateImageView = ::kiero::Method<::kiero::RenderType::Vulkan, 56>;
+	using vkDestroyImageView = ::kiero::Method<::kiero::RenderType::Vulkan, 57>;
+	using vkCreateShaderModule = ::kiero::Method<::kiero::RenderType::Vulkan, 58>;
+	using vkDestroyShaderModule = ::kiero::Method<::kiero::RenderType::Vulkan, 59>;
+	using vkCreatePipelineCache = ::kiero::Method<::kiero::RenderType::Vulkan, 60>;
+	using vkDestroyPipelineCache = ::kiero::Method<::kiero::RenderType::Vulkan, 61>;
+	using vkGetPipelineCacheData = ::kiero::Method<::kiero::RenderType::Vulkan, 62>;
+	using vkMergePipelineCaches = ::kiero::Method<::kiero::RenderType::Vulkan, 63>;
+	using vkCreateGraphicsPipelines = ::kiero::Method<::kiero::RenderType::Vulkan, 64>;
+	using vkCreateComputePipelines = ::kiero::Method<::kiero::RenderType::Vulkan, 65>;
+	using vkDestroyPipeline = ::kiero::Method<::kiero::RenderType::Vulkan, 66>;
+	using vkCreatePipelineLayout = ::kiero::Method<::kiero::RenderType::Vulkan, 67>;
+	using vkDestroyPipelineLayout = ::kiero::Method<::kiero::RenderType::Vulkan, 68>;
+	using vkCreateSampler = ::kiero::Method<::kiero::RenderType::Vulkan, 69>;
+	using vkDestroySampler = ::kiero::Method<::kiero::RenderType::Vulkan, 70>;
+	using vkCreateDescriptorSetLayout = ::kiero::Method<::kiero::RenderType::Vulkan, 71>;
+	using vkDestroyDescriptorSetLayout = ::kiero::Method<::kiero::RenderType::Vulkan, 72>;
+	using vkCreateDescriptorPool = ::kiero::Method<::kiero::RenderType::Vulkan, 73>;
+	using vkDestroyDescriptorPool = ::kiero::Method<::kiero::RenderType::Vulkan, 74>;
+	using vkResetDescriptorPool = ::kiero::Method<::kiero::RenderType::Vulkan, 75>;
+	using vkAllocateDescriptorSets = ::kiero::Method<::kiero::RenderType::Vulkan, 76>;
+	using vkFreeDescriptorSets = ::kiero::Method<::kiero::RenderType::Vulkan, 77>;
+	using vkUpdateDescriptorSets = ::kiero::Method<::kiero::RenderType::Vulkan, 78>;
+	using vkCreateFramebuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 79>;
+	using vkDestroyFramebuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 80>;
+	using vkCreateRenderPass = ::kiero::Method<::kiero::RenderType::Vulkan, 81>;
+	using vkDestroyRenderPass = ::kiero::Method<::kiero::RenderType::Vulkan, 82>;
+	using vkGetRenderAreaGranularity = ::kiero::Method<::kiero::RenderType::Vulkan, 83>;
+	using vkCreateCommandPool = ::kiero::Method<::kiero::RenderType::Vulkan, 84>;
+	using vkDestroyCommandPool = ::kiero::Method<::kiero::RenderType::Vulkan, 85>;
+	using vkResetCommandPool = ::kiero::Method<::kiero::RenderType::Vulkan, 86>;
+	using vkAllocateCommandBuffers = ::kiero::Method<::kiero::RenderType::Vulkan, 87>;
+	using vkFreeCommandBuffers = ::kiero::Method<::kiero::RenderType::Vulkan, 88>;
+	using vkBeginCommandBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 89>;
+	using vkEndCommandBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 90>;
+	using vkResetCommandBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 91>;
+	using vkCmdBindPipeline = ::kiero::Method<::kiero::RenderType::Vulkan, 92>;
+	using vkCmdSetViewport = ::kiero::Method<::kiero::RenderType::Vulkan, 93>;
+	using vkCmdSetScissor = ::kiero::Method<::kiero::RenderType::Vulkan, 94>;
+	using vkCmdSetLineWidth = ::kiero::Method<::kiero::RenderType::Vulkan, 95>;
+	using vkCmdSetDepthBias = ::kiero::Method<::kiero::RenderType::Vulkan, 96>;
+	using vkCmdSetBlendConstants = ::kiero::Method<::kiero::RenderType::Vulkan, 97>;
+	using vkCmdSetDepthBounds = ::kiero::Method<::kiero::RenderType::Vulkan, 98>;
+	using vkCmdSetStencilCompareMask = ::kiero::Method<::kiero::RenderType::Vulkan, 99>;
+	using vkCmdSetStencilWriteMask = ::kiero::Method<::kiero::RenderType::Vulkan, 100>;
+	using vkCmdSetStencilReference = ::kiero::Method<::kiero::RenderType::Vulkan, 101>;
+	using vkCmdBindDescriptorSets = ::kiero::Method<::kiero::RenderType::Vulkan, 102>;
+	using vkCmdBindIndexBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 103>;
+	using vkCmdBindVertexBuffers = ::kiero::Method<::kiero::RenderType::Vulkan, 104>;
+	using vkCmdDraw = ::kiero::Method<::kiero::RenderType::Vulkan, 105>;
+	using vkCmdDrawIndexed = ::kiero::Method<::kiero::RenderType::Vulkan, 106>;
+	using vkCmdDrawIndirect = ::kiero::Method<::kiero::RenderType::Vulkan, 107>;
+	using vkCmdDrawIndexedIndirect = ::kiero::Method<::kiero::RenderType::Vulkan, 108>;
+	using vkCmdDispatch = ::kiero::Method<::kiero::RenderType::Vulkan, 109>;
+	using vkCmdDispatchIndirect = ::kiero::Method<::kiero::RenderType::Vulkan, 110>;
+	using vkCmdCopyBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 111>;
+	using vkCmdCopyImage = ::kiero::Method<::kiero::RenderType::Vulkan, 112>;
+	using vkCmdBlitImage = ::kiero::Method<::kiero::RenderType::Vulkan, 113>;
+	using vkCmdCopyBufferToImage = ::kiero::Method<::kiero::RenderType::Vulkan, 114>;
+	using vkCmdCopyImageToBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 115>;
+	using vkCmdUpdateBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 116>;
+	using vkCmdFillBuffer = ::kiero::Method<::kiero::RenderType::Vulkan, 117>;
+	using vkCmdClearColorImage = ::kiero::Method<::kiero::RenderType::Vulkan, 118>;
+	using vkCmdClearDepthStencilImage = ::kiero::Method<::kiero::RenderType::Vulkan, 119>;
+	using vkCmdClearAttachments = ::kiero::Method<::kiero::RenderType::Vulkan, 120>;
+	using vkCmdResolveImage = ::kiero::Method<::kiero::RenderType::Vulkan, 121>;
+	using vkCmdSetEvent = ::kiero::Method<::kiero::RenderType::Vulkan, 122>;
+	using vkCmdResetEvent = ::kiero::Method<::kiero::RenderType::Vulkan, 123>;
+	using vkCmdWaitEvents = ::kiero::Method<::kiero::RenderType::Vulkan, 124>;
+	using vkCmdPipelineBarrier = ::kiero::Method<::kiero::RenderType::Vulkan, 125>;
+	using vkCmdBeginQuery = ::kiero::Method<::kiero::RenderType::Vulkan, 126>;
+	using vkCmdEndQuery = ::kiero::Method<::kiero::RenderType::Vulkan, 127>;
+	using vkCmdResetQueryPool = ::kiero::Method<::kiero::RenderType::Vulkan, 128>;
+	using vkCmdWriteTimestamp = ::kiero::Method<::kiero::RenderType::Vulkan, 129>;
+	using vkCmdCopyQueryPoolResults = ::kiero::Method<::kiero::RenderType::Vulkan, 130>;
+	using vkCmdPushConstants = ::kiero::Method<::kiero::RenderType::Vulkan, 131>;
+	using vkCmdBeginRenderPass = ::kiero::Method<::kiero::RenderType::Vulkan, 132>;
+	using vkCmdNextSubpass = ::kiero::Method<::kiero::RenderType::Vulkan, 133>;
+	using vkCmdEndRenderPass = ::kiero::Method<::kiero::RenderType::Vulkan, 134>;
+	using vkCmdExecuteCommands = ::kiero::Method<::kiero::RenderType::Vulkan, 135>;
+	using vkQueuePresentKHR = ::kiero::Method<::kiero::RenderType::Vulkan, 136>;
+
+	inline constexpr const char* const Names[] = {
+		"vkCreateInstance",
+		"vkDestroyInstance",
+		"vkEnumeratePhysicalDevices",
+		"vkGetPhysicalDeviceFeatures",
+		"vkGetPhysicalDeviceFormatProperties",
+		"vkGetPhysicalDeviceImageFormatProperties",
+		"vkGetPhysicalDeviceProperties",
+		"vkGetPhysicalDeviceQueueFamilyProperties",
+		"vkGetPhysicalDeviceMemoryProperties",
+		"vkGetInstanceProcAddr",
+		"vkGetDeviceProcAddr",
+		"vkCreateDevice",
+		"vkDestroyDevice",
+		"vkEnumerateInstanceExtensionProperties",
+		"vkEnumerateDeviceExtensionProperties",
+		"vkEnumerateDeviceLayerProperties",
+		"vkGetDeviceQueue",
+		"vkQueueSubmit",
+		"vkQueueWaitIdle",
+		"vkDeviceWaitIdle",
+		"vkAllocateMemory",
+		"vkFreeMemory",
+		"vkMapMemory",
+		"vkUnmapMemory",
+		"vkFlushMappedMemoryRanges",
+		"vkInvalidateMappedMemoryRanges",
+		"vkGetDeviceMemoryCommitment",
+		"vkBindBufferMemory",
+		"vkBindImageMemory",
+		"vkGetBufferMemoryRequirements",
+		"vkGetImageMemoryRequirements",
+		"vkGetImageSparseMemoryRequirements",
+		"vkGetPhysicalDeviceSparseImageFormatProperties",
+		"vkQueueBindSparse",
+		"vkCreateFence",
+		"vkDestroyFence",
+		"vkResetFences",
+		"vkGetFenceStatus",
+		"vkWaitForFences",
+		"vkCreateSemaphore",
+		"vkDestroySemaphore",
+		"vkCreateEvent",
+		"vkDestroyEvent",
+		"vkGetEventStatus",
+		"vkSetEvent",
+		"vkResetEvent",
+		"vkCreateQueryPool",
+		"vkDestroyQueryPool",
+		"vkGetQueryPoolResults",
+		"vkCreateBuffer",
+		"vkDestroyBuffer",
+		"vkCreateBufferView",
+		"vkDestroyBufferView",
+		"vkCreateImage",
+		"vkDestroyImage",
+		"vkGetImageSubresourceLayout",
+		"vkCreateImageView",
+		"vkDestroyImageView",
+		"vkCreateShaderModule",
+		"vkDestroyShaderModule",
+		"vkCreatePipelineCache",
+		"vkDestroyPipelineCache",
+		"vkGetPipelineCacheData",
+		"vkMergePipelineCaches",
+		"vkCreateGraphicsPipelines",
+		"vkCreateComputePipelines",
+		"vkDestroyPipeline",
+		"vkCreatePipelineLayout",
+		"vkDestroyPipelineLayout",
+		"vkCreateSampler",
+		"vkDestroySampler",
+		"vkCreateDescriptorSetLayout",
+		"vkDestroyDescriptorSetLayout",
+		"vkCreateDescriptorPool",
+		"vkDestroyDescriptorPool",
+		"vkResetDescriptorPool",
+		"vkAllocateDescriptorSets",
+		"vkFreeDescriptorSets",
+		"vkUpdateDescriptorSets",
+		"vkCreateFramebuffer",
+		"vkDestroyFramebuffer",
+		"vkCreateRenderPass",
+		"vkDestroyRenderPass",
+		"vkGetRenderAreaGranularity",
+		"vkCreateCommandPool",
+		"vkDestroyCommandPool",
+		"vkResetCommandPool",
+		"vkAllocateCommandBuffers",
+		"vkFreeCommandBuffers",
+		"vkBeginCommandBuffer",
+		"vkEndCommandBuffer",
+		"vkResetCommandBuffer",
+		"vkCmdBindPipeline",
+		"vkCmdSetViewport",
+		"vkCmdSetScissor",
+		"vkCmdSetLineWidth",
+		"vkCmdSetDepthBias",
+		"vkCmdSetBlendConstants",
+		"vkCmdSetDepthBounds",
+		"vkCmdSetStencilCompareMask",
+		"vkCmdSetStencilWriteMask",
+		"vkCmdSetStencilReference",
+		"vkCmdBindDescriptorSets",
+		"vkCmdBindIndexBuffer",
+		"vkCmdBindVertexBuffers",
+		"vkCmdDraw",
+		"vkCmdDrawIndexed",
+		"vkCmdDrawIndirect",
+		"vkCmdDrawIndexedIndirect",
+		"vkCmdDispatch",
+		"vkCmdDispatchIndirect",
+		"vkCmdCopyBuffer",
+		"vkCmdCopyImage",
+		"vkCmdBlitImage",
+		"vkCmdCopyBufferToImage",
+		"vkCmdCopyImageToBuffer",
+		"vkCmdUpdateBuffer",
+		"vkCmdFillBuffer",
+		"vkCmdClearColorImage",
+		"vkCmdClearDepthStencilImage",
+		"vkCmdClearAttachments",
+		"vkCmdResolveImage",
+		"vkCmdSetEvent",
+		"vkCmdResetEvent",
+		"vkCmdWaitEvents",
+		"vkCmdPipelineBarrier",
+		"vkCmdBeginQuery",
+		"vkCmdEndQuery",
+		"vkCmdResetQueryPool",
+		"vkCmdWriteTimestamp",
+		"vkCmdCopyQueryPoolResults",
+		"vkCmdPushConstants",
+		"vkCmdBeginRenderPass",
+		"vkCmdNextSubpass",
+		"vkCmdEndRenderPass",
+		"vkCmdExecuteCommands",
+		"vkQueuePresentKHR",
+	};
+}
@@ -0,0 +1,1165 @@
+// Generated from METHODSTABLE.txt by cmake/KieroMethodsTable.cmake, do not edit
+#pragma once
+
+#include "kiero_methods.h"
+
+// Included by the code using kiero::bind<Method>, not by kiero itself, so the graphics headers are
+// only needed there
+#if (KIERO_INCLUDE_D3D9 || KIERO_INCLUDE_D3D10 || KIERO_INCLUDE_D3D11 || KIERO_INCLUDE_D3D12) && defined(_WIN32)
+# include <Windows.h>
+# include <type_traits>
+
+namespace kiero::detail
+{
+	// A COM method as the free function its vtable slot points to, This first. A method returning
+	// a struct (GetDesc, GetAdapterLuid...) takes the caller's buffer after This and returns it, the
+	// MSVC ABI of a member function returning by value whatever the struct's size
+	template<typename Interface, typename Member>
+	struct ComMethod;
+
+	template<typename Interface, typename Return, typename Class, typename... Args>
+	struct ComMethod<Interface, Return (STDMETHODCALLTYPE Class::*)(Args...)>
+	{
+		using Type = Return (STDMETHODCALLTYPE*)(Interface*, Args...);
+	};
+
+	template<typename Interface, typename Return, typename Class, typename... Args>
+		requires ::std::is_class_v<Return>
+	struct ComMethod<Interface, Return (STDMETHODCALLTYPE Class::*)(Args...)>
+	{
+		using Type = Return* (STDMETHODCALLTYPE*)(Interface*, Return*, Args...);
+	};
+}
+#endif
+
+#if KIERO_INCLUDE_D3D9 && defined(_WIN32)
+# include <d3d9.h>
+
+namespace kiero
+{
+	template<> struct MethodSignature<RenderType::D3D9, 0> { using Type = HRESULT (STDMETHODCALLTYPE*)(::IDirect3DDevice9*, REFIID, void**); }; // IDirect3DDevice9::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D9, 1> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::AddRef)>::Type; }; // IDirect3DDevice9::AddRef
+	template<> struct MethodSignature<RenderType::D3D9, 2> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::Release)>::Type; }; // IDirect3DDevice9::Release
+	template<> struct MethodSignature<RenderType::D3D9, 3> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::TestCooperativeLevel)>::Type; }; // IDirect3DDevice9::TestCooperativeLevel
+	template<> struct MethodSignature<RenderType::D3D9, 4> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetAvailableTextureMem)>::Type; }; // IDirect3DDevice9::GetAvailableTextureMem
+	template<> struct MethodSignature<RenderType::D3D9, 5> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::EvictManagedResources)>::Type; }; // IDirect3DDevice9::EvictManagedResources
+	template<> struct MethodSignature<RenderType::D3D9, 6> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetDirect3D)>::Type; }; // IDirect3DDevice9::GetDirect3D
+	template<> struct MethodSignature<RenderType::D3D9, 7> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetDeviceCaps)>::Type; }; // IDirect3DDevice9::GetDeviceCaps
+	template<> struct MethodSignature<RenderType::D3D9, 8> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetDisplayMode)>::Type; }; // IDirect3DDevice9::GetDisplayMode
+	template<> struct MethodSignature<RenderType::D3D9, 9> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetCreationParameters)>::Type; }; // IDirect3DDevice9::GetCreationParameters
+	template<> struct MethodSignature<RenderType::D3D9, 10> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetCursorProperties)>::Type; }; // IDirect3DDevice9::SetCursorProperties
+	template<> struct MethodSignature<RenderType::D3D9, 11> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetCursorPosition)>::Type; }; // IDirect3DDevice9::SetCursorPosition
+	template<> struct MethodSignature<RenderType::D3D9, 12> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::ShowCursor)>::Type; }; // IDirect3DDevice9::ShowCursor
+	template<> struct MethodSignature<RenderType::D3D9, 13> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateAdditionalSwapChain)>::Type; }; // IDirect3DDevice9::CreateAdditionalSwapChain
+	template<> struct MethodSignature<RenderType::D3D9, 14> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetSwapChain)>::Type; }; // IDirect3DDevice9::GetSwapChain
+	template<> struct MethodSignature<RenderType::D3D9, 15> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetNumberOfSwapChains)>::Type; }; // IDirect3DDevice9::GetNumberOfSwapChains
+	template<> struct MethodSignature<RenderType::D3D9, 16> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::Reset)>::Type; }; // IDirect3DDevice9::Reset
+	template<> struct MethodSignature<RenderType::D3D9, 17> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::Present)>::Type; }; // IDirect3DDevice9::Present
+	template<> struct MethodSignature<RenderType::D3D9, 18> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetBackBuffer)>::Type; }; // IDirect3DDevice9::GetBackBuffer
+	template<> struct MethodSignature<RenderType::D3D9, 19> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetRasterStatus)>::Type; }; // IDirect3DDevice9::GetRasterStatus
+	template<> struct MethodSignature<RenderType::D3D9, 20> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetDialogBoxMode)>::Type; }; // IDirect3DDevice9::SetDialogBoxMode
+	template<> struct MethodSignature<RenderType::D3D9, 21> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetGammaRamp)>::Type; }; // IDirect3DDevice9::SetGammaRamp
+	template<> struct MethodSignature<RenderType::D3D9, 22> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetGammaRamp)>::Type; }; // IDirect3DDevice9::GetGammaRamp
+	template<> struct MethodSignature<RenderType::D3D9, 23> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateTexture)>::Type; }; // IDirect3DDevice9::CreateTexture
+	template<> struct MethodSignature<RenderType::D3D9, 24> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateVolumeTexture)>::Type; }; // IDirect3DDevice9::CreateVolumeTexture
+	template<> struct MethodSignature<RenderType::D3D9, 25> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateCubeTexture)>::Type; }; // IDirect3DDevice9::CreateCubeTexture
+	template<> struct MethodSignature<RenderType::D3D9, 26> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateVertexBuffer)>::Type; }; // IDirect3DDevice9::CreateVertexBuffer
+	template<> struct MethodSignature<RenderType::D3D9, 27> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateIndexBuffer)>::Type; }; // IDirect3DDevice9::CreateIndexBuffer
+	template<> struct MethodSignature<RenderType::D3D9, 28> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateRenderTarget)>::Type; }; // IDirect3DDevice9::CreateRenderTarget
+	template<> struct MethodSignature<RenderType::D3D9, 29> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateDepthStencilSurface)>::Type; }; // IDirect3DDevice9::CreateDepthStencilSurface
+	template<> struct MethodSignature<RenderType::D3D9, 30> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::UpdateSurface)>::Type; }; // IDirect3DDevice9::UpdateSurface
+	template<> struct MethodSignature<RenderType::D3D9, 31> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::UpdateTexture)>::Type; }; // IDirect3DDevice9::UpdateTexture
+	template<> struct MethodSignature<RenderType::D3D9, 32> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetRenderTargetData)>::Type; }; // IDirect3DDevice9::GetRenderTargetData
+	template<> struct MethodSignature<RenderType::D3D9, 33> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetFrontBufferData)>::Type; }; // IDirect3DDevice9::GetFrontBufferData
+	template<> struct MethodSignature<RenderType::D3D9, 34> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::StretchRect)>::Type; }; // IDirect3DDevice9::StretchRect
+	template<> struct MethodSignature<RenderType::D3D9, 35> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::ColorFill)>::Type; }; // IDirect3DDevice9::ColorFill
+	template<> struct MethodSignature<RenderType::D3D9, 36> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateOffscreenPlainSurface)>::Type; }; // IDirect3DDevice9::CreateOffscreenPlainSurface
+	template<> struct MethodSignature<RenderType::D3D9, 37> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetRenderTarget)>::Type; }; // IDirect3DDevice9::SetRenderTarget
+	template<> struct MethodSignature<RenderType::D3D9, 38> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetRenderTarget)>::Type; }; // IDirect3DDevice9::GetRenderTarget
+	template<> struct MethodSignature<RenderType::D3D9, 39> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetDepthStencilSurface)>::Type; }; // IDirect3DDevice9::SetDepthStencilSurface
+	template<> struct MethodSignature<RenderType::D3D9, 40> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetDepthStencilSurface)>::Type; }; // IDirect3DDevice9::GetDepthStencilSurface
+	template<> struct MethodSignature<RenderType::D3D9, 41> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::BeginScene)>::Type; }; // IDirect3DDevice9::BeginScene
+	template<> struct MethodSignature<RenderType::D3D9, 42> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::EndScene)>::Type; }; // IDirect3DDevice9::EndScene
+	template<> struct MethodSignature<RenderType::D3D9, 43> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::Clear)>::Type; }; // IDirect3DDevice9::Clear
+	template<> struct MethodSignature<RenderType::D3D9, 44> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetTransform)>::Type; }; // IDirect3DDevice9::SetTransform
+	template<> struct MethodSignature<RenderType::D3D9, 45> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetTransform)>::Type; }; // IDirect3DDevice9::GetTransform
+	template<> struct MethodSignature<RenderType::D3D9, 46> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::MultiplyTransform)>::Type; }; // IDirect3DDevice9::MultiplyTransform
+	template<> struct MethodSignature<RenderType::D3D9, 47> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetViewport)>::Type; }; // IDirect3DDevice9::SetViewport
+	template<> struct MethodSignature<RenderType::D3D9, 48> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetViewport)>::Type; }; // IDirect3DDevice9::GetViewport
+	template<> struct MethodSignature<RenderType::D3D9, 49> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetMaterial)>::Type; }; // IDirect3DDevice9::SetMaterial
+	template<> struct MethodSignature<RenderType::D3D9, 50> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetMaterial)>::Type; }; // IDirect3DDevice9::GetMaterial
+	template<> struct MethodSignature<RenderType::D3D9, 51> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetLight)>::Type; }; // IDirect3DDevice9::SetLight
+	template<> struct MethodSignature<RenderType::D3D9, 52> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetLight)>::Type; }; // IDirect3DDevice9::GetLight
+	template<> struct MethodSignature<RenderType::D3D9, 53> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::LightEnable)>::Type; }; // IDirect3DDevice9::LightEnable
+	template<> struct MethodSignature<RenderType::D3D9, 54> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetLightEnable)>::Type; }; // IDirect3DDevice9::GetLightEnable
+	template<> struct MethodSignature<RenderType::D3D9, 55> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetClipPlane)>::Type; }; // IDirect3DDevice9::SetClipPlane
+	template<> struct MethodSignature<RenderType::D3D9, 56> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetClipPlane)>::Type; }; // IDirect3DDevice9::GetClipPlane
+	template<> struct MethodSignature<RenderType::D3D9, 57> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetRenderState)>::Type; }; // IDirect3DDevice9::SetRenderState
+	template<> struct MethodSignature<RenderType::D3D9, 58> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetRenderState)>::Type; }; // IDirect3DDevice9::GetRenderState
+	template<> struct MethodSignature<RenderType::D3D9, 59> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateStateBlock)>::Type; }; // IDirect3DDevice9::CreateStateBlock
+	template<> struct MethodSignature<RenderType::D3D9, 60> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::BeginStateBlock)>::Type; }; // IDirect3DDevice9::BeginStateBlock
+	template<> struct MethodSignature<RenderType::D3D9, 61> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::EndStateBlock)>::Type; }; // IDirect3DDevice9::EndStateBlock
+	template<> struct MethodSignature<RenderType::D3D9, 62> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetClipStatus)>::Type; }; // IDirect3DDevice9::SetClipStatus
+	template<> struct MethodSignature<RenderType::D3D9, 63> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetClipStatus)>::Type; }; // IDirect3DDevice9::GetClipStatus
+	template<> struct MethodSignature<RenderType::D3D9, 64> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetTexture)>::Type; }; // IDirect3DDevice9::GetTexture
+	template<> struct MethodSignature<RenderType::D3D9, 65> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetTexture)>::Type; }; // IDirect3DDevice9::SetTexture
+	template<> struct MethodSignature<RenderType::D3D9, 66> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetTextureStageState)>::Type; }; // IDirect3DDevice9::GetTextureStageState
+	template<> struct MethodSignature<RenderType::D3D9, 67> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetTextureStageState)>::Type; }; // IDirect3DDevice9::SetTextureStageState
+	template<> struct MethodSignature<RenderType::D3D9, 68> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetSamplerState)>::Type; }; // IDirect3DDevice9::GetSamplerState
+	template<> struct MethodSignature<RenderType::D3D9, 69> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetSamplerState)>::Type; }; // IDirect3DDevice9::SetSamplerState
+	template<> struct MethodSignature<RenderType::D3D9, 70> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::ValidateDevice)>::Type; }; // IDirect3DDevice9::ValidateDevice
+	template<> struct MethodSignature<RenderType::D3D9, 71> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetPaletteEntries)>::Type; }; // IDirect3DDevice9::SetPaletteEntries
+	template<> struct MethodSignature<RenderType::D3D9, 72> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetPaletteEntries)>::Type; }; // IDirect3DDevice9::GetPaletteEntries
+	template<> struct MethodSignature<RenderType::D3D9, 73> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetCurrentTexturePalette)>::Type; }; // IDirect3DDevice9::SetCurrentTexturePalette
+	template<> struct MethodSignature<RenderType::D3D9, 74> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetCurrentTexturePalette)>::Type; }; // IDirect3DDevice9::GetCurrentTexturePalette
+	template<> struct MethodSignature<RenderType::D3D9, 75> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetScissorRect)>::Type; }; // IDirect3DDevice9::SetScissorRect
+	template<> struct MethodSignature<RenderType::D3D9, 76> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetScissorRect)>::Type; }; // IDirect3DDevice9::GetScissorRect
+	template<> struct MethodSignature<RenderType::D3D9, 77> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetSoftwareVertexProcessing)>::Type; }; // IDirect3DDevice9::SetSoftwareVertexProcessing
+	template<> struct MethodSignature<RenderType::D3D9, 78> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetSoftwareVertexProcessing)>::Type; }; // IDirect3DDevice9::GetSoftwareVertexProcessing
+	template<> struct MethodSignature<RenderType::D3D9, 79> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetNPatchMode)>::Type; }; // IDirect3DDevice9::SetNPatchMode
+	template<> struct MethodSignature<RenderType::D3D9, 80> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetNPatchMode)>::Type; }; // IDirect3DDevice9::GetNPatchMode
+	template<> struct MethodSignature<RenderType::D3D9, 81> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DrawPrimitive)>::Type; }; // IDirect3DDevice9::DrawPrimitive
+	template<> struct MethodSignature<RenderType::D3D9, 82> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DrawIndexedPrimitive)>::Type; }; // IDirect3DDevice9::DrawIndexedPrimitive
+	template<> struct MethodSignature<RenderType::D3D9, 83> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DrawPrimitiveUP)>::Type; }; // IDirect3DDevice9::DrawPrimitiveUP
+	template<> struct MethodSignature<RenderType::D3D9, 84> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DrawIndexedPrimitiveUP)>::Type; }; // IDirect3DDevice9::DrawIndexedPrimitiveUP
+	template<> struct MethodSignature<RenderType::D3D9, 85> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::ProcessVertices)>::Type; }; // IDirect3DDevice9::ProcessVertices
+	template<> struct MethodSignature<RenderType::D3D9, 86> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateVertexDeclaration)>::Type; }; // IDirect3DDevice9::CreateVertexDeclaration
+	template<> struct MethodSignature<RenderType::D3D9, 87> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetVertexDeclaration)>::Type; }; // IDirect3DDevice9::SetVertexDeclaration
+	template<> struct MethodSignature<RenderType::D3D9, 88> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetVertexDeclaration)>::Type; }; // IDirect3DDevice9::GetVertexDeclaration
+	template<> struct MethodSignature<RenderType::D3D9, 89> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetFVF)>::Type; }; // IDirect3DDevice9::SetFVF
+	template<> struct MethodSignature<RenderType::D3D9, 90> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetFVF)>::Type; }; // IDirect3DDevice9::GetFVF
+	template<> struct MethodSignature<RenderType::D3D9, 91> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateVertexShader)>::Type; }; // IDirect3DDevice9::CreateVertexShader
+	template<> struct MethodSignature<RenderType::D3D9, 92> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetVertexShader)>::Type; }; // IDirect3DDevice9::SetVertexShader
+	template<> struct MethodSignature<RenderType::D3D9, 93> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetVertexShader)>::Type; }; // IDirect3DDevice9::GetVertexShader
+	template<> struct MethodSignature<RenderType::D3D9, 94> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetVertexShaderConstantF)>::Type; }; // IDirect3DDevice9::SetVertexShaderConstantF
+	template<> struct MethodSignature<RenderType::D3D9, 95> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetVertexShaderConstantF)>::Type; }; // IDirect3DDevice9::GetVertexShaderConstantF
+	template<> struct MethodSignature<RenderType::D3D9, 96> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetVertexShaderConstantI)>::Type; }; // IDirect3DDevice9::SetVertexShaderConstantI
+	template<> struct MethodSignature<RenderType::D3D9, 97> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetVertexShaderConstantI)>::Type; }; // IDirect3DDevice9::GetVertexShaderConstantI
+	template<> struct MethodSignature<RenderType::D3D9, 98> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetVertexShaderConstantB)>::Type; }; // IDirect3DDevice9::SetVertexShaderConstantB
+	template<> struct MethodSignature<RenderType::D3D9, 99> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetVertexShaderConstantB)>::Type; }; // IDirect3DDevice9::GetVertexShaderConstantB
+	template<> struct MethodSignature<RenderType::D3D9, 100> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetStreamSource)>::Type; }; // IDirect3DDevice9::SetStreamSource
+	template<> struct MethodSignature<RenderType::D3D9, 101> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetStreamSource)>::Type; }; // IDirect3DDevice9::GetStreamSource
+	template<> struct MethodSignature<RenderType::D3D9, 102> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetStreamSourceFreq)>::Type; }; // IDirect3DDevice9::SetStreamSourceFreq
+	template<> struct MethodSignature<RenderType::D3D9, 103> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetStreamSourceFreq)>::Type; }; // IDirect3DDevice9::GetStreamSourceFreq
+	template<> struct MethodSignature<RenderType::D3D9, 104> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetIndices)>::Type; }; // IDirect3DDevice9::SetIndices
+	template<> struct MethodSignature<RenderType::D3D9, 105> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetIndices)>::Type; }; // IDirect3DDevice9::GetIndices
+	template<> struct MethodSignature<RenderType::D3D9, 106> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreatePixelShader)>::Type; }; // IDirect3DDevice9::CreatePixelShader
+	template<> struct MethodSignature<RenderType::D3D9, 107> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetPixelShader)>::Type; }; // IDirect3DDevice9::SetPixelShader
+	template<> struct MethodSignature<RenderType::D3D9, 108> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetPixelShader)>::Type; }; // IDirect3DDevice9::GetPixelShader
+	template<> struct MethodSignature<RenderType::D3D9, 109> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetPixelShaderConstantF)>::Type; }; // IDirect3DDevice9::SetPixelShaderConstantF
+	template<> struct MethodSignature<RenderType::D3D9, 110> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetPixelShaderConstantF)>::Type; }; // IDirect3DDevice9::GetPixelShaderConstantF
+	template<> struct MethodSignature<RenderType::D3D9, 111> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetPixelShaderConstantI)>::Type; }; // IDirect3DDevice9::SetPixelShaderConstantI
+	template<> struct MethodSignature<RenderType::D3D9, 112> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetPixelShaderConstantI)>::Type; }; // IDirect3DDevice9::GetPixelShaderConstantI
+	template<> struct MethodSignature<RenderType::D3D9, 113> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::SetPixelShaderConstantB)>::Type; }; // IDirect3DDevice9::SetPixelShaderConstantB
+	template<> struct MethodSignature<RenderType::D3D9, 114> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::GetPixelShaderConstantB)>::Type; }; // IDirect3DDevice9::GetPixelShaderConstantB
+	template<> struct MethodSignature<RenderType::D3D9, 115> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DrawRectPatch)>::Type; }; // IDirect3DDevice9::DrawRectPatch
+	template<> struct MethodSignature<RenderType::D3D9, 116> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DrawTriPatch)>::Type; }; // IDirect3DDevice9::DrawTriPatch
+	template<> struct MethodSignature<RenderType::D3D9, 117> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::DeletePatch)>::Type; }; // IDirect3DDevice9::DeletePatch
+	template<> struct MethodSignature<RenderType::D3D9, 118> { using Type = detail::ComMethod<::IDirect3DDevice9, decltype(&::IDirect3DDevice9::CreateQuery)>::Type; }; // IDirect3DDevice9::CreateQuery
+}
+#endif
+
+#if KIERO_INCLUDE_D3D10 && defined(_WIN32)
+# include <dxgi.h>
+# include <d3d10_1.h>
+# include <d3d10.h>
+
+namespace kiero
+{
+	template<> struct MethodSignature<RenderType::D3D10, 0> { using Type = HRESULT (STDMETHODCALLTYPE*)(::IDXGISwapChain*, REFIID, void**); }; // IDXGISwapChain::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D10, 1> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::AddRef)>::Type; }; // IDXGISwapChain::AddRef
+	template<> struct MethodSignature<RenderType::D3D10, 2> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::Release)>::Type; }; // IDXGISwapChain::Release
+	template<> struct MethodSignature<RenderType::D3D10, 3> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetPrivateData)>::Type; }; // IDXGISwapChain::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D10, 4> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetPrivateDataInterface)>::Type; }; // IDXGISwapChain::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D10, 5> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetPrivateData)>::Type; }; // IDXGISwapChain::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D10, 6> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetParent)>::Type; }; // IDXGISwapChain::GetParent
+	template<> struct MethodSignature<RenderType::D3D10, 7> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetDevice)>::Type; }; // IDXGISwapChain::GetDevice
+	template<> struct MethodSignature<RenderType::D3D10, 8> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::Present)>::Type; }; // IDXGISwapChain::Present
+	template<> struct MethodSignature<RenderType::D3D10, 9> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetBuffer)>::Type; }; // IDXGISwapChain::GetBuffer
+	template<> struct MethodSignature<RenderType::D3D10, 10> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetFullscreenState)>::Type; }; // IDXGISwapChain::SetFullscreenState
+	template<> struct MethodSignature<RenderType::D3D10, 11> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetFullscreenState)>::Type; }; // IDXGISwapChain::GetFullscreenState
+	template<> struct MethodSignature<RenderType::D3D10, 12> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetDesc)>::Type; }; // IDXGISwapChain::GetDesc
+	template<> struct MethodSignature<RenderType::D3D10, 13> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::ResizeBuffers)>::Type; }; // IDXGISwapChain::ResizeBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 14> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::ResizeTarget)>::Type; }; // IDXGISwapChain::ResizeTarget
+	template<> struct MethodSignature<RenderType::D3D10, 15> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetContainingOutput)>::Type; }; // IDXGISwapChain::GetContainingOutput
+	template<> struct MethodSignature<RenderType::D3D10, 16> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetFrameStatistics)>::Type; }; // IDXGISwapChain::GetFrameStatistics
+	template<> struct MethodSignature<RenderType::D3D10, 17> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetLastPresentCount)>::Type; }; // IDXGISwapChain::GetLastPresentCount
+	template<> struct MethodSignature<RenderType::D3D10, 18> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D10Device*, REFIID, void**); }; // ID3D10Device::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D10, 19> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::AddRef)>::Type; }; // ID3D10Device::AddRef
+	template<> struct MethodSignature<RenderType::D3D10, 20> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::Release)>::Type; }; // ID3D10Device::Release
+	template<> struct MethodSignature<RenderType::D3D10, 21> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSSetConstantBuffers)>::Type; }; // ID3D10Device::VSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 22> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSSetShaderResources)>::Type; }; // ID3D10Device::PSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D10, 23> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSSetShader)>::Type; }; // ID3D10Device::PSSetShader
+	template<> struct MethodSignature<RenderType::D3D10, 24> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSSetSamplers)>::Type; }; // ID3D10Device::PSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D10, 25> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSSetShader)>::Type; }; // ID3D10Device::VSSetShader
+	template<> struct MethodSignature<RenderType::D3D10, 26> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::DrawIndexed)>::Type; }; // ID3D10Device::DrawIndexed
+	template<> struct MethodSignature<RenderType::D3D10, 27> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::Draw)>::Type; }; // ID3D10Device::Draw
+	template<> struct MethodSignature<RenderType::D3D10, 28> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSSetConstantBuffers)>::Type; }; // ID3D10Device::PSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 29> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IASetInputLayout)>::Type; }; // ID3D10Device::IASetInputLayout
+	template<> struct MethodSignature<RenderType::D3D10, 30> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IASetVertexBuffers)>::Type; }; // ID3D10Device::IASetVertexBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 31> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IASetIndexBuffer)>::Type; }; // ID3D10Device::IASetIndexBuffer
+	template<> struct MethodSignature<RenderType::D3D10, 32> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::DrawIndexedInstanced)>::Type; }; // ID3D10Device::DrawIndexedInstanced
+	template<> struct MethodSignature<RenderType::D3D10, 33> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::DrawInstanced)>::Type; }; // ID3D10Device::DrawInstanced
+	template<> struct MethodSignature<RenderType::D3D10, 34> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSSetConstantBuffers)>::Type; }; // ID3D10Device::GSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 35> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSSetShader)>::Type; }; // ID3D10Device::GSSetShader
+	template<> struct MethodSignature<RenderType::D3D10, 36> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IASetPrimitiveTopology)>::Type; }; // ID3D10Device::IASetPrimitiveTopology
+	template<> struct MethodSignature<RenderType::D3D10, 37> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSSetShaderResources)>::Type; }; // ID3D10Device::VSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D10, 38> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSSetSamplers)>::Type; }; // ID3D10Device::VSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D10, 39> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SetPredication)>::Type; }; // ID3D10Device::SetPredication
+	template<> struct MethodSignature<RenderType::D3D10, 40> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSSetShaderResources)>::Type; }; // ID3D10Device::GSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D10, 41> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSSetSamplers)>::Type; }; // ID3D10Device::GSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D10, 42> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OMSetRenderTargets)>::Type; }; // ID3D10Device::OMSetRenderTargets
+	template<> struct MethodSignature<RenderType::D3D10, 43> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OMSetBlendState)>::Type; }; // ID3D10Device::OMSetBlendState
+	template<> struct MethodSignature<RenderType::D3D10, 44> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OMSetDepthStencilState)>::Type; }; // ID3D10Device::OMSetDepthStencilState
+	template<> struct MethodSignature<RenderType::D3D10, 45> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SOSetTargets)>::Type; }; // ID3D10Device::SOSetTargets
+	template<> struct MethodSignature<RenderType::D3D10, 46> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::DrawAuto)>::Type; }; // ID3D10Device::DrawAuto
+	template<> struct MethodSignature<RenderType::D3D10, 47> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::RSSetState)>::Type; }; // ID3D10Device::RSSetState
+	template<> struct MethodSignature<RenderType::D3D10, 48> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::RSSetViewports)>::Type; }; // ID3D10Device::RSSetViewports
+	template<> struct MethodSignature<RenderType::D3D10, 49> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::RSSetScissorRects)>::Type; }; // ID3D10Device::RSSetScissorRects
+	template<> struct MethodSignature<RenderType::D3D10, 50> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CopySubresourceRegion)>::Type; }; // ID3D10Device::CopySubresourceRegion
+	template<> struct MethodSignature<RenderType::D3D10, 51> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CopyResource)>::Type; }; // ID3D10Device::CopyResource
+	template<> struct MethodSignature<RenderType::D3D10, 52> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::UpdateSubresource)>::Type; }; // ID3D10Device::UpdateSubresource
+	template<> struct MethodSignature<RenderType::D3D10, 53> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::ClearRenderTargetView)>::Type; }; // ID3D10Device::ClearRenderTargetView
+	template<> struct MethodSignature<RenderType::D3D10, 54> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::ClearDepthStencilView)>::Type; }; // ID3D10Device::ClearDepthStencilView
+	template<> struct MethodSignature<RenderType::D3D10, 55> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GenerateMips)>::Type; }; // ID3D10Device::GenerateMips
+	template<> struct MethodSignature<RenderType::D3D10, 56> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::ResolveSubresource)>::Type; }; // ID3D10Device::ResolveSubresource
+	template<> struct MethodSignature<RenderType::D3D10, 57> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSGetConstantBuffers)>::Type; }; // ID3D10Device::VSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 58> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSGetShaderResources)>::Type; }; // ID3D10Device::PSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D10, 59> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSGetShader)>::Type; }; // ID3D10Device::PSGetShader
+	template<> struct MethodSignature<RenderType::D3D10, 60> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSGetSamplers)>::Type; }; // ID3D10Device::PSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D10, 61> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSGetShader)>::Type; }; // ID3D10Device::VSGetShader
+	template<> struct MethodSignature<RenderType::D3D10, 62> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::PSGetConstantBuffers)>::Type; }; // ID3D10Device::PSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 63> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IAGetInputLayout)>::Type; }; // ID3D10Device::IAGetInputLayout
+	template<> struct MethodSignature<RenderType::D3D10, 64> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IAGetVertexBuffers)>::Type; }; // ID3D10Device::IAGetVertexBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 65> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IAGetIndexBuffer)>::Type; }; // ID3D10Device::IAGetIndexBuffer
+	template<> struct MethodSignature<RenderType::D3D10, 66> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSGetConstantBuffers)>::Type; }; // ID3D10Device::GSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D10, 67> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSGetShader)>::Type; }; // ID3D10Device::GSGetShader
+	template<> struct MethodSignature<RenderType::D3D10, 68> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::IAGetPrimitiveTopology)>::Type; }; // ID3D10Device::IAGetPrimitiveTopology
+	template<> struct MethodSignature<RenderType::D3D10, 69> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSGetShaderResources)>::Type; }; // ID3D10Device::VSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D10, 70> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::VSGetSamplers)>::Type; }; // ID3D10Device::VSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D10, 71> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GetPredication)>::Type; }; // ID3D10Device::GetPredication
+	template<> struct MethodSignature<RenderType::D3D10, 72> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSGetShaderResources)>::Type; }; // ID3D10Device::GSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D10, 73> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GSGetSamplers)>::Type; }; // ID3D10Device::GSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D10, 74> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OMGetRenderTargets)>::Type; }; // ID3D10Device::OMGetRenderTargets
+	template<> struct MethodSignature<RenderType::D3D10, 75> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OMGetBlendState)>::Type; }; // ID3D10Device::OMGetBlendState
+	template<> struct MethodSignature<RenderType::D3D10, 76> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OMGetDepthStencilState)>::Type; }; // ID3D10Device::OMGetDepthStencilState
+	template<> struct MethodSignature<RenderType::D3D10, 77> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SOGetTargets)>::Type; }; // ID3D10Device::SOGetTargets
+	template<> struct MethodSignature<RenderType::D3D10, 78> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::RSGetState)>::Type; }; // ID3D10Device::RSGetState
+	template<> struct MethodSignature<RenderType::D3D10, 79> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::RSGetViewports)>::Type; }; // ID3D10Device::RSGetViewports
+	template<> struct MethodSignature<RenderType::D3D10, 80> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::RSGetScissorRects)>::Type; }; // ID3D10Device::RSGetScissorRects
+	template<> struct MethodSignature<RenderType::D3D10, 81> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GetDeviceRemovedReason)>::Type; }; // ID3D10Device::GetDeviceRemovedReason
+	template<> struct MethodSignature<RenderType::D3D10, 82> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SetExceptionMode)>::Type; }; // ID3D10Device::SetExceptionMode
+	template<> struct MethodSignature<RenderType::D3D10, 83> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GetExceptionMode)>::Type; }; // ID3D10Device::GetExceptionMode
+	template<> struct MethodSignature<RenderType::D3D10, 84> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GetPrivateData)>::Type; }; // ID3D10Device::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D10, 85> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SetPrivateData)>::Type; }; // ID3D10Device::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D10, 86> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SetPrivateDataInterface)>::Type; }; // ID3D10Device::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D10, 87> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::ClearState)>::Type; }; // ID3D10Device::ClearState
+	template<> struct MethodSignature<RenderType::D3D10, 88> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::Flush)>::Type; }; // ID3D10Device::Flush
+	template<> struct MethodSignature<RenderType::D3D10, 89> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateBuffer)>::Type; }; // ID3D10Device::CreateBuffer
+	template<> struct MethodSignature<RenderType::D3D10, 90> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateTexture1D)>::Type; }; // ID3D10Device::CreateTexture1D
+	template<> struct MethodSignature<RenderType::D3D10, 91> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateTexture2D)>::Type; }; // ID3D10Device::CreateTexture2D
+	template<> struct MethodSignature<RenderType::D3D10, 92> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateTexture3D)>::Type; }; // ID3D10Device::CreateTexture3D
+	template<> struct MethodSignature<RenderType::D3D10, 93> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateShaderResourceView)>::Type; }; // ID3D10Device::CreateShaderResourceView
+	template<> struct MethodSignature<RenderType::D3D10, 94> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateRenderTargetView)>::Type; }; // ID3D10Device::CreateRenderTargetView
+	template<> struct MethodSignature<RenderType::D3D10, 95> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateDepthStencilView)>::Type; }; // ID3D10Device::CreateDepthStencilView
+	template<> struct MethodSignature<RenderType::D3D10, 96> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateInputLayout)>::Type; }; // ID3D10Device::CreateInputLayout
+	template<> struct MethodSignature<RenderType::D3D10, 97> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateVertexShader)>::Type; }; // ID3D10Device::CreateVertexShader
+	template<> struct MethodSignature<RenderType::D3D10, 98> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateGeometryShader)>::Type; }; // ID3D10Device::CreateGeometryShader
+	template<> struct MethodSignature<RenderType::D3D10, 99> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateGemoetryShaderWithStreamOutput)>::Type; }; // ID3D10Device::CreateGemoetryShaderWithStreamOutput
+	template<> struct MethodSignature<RenderType::D3D10, 100> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreatePixelShader)>::Type; }; // ID3D10Device::CreatePixelShader
+	template<> struct MethodSignature<RenderType::D3D10, 101> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateBlendState)>::Type; }; // ID3D10Device::CreateBlendState
+	template<> struct MethodSignature<RenderType::D3D10, 102> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateDepthStencilState)>::Type; }; // ID3D10Device::CreateDepthStencilState
+	template<> struct MethodSignature<RenderType::D3D10, 103> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateRasterizerState)>::Type; }; // ID3D10Device::CreateRasterizerState
+	template<> struct MethodSignature<RenderType::D3D10, 104> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateSamplerState)>::Type; }; // ID3D10Device::CreateSamplerState
+	template<> struct MethodSignature<RenderType::D3D10, 105> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateQuery)>::Type; }; // ID3D10Device::CreateQuery
+	template<> struct MethodSignature<RenderType::D3D10, 106> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreatePredicate)>::Type; }; // ID3D10Device::CreatePredicate
+	template<> struct MethodSignature<RenderType::D3D10, 107> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CreateCounter)>::Type; }; // ID3D10Device::CreateCounter
+	template<> struct MethodSignature<RenderType::D3D10, 108> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CheckFormatSupport)>::Type; }; // ID3D10Device::CheckFormatSupport
+	template<> struct MethodSignature<RenderType::D3D10, 109> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CheckMultisampleQualityLevels)>::Type; }; // ID3D10Device::CheckMultisampleQualityLevels
+	template<> struct MethodSignature<RenderType::D3D10, 110> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CheckCounterInfo)>::Type; }; // ID3D10Device::CheckCounterInfo
+	template<> struct MethodSignature<RenderType::D3D10, 111> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::CheckCounter)>::Type; }; // ID3D10Device::CheckCounter
+	template<> struct MethodSignature<RenderType::D3D10, 112> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GetCreationFlags)>::Type; }; // ID3D10Device::GetCreationFlags
+	template<> struct MethodSignature<RenderType::D3D10, 113> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::OpenSharedResource)>::Type; }; // ID3D10Device::OpenSharedResource
+	template<> struct MethodSignature<RenderType::D3D10, 114> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::SetTextFilterSize)>::Type; }; // ID3D10Device::SetTextFilterSize
+	template<> struct MethodSignature<RenderType::D3D10, 115> { using Type = detail::ComMethod<::ID3D10Device, decltype(&::ID3D10Device::GetTextFilterSize)>::Type; }; // ID3D10Device::GetTextFilterSize
+}
+#endif
+
+#if KIERO_INCLUDE_D3D11 && defined(_WIN32)
+# include <dxgi.h>
+# include <d3d11_2.h>
+
+namespace kiero
+{
+	template<> struct MethodSignature<RenderType::D3D11, 0> { using Type = HRESULT (STDMETHODCALLTYPE*)(::IDXGISwapChain*, REFIID, void**); }; // IDXGISwapChain::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D11, 1> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::AddRef)>::Type; }; // IDXGISwapChain::AddRef
+	template<> struct MethodSignature<RenderType::D3D11, 2> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::Release)>::Type; }; // IDXGISwapChain::Release
+	template<> struct MethodSignature<RenderType::D3D11, 3> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetPrivateData)>::Type; }; // IDXGISwapChain::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D11, 4> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetPrivateDataInterface)>::Type; }; // IDXGISwapChain::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D11, 5> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetPrivateData)>::Type; }; // IDXGISwapChain::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D11, 6> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetParent)>::Type; }; // IDXGISwapChain::GetParent
+	template<> struct MethodSignature<RenderType::D3D11, 7> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetDevice)>::Type; }; // IDXGISwapChain::GetDevice
+	template<> struct MethodSignature<RenderType::D3D11, 8> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::Present)>::Type; }; // IDXGISwapChain::Present
+	template<> struct MethodSignature<RenderType::D3D11, 9> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetBuffer)>::Type; }; // IDXGISwapChain::GetBuffer
+	template<> struct MethodSignature<RenderType::D3D11, 10> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetFullscreenState)>::Type; }; // IDXGISwapChain::SetFullscreenState
+	template<> struct MethodSignature<RenderType::D3D11, 11> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetFullscreenState)>::Type; }; // IDXGISwapChain::GetFullscreenState
+	template<> struct MethodSignature<RenderType::D3D11, 12> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetDesc)>::Type; }; // IDXGISwapChain::GetDesc
+	template<> struct MethodSignature<RenderType::D3D11, 13> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::ResizeBuffers)>::Type; }; // IDXGISwapChain::ResizeBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 14> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::ResizeTarget)>::Type; }; // IDXGISwapChain::ResizeTarget
+	template<> struct MethodSignature<RenderType::D3D11, 15> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetContainingOutput)>::Type; }; // IDXGISwapChain::GetContainingOutput
+	template<> struct MethodSignature<RenderType::D3D11, 16> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetFrameStatistics)>::Type; }; // IDXGISwapChain::GetFrameStatistics
+	template<> struct MethodSignature<RenderType::D3D11, 17> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetLastPresentCount)>::Type; }; // IDXGISwapChain::GetLastPresentCount
+	template<> struct MethodSignature<RenderType::D3D11, 18> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D11Device*, REFIID, void**); }; // ID3D11Device::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D11, 19> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::AddRef)>::Type; }; // ID3D11Device::AddRef
+	template<> struct MethodSignature<RenderType::D3D11, 20> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::Release)>::Type; }; // ID3D11Device::Release
+	template<> struct MethodSignature<RenderType::D3D11, 21> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateBuffer)>::Type; }; // ID3D11Device::CreateBuffer
+	template<> struct MethodSignature<RenderType::D3D11, 22> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateTexture1D)>::Type; }; // ID3D11Device::CreateTexture1D
+	template<> struct MethodSignature<RenderType::D3D11, 23> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateTexture2D)>::Type; }; // ID3D11Device::CreateTexture2D
+	template<> struct MethodSignature<RenderType::D3D11, 24> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateTexture3D)>::Type; }; // ID3D11Device::CreateTexture3D
+	template<> struct MethodSignature<RenderType::D3D11, 25> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateShaderResourceView)>::Type; }; // ID3D11Device::CreateShaderResourceView
+	template<> struct MethodSignature<RenderType::D3D11, 26> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateUnorderedAccessView)>::Type; }; // ID3D11Device::CreateUnorderedAccessView
+	template<> struct MethodSignature<RenderType::D3D11, 27> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateRenderTargetView)>::Type; }; // ID3D11Device::CreateRenderTargetView
+	template<> struct MethodSignature<RenderType::D3D11, 28> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateDepthStencilView)>::Type; }; // ID3D11Device::CreateDepthStencilView
+	template<> struct MethodSignature<RenderType::D3D11, 29> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateInputLayout)>::Type; }; // ID3D11Device::CreateInputLayout
+	template<> struct MethodSignature<RenderType::D3D11, 30> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateVertexShader)>::Type; }; // ID3D11Device::CreateVertexShader
+	template<> struct MethodSignature<RenderType::D3D11, 31> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateGeometryShader)>::Type; }; // ID3D11Device::CreateGeometryShader
+	template<> struct MethodSignature<RenderType::D3D11, 32> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateGeometryShaderWithStreamOutput)>::Type; }; // ID3D11Device::CreateGeometryShaderWithStreamOutput
+	template<> struct MethodSignature<RenderType::D3D11, 33> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreatePixelShader)>::Type; }; // ID3D11Device::CreatePixelShader
+	template<> struct MethodSignature<RenderType::D3D11, 34> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateHullShader)>::Type; }; // ID3D11Device::CreateHullShader
+	template<> struct MethodSignature<RenderType::D3D11, 35> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateDomainShader)>::Type; }; // ID3D11Device::CreateDomainShader
+	template<> struct MethodSignature<RenderType::D3D11, 36> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateComputeShader)>::Type; }; // ID3D11Device::CreateComputeShader
+	template<> struct MethodSignature<RenderType::D3D11, 37> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateClassLinkage)>::Type; }; // ID3D11Device::CreateClassLinkage
+	template<> struct MethodSignature<RenderType::D3D11, 38> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateBlendState)>::Type; }; // ID3D11Device::CreateBlendState
+	template<> struct MethodSignature<RenderType::D3D11, 39> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateDepthStencilState)>::Type; }; // ID3D11Device::CreateDepthStencilState
+	template<> struct MethodSignature<RenderType::D3D11, 40> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateRasterizerState)>::Type; }; // ID3D11Device::CreateRasterizerState
+	template<> struct MethodSignature<RenderType::D3D11, 41> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateSamplerState)>::Type; }; // ID3D11Device::CreateSamplerState
+	template<> struct MethodSignature<RenderType::D3D11, 42> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateQuery)>::Type; }; // ID3D11Device::CreateQuery
+	template<> struct MethodSignature<RenderType::D3D11, 43> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreatePredicate)>::Type; }; // ID3D11Device::CreatePredicate
+	template<> struct MethodSignature<RenderType::D3D11, 44> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateCounter)>::Type; }; // ID3D11Device::CreateCounter
+	template<> struct MethodSignature<RenderType::D3D11, 45> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CreateDeferredContext)>::Type; }; // ID3D11Device::CreateDeferredContext
+	template<> struct MethodSignature<RenderType::D3D11, 46> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::OpenSharedResource)>::Type; }; // ID3D11Device::OpenSharedResource
+	template<> struct MethodSignature<RenderType::D3D11, 47> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CheckFormatSupport)>::Type; }; // ID3D11Device::CheckFormatSupport
+	template<> struct MethodSignature<RenderType::D3D11, 48> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CheckMultisampleQualityLevels)>::Type; }; // ID3D11Device::CheckMultisampleQualityLevels
+	template<> struct MethodSignature<RenderType::D3D11, 49> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CheckCounterInfo)>::Type; }; // ID3D11Device::CheckCounterInfo
+	template<> struct MethodSignature<RenderType::D3D11, 50> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CheckCounter)>::Type; }; // ID3D11Device::CheckCounter
+	template<> struct MethodSignature<RenderType::D3D11, 51> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::CheckFeatureSupport)>::Type; }; // ID3D11Device::CheckFeatureSupport
+	template<> struct MethodSignature<RenderType::D3D11, 52> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::GetPrivateData)>::Type; }; // ID3D11Device::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D11, 53> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::SetPrivateData)>::Type; }; // ID3D11Device::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D11, 54> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::SetPrivateDataInterface)>::Type; }; // ID3D11Device::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D11, 55> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::GetFeatureLevel)>::Type; }; // ID3D11Device::GetFeatureLevel
+	template<> struct MethodSignature<RenderType::D3D11, 56> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::GetCreationFlags)>::Type; }; // ID3D11Device::GetCreationFlags
+	template<> struct MethodSignature<RenderType::D3D11, 57> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::GetDeviceRemovedReason)>::Type; }; // ID3D11Device::GetDeviceRemovedReason
+	template<> struct MethodSignature<RenderType::D3D11, 58> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::GetImmediateContext)>::Type; }; // ID3D11Device::GetImmediateContext
+	template<> struct MethodSignature<RenderType::D3D11, 59> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::SetExceptionMode)>::Type; }; // ID3D11Device::SetExceptionMode
+	template<> struct MethodSignature<RenderType::D3D11, 60> { using Type = detail::ComMethod<::ID3D11Device, decltype(&::ID3D11Device::GetExceptionMode)>::Type; }; // ID3D11Device::GetExceptionMode
+	template<> struct MethodSignature<RenderType::D3D11, 61> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D11DeviceContext*, REFIID, void**); }; // ID3D11DeviceContext::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D11, 62> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::AddRef)>::Type; }; // ID3D11DeviceContext::AddRef
+	template<> struct MethodSignature<RenderType::D3D11, 63> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Release)>::Type; }; // ID3D11DeviceContext::Release
+	template<> struct MethodSignature<RenderType::D3D11, 64> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetDevice)>::Type; }; // ID3D11DeviceContext::GetDevice
+	template<> struct MethodSignature<RenderType::D3D11, 65> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetPrivateData)>::Type; }; // ID3D11DeviceContext::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D11, 66> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::SetPrivateData)>::Type; }; // ID3D11DeviceContext::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D11, 67> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::SetPrivateDataInterface)>::Type; }; // ID3D11DeviceContext::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D11, 68> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSSetConstantBuffers)>::Type; }; // ID3D11DeviceContext::VSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 69> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSSetShaderResources)>::Type; }; // ID3D11DeviceContext::PSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 70> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSSetShader)>::Type; }; // ID3D11DeviceContext::PSSetShader
+	template<> struct MethodSignature<RenderType::D3D11, 71> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSSetSamplers)>::Type; }; // ID3D11DeviceContext::PSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 72> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSSetShader)>::Type; }; // ID3D11DeviceContext::VSSetShader
+	template<> struct MethodSignature<RenderType::D3D11, 73> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DrawIndexed)>::Type; }; // ID3D11DeviceContext::DrawIndexed
+	template<> struct MethodSignature<RenderType::D3D11, 74> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Draw)>::Type; }; // ID3D11DeviceContext::Draw
+	template<> struct MethodSignature<RenderType::D3D11, 75> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Map)>::Type; }; // ID3D11DeviceContext::Map
+	template<> struct MethodSignature<RenderType::D3D11, 76> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Unmap)>::Type; }; // ID3D11DeviceContext::Unmap
+	template<> struct MethodSignature<RenderType::D3D11, 77> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSSetConstantBuffers)>::Type; }; // ID3D11DeviceContext::PSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 78> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IASetInputLayout)>::Type; }; // ID3D11DeviceContext::IASetInputLayout
+	template<> struct MethodSignature<RenderType::D3D11, 79> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IASetVertexBuffers)>::Type; }; // ID3D11DeviceContext::IASetVertexBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 80> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IASetIndexBuffer)>::Type; }; // ID3D11DeviceContext::IASetIndexBuffer
+	template<> struct MethodSignature<RenderType::D3D11, 81> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DrawIndexedInstanced)>::Type; }; // ID3D11DeviceContext::DrawIndexedInstanced
+	template<> struct MethodSignature<RenderType::D3D11, 82> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DrawInstanced)>::Type; }; // ID3D11DeviceContext::DrawInstanced
+	template<> struct MethodSignature<RenderType::D3D11, 83> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSSetConstantBuffers)>::Type; }; // ID3D11DeviceContext::GSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 84> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSSetShader)>::Type; }; // ID3D11DeviceContext::GSSetShader
+	template<> struct MethodSignature<RenderType::D3D11, 85> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IASetPrimitiveTopology)>::Type; }; // ID3D11DeviceContext::IASetPrimitiveTopology
+	template<> struct MethodSignature<RenderType::D3D11, 86> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSSetShaderResources)>::Type; }; // ID3D11DeviceContext::VSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 87> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSSetSamplers)>::Type; }; // ID3D11DeviceContext::VSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 88> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Begin)>::Type; }; // ID3D11DeviceContext::Begin
+	template<> struct MethodSignature<RenderType::D3D11, 89> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::End)>::Type; }; // ID3D11DeviceContext::End
+	template<> struct MethodSignature<RenderType::D3D11, 90> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetData)>::Type; }; // ID3D11DeviceContext::GetData
+	template<> struct MethodSignature<RenderType::D3D11, 91> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::SetPredication)>::Type; }; // ID3D11DeviceContext::SetPredication
+	template<> struct MethodSignature<RenderType::D3D11, 92> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSSetShaderResources)>::Type; }; // ID3D11DeviceContext::GSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 93> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSSetSamplers)>::Type; }; // ID3D11DeviceContext::GSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 94> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMSetRenderTargets)>::Type; }; // ID3D11DeviceContext::OMSetRenderTargets
+	template<> struct MethodSignature<RenderType::D3D11, 95> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMSetRenderTargetsAndUnorderedAccessViews)>::Type; }; // ID3D11DeviceContext::OMSetRenderTargetsAndUnorderedAccessViews
+	template<> struct MethodSignature<RenderType::D3D11, 96> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMSetBlendState)>::Type; }; // ID3D11DeviceContext::OMSetBlendState
+	template<> struct MethodSignature<RenderType::D3D11, 97> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMSetDepthStencilState)>::Type; }; // ID3D11DeviceContext::OMSetDepthStencilState
+	template<> struct MethodSignature<RenderType::D3D11, 98> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::SOSetTargets)>::Type; }; // ID3D11DeviceContext::SOSetTargets
+	template<> struct MethodSignature<RenderType::D3D11, 99> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DrawAuto)>::Type; }; // ID3D11DeviceContext::DrawAuto
+	template<> struct MethodSignature<RenderType::D3D11, 100> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DrawIndexedInstancedIndirect)>::Type; }; // ID3D11DeviceContext::DrawIndexedInstancedIndirect
+	template<> struct MethodSignature<RenderType::D3D11, 101> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DrawInstancedIndirect)>::Type; }; // ID3D11DeviceContext::DrawInstancedIndirect
+	template<> struct MethodSignature<RenderType::D3D11, 102> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Dispatch)>::Type; }; // ID3D11DeviceContext::Dispatch
+	template<> struct MethodSignature<RenderType::D3D11, 103> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DispatchIndirect)>::Type; }; // ID3D11DeviceContext::DispatchIndirect
+	template<> struct MethodSignature<RenderType::D3D11, 104> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::RSSetState)>::Type; }; // ID3D11DeviceContext::RSSetState
+	template<> struct MethodSignature<RenderType::D3D11, 105> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::RSSetViewports)>::Type; }; // ID3D11DeviceContext::RSSetViewports
+	template<> struct MethodSignature<RenderType::D3D11, 106> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::RSSetScissorRects)>::Type; }; // ID3D11DeviceContext::RSSetScissorRects
+	template<> struct MethodSignature<RenderType::D3D11, 107> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CopySubresourceRegion)>::Type; }; // ID3D11DeviceContext::CopySubresourceRegion
+	template<> struct MethodSignature<RenderType::D3D11, 108> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CopyResource)>::Type; }; // ID3D11DeviceContext::CopyResource
+	template<> struct MethodSignature<RenderType::D3D11, 109> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::UpdateSubresource)>::Type; }; // ID3D11DeviceContext::UpdateSubresource
+	template<> struct MethodSignature<RenderType::D3D11, 110> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CopyStructureCount)>::Type; }; // ID3D11DeviceContext::CopyStructureCount
+	template<> struct MethodSignature<RenderType::D3D11, 111> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ClearRenderTargetView)>::Type; }; // ID3D11DeviceContext::ClearRenderTargetView
+	template<> struct MethodSignature<RenderType::D3D11, 112> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ClearUnorderedAccessViewUint)>::Type; }; // ID3D11DeviceContext::ClearUnorderedAccessViewUint
+	template<> struct MethodSignature<RenderType::D3D11, 113> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ClearUnorderedAccessViewFloat)>::Type; }; // ID3D11DeviceContext::ClearUnorderedAccessViewFloat
+	template<> struct MethodSignature<RenderType::D3D11, 114> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ClearDepthStencilView)>::Type; }; // ID3D11DeviceContext::ClearDepthStencilView
+	template<> struct MethodSignature<RenderType::D3D11, 115> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GenerateMips)>::Type; }; // ID3D11DeviceContext::GenerateMips
+	template<> struct MethodSignature<RenderType::D3D11, 116> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::SetResourceMinLOD)>::Type; }; // ID3D11DeviceContext::SetResourceMinLOD
+	template<> struct MethodSignature<RenderType::D3D11, 117> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetResourceMinLOD)>::Type; }; // ID3D11DeviceContext::GetResourceMinLOD
+	template<> struct MethodSignature<RenderType::D3D11, 118> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ResolveSubresource)>::Type; }; // ID3D11DeviceContext::ResolveSubresource
+	template<> struct MethodSignature<RenderType::D3D11, 119> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ExecuteCommandList)>::Type; }; // ID3D11DeviceContext::ExecuteCommandList
+	template<> struct MethodSignature<RenderType::D3D11, 120> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSSetShaderResources)>::Type; }; // ID3D11DeviceContext::HSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 121> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSSetShader)>::Type; }; // ID3D11DeviceContext::HSSetShader
+	template<> struct MethodSignature<RenderType::D3D11, 122> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSSetSamplers)>::Type; }; // ID3D11DeviceContext::HSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 123> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSSetConstantBuffers)>::Type; }; // ID3D11DeviceContext::HSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 124> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSSetShaderResources)>::Type; }; // ID3D11DeviceContext::DSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 125> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSSetShader)>::Type; }; // ID3D11DeviceContext::DSSetShader
+	template<> struct MethodSignature<RenderType::D3D11, 126> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSSetSamplers)>::Type; }; // ID3D11DeviceContext::DSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 127> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSSetConstantBuffers)>::Type; }; // ID3D11DeviceContext::DSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 128> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSSetShaderResources)>::Type; }; // ID3D11DeviceContext::CSSetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 129> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSSetUnorderedAccessViews)>::Type; }; // ID3D11DeviceContext::CSSetUnorderedAccessViews
+	template<> struct MethodSignature<RenderType::D3D11, 130> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSSetShader)>::Type; }; // ID3D11DeviceContext::CSSetShader
+	template<> struct MethodSignature<RenderType::D3D11, 131> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSSetSamplers)>::Type; }; // ID3D11DeviceContext::CSSetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 132> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSSetConstantBuffers)>::Type; }; // ID3D11DeviceContext::CSSetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 133> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSGetConstantBuffers)>::Type; }; // ID3D11DeviceContext::VSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 134> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSGetShaderResources)>::Type; }; // ID3D11DeviceContext::PSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 135> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSGetShader)>::Type; }; // ID3D11DeviceContext::PSGetShader
+	template<> struct MethodSignature<RenderType::D3D11, 136> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSGetSamplers)>::Type; }; // ID3D11DeviceContext::PSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 137> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSGetShader)>::Type; }; // ID3D11DeviceContext::VSGetShader
+	template<> struct MethodSignature<RenderType::D3D11, 138> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::PSGetConstantBuffers)>::Type; }; // ID3D11DeviceContext::PSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 139> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IAGetInputLayout)>::Type; }; // ID3D11DeviceContext::IAGetInputLayout
+	template<> struct MethodSignature<RenderType::D3D11, 140> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IAGetVertexBuffers)>::Type; }; // ID3D11DeviceContext::IAGetVertexBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 141> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IAGetIndexBuffer)>::Type; }; // ID3D11DeviceContext::IAGetIndexBuffer
+	template<> struct MethodSignature<RenderType::D3D11, 142> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSGetConstantBuffers)>::Type; }; // ID3D11DeviceContext::GSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 143> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSGetShader)>::Type; }; // ID3D11DeviceContext::GSGetShader
+	template<> struct MethodSignature<RenderType::D3D11, 144> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::IAGetPrimitiveTopology)>::Type; }; // ID3D11DeviceContext::IAGetPrimitiveTopology
+	template<> struct MethodSignature<RenderType::D3D11, 145> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSGetShaderResources)>::Type; }; // ID3D11DeviceContext::VSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 146> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::VSGetSamplers)>::Type; }; // ID3D11DeviceContext::VSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 147> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetPredication)>::Type; }; // ID3D11DeviceContext::GetPredication
+	template<> struct MethodSignature<RenderType::D3D11, 148> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSGetShaderResources)>::Type; }; // ID3D11DeviceContext::GSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 149> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GSGetSamplers)>::Type; }; // ID3D11DeviceContext::GSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 150> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMGetRenderTargets)>::Type; }; // ID3D11DeviceContext::OMGetRenderTargets
+	template<> struct MethodSignature<RenderType::D3D11, 151> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMGetRenderTargetsAndUnorderedAccessViews)>::Type; }; // ID3D11DeviceContext::OMGetRenderTargetsAndUnorderedAccessViews
+	template<> struct MethodSignature<RenderType::D3D11, 152> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMGetBlendState)>::Type; }; // ID3D11DeviceContext::OMGetBlendState
+	template<> struct MethodSignature<RenderType::D3D11, 153> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::OMGetDepthStencilState)>::Type; }; // ID3D11DeviceContext::OMGetDepthStencilState
+	template<> struct MethodSignature<RenderType::D3D11, 154> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::SOGetTargets)>::Type; }; // ID3D11DeviceContext::SOGetTargets
+	template<> struct MethodSignature<RenderType::D3D11, 155> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::RSGetState)>::Type; }; // ID3D11DeviceContext::RSGetState
+	template<> struct MethodSignature<RenderType::D3D11, 156> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::RSGetViewports)>::Type; }; // ID3D11DeviceContext::RSGetViewports
+	template<> struct MethodSignature<RenderType::D3D11, 157> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::RSGetScissorRects)>::Type; }; // ID3D11DeviceContext::RSGetScissorRects
+	template<> struct MethodSignature<RenderType::D3D11, 158> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSGetShaderResources)>::Type; }; // ID3D11DeviceContext::HSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 159> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSGetShader)>::Type; }; // ID3D11DeviceContext::HSGetShader
+	template<> struct MethodSignature<RenderType::D3D11, 160> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSGetSamplers)>::Type; }; // ID3D11DeviceContext::HSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 161> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::HSGetConstantBuffers)>::Type; }; // ID3D11DeviceContext::HSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 162> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSGetShaderResources)>::Type; }; // ID3D11DeviceContext::DSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 163> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSGetShader)>::Type; }; // ID3D11DeviceContext::DSGetShader
+	template<> struct MethodSignature<RenderType::D3D11, 164> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSGetSamplers)>::Type; }; // ID3D11DeviceContext::DSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 165> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::DSGetConstantBuffers)>::Type; }; // ID3D11DeviceContext::DSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 166> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSGetShaderResources)>::Type; }; // ID3D11DeviceContext::CSGetShaderResources
+	template<> struct MethodSignature<RenderType::D3D11, 167> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSGetUnorderedAccessViews)>::Type; }; // ID3D11DeviceContext::CSGetUnorderedAccessViews
+	template<> struct MethodSignature<RenderType::D3D11, 168> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSGetShader)>::Type; }; // ID3D11DeviceContext::CSGetShader
+	template<> struct MethodSignature<RenderType::D3D11, 169> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSGetSamplers)>::Type; }; // ID3D11DeviceContext::CSGetSamplers
+	template<> struct MethodSignature<RenderType::D3D11, 170> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::CSGetConstantBuffers)>::Type; }; // ID3D11DeviceContext::CSGetConstantBuffers
+	template<> struct MethodSignature<RenderType::D3D11, 171> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::ClearState)>::Type; }; // ID3D11DeviceContext::ClearState
+	template<> struct MethodSignature<RenderType::D3D11, 172> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::Flush)>::Type; }; // ID3D11DeviceContext::Flush
+	template<> struct MethodSignature<RenderType::D3D11, 173> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetType)>::Type; }; // ID3D11DeviceContext::GetType
+	template<> struct MethodSignature<RenderType::D3D11, 174> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::GetContextFlags)>::Type; }; // ID3D11DeviceContext::GetContextFlags
+	template<> struct MethodSignature<RenderType::D3D11, 175> { using Type = detail::ComMethod<::ID3D11DeviceContext, decltype(&::ID3D11DeviceContext::FinishCommandList)>::Type; }; // ID3D11DeviceContext::FinishCommandList
+	template<> struct MethodSignature<RenderType::D3D11, 176> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::CopySubresourceRegion1)>::Type; }; // ID3D11DeviceContext1::CopySubresourceRegion1
+	template<> struct MethodSignature<RenderType::D3D11, 177> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::UpdateSubresource1)>::Type; }; // ID3D11DeviceContext1::UpdateSubresource1
+	template<> struct MethodSignature<RenderType::D3D11, 178> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::DiscardResource)>::Type; }; // ID3D11DeviceContext1::DiscardResource
+	template<> struct MethodSignature<RenderType::D3D11, 179> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::DiscardView)>::Type; }; // ID3D11DeviceContext1::DiscardView
+	template<> struct MethodSignature<RenderType::D3D11, 180> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::VSSetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::VSSetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 181> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::HSSetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::HSSetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 182> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::DSSetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::DSSetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 183> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::GSSetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::GSSetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 184> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::PSSetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::PSSetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 185> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::CSSetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::CSSetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 186> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::VSGetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::VSGetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 187> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::HSGetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::HSGetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 188> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::DSGetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::DSGetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 189> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::GSGetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::GSGetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 190> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::PSGetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::PSGetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 191> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::CSGetConstantBuffers1)>::Type; }; // ID3D11DeviceContext1::CSGetConstantBuffers1
+	template<> struct MethodSignature<RenderType::D3D11, 192> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::SwapDeviceContextState)>::Type; }; // ID3D11DeviceContext1::SwapDeviceContextState
+	template<> struct MethodSignature<RenderType::D3D11, 193> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::ClearView)>::Type; }; // ID3D11DeviceContext1::ClearView
+	template<> struct MethodSignature<RenderType::D3D11, 194> { using Type = detail::ComMethod<::ID3D11DeviceContext1, decltype(&::ID3D11DeviceContext1::DiscardView1)>::Type; }; // ID3D11DeviceContext1::DiscardView1
+	template<> struct MethodSignature<RenderType::D3D11, 195> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::UpdateTileMappings)>::Type; }; // ID3D11DeviceContext2::UpdateTileMappings
+	template<> struct MethodSignature<RenderType::D3D11, 196> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::CopyTileMappings)>::Type; }; // ID3D11DeviceContext2::CopyTileMappings
+	template<> struct MethodSignature<RenderType::D3D11, 197> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::CopyTiles)>::Type; }; // ID3D11DeviceContext2::CopyTiles
+	template<> struct MethodSignature<RenderType::D3D11, 198> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::UpdateTiles)>::Type; }; // ID3D11DeviceContext2::UpdateTiles
+	template<> struct MethodSignature<RenderType::D3D11, 199> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::ResizeTilePool)>::Type; }; // ID3D11DeviceContext2::ResizeTilePool
+	template<> struct MethodSignature<RenderType::D3D11, 200> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::TiledResourceBarrier)>::Type; }; // ID3D11DeviceContext2::TiledResourceBarrier
+	template<> struct MethodSignature<RenderType::D3D11, 201> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::IsAnnotationEnabled)>::Type; }; // ID3D11DeviceContext2::IsAnnotationEnabled
+	template<> struct MethodSignature<RenderType::D3D11, 202> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::SetMarkerInt)>::Type; }; // ID3D11DeviceContext2::SetMarkerInt
+	template<> struct MethodSignature<RenderType::D3D11, 203> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::BeginEventInt)>::Type; }; // ID3D11DeviceContext2::BeginEventInt
+	template<> struct MethodSignature<RenderType::D3D11, 204> { using Type = detail::ComMethod<::ID3D11DeviceContext2, decltype(&::ID3D11DeviceContext2::EndEvent)>::Type; }; // ID3D11DeviceContext2::EndEvent
+}
+#endif
+
+#if KIERO_INCLUDE_D3D12 && defined(_WIN32)
+# include <dxgi.h>
+# include <d3d12.h>
+
+namespace kiero
+{
+	template<> struct MethodSignature<RenderType::D3D12, 0> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D12Device*, REFIID, void**); }; // ID3D12Device::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D12, 1> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::AddRef)>::Type; }; // ID3D12Device::AddRef
+	template<> struct MethodSignature<RenderType::D3D12, 2> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::Release)>::Type; }; // ID3D12Device::Release
+	template<> struct MethodSignature<RenderType::D3D12, 3> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetPrivateData)>::Type; }; // ID3D12Device::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 4> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::SetPrivateData)>::Type; }; // ID3D12Device::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 5> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::SetPrivateDataInterface)>::Type; }; // ID3D12Device::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D12, 6> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::SetName)>::Type; }; // ID3D12Device::SetName
+	template<> struct MethodSignature<RenderType::D3D12, 7> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetNodeCount)>::Type; }; // ID3D12Device::GetNodeCount
+	template<> struct MethodSignature<RenderType::D3D12, 8> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateCommandQueue)>::Type; }; // ID3D12Device::CreateCommandQueue
+	template<> struct MethodSignature<RenderType::D3D12, 9> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateCommandAllocator)>::Type; }; // ID3D12Device::CreateCommandAllocator
+	template<> struct MethodSignature<RenderType::D3D12, 10> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateGraphicsPipelineState)>::Type; }; // ID3D12Device::CreateGraphicsPipelineState
+	template<> struct MethodSignature<RenderType::D3D12, 11> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateComputePipelineState)>::Type; }; // ID3D12Device::CreateComputePipelineState
+	template<> struct MethodSignature<RenderType::D3D12, 12> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateCommandList)>::Type; }; // ID3D12Device::CreateCommandList
+	template<> struct MethodSignature<RenderType::D3D12, 13> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CheckFeatureSupport)>::Type; }; // ID3D12Device::CheckFeatureSupport
+	template<> struct MethodSignature<RenderType::D3D12, 14> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateDescriptorHeap)>::Type; }; // ID3D12Device::CreateDescriptorHeap
+	template<> struct MethodSignature<RenderType::D3D12, 15> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetDescriptorHandleIncrementSize)>::Type; }; // ID3D12Device::GetDescriptorHandleIncrementSize
+	template<> struct MethodSignature<RenderType::D3D12, 16> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateRootSignature)>::Type; }; // ID3D12Device::CreateRootSignature
+	template<> struct MethodSignature<RenderType::D3D12, 17> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateConstantBufferView)>::Type; }; // ID3D12Device::CreateConstantBufferView
+	template<> struct MethodSignature<RenderType::D3D12, 18> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateShaderResourceView)>::Type; }; // ID3D12Device::CreateShaderResourceView
+	template<> struct MethodSignature<RenderType::D3D12, 19> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateUnorderedAccessView)>::Type; }; // ID3D12Device::CreateUnorderedAccessView
+	template<> struct MethodSignature<RenderType::D3D12, 20> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateRenderTargetView)>::Type; }; // ID3D12Device::CreateRenderTargetView
+	template<> struct MethodSignature<RenderType::D3D12, 21> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateDepthStencilView)>::Type; }; // ID3D12Device::CreateDepthStencilView
+	template<> struct MethodSignature<RenderType::D3D12, 22> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateSampler)>::Type; }; // ID3D12Device::CreateSampler
+	template<> struct MethodSignature<RenderType::D3D12, 23> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CopyDescriptors)>::Type; }; // ID3D12Device::CopyDescriptors
+	template<> struct MethodSignature<RenderType::D3D12, 24> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CopyDescriptorsSimple)>::Type; }; // ID3D12Device::CopyDescriptorsSimple
+	template<> struct MethodSignature<RenderType::D3D12, 25> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetResourceAllocationInfo)>::Type; }; // ID3D12Device::GetResourceAllocationInfo
+	template<> struct MethodSignature<RenderType::D3D12, 26> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetCustomHeapProperties)>::Type; }; // ID3D12Device::GetCustomHeapProperties
+	template<> struct MethodSignature<RenderType::D3D12, 27> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateCommittedResource)>::Type; }; // ID3D12Device::CreateCommittedResource
+	template<> struct MethodSignature<RenderType::D3D12, 28> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateHeap)>::Type; }; // ID3D12Device::CreateHeap
+	template<> struct MethodSignature<RenderType::D3D12, 29> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreatePlacedResource)>::Type; }; // ID3D12Device::CreatePlacedResource
+	template<> struct MethodSignature<RenderType::D3D12, 30> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateReservedResource)>::Type; }; // ID3D12Device::CreateReservedResource
+	template<> struct MethodSignature<RenderType::D3D12, 31> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateSharedHandle)>::Type; }; // ID3D12Device::CreateSharedHandle
+	template<> struct MethodSignature<RenderType::D3D12, 32> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::OpenSharedHandle)>::Type; }; // ID3D12Device::OpenSharedHandle
+	template<> struct MethodSignature<RenderType::D3D12, 33> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::OpenSharedHandleByName)>::Type; }; // ID3D12Device::OpenSharedHandleByName
+	template<> struct MethodSignature<RenderType::D3D12, 34> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::MakeResident)>::Type; }; // ID3D12Device::MakeResident
+	template<> struct MethodSignature<RenderType::D3D12, 35> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::Evict)>::Type; }; // ID3D12Device::Evict
+	template<> struct MethodSignature<RenderType::D3D12, 36> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateFence)>::Type; }; // ID3D12Device::CreateFence
+	template<> struct MethodSignature<RenderType::D3D12, 37> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetDeviceRemovedReason)>::Type; }; // ID3D12Device::GetDeviceRemovedReason
+	template<> struct MethodSignature<RenderType::D3D12, 38> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetCopyableFootprints)>::Type; }; // ID3D12Device::GetCopyableFootprints
+	template<> struct MethodSignature<RenderType::D3D12, 39> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateQueryHeap)>::Type; }; // ID3D12Device::CreateQueryHeap
+	template<> struct MethodSignature<RenderType::D3D12, 40> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::SetStablePowerState)>::Type; }; // ID3D12Device::SetStablePowerState
+	template<> struct MethodSignature<RenderType::D3D12, 41> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::CreateCommandSignature)>::Type; }; // ID3D12Device::CreateCommandSignature
+	template<> struct MethodSignature<RenderType::D3D12, 42> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetResourceTiling)>::Type; }; // ID3D12Device::GetResourceTiling
+	template<> struct MethodSignature<RenderType::D3D12, 43> { using Type = detail::ComMethod<::ID3D12Device, decltype(&::ID3D12Device::GetAdapterLuid)>::Type; }; // ID3D12Device::GetAdapterLuid
+	template<> struct MethodSignature<RenderType::D3D12, 44> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D12CommandQueue*, REFIID, void**); }; // ID3D12CommandQueue::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D12, 45> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::AddRef)>::Type; }; // ID3D12CommandQueue::AddRef
+	template<> struct MethodSignature<RenderType::D3D12, 46> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::Release)>::Type; }; // ID3D12CommandQueue::Release
+	template<> struct MethodSignature<RenderType::D3D12, 47> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::GetPrivateData)>::Type; }; // ID3D12CommandQueue::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 48> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::SetPrivateData)>::Type; }; // ID3D12CommandQueue::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 49> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::SetPrivateDataInterface)>::Type; }; // ID3D12CommandQueue::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D12, 50> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::SetName)>::Type; }; // ID3D12CommandQueue::SetName
+	template<> struct MethodSignature<RenderType::D3D12, 51> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::GetDevice)>::Type; }; // ID3D12CommandQueue::GetDevice
+	template<> struct MethodSignature<RenderType::D3D12, 52> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::UpdateTileMappings)>::Type; }; // ID3D12CommandQueue::UpdateTileMappings
+	template<> struct MethodSignature<RenderType::D3D12, 53> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::CopyTileMappings)>::Type; }; // ID3D12CommandQueue::CopyTileMappings
+	template<> struct MethodSignature<RenderType::D3D12, 54> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::ExecuteCommandLists)>::Type; }; // ID3D12CommandQueue::ExecuteCommandLists
+	template<> struct MethodSignature<RenderType::D3D12, 55> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::SetMarker)>::Type; }; // ID3D12CommandQueue::SetMarker
+	template<> struct MethodSignature<RenderType::D3D12, 56> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::BeginEvent)>::Type; }; // ID3D12CommandQueue::BeginEvent
+	template<> struct MethodSignature<RenderType::D3D12, 57> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::EndEvent)>::Type; }; // ID3D12CommandQueue::EndEvent
+	template<> struct MethodSignature<RenderType::D3D12, 58> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::Signal)>::Type; }; // ID3D12CommandQueue::Signal
+	template<> struct MethodSignature<RenderType::D3D12, 59> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::Wait)>::Type; }; // ID3D12CommandQueue::Wait
+	template<> struct MethodSignature<RenderType::D3D12, 60> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::GetTimestampFrequency)>::Type; }; // ID3D12CommandQueue::GetTimestampFrequency
+	template<> struct MethodSignature<RenderType::D3D12, 61> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::GetClockCalibration)>::Type; }; // ID3D12CommandQueue::GetClockCalibration
+	template<> struct MethodSignature<RenderType::D3D12, 62> { using Type = detail::ComMethod<::ID3D12CommandQueue, decltype(&::ID3D12CommandQueue::GetDesc)>::Type; }; // ID3D12CommandQueue::GetDesc
+	template<> struct MethodSignature<RenderType::D3D12, 63> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D12CommandAllocator*, REFIID, void**); }; // ID3D12CommandAllocator::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D12, 64> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::AddRef)>::Type; }; // ID3D12CommandAllocator::AddRef
+	template<> struct MethodSignature<RenderType::D3D12, 65> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::Release)>::Type; }; // ID3D12CommandAllocator::Release
+	template<> struct MethodSignature<RenderType::D3D12, 66> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::GetPrivateData)>::Type; }; // ID3D12CommandAllocator::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 67> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::SetPrivateData)>::Type; }; // ID3D12CommandAllocator::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 68> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::SetPrivateDataInterface)>::Type; }; // ID3D12CommandAllocator::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D12, 69> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::SetName)>::Type; }; // ID3D12CommandAllocator::SetName
+	template<> struct MethodSignature<RenderType::D3D12, 70> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::GetDevice)>::Type; }; // ID3D12CommandAllocator::GetDevice
+	template<> struct MethodSignature<RenderType::D3D12, 71> { using Type = detail::ComMethod<::ID3D12CommandAllocator, decltype(&::ID3D12CommandAllocator::Reset)>::Type; }; // ID3D12CommandAllocator::Reset
+	template<> struct MethodSignature<RenderType::D3D12, 72> { using Type = HRESULT (STDMETHODCALLTYPE*)(::ID3D12GraphicsCommandList*, REFIID, void**); }; // ID3D12GraphicsCommandList::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D12, 73> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::AddRef)>::Type; }; // ID3D12GraphicsCommandList::AddRef
+	template<> struct MethodSignature<RenderType::D3D12, 74> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::Release)>::Type; }; // ID3D12GraphicsCommandList::Release
+	template<> struct MethodSignature<RenderType::D3D12, 75> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::GetPrivateData)>::Type; }; // ID3D12GraphicsCommandList::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 76> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetPrivateData)>::Type; }; // ID3D12GraphicsCommandList::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 77> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetPrivateDataInterface)>::Type; }; // ID3D12GraphicsCommandList::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D12, 78> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetName)>::Type; }; // ID3D12GraphicsCommandList::SetName
+	template<> struct MethodSignature<RenderType::D3D12, 79> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::GetDevice)>::Type; }; // ID3D12GraphicsCommandList::GetDevice
+	template<> struct MethodSignature<RenderType::D3D12, 80> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::GetType)>::Type; }; // ID3D12GraphicsCommandList::GetType
+	template<> struct MethodSignature<RenderType::D3D12, 81> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::Close)>::Type; }; // ID3D12GraphicsCommandList::Close
+	template<> struct MethodSignature<RenderType::D3D12, 82> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::Reset)>::Type; }; // ID3D12GraphicsCommandList::Reset
+	template<> struct MethodSignature<RenderType::D3D12, 83> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ClearState)>::Type; }; // ID3D12GraphicsCommandList::ClearState
+	template<> struct MethodSignature<RenderType::D3D12, 84> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::DrawInstanced)>::Type; }; // ID3D12GraphicsCommandList::DrawInstanced
+	template<> struct MethodSignature<RenderType::D3D12, 85> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::DrawIndexedInstanced)>::Type; }; // ID3D12GraphicsCommandList::DrawIndexedInstanced
+	template<> struct MethodSignature<RenderType::D3D12, 86> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::Dispatch)>::Type; }; // ID3D12GraphicsCommandList::Dispatch
+	template<> struct MethodSignature<RenderType::D3D12, 87> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::CopyBufferRegion)>::Type; }; // ID3D12GraphicsCommandList::CopyBufferRegion
+	template<> struct MethodSignature<RenderType::D3D12, 88> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::CopyTextureRegion)>::Type; }; // ID3D12GraphicsCommandList::CopyTextureRegion
+	template<> struct MethodSignature<RenderType::D3D12, 89> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::CopyResource)>::Type; }; // ID3D12GraphicsCommandList::CopyResource
+	template<> struct MethodSignature<RenderType::D3D12, 90> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::CopyTiles)>::Type; }; // ID3D12GraphicsCommandList::CopyTiles
+	template<> struct MethodSignature<RenderType::D3D12, 91> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ResolveSubresource)>::Type; }; // ID3D12GraphicsCommandList::ResolveSubresource
+	template<> struct MethodSignature<RenderType::D3D12, 92> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::IASetPrimitiveTopology)>::Type; }; // ID3D12GraphicsCommandList::IASetPrimitiveTopology
+	template<> struct MethodSignature<RenderType::D3D12, 93> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::RSSetViewports)>::Type; }; // ID3D12GraphicsCommandList::RSSetViewports
+	template<> struct MethodSignature<RenderType::D3D12, 94> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::RSSetScissorRects)>::Type; }; // ID3D12GraphicsCommandList::RSSetScissorRects
+	template<> struct MethodSignature<RenderType::D3D12, 95> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::OMSetBlendFactor)>::Type; }; // ID3D12GraphicsCommandList::OMSetBlendFactor
+	template<> struct MethodSignature<RenderType::D3D12, 96> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::OMSetStencilRef)>::Type; }; // ID3D12GraphicsCommandList::OMSetStencilRef
+	template<> struct MethodSignature<RenderType::D3D12, 97> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetPipelineState)>::Type; }; // ID3D12GraphicsCommandList::SetPipelineState
+	template<> struct MethodSignature<RenderType::D3D12, 98> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ResourceBarrier)>::Type; }; // ID3D12GraphicsCommandList::ResourceBarrier
+	template<> struct MethodSignature<RenderType::D3D12, 99> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ExecuteBundle)>::Type; }; // ID3D12GraphicsCommandList::ExecuteBundle
+	template<> struct MethodSignature<RenderType::D3D12, 100> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetDescriptorHeaps)>::Type; }; // ID3D12GraphicsCommandList::SetDescriptorHeaps
+	template<> struct MethodSignature<RenderType::D3D12, 101> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRootSignature)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRootSignature
+	template<> struct MethodSignature<RenderType::D3D12, 102> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRootSignature)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRootSignature
+	template<> struct MethodSignature<RenderType::D3D12, 103> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRootDescriptorTable)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRootDescriptorTable
+	template<> struct MethodSignature<RenderType::D3D12, 104> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRootDescriptorTable)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRootDescriptorTable
+	template<> struct MethodSignature<RenderType::D3D12, 105> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRoot32BitConstant)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRoot32BitConstant
+	template<> struct MethodSignature<RenderType::D3D12, 106> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRoot32BitConstant)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRoot32BitConstant
+	template<> struct MethodSignature<RenderType::D3D12, 107> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRoot32BitConstants)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRoot32BitConstants
+	template<> struct MethodSignature<RenderType::D3D12, 108> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRoot32BitConstants)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRoot32BitConstants
+	template<> struct MethodSignature<RenderType::D3D12, 109> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRootConstantBufferView)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRootConstantBufferView
+	template<> struct MethodSignature<RenderType::D3D12, 110> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRootConstantBufferView)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRootConstantBufferView
+	template<> struct MethodSignature<RenderType::D3D12, 111> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRootShaderResourceView)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRootShaderResourceView
+	template<> struct MethodSignature<RenderType::D3D12, 112> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRootShaderResourceView)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRootShaderResourceView
+	template<> struct MethodSignature<RenderType::D3D12, 113> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetComputeRootUnorderedAccessView)>::Type; }; // ID3D12GraphicsCommandList::SetComputeRootUnorderedAccessView
+	template<> struct MethodSignature<RenderType::D3D12, 114> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetGraphicsRootUnorderedAccessView)>::Type; }; // ID3D12GraphicsCommandList::SetGraphicsRootUnorderedAccessView
+	template<> struct MethodSignature<RenderType::D3D12, 115> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::IASetIndexBuffer)>::Type; }; // ID3D12GraphicsCommandList::IASetIndexBuffer
+	template<> struct MethodSignature<RenderType::D3D12, 116> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::IASetVertexBuffers)>::Type; }; // ID3D12GraphicsCommandList::IASetVertexBuffers
+	template<> struct MethodSignature<RenderType::D3D12, 117> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SOSetTargets)>::Type; }; // ID3D12GraphicsCommandList::SOSetTargets
+	template<> struct MethodSignature<RenderType::D3D12, 118> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::OMSetRenderTargets)>::Type; }; // ID3D12GraphicsCommandList::OMSetRenderTargets
+	template<> struct MethodSignature<RenderType::D3D12, 119> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ClearDepthStencilView)>::Type; }; // ID3D12GraphicsCommandList::ClearDepthStencilView
+	template<> struct MethodSignature<RenderType::D3D12, 120> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ClearRenderTargetView)>::Type; }; // ID3D12GraphicsCommandList::ClearRenderTargetView
+	template<> struct MethodSignature<RenderType::D3D12, 121> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ClearUnorderedAccessViewUint)>::Type; }; // ID3D12GraphicsCommandList::ClearUnorderedAccessViewUint
+	template<> struct MethodSignature<RenderType::D3D12, 122> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ClearUnorderedAccessViewFloat)>::Type; }; // ID3D12GraphicsCommandList::ClearUnorderedAccessViewFloat
+	template<> struct MethodSignature<RenderType::D3D12, 123> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::DiscardResource)>::Type; }; // ID3D12GraphicsCommandList::DiscardResource
+	template<> struct MethodSignature<RenderType::D3D12, 124> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::BeginQuery)>::Type; }; // ID3D12GraphicsCommandList::BeginQuery
+	template<> struct MethodSignature<RenderType::D3D12, 125> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::EndQuery)>::Type; }; // ID3D12GraphicsCommandList::EndQuery
+	template<> struct MethodSignature<RenderType::D3D12, 126> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ResolveQueryData)>::Type; }; // ID3D12GraphicsCommandList::ResolveQueryData
+	template<> struct MethodSignature<RenderType::D3D12, 127> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetPredication)>::Type; }; // ID3D12GraphicsCommandList::SetPredication
+	template<> struct MethodSignature<RenderType::D3D12, 128> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::SetMarker)>::Type; }; // ID3D12GraphicsCommandList::SetMarker
+	template<> struct MethodSignature<RenderType::D3D12, 129> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::BeginEvent)>::Type; }; // ID3D12GraphicsCommandList::BeginEvent
+	template<> struct MethodSignature<RenderType::D3D12, 130> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::EndEvent)>::Type; }; // ID3D12GraphicsCommandList::EndEvent
+	template<> struct MethodSignature<RenderType::D3D12, 131> { using Type = detail::ComMethod<::ID3D12GraphicsCommandList, decltype(&::ID3D12GraphicsCommandList::ExecuteIndirect)>::Type; }; // ID3D12GraphicsCommandList::ExecuteIndirect
+	template<> struct MethodSignature<RenderType::D3D12, 132> { using Type = HRESULT (STDMETHODCALLTYPE*)(::IDXGISwapChain*, REFIID, void**); }; // IDXGISwapChain::QueryInterface
+	template<> struct MethodSignature<RenderType::D3D12, 133> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::AddRef)>::Type; }; // IDXGISwapChain::AddRef
+	template<> struct MethodSignature<RenderType::D3D12, 134> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::Release)>::Type; }; // IDXGISwapChain::Release
+	template<> struct MethodSignature<RenderType::D3D12, 135> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetPrivateData)>::Type; }; // IDXGISwapChain::SetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 136> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetPrivateDataInterface)>::Type; }; // IDXGISwapChain::SetPrivateDataInterface
+	template<> struct MethodSignature<RenderType::D3D12, 137> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetPrivateData)>::Type; }; // IDXGISwapChain::GetPrivateData
+	template<> struct MethodSignature<RenderType::D3D12, 138> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetParent)>::Type; }; // IDXGISwapChain::GetParent
+	template<> struct MethodSignature<RenderType::D3D12, 139> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetDevice)>::Type; }; // IDXGISwapChain::GetDevice
+	template<> struct MethodSignature<RenderType::D3D12, 140> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::Present)>::Type; }; // IDXGISwapChain::Present
+	template<> struct MethodSignature<RenderType::D3D12, 141> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetBuffer)>::Type; }; // IDXGISwapChain::GetBuffer
+	template<> struct MethodSignature<RenderType::D3D12, 142> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::SetFullscreenState)>::Type; }; // IDXGISwapChain::SetFullscreenState
+	template<> struct MethodSignature<RenderType::D3D12, 143> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetFullscreenState)>::Type; }; // IDXGISwapChain::GetFullscreenState
+	template<> struct MethodSignature<RenderType::D3D12, 144> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetDesc)>::Type; }; // IDXGISwapChain::GetDesc
+	template<> struct MethodSignature<RenderType::D3D12, 145> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::ResizeBuffers)>::Type; }; // IDXGISwapChain::ResizeBuffers
+	template<> struct MethodSignature<RenderType::D3D12, 146> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::ResizeTarget)>::Type; }; // IDXGISwapChain::ResizeTarget
+	template<> struct MethodSignature<RenderType::D3D12, 147> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetContainingOutput)>::Type; }; // IDXGISwapChain::GetContainingOutput
+	template<> struct MethodSignature<RenderType::D3D12, 148> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetFrameStatistics)>::Type; }; // IDXGISwapChain::GetFrameStatistics
+	template<> struct MethodSignature<RenderType::D3D12, 149> { using Type = detail::ComMethod<::IDXGISwapChain, decltype(&::IDXGISwapChain::GetLastPresentCount)>::Type; }; // IDXGISwapChain::GetLastPresentCount
+}
+#endif
+
+#if KIERO_INCLUDE_OPENGL
+#ifdef _WIN32
+# include <Windows.h>
+# include <gl/GL.h>
+#else
+# include <GL/gl.h>
+
+struct _XDisplay;
+#endif
+
+namespace kiero
+{
+	template<> struct MethodSignature<RenderType::OpenGL, 0> { using Type = decltype(&::glAccum); };
+	template<> struct MethodSignature<RenderType::OpenGL, 1> { using Type = decltype(&::glAlphaFunc); };
+	template<> struct MethodSignature<RenderType::OpenGL, 2> { using Type = decltype(&::glAreTexturesResident); };
+	template<> struct MethodSignature<RenderType::OpenGL, 3> { using Type = decltype(&::glArrayElement); };
+	template<> struct MethodSignature<RenderType::OpenGL, 4> { using Type = decltype(&::glBegin); };
+	template<> struct MethodSignature<RenderType::OpenGL, 5> { using Type = decltype(&::glBindTexture); };
+	template<> struct MethodSignature<RenderType::OpenGL, 6> { using Type = decltype(&::glBitmap); };
+	template<> struct MethodSignature<RenderType::OpenGL, 7> { using Type = decltype(&::glBlendFunc); };
+	template<> struct MethodSignature<RenderType::OpenGL, 8> { using Type = decltype(&::glCallList); };
+	template<> struct MethodSignature<RenderType::OpenGL, 9> { using Type = decltype(&::glCallLists); };
+	template<> struct MethodSignature<RenderType::OpenGL, 10> { using Type = decltype(&::glClear); };
+	template<> struct MethodSignature<RenderType::OpenGL, 11> { using Type = decltype(&::glClearAccum); };
+	template<> struct MethodSignature<RenderType::OpenGL, 12> { using Type = decltype(&::glClearColor); };
+	template<> struct MethodSignature<RenderType::OpenGL, 13> { using Type = decltype(&::glClearDepth); };
+	template<> struct MethodSignature<RenderType::OpenGL, 14> { using Type = decltype(&::glClearIndex); };
+	template<> struct MethodSignature<RenderType::OpenGL, 15> { using Type = decltype(&::glClearStencil); };
+	template<> struct MethodSignature<RenderType::OpenGL, 16> { using Type = decltype(&::glClipPlane); };
+	template<> struct MethodSignature<RenderType::OpenGL, 17> { using Type = decltype(&::glColor3b); };
+	template<> struct MethodSignature<RenderType::OpenGL, 18> { using Type = decltype(&::glColor3bv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 19> { using Type = decltype(&::glColor3d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 20> { using Type = decltype(&::glColor3dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 21> { using Type = decltype(&::glColor3f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 22> { using Type = decltype(&::glColor3fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 23> { using Type = decltype(&::glColor3i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 24> { using Type = decltype(&::glColor3iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 25> { using Type = decltype(&::glColor3s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 26> { using Type = decltype(&::glColor3sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 27> { using Type = decltype(&::glColor3ub); };
+	template<> struct MethodSignature<RenderType::OpenGL, 28> { using Type = decltype(&::glColor3ubv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 29> { using Type = decltype(&::glColor3ui); };
+	template<> struct MethodSignature<RenderType::OpenGL, 30> { using Type = decltype(&::glColor3uiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 31> { using Type = decltype(&::glColor3us); };
+	template<> struct MethodSignature<RenderType::OpenGL, 32> { using Type = decltype(&::glColor3usv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 33> { using Type = decltype(&::glColor4b); };
+	template<> struct MethodSignature<RenderType::OpenGL, 34> { using Type = decltype(&::glColor4bv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 35> { using Type = decltype(&::glColor4d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 36> { using Type = decltype(&::glColor4dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 37> { using Type = decltype(&::glColor4f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 38> { using Type = decltype(&::glColor4fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 39> { using Type = decltype(&::glColor4i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 40> { using Type = decltype(&::glColor4iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 41> { using Type = decltype(&::glColor4s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 42> { using Type = decltype(&::glColor4sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 43> { using Type = decltype(&::glColor4ub); };
+	template<> struct MethodSignature<RenderType::OpenGL, 44> { using Type = decltype(&::glColor4ubv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 45> { using Type = decltype(&::glColor4ui); };
+	template<> struct MethodSignature<RenderType::OpenGL, 46> { using Type = decltype(&::glColor4uiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 47> { using Type = decltype(&::glColor4us); };
+	template<> struct MethodSignature<RenderType::OpenGL, 48> { using Type = decltype(&::glColor4usv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 49> { using Type = decltype(&::glColorMask); };
+	template<> struct MethodSignature<RenderType::OpenGL, 50> { using Type = decltype(&::glColorMaterial); };
+	template<> struct MethodSignature<RenderType::OpenGL, 51> { using Type = decltype(&::glColorPointer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 52> { using Type = decltype(&::glCopyPixels); };
+	template<> struct MethodSignature<RenderType::OpenGL, 53> { using Type = decltype(&::glCopyTexImage1D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 54> { using Type = decltype(&::glCopyTexImage2D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 55> { using Type = decltype(&::glCopyTexSubImage1D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 56> { using Type = decltype(&::glCopyTexSubImage2D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 57> { using Type = decltype(&::glCullFace); };
+	template<> struct MethodSignature<RenderType::OpenGL, 58> { using Type = decltype(&::glDeleteLists); };
+	template<> struct MethodSignature<RenderType::OpenGL, 59> { using Type = decltype(&::glDeleteTextures); };
+	template<> struct MethodSignature<RenderType::OpenGL, 60> { using Type = decltype(&::glDepthFunc); };
+	template<> struct MethodSignature<RenderType::OpenGL, 61> { using Type = decltype(&::glDepthMask); };
+	template<> struct MethodSignature<RenderType::OpenGL, 62> { using Type = decltype(&::glDepthRange); };
+	template<> struct MethodSignature<RenderType::OpenGL, 63> { using Type = decltype(&::glDisable); };
+	template<> struct MethodSignature<RenderType::OpenGL, 64> { using Type = decltype(&::glDisableClientState); };
+	template<> struct MethodSignature<RenderType::OpenGL, 65> { using Type = decltype(&::glDrawArrays); };
+	template<> struct MethodSignature<RenderType::OpenGL, 66> { using Type = decltype(&::glDrawBuffer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 67> { using Type = decltype(&::glDrawElements); };
+	template<> struct MethodSignature<RenderType::OpenGL, 68> { using Type = decltype(&::glDrawPixels); };
+	template<> struct MethodSignature<RenderType::OpenGL, 69> { using Type = decltype(&::glEdgeFlag); };
+	template<> struct MethodSignature<RenderType::OpenGL, 70> { using Type = decltype(&::glEdgeFlagPointer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 71> { using Type = decltype(&::glEdgeFlagv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 72> { using Type = decltype(&::glEnable); };
+	template<> struct MethodSignature<RenderType::OpenGL, 73> { using Type = decltype(&::glEnableClientState); };
+	template<> struct MethodSignature<RenderType::OpenGL, 74> { using Type = decltype(&::glEnd); };
+	template<> struct MethodSignature<RenderType::OpenGL, 75> { using Type = decltype(&::glEndList); };
+	template<> struct MethodSignature<RenderType::OpenGL, 76> { using Type = decltype(&::glEvalCoord1d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 77> { using Type = decltype(&::glEvalCoord1dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 78> { using Type = decltype(&::glEvalCoord1f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 79> { using Type = decltype(&::glEvalCoord1fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 80> { using Type = decltype(&::glEvalCoord2d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 81> { using Type = decltype(&::glEvalCoord2dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 82> { using Type = decltype(&::glEvalCoord2f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 83> { using Type = decltype(&::glEvalCoord2fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 84> { using Type = decltype(&::glEvalMesh1); };
+	template<> struct MethodSignature<RenderType::OpenGL, 85> { using Type = decltype(&::glEvalMesh2); };
+	template<> struct MethodSignature<RenderType::OpenGL, 86> { using Type = decltype(&::glEvalPoint1); };
+	template<> struct MethodSignature<RenderType::OpenGL, 87> { using Type = decltype(&::glEvalPoint2); };
+	template<> struct MethodSignature<RenderType::OpenGL, 88> { using Type = decltype(&::glFeedbackBuffer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 89> { using Type = decltype(&::glFinish); };
+	template<> struct MethodSignature<RenderType::OpenGL, 90> { using Type = decltype(&::glFlush); };
+	template<> struct MethodSignature<RenderType::OpenGL, 91> { using Type = decltype(&::glFogf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 92> { using Type = decltype(&::glFogfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 93> { using Type = decltype(&::glFogi); };
+	template<> struct MethodSignature<RenderType::OpenGL, 94> { using Type = decltype(&::glFogiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 95> { using Type = decltype(&::glFrontFace); };
+	template<> struct MethodSignature<RenderType::OpenGL, 96> { using Type = decltype(&::glFrustum); };
+	template<> struct MethodSignature<RenderType::OpenGL, 97> { using Type = decltype(&::glGenLists); };
+	template<> struct MethodSignature<RenderType::OpenGL, 98> { using Type = decltype(&::glGenTextures); };
+	template<> struct MethodSignature<RenderType::OpenGL, 99> { using Type = decltype(&::glGetBooleanv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 100> { using Type = decltype(&::glGetClipPlane); };
+	template<> struct MethodSignature<RenderType::OpenGL, 101> { using Type = decltype(&::glGetDoublev); };
+	template<> struct MethodSignature<RenderType::OpenGL, 102> { using Type = decltype(&::glGetError); };
+	template<> struct MethodSignature<RenderType::OpenGL, 103> { using Type = decltype(&::glGetFloatv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 104> { using Type = decltype(&::glGetIntegerv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 105> { using Type = decltype(&::glGetLightfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 106> { using Type = decltype(&::glGetLightiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 107> { using Type = decltype(&::glGetMapdv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 108> { using Type = decltype(&::glGetMapfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 109> { using Type = decltype(&::glGetMapiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 110> { using Type = decltype(&::glGetMaterialfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 111> { using Type = decltype(&::glGetMaterialiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 112> { using Type = decltype(&::glGetPixelMapfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 113> { using Type = decltype(&::glGetPixelMapuiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 114> { using Type = decltype(&::glGetPixelMapusv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 115> { using Type = decltype(&::glGetPointerv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 116> { using Type = decltype(&::glGetPolygonStipple); };
+	template<> struct MethodSignature<RenderType::OpenGL, 117> { using Type = decltype(&::glGetString); };
+	template<> struct MethodSignature<RenderType::OpenGL, 118> { using Type = decltype(&::glGetTexEnvfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 119> { using Type = decltype(&::glGetTexEnviv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 120> { using Type = decltype(&::glGetTexGendv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 121> { using Type = decltype(&::glGetTexGenfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 122> { using Type = decltype(&::glGetTexGeniv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 123> { using Type = decltype(&::glGetTexImage); };
+	template<> struct MethodSignature<RenderType::OpenGL, 124> { using Type = decltype(&::glGetTexLevelParameterfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 125> { using Type = decltype(&::glGetTexLevelParameteriv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 126> { using Type = decltype(&::glGetTexParameterfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 127> { using Type = decltype(&::glGetTexParameteriv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 128> { using Type = decltype(&::glHint); };
+	template<> struct MethodSignature<RenderType::OpenGL, 129> { using Type = decltype(&::glIndexMask); };
+	template<> struct MethodSignature<RenderType::OpenGL, 130> { using Type = decltype(&::glIndexPointer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 131> { using Type = decltype(&::glIndexd); };
+	template<> struct MethodSignature<RenderType::OpenGL, 132> { using Type = decltype(&::glIndexdv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 133> { using Type = decltype(&::glIndexf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 134> { using Type = decltype(&::glIndexfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 135> { using Type = decltype(&::glIndexi); };
+	template<> struct MethodSignature<RenderType::OpenGL, 136> { using Type = decltype(&::glIndexiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 137> { using Type = decltype(&::glIndexs); };
+	template<> struct MethodSignature<RenderType::OpenGL, 138> { using Type = decltype(&::glIndexsv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 139> { using Type = decltype(&::glIndexub); };
+	template<> struct MethodSignature<RenderType::OpenGL, 140> { using Type = decltype(&::glIndexubv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 141> { using Type = decltype(&::glInitNames); };
+	template<> struct MethodSignature<RenderType::OpenGL, 142> { using Type = decltype(&::glInterleavedArrays); };
+	template<> struct MethodSignature<RenderType::OpenGL, 143> { using Type = decltype(&::glIsEnabled); };
+	template<> struct MethodSignature<RenderType::OpenGL, 144> { using Type = decltype(&::glIsList); };
+	template<> struct MethodSignature<RenderType::OpenGL, 145> { using Type = decltype(&::glIsTexture); };
+	template<> struct MethodSignature<RenderType::OpenGL, 146> { using Type = decltype(&::glLightModelf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 147> { using Type = decltype(&::glLightModelfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 148> { using Type = decltype(&::glLightModeli); };
+	template<> struct MethodSignature<RenderType::OpenGL, 149> { using Type = decltype(&::glLightModeliv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 150> { using Type = decltype(&::glLightf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 151> { using Type = decltype(&::glLightfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 152> { using Type = decltype(&::glLighti); };
+	template<> struct MethodSignature<RenderType::OpenGL, 153> { using Type = decltype(&::glLightiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 154> { using Type = decltype(&::glLineStipple); };
+	template<> struct MethodSignature<RenderType::OpenGL, 155> { using Type = decltype(&::glLineWidth); };
+	template<> struct MethodSignature<RenderType::OpenGL, 156> { using Type = decltype(&::glListBase); };
+	template<> struct MethodSignature<RenderType::OpenGL, 157> { using Type = decltype(&::glLoadIdentity); };
+	template<> struct MethodSignature<RenderType::OpenGL, 158> { using Type = decltype(&::glLoadMatrixd); };
+	template<> struct MethodSignature<RenderType::OpenGL, 159> { using Type = decltype(&::glLoadMatrixf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 160> { using Type = decltype(&::glLoadName); };
+	template<> struct MethodSignature<RenderType::OpenGL, 161> { using Type = decltype(&::glLogicOp); };
+	template<> struct MethodSignature<RenderType::OpenGL, 162> { using Type = decltype(&::glMap1d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 163> { using Type = decltype(&::glMap1f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 164> { using Type = decltype(&::glMap2d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 165> { using Type = decltype(&::glMap2f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 166> { using Type = decltype(&::glMapGrid1d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 167> { using Type = decltype(&::glMapGrid1f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 168> { using Type = decltype(&::glMapGrid2d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 169> { using Type = decltype(&::glMapGrid2f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 170> { using Type = decltype(&::glMaterialf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 171> { using Type = decltype(&::glMaterialfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 172> { using Type = decltype(&::glMateriali); };
+	template<> struct MethodSignature<RenderType::OpenGL, 173> { using Type = decltype(&::glMaterialiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 174> { using Type = decltype(&::glMatrixMode); };
+	template<> struct MethodSignature<RenderType::OpenGL, 175> { using Type = decltype(&::glMultMatrixd); };
+	template<> struct MethodSignature<RenderType::OpenGL, 176> { using Type = decltype(&::glMultMatrixf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 177> { using Type = decltype(&::glNewList); };
+	template<> struct MethodSignature<RenderType::OpenGL, 178> { using Type = decltype(&::glNormal3b); };
+	template<> struct MethodSignature<RenderType::OpenGL, 179> { using Type = decltype(&::glNormal3bv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 180> { using Type = decltype(&::glNormal3d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 181> { using Type = decltype(&::glNormal3dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 182> { using Type = decltype(&::glNormal3f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 183> { using Type = decltype(&::glNormal3fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 184> { using Type = decltype(&::glNormal3i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 185> { using Type = decltype(&::glNormal3iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 186> { using Type = decltype(&::glNormal3s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 187> { using Type = decltype(&::glNormal3sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 188> { using Type = decltype(&::glNormalPointer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 189> { using Type = decltype(&::glOrtho); };
+	template<> struct MethodSignature<RenderType::OpenGL, 190> { using Type = decltype(&::glPassThrough); };
+	template<> struct MethodSignature<RenderType::OpenGL, 191> { using Type = decltype(&::glPixelMapfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 192> { using Type = decltype(&::glPixelMapuiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 193> { using Type = decltype(&::glPixelMapusv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 194> { using Type = decltype(&::glPixelStoref); };
+	template<> struct MethodSignature<RenderType::OpenGL, 195> { using Type = decltype(&::glPixelStorei); };
+	template<> struct MethodSignature<RenderType::OpenGL, 196> { using Type = decltype(&::glPixelTransferf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 197> { using Type = decltype(&::glPixelTransferi); };
+	template<> struct MethodSignature<RenderType::OpenGL, 198> { using Type = decltype(&::glPixelZoom); };
+	template<> struct MethodSignature<RenderType::OpenGL, 199> { using Type = decltype(&::glPointSize); };
+	template<> struct MethodSignature<RenderType::OpenGL, 200> { using Type = decltype(&::glPolygonMode); };
+	template<> struct MethodSignature<RenderType::OpenGL, 201> { using Type = decltype(&::glPolygonOffset); };
+	template<> struct MethodSignature<RenderType::OpenGL, 202> { using Type = decltype(&::glPolygonStipple); };
+	template<> struct MethodSignature<RenderType::OpenGL, 203> { using Type = decltype(&::glPopAttrib); };
+	template<> struct MethodSignature<RenderType::OpenGL, 204> { using Type = decltype(&::glPopClientAttrib); };
+	template<> struct MethodSignature<RenderType::OpenGL, 205> { using Type = decltype(&::glPopMatrix); };
+	template<> struct MethodSignature<RenderType::OpenGL, 206> { using Type = decltype(&::glPopName); };
+	template<> struct MethodSignature<RenderType::OpenGL, 207> { using Type = decltype(&::glPrioritizeTextures); };
+	template<> struct MethodSignature<RenderType::OpenGL, 208> { using Type = decltype(&::glPushAttrib); };
+	template<> struct MethodSignature<RenderType::OpenGL, 209> { using Type = decltype(&::glPushClientAttrib); };
+	template<> struct MethodSignature<RenderType::OpenGL, 210> { using Type = decltype(&::glPushMatrix); };
+	template<> struct MethodSignature<RenderType::OpenGL, 211> { using Type = decltype(&::glPushName); };
+	template<> struct MethodSignature<RenderType::OpenGL, 212> { using Type = decltype(&::glRasterPos2d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 213> { using Type = decltype(&::glRasterPos2dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 214> { using Type = decltype(&::glRasterPos2f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 215> { using Type = decltype(&::glRasterPos2fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 216> { using Type = decltype(&::glRasterPos2i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 217> { using Type = decltype(&::glRasterPos2iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 218> { using Type = decltype(&::glRasterPos2s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 219> { using Type = decltype(&::glRasterPos2sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 220> { using Type = decltype(&::glRasterPos3d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 221> { using Type = decltype(&::glRasterPos3dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 222> { using Type = decltype(&::glRasterPos3f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 223> { using Type = decltype(&::glRasterPos3fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 224> { using Type = decltype(&::glRasterPos3i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 225> { using Type = decltype(&::glRasterPos3iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 226> { using Type = decltype(&::glRasterPos3s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 227> { using Type = decltype(&::glRasterPos3sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 228> { using Type = decltype(&::glRasterPos4d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 229> { using Type = decltype(&::glRasterPos4dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 230> { using Type = decltype(&::glRasterPos4f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 231> { using Type = decltype(&::glRasterPos4fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 232> { using Type = decltype(&::glRasterPos4i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 233> { using Type = decltype(&::glRasterPos4iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 234> { using Type = decltype(&::glRasterPos4s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 235> { using Type = decltype(&::glRasterPos4sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 236> { using Type = decltype(&::glReadBuffer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 237> { using Type = decltype(&::glReadPixels); };
+	template<> struct MethodSignature<RenderType::OpenGL, 238> { using Type = decltype(&::glRectd); };
+	template<> struct MethodSignature<RenderType::OpenGL, 239> { using Type = decltype(&::glRectdv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 240> { using Type = decltype(&::glRectf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 241> { using Type = decltype(&::glRectfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 242> { using Type = decltype(&::glRecti); };
+	template<> struct MethodSignature<RenderType::OpenGL, 243> { using Type = decltype(&::glRectiv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 244> { using Type = decltype(&::glRects); };
+	template<> struct MethodSignature<RenderType::OpenGL, 245> { using Type = decltype(&::glRectsv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 246> { using Type = decltype(&::glRenderMode); };
+	template<> struct MethodSignature<RenderType::OpenGL, 247> { using Type = decltype(&::glRotated); };
+	template<> struct MethodSignature<RenderType::OpenGL, 248> { using Type = decltype(&::glRotatef); };
+	template<> struct MethodSignature<RenderType::OpenGL, 249> { using Type = decltype(&::glScaled); };
+	template<> struct MethodSignature<RenderType::OpenGL, 250> { using Type = decltype(&::glScalef); };
+	template<> struct MethodSignature<RenderType::OpenGL, 251> { using Type = decltype(&::glScissor); };
+	template<> struct MethodSignature<RenderType::OpenGL, 252> { using Type = decltype(&::glSelectBuffer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 253> { using Type = decltype(&::glShadeModel); };
+	template<> struct MethodSignature<RenderType::OpenGL, 254> { using Type = decltype(&::glStencilFunc); };
+	template<> struct MethodSignature<RenderType::OpenGL, 255> { using Type = decltype(&::glStencilMask); };
+	template<> struct MethodSignature<RenderType::OpenGL, 256> { using Type = decltype(&::glStencilOp); };
+	template<> struct MethodSignature<RenderType::OpenGL, 257> { using Type = decltype(&::glTexCoord1d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 258> { using Type = decltype(&::glTexCoord1dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 259> { using Type = decltype(&::glTexCoord1f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 260> { using Type = decltype(&::glTexCoord1fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 261> { using Type = decltype(&::glTexCoord1i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 262> { using Type = decltype(&::glTexCoord1iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 263> { using Type = decltype(&::glTexCoord1s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 264> { using Type = decltype(&::glTexCoord1sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 265> { using Type = decltype(&::glTexCoord2d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 266> { using Type = decltype(&::glTexCoord2dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 267> { using Type = decltype(&::glTexCoord2f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 268> { using Type = decltype(&::glTexCoord2fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 269> { using Type = decltype(&::glTexCoord2i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 270> { using Type = decltype(&::glTexCoord2iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 271> { using Type = decltype(&::glTexCoord2s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 272> { using Type = decltype(&::glTexCoord2sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 273> { using Type = decltype(&::glTexCoord3d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 274> { using Type = decltype(&::glTexCoord3dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 275> { using Type = decltype(&::glTexCoord3f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 276> { using Type = decltype(&::glTexCoord3fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 277> { using Type = decltype(&::glTexCoord3i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 278> { using Type = decltype(&::glTexCoord3iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 279> { using Type = decltype(&::glTexCoord3s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 280> { using Type = decltype(&::glTexCoord3sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 281> { using Type = decltype(&::glTexCoord4d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 282> { using Type = decltype(&::glTexCoord4dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 283> { using Type = decltype(&::glTexCoord4f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 284> { using Type = decltype(&::glTexCoord4fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 285> { using Type = decltype(&::glTexCoord4i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 286> { using Type = decltype(&::glTexCoord4iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 287> { using Type = decltype(&::glTexCoord4s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 288> { using Type = decltype(&::glTexCoord4sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 289> { using Type = decltype(&::glTexCoordPointer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 290> { using Type = decltype(&::glTexEnvf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 291> { using Type = decltype(&::glTexEnvfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 292> { using Type = decltype(&::glTexEnvi); };
+	template<> struct MethodSignature<RenderType::OpenGL, 293> { using Type = decltype(&::glTexEnviv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 294> { using Type = decltype(&::glTexGend); };
+	template<> struct MethodSignature<RenderType::OpenGL, 295> { using Type = decltype(&::glTexGendv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 296> { using Type = decltype(&::glTexGenf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 297> { using Type = decltype(&::glTexGenfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 298> { using Type = decltype(&::glTexGeni); };
+	template<> struct MethodSignature<RenderType::OpenGL, 299> { using Type = decltype(&::glTexGeniv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 300> { using Type = decltype(&::glTexImage1D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 301> { using Type = decltype(&::glTexImage2D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 302> { using Type = decltype(&::glTexParameterf); };
+	template<> struct MethodSignature<RenderType::OpenGL, 303> { using Type = decltype(&::glTexParameterfv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 304> { using Type = decltype(&::glTexParameteri); };
+	template<> struct MethodSignature<RenderType::OpenGL, 305> { using Type = decltype(&::glTexParameteriv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 306> { using Type = decltype(&::glTexSubImage1D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 307> { using Type = decltype(&::glTexSubImage2D); };
+	template<> struct MethodSignature<RenderType::OpenGL, 308> { using Type = decltype(&::glTranslated); };
+	template<> struct MethodSignature<RenderType::OpenGL, 309> { using Type = decltype(&::glTranslatef); };
+	template<> struct MethodSignature<RenderType::OpenGL, 310> { using Type = decltype(&::glVertex2d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 311> { using Type = decltype(&::glVertex2dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 312> { using Type = decltype(&::glVertex2f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 313> { using Type = decltype(&::glVertex2fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 314> { using Type = decltype(&::glVertex2i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 315> { using Type = decltype(&::glVertex2iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 316> { using Type = decltype(&::glVertex2s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 317> { using Type = decltype(&::glVertex2sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 318> { using Type = decltype(&::glVertex3d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 319> { using Type = decltype(&::glVertex3dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 320> { using Type = decltype(&::glVertex3f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 321> { using Type = decltype(&::glVertex3fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 322> { using Type = decltype(&::glVertex3i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 323> { using Type = decltype(&::glVertex3iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 324> { using Type = decltype(&::glVertex3s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 325> { using Type = decltype(&::glVertex3sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 326> { using Type = decltype(&::glVertex4d); };
+	template<> struct MethodSignature<RenderType::OpenGL, 327> { using Type = decltype(&::glVertex4dv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 328> { using Type = decltype(&::glVertex4f); };
+	template<> struct MethodSignature<RenderType::OpenGL, 329> { using Type = decltype(&::glVertex4fv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 330> { using Type = decltype(&::glVertex4i); };
+	template<> struct MethodSignature<RenderType::OpenGL, 331> { using Type = decltype(&::glVertex4iv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 332> { using Type = decltype(&::glVertex4s); };
+	template<> struct MethodSignature<RenderType::OpenGL, 333> { using Type = decltype(&::glVertex4sv); };
+	template<> struct MethodSignature<RenderType::OpenGL, 334> { using Type = decltype(&::glVertexPointer); };
+	template<> struct MethodSignature<RenderType::OpenGL, 335> { using Type = decltype(&::glViewport); };
+#ifdef _WIN32
+	template<> struct MethodSignature<RenderType::OpenGL, 336> { using Type = BOOL (WINAPI*)(HDC); }; // wglSwapBuffers
+#else
+	template<> struct MethodSignature<RenderType::OpenGL, 336> { using Type = void (*)(::_XDisplay*, unsigned long); }; // glXSwapBuffers
+#endif
+#ifdef _WIN32
+	template<> struct MethodSignature<RenderType::OpenGL, 337> { using Type = unsigned int (__stdcall*)(void*, void*); }; // eglSwapBuffers
+#else
+	template<> struct MethodSignature<RenderType::OpenGL, 337> { using Type = unsigned int (*)(void*, void*); }; // eglSwapBuffers
+#endif
+}
+#endif
+
+#if KIERO_INCLUDE_VULKAN
+# include <vulkan/vulkan.h>
+
+namespace kiero
+{
+	template<> struct MethodSignature<RenderType::Vulkan, 0> { using Type = PFN_vkCreateInstance; };
+	template<> struct MethodSignature<RenderType::Vulkan, 1> { using Type = PFN_vkDestroyInstance; };
+	template<> struct MethodSignature<RenderType::Vulkan, 2> { using Type = PFN_vkEnumeratePhysicalDevices; };
+	template<> struct MethodSignature<RenderType::Vulkan, 3> { using Type = PFN_vkGetPhysicalDeviceFeatures; };
+	template<> struct MethodSignature<RenderType::Vulkan, 4> { using Type = PFN_vkGetPhysicalDeviceFormatProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 5> { using Type = PFN_vkGetPhysicalDeviceImageFormatProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 6> { using Type = PFN_vkGetPhysicalDeviceProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 7> { using Type = PFN_vkGetPhysicalDeviceQueueFamilyProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 8> { using Type = PFN_vkGetPhysicalDeviceMemoryProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 9> { using Type = PFN_vkGetInstanceProcAddr; };
+	template<> struct MethodSignature<RenderType::Vulkan, 10> { using Type = PFN_vkGetDeviceProcAddr; };
+	template<> struct MethodSignature<RenderType::Vulkan, 11> { using Type = PFN_vkCreateDevice; };
+	template<> struct MethodSignature<RenderType::Vulkan, 12> { using Type = PFN_vkDestroyDevice; };
+	template<> struct MethodSignature<RenderType::Vulkan, 13> { using Type = PFN_vkEnumerateInstanceExtensionProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 14> { using Type = PFN_vkEnumerateDeviceExtensionProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 15> { using Type = PFN_vkEnumerateDeviceLayerProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 16> { using Type = PFN_vkGetDeviceQueue; };
+	template<> struct MethodSignature<RenderType::Vulkan, 17> { using Type = PFN_vkQueueSubmit; };
+	template<> struct MethodSignature<RenderType::Vulkan, 18> { using Type = PFN_vkQueueWaitIdle; };
+	template<> struct MethodSignature<RenderType::Vulkan, 19> { using Type = PFN_vkDeviceWaitIdle; };
+	template<> struct MethodSignature<RenderType::Vulkan, 20> { using Type = PFN_vkAllocateMemory; };
+	template<> struct MethodSignature<RenderType::Vulkan, 21> { using Type = PFN_vkFreeMemory; };
+	template<> struct MethodSignature<RenderType::Vulkan, 22> { using Type = PFN_vkMapMemory; };
+	template<> struct MethodSignature<RenderType::Vulkan, 23> { using Type = PFN_vkUnmapMemory; };
+	template<> struct MethodSignature<RenderType::Vulkan, 24> { using Type = PFN_vkFlushMappedMemoryRanges; };
+	template<> struct MethodSignature<RenderType::Vulkan, 25> { using Type = PFN_vkInvalidateMappedMemoryRanges; };
+	template<> struct MethodSignature<RenderType::Vulkan, 26> { using Type = PFN_vkGetDeviceMemoryCommitment; };
+	template<> struct MethodSignature<RenderType::Vulkan, 27> { using Type = PFN_vkBindBufferMemory; };
+	template<> struct MethodSignature<RenderType::Vulkan, 28> { using Type = PFN_vkBindImageMemory; };
+	template<> struct MethodSignature<RenderType::Vulkan, 29> { using Type = PFN_vkGetBufferMemoryRequirements; };
+	template<> struct MethodSignature<RenderType::Vulkan, 30> { using Type = PFN_vkGetImageMemoryRequirements; };
+	template<> struct MethodSignature<RenderType::Vulkan, 31> { using Type = PFN_vkGetImageSparseMemoryRequirements; };
+	template<> struct MethodSignature<RenderType::Vulkan, 32> { using Type = PFN_vkGetPhysicalDeviceSparseImageFormatProperties; };
+	template<> struct MethodSignature<RenderType::Vulkan, 33> { using Type = PFN_vkQueueBindSparse; };
+	template<> struct MethodSignature<RenderType::Vulkan, 34> { using Type = PFN_vkCreateFence; };
+	template<> struct MethodSignature<RenderType::Vulkan, 35> { using Type = PFN_vkDestroyFence; };
+	template<> struct MethodSignature<RenderType::Vulkan, 36> { using Type = PFN_vkResetFences; };
+	template<> struct MethodSignature<RenderType::Vulkan, 37> { using Type = PFN_vkGetFenceStatus; };
+	template<> struct MethodSignature<RenderType::Vulkan, 38> { using Type = PFN_vkWaitForFences; };
+	template<> struct MethodSignature<RenderType::Vulkan, 39> { using Type = PFN_vkCreateSemaphore; };
+	template<> struct MethodSignature<RenderType::Vulkan, 40> { using Type = PFN_vkDestroySemaphore; };
+	template<> struct MethodSignature<RenderType::Vulkan, 41> { using Type = PFN_vkCreateEvent; };
+	template<> struct MethodSignature<RenderType::Vulkan, 42> { using Type = PFN_vkDestroyEvent; };
+	template<> struct MethodSignature<RenderType::Vulkan, 43> { using Type = PFN_vkGetEventStatus; };
+	template<> struct MethodSignature<RenderType::Vulkan, 44> { using Type = PFN_vkSetEvent; };
+	template<> struct MethodSignature<RenderType::Vulkan, 45> { using Type = PFN_vkResetEvent; };
+	template<> struct MethodSignature<RenderType::Vulkan, 46> { using Type = PFN_vkCreateQueryPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 47> { using Type = PFN_vkDestroyQueryPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 48> { using Type = PFN_vkGetQueryPoolResults; };
+	template<> struct MethodSignature<RenderType::Vulkan, 49> { using Type = PFN_vkCreateBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 50> { using Type = PFN_vkDestroyBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 51> { using Type = PFN_vkCreateBufferView; };
+	template<> struct MethodSignature<RenderType::Vulkan, 52> { using Type = PFN_vkDestroyBufferView; };
+	template<> struct MethodSignature<RenderType::Vulkan, 53> { using Type = PFN_vkCreateImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 54> { using Type = PFN_vkDestroyImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 55> { using Type = PFN_vkGetImageSubresourceLayout; };
+	template<> struct MethodSignature<RenderType::Vulkan, 56> { using Type = PFN_vkCreateImageView; };
+	template<> struct MethodSignature<RenderType::Vulkan, 57> { using Type = PFN_vkDestroyImageView; };
+	template<> struct MethodSignature<RenderType::Vulkan, 58> { using Type = PFN_vkCreateShaderModule; };
+	template<> struct MethodSignature<RenderType::Vulkan, 59> { using Type = PFN_vkDestroyShaderModule; };
+	template<> struct MethodSignature<RenderType::Vulkan, 60> { using Type = PFN_vkCreatePipelineCache; };
+	template<> struct MethodSignature<RenderType::Vulkan, 61> { using Type = PFN_vkDestroyPipelineCache; };
+	template<> struct MethodSignature<RenderType::Vulkan, 62> { using Type = PFN_vkGetPipelineCacheData; };
+	template<> struct MethodSignature<RenderType::Vulkan, 63> { using Type = PFN_vkMergePipelineCaches; };
+	template<> struct MethodSignature<RenderType::Vulkan, 64> { using Type = PFN_vkCreateGraphicsPipelines; };
+	template<> struct MethodSignature<RenderType::Vulkan, 65> { using Type = PFN_vkCreateComputePipelines; };
+	template<> struct MethodSignature<RenderType::Vulkan, 66> { using Type = PFN_vkDestroyPipeline; };
+	template<> struct MethodSignature<RenderType::Vulkan, 67> { using Type = PFN_vkCreatePipelineLayout; };
+	template<> struct MethodSignature<RenderType::Vulkan, 68> { using Type = PFN_vkDestroyPipelineLayout; };
+	template<> struct MethodSignature<RenderType::Vulkan, 69> { using Type = PFN_vkCreateSampler; };
+	template<> struct MethodSignature<RenderType::Vulkan, 70> { using Type = PFN_vkDestroySampler; };
+	template<> struct MethodSignature<RenderType::Vulkan, 71> { using Type = PFN_vkCreateDescriptorSetLayout; };
+	template<> struct MethodSignature<RenderType::Vulkan, 72> { using Type = PFN_vkDestroyDescriptorSetLayout; };
+	template<> struct MethodSignature<RenderType::Vulkan, 73> { using Type = PFN_vkCreateDescriptorPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 74> { using Type = PFN_vkDestroyDescriptorPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 75> { using Type = PFN_vkResetDescriptorPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 76> { using Type = PFN_vkAllocateDescriptorSets; };
+	template<> struct MethodSignature<RenderType::Vulkan, 77> { using Type = PFN_vkFreeDescriptorSets; };
+	template<> struct MethodSignature<RenderType::Vulkan, 78> { using Type = PFN_vkUpdateDescriptorSets; };
+	template<> struct MethodSignature<RenderType::Vulkan, 79> { using Type = PFN_vkCreateFramebuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 80> { using Type = PFN_vkDestroyFramebuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 81> { using Type = PFN_vkCreateRenderPass; };
+	template<> struct MethodSignature<RenderType::Vulkan, 82> { using Type = PFN_vkDestroyRenderPass; };
+	template<> struct MethodSignature<RenderType::Vulkan, 83> { using Type = PFN_vkGetRenderAreaGranularity; };
+	template<> struct MethodSignature<RenderType::Vulkan, 84> { using Type = PFN_vkCreateCommandPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 85> { using Type = PFN_vkDestroyCommandPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 86> { using Type = PFN_vkResetCommandPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 87> { using Type = PFN_vkAllocateCommandBuffers; };
+	template<> struct MethodSignature<RenderType::Vulkan, 88> { using Type = PFN_vkFreeCommandBuffers; };
+	template<> struct MethodSignature<RenderType::Vulkan, 89> { using Type = PFN_vkBeginCommandBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 90> { using Type = PFN_vkEndCommandBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 91> { using Type = PFN_vkResetCommandBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 92> { using Type = PFN_vkCmdBindPipeline; };
+	template<> struct MethodSignature<RenderType::Vulkan, 93> { using Type = PFN_vkCmdSetViewport; };
+	template<> struct MethodSignature<RenderType::Vulkan, 94> { using Type = PFN_vkCmdSetScissor; };
+	template<> struct MethodSignature<RenderType::Vulkan, 95> { using Type = PFN_vkCmdSetLineWidth; };
+	template<> struct MethodSignature<RenderType::Vulkan, 96> { using Type = PFN_vkCmdSetDepthBias; };
+	template<> struct MethodSignature<RenderType::Vulkan, 97> { using Type = PFN_vkCmdSetBlendConstants; };
+	template<> struct MethodSignature<RenderType::Vulkan, 98> { using Type = PFN_vkCmdSetDepthBounds; };
+	template<> struct MethodSignature<RenderType::Vulkan, 99> { using Type = PFN_vkCmdSetStencilCompareMask; };
+	template<> struct MethodSignature<RenderType::Vulkan, 100> { using Type = PFN_vkCmdSetStencilWriteMask; };
+	template<> struct MethodSignature<RenderType::Vulkan, 101> { using Type = PFN_vkCmdSetStencilReference; };
+	template<> struct MethodSignature<RenderType::Vulkan, 102> { using Type = PFN_vkCmdBindDescriptorSets; };
+	template<> struct MethodSignature<RenderType::Vulkan, 103> { using Type = PFN_vkCmdBindIndexBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 104> { using Type = PFN_vkCmdBindVertexBuffers; };
+	template<> struct MethodSignature<RenderType::Vulkan, 105> { using Type = PFN_vkCmdDraw; };
+	template<> struct MethodSignature<RenderType::Vulkan, 106> { using Type = PFN_vkCmdDrawIndexed; };
+	template<> struct MethodSignature<RenderType::Vulkan, 107> { using Type = PFN_vkCmdDrawIndirect; };
+	template<> struct MethodSignature<RenderType::Vulkan, 108> { using Type = PFN_vkCmdDrawIndexedIndirect; };
+	template<> struct MethodSignature<RenderType::Vulkan, 109> { using Type = PFN_vkCmdDispatch; };
+	template<> struct MethodSignature<RenderType::Vulkan, 110> { using Type = PFN_vkCmdDispatchIndirect; };
+	template<> struct MethodSignature<RenderType::Vulkan, 111> { using Type = PFN_vkCmdCopyBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 112> { using Type = PFN_vkCmdCopyImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 113> { using Type = PFN_vkCmdBlitImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 114> { using Type = PFN_vkCmdCopyBufferToImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 115> { using Type = PFN_vkCmdCopyImageToBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 116> { using Type = PFN_vkCmdUpdateBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 117> { using Type = PFN_vkCmdFillBuffer; };
+	template<> struct MethodSignature<RenderType::Vulkan, 118> { using Type = PFN_vkCmdClearColorImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 119> { using Type = PFN_vkCmdClearDepthStencilImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 120> { using Type = PFN_vkCmdClearAttachments; };
+	template<> struct MethodSignature<RenderType::Vulkan, 121> { using Type = PFN_vkCmdResolveImage; };
+	template<> struct MethodSignature<RenderType::Vulkan, 122> { using Type = PFN_vkCmdSetEvent; };
+	template<> struct MethodSignature<RenderType::Vulkan, 123> { using Type = PFN_vkCmdResetEvent; };
+	template<> struct MethodSignature<RenderType::Vulkan, 124> { using Type = PFN_vkCmdWaitEvents; };
+	template<> struct MethodSignature<RenderType::Vulkan, 125> { using Type = PFN_vkCmdPipelineBarrier; };
+	template<> struct MethodSignature<RenderType::Vulkan, 126> { using Type = PFN_vkCmdBeginQuery; };
+	template<> struct MethodSignature<RenderType::Vulkan, 127> { using Type = PFN_vkCmdEndQuery; };
+	template<> struct MethodSignature<RenderType::Vulkan, 128> { using Type = PFN_vkCmdResetQueryPool; };
+	template<> struct MethodSignature<RenderType::Vulkan, 129> { using Type = PFN_vkCmdWriteTimestamp; };
+	template<> struct MethodSignature<RenderType::Vulkan, 130> { using Type = PFN_vkCmdCopyQueryPoolResults; };
+	template<> struct MethodSignature<RenderType::Vulkan, 131> { using Type = PFN_vkCmdPushConstants; };
+	template<> struct MethodSignature<RenderType::Vulkan, 132> { using Type = PFN_vkCmdBeginRenderPass; };
+	template<> struct MethodSignature<RenderType::Vulkan, 133> { using Type = PFN_vkCmdNextSubpass; };
+	template<> struct MethodSignature<RenderType::Vulkan, 134> { using Type = PFN_vkCmdEndRenderPass; };
+	template<> struct MethodSignature<RenderType::Vulkan, 135> { using Type = PFN_vkCmdExecuteCommands; };
+	template<> struct MethodSignature<RenderType::Vulkan, 136> { using Type = PFN_vkQueuePresentKHR; };
+}
+#endif
@@ -0,0 +1,114 @@
+#include "kiero_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace kiero
+{
+
+namespace
+{
+
+// Each slot holds the low 32 bits of its interval's sequence number above the interval in
+// nanoseconds, so readers can skip slots that were claimed but not written yet or were
+// overwritten while they copied the ring
+::std::atomic<::std::uint64_t> g_intervals[FrameStatsCapacity];
+::std::atomic<::std::uint64_t> g_recorded { 0 };
+::std::atomic<::std::uint64_t> g_resetAt { 0 };
+
+thread_local ::std::int64_t g_lastPresent = 0;
+
+// Nearest rank
+[[nodiscard]] double percentile(const ::std::uint32_t* const sorted, const ::std::uint32_t count, const double fraction) noexcept
+{
+    ::std::uint32_t rank = static_cast<::std::uint32_t>(fraction * count + 0.999999);
+    rank = rank == 0 ? 1 : rank > count ? count : rank;
+
+    return sorted[rank - 1] / 1e6;
+}
+
+}
+
+bool getFrameStats(FrameStats& stats)
+{
+    const ::std::uint64_t end = g_recorded.load(::std::memory_order_acquire);
+    const ::std::uint64_t resetAt = g_resetAt.load(::std::memory_order_relaxed);
+    const ::std::uint64_t begin = ::std::max(resetAt, end > FrameStatsCapacity ? end - FrameStatsCapacity : 0);
+
+    ::std::uint32_t intervals[FrameStatsCapacity];
+    ::std::uint32_t count = 0;
+
+    for(::std::uint64_t sequence = begin; sequence < end; ++sequence)
+    {
+        const ::std::uint64_t slot = g_intervals[sequence % FrameStatsCapacity].load(::std::memory_order_relaxed);
+
+        if(static_cast<::std::uint32_t>(slot >> 32) == static_cast<::std::uint32_t>(sequence))
+        {
+            intervals[count++] = static_cast<::std::uint32_t>(slot);
+        }
+    }
+
+    if(count == 0)
+    {
+        return false;
+    }
+
+    ::std::sort(intervals, intervals + count);
+
+    ::std::uint64_t sum = 0;
+    for(::std::uint32_t i = 0; i < count; ++i)
+    {
+        sum += intervals[i];
+    }
+
+    stats.frames = count;
+    stats.totalFrames = end - resetAt;
+    stats.average = static_cast<double>(sum) / count / 1e6;
+    stats.averageFps = stats.average > 0.0 ? 1000.0 / stats.average : 0.0;
+    stats.p50 = percentile(intervals, count, 0.5);
+    stats.p95 = percentile(intervals, count, 0.95);
+    stats.p99 = percentile(intervals, count, 0.99);
+    stats.p999 = percentile(intervals, count, 0.999);
+    stats.max = intervals[count - 1] / 1e6;
+
+    const ::std::uint64_t stutter = 2 * static_cast<::std::uint64_t>(intervals[(count - 1) / 2]);
+    stats.stutters = static_cast<::std::uint32_t>(intervals + count - ::std::upper_bound(intervals, intervals + count, stutter, [](const ::std::uint64_t value, const ::std::uint32_t interval)
+    {
+        return value < interval;
+    }));
+
+    return true;
+}
+
+void resetFrameStats() noexcept
+{
+    g_resetAt.store(g_recorded.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+}
+
+namespace detail
+{
+
+::std::uint32_t recordPresent(const ::std::int64_t time) noexcept
+{
+    const ::std::int64_t last = g_lastPresent;
+    g_lastPresent = time;
+
+    if(last == 0)
+    {
+        return 0;
+    }
+
+    // Pauses of more than 4 seconds are recorded as 4 seconds
+    const ::std::int64_t elapsed = time - last;
+    const ::std::uint64_t interval = elapsed < 0 ? 0 : elapsed > UINT32_MAX ? UINT32_MAX : static_cast<::std::uint64_t>(elapsed);
+
+    const ::std::uint64_t sequence = g_recorded.fetch_add(1, ::std::memory_order_relaxed);
+    g_intervals[sequence % FrameStatsCapacity].store(sequence << 32 | interval, ::std::memory_order_release);
+
+    return static_cast<::std::uint32_t>(interval);
+}
+
+}
+
+}
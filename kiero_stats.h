@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kiero
+{
+	// The number of latest present-to-present intervals the statistics are computed over
+	inline constexpr ::std::uint32_t FrameStatsCapacity = 4096;
+
+	struct FrameStats
+	{
+		::std::uint32_t frames;      // intervals in the window
+		::std::uint64_t totalFrames; // intervals recorded since the last reset
+
+		double averageFps;
+
+		// Present-to-present intervals in milliseconds
+		double average;
+		double p50;
+		double p95;
+		double p99;
+		double p999;
+		double max;
+
+		::std::uint32_t stutters; // intervals in the window longer than twice the median
+	};
+
+	// Computes the statistics of the frame boundaries (kiero_frame.h) of every presenting thread
+	// from the latest FrameStatsCapacity intervals. Any thread may call it, the presenting
+	// threads never wait for it. Returns false while no interval was recorded.
+	bool getFrameStats(FrameStats& stats);
+
+	// Starts the window over, intervals still being recorded may survive the reset
+	void resetFrameStats() noexcept;
+
+	namespace detail
+	{
+		// Called by the outermost FrameScope of a thread with the time its boundary call
+		// proceeds at, in monotonic nanoseconds. Returns the interval since the thread's previous
+		// boundary in nanoseconds, 0 for its first one.
+		::std::uint32_t recordPresent(const ::std::int64_t time) noexcept;
+	}
+}
@@ -0,0 +1,213 @@
+#include "kiero_subscribers.h"
+
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace kiero
+{
+
+namespace
+{
+
+// Serializes writers only, dispatchers never take it
+::std::mutex g_mutex;
+detail::SubscriberSlot* g_slots = nullptr;
+SubscriptionId g_nextId = 0;
+
+[[nodiscard]] detail::SubscriberList* allocateList(const ::std::uint32_t count) noexcept
+{
+    assert(count > 0);
+
+    const ::std::size_t size = sizeof(detail::SubscriberList) + (count - 1) * sizeof(detail::Subscriber);
+
+    auto* list = static_cast<detail::SubscriberList*>(::operator new(size, ::std::nothrow));
+    if(list)
+    {
+        list->count = count;
+    }
+
+    return list;
+}
+
+void deleteList(void* const list)
+{
+    ::operator delete(list);
+}
+
+// Publishes list (null for none) and retires the one it replaces
+void publish(detail::SubscriberSlot& slot, const detail::SubscriberList* const list) noexcept
+{
+    const detail::SubscriberList* previous = slot.list.exchange(list, ::std::memory_order_acq_rel);
+    if(previous)
+    {
+        detail::retire(const_cast<detail::SubscriberList*>(previous), deleteList);
+    }
+}
+
+void unlink(detail::SubscriberSlot& slot) noexcept
+{
+    for(detail::SubscriberSlot** link = &g_slots; *link; link = &(*link)->next)
+    {
+        if(*link == &slot)
+        {
+            *link = slot.next;
+            slot.next = nullptr;
+            return;
+        }
+    }
+}
+
+}
+
+namespace detail
+{
+
+Status subscribe(const RenderType renderType, const ::std::uint16_t index, SubscriberSlot& slot, void* const dispatcher, Subscriber& subscriber)
+{
+    assert(dispatcher != nullptr && (subscriber.pre != nullptr || subscriber.post != nullptr));
+
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    SubscriberSlot* subscribed = g_slots;
+    while(subscribed && (subscribed->renderType != renderType || subscribed->index != index))
+    {
+        subscribed = subscribed->next;
+    }
+
+    if(!subscribed)
+    {
+        // The dispatcher is bound like any detour, it calls the original through slot.original
+        const Status status = ::kiero::bind(renderType, index, &slot.original, dispatcher);
+        if(status != Status::Success)
+        {
+            return status;
+        }
+
+        slot.renderType = renderType;
+        slot.index = index;
+        slot.next = g_slots;
+        g_slots = &slot;
+    }
+    else if(subscribed != &slot)
+    {
+        return Status::UnknownError;
+    }
+
+    const SubscriberList* current = slot.list.load(::std::memory_order_relaxed);
+    const ::std::uint32_t count = current ? current->count : 0;
+
+    SubscriberList* list = allocateList(count + 1);
+    if(!list)
+    {
+        return Status::UnknownError;
+    }
+
+    if(++g_nextId == 0)
+    {
+        ++g_nextId;
+    }
+
+    subscriber.id = g_nextId;
+
+    ::std::uint32_t position = 0;
+    while(position < count && current->subscribers[position].priority >= subscriber.priority)
+    {
+        ++position;
+    }
+
+    for(::std::uint32_t i = 0, j = 0; i <= count; ++i)
+    {
+        list->subscribers[i] = i == position ? subscriber : current->subscribers[j++];
+    }
+
+    publish(slot, list);
+
+    return Status::Success;
+}
+
+void releaseSubscribers(const RenderType renderType, const ::std::uint16_t index) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    for(SubscriberSlot* slot = g_slots; slot; slot = slot->next)
+    {
+        if(slot->renderType == renderType && slot->index == index)
+        {
+            unlink(*slot);
+            publish(*slot, nullptr);
+            return;
+        }
+    }
+}
+
+void releaseSubscribers(const RenderType renderType) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    SubscriberSlot* slot = g_slots;
+    while(slot)
+    {
+        SubscriberSlot* const next = slot->next;
+
+        if(slot->renderType == renderType)
+        {
+            unlink(*slot);
+            publish(*slot, nullptr);
+        }
+
+        slot = next;
+    }
+}
+
+}
+
+void unsubscribe(const SubscriptionId id)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    for(detail::SubscriberSlot* slot = g_slots; slot; slot = slot->next)
+    {
+        const detail::SubscriberList* current = slot->list.load(::std::memory_order_relaxed);
+        if(!current)
+        {
+            continue;
+        }
+
+        ::std::uint32_t position = 0;
+        while(position < current->count && current->subscribers[position].id != id)
+        {
+            ++position;
+        }
+
+        if(position == current->count)
+        {
+            continue;
+        }
+
+        detail::SubscriberList* list = nullptr;
+
+        if(current->count > 1)
+        {
+            list = allocateList(current->count - 1);
+            if(!list)
+            {
+                return;
+            }
+
+            for(::std::uint32_t i = 0, j = 0; i < current->count; ++i)
+            {
+                if(i != position)
+                {
+                    list->subscribers[j++] = current->subscribers[i];
+                }
+            }
+        }
+
+        publish(*slot, list);
+        return;
+    }
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "kiero.h"
+#include "kiero_epoch.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace kiero
+{
+	using SubscriptionId = ::std::uint32_t; // 0 is never handed out
+
+	// Removes a subscription made with kiero::subscribe (kiero_thunk.h). The slot stays hooked
+	// until it is unbound, calls then go straight to the original.
+	void unsubscribe(const SubscriptionId id);
+
+	namespace detail
+	{
+		struct Subscriber
+		{
+			void* pre;  // typed by the slot's dispatcher, either may be null
+			void* post;
+			::std::int32_t priority;
+			SubscriptionId id;
+		};
+
+		// Never modified once published, every change publishes a new copy
+		struct SubscriberList
+		{
+			::std::uint32_t count;
+			Subscriber subscribers[1]; // count entries, highest priority first
+		};
+
+		// The state of one slot's dispatcher. Dispatchers read list inside an epoch section,
+		// replaced lists are retired.
+		struct SubscriberSlot
+		{
+			::std::atomic<const SubscriberList*> list { nullptr };
+			void* original = nullptr;
+
+			RenderType renderType = RenderType::None;
+			::std::uint16_t index = 0;
+			SubscriberSlot* next = nullptr; // subscribed slots
+		};
+
+		// Binds dispatcher to the backend's index on the first subscription, then publishes slot's
+		// list with subscriber inserted after the subscribers of the same or higher priority.
+		// subscriber.id receives the new subscription's id.
+		Status subscribe(const RenderType renderType, const ::std::uint16_t index, SubscriberSlot& slot, void* const dispatcher, Subscriber& subscriber);
+
+		// Drops the subscribers of an index that is being unbound, or of a backend shutting down
+		void releaseSubscribers(const RenderType renderType, const ::std::uint16_t index) noexcept;
+		void releaseSubscribers(const RenderType renderType) noexcept;
+	}
+}
@@ -0,0 +1,209 @@
+#include "kiero_telemetry.h"
+#include "kiero_census.h"
+#include "kiero_epoch.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#ifdef _WIN32
+# include <Windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+# include <immintrin.h>
+# define KIERO_SPIN_PAUSE() _mm_pause()
+#else
+# include <thread>
+# define KIERO_SPIN_PAUSE() ::std::this_thread::yield()
+#endif
+
+namespace kiero
+{
+
+namespace
+{
+
+// Serializes startTelemetry and stopTelemetry, the presenting threads only read g_shared
+::std::mutex g_telemetryMutex;
+::std::atomic<Telemetry*> g_shared { nullptr };
+
+#ifdef _WIN32
+HANDLE g_mapping = nullptr;
+#else
+char g_name[256];
+#endif
+
+void unmapView(void* const shared) noexcept
+{
+#ifdef _WIN32
+    ::UnmapViewOfFile(shared);
+#else
+    ::munmap(shared, sizeof(Telemetry));
+#endif
+}
+
+void unmapLocked() noexcept
+{
+    Telemetry* const shared = g_shared.exchange(nullptr, ::std::memory_order_acq_rel);
+    if(!shared)
+    {
+        return;
+    }
+
+    // The name goes now, the view once no presenting thread can still be writing it
+#ifdef _WIN32
+    ::CloseHandle(g_mapping);
+    g_mapping = nullptr;
+#else
+    ::shm_unlink(g_name);
+    g_name[0] = '\0';
+#endif
+
+    detail::retire(shared, unmapView);
+}
+
+}
+
+Status startTelemetry(const char* const name)
+{
+    if(!name || !*name)
+    {
+        return Status::UnknownError;
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_telemetryMutex);
+
+    unmapLocked();
+
+#ifdef _WIN32
+    HANDLE mapping = ::CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(Telemetry), name);
+    if(!mapping)
+    {
+        return Status::UnknownError;
+    }
+
+    void* const memory = ::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(Telemetry));
+    if(!memory)
+    {
+        ::CloseHandle(mapping);
+        return Status::UnknownError;
+    }
+
+    g_mapping = mapping;
+    const ::std::uint32_t processId = ::GetCurrentProcessId();
+#else
+    const ::std::size_t length = ::std::strlen(name);
+    const ::std::size_t offset = name[0] == '/' ? 0 : 1;
+    if(length + offset >= sizeof(g_name))
+    {
+        return Status::UnknownError;
+    }
+
+    g_name[0] = '/';
+    ::std::memcpy(g_name + offset, name, length + 1);
+
+    // Replaces a segment a crashed process left behind
+    const int descriptor = ::shm_open(g_name, O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if(descriptor < 0)
+    {
+        g_name[0] = '\0';
+        return Status::UnknownError;
+    }
+
+    void* memory = MAP_FAILED;
+    if(::ftruncate(descriptor, sizeof(Telemetry)) == 0)
+    {
+        memory = ::mmap(nullptr, sizeof(Telemetry), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    }
+
+    ::close(descriptor);
+
+    if(memory == MAP_FAILED)
+    {
+        ::shm_unlink(g_name);
+        g_name[0] = '\0';
+        return Status::UnknownError;
+    }
+
+    const ::std::uint32_t processId = static_cast<::std::uint32_t>(::getpid());
+#endif
+
+    // The mapping starts zeroed, the magic is written last so readers never accept a partial header
+    Telemetry* const shared = static_cast<Telemetry*>(memory);
+    shared->version = TelemetryVersion;
+    shared->size = sizeof(Telemetry);
+    shared->processId = processId;
+    shared->renderType = static_cast<::std::uint32_t>(getRenderType());
+    ::std::atomic_ref<::std::uint32_t>(shared->magic).store(TelemetryMagic, ::std::memory_order_release);
+
+    g_shared.store(shared, ::std::memory_order_release);
+    return Status::Success;
+}
+
+void stopTelemetry()
+{
+    const ::std::lock_guard<::std::mutex> lock(g_telemetryMutex);
+    unmapLocked();
+}
+
+namespace detail
+{
+
+void publishPresent(const ::std::int64_t time, const ::std::uint32_t interval) noexcept
+{
+    if(!g_shared.load(::std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // stopTelemetry retires the view
+    const EpochGuard guard;
+    if(!guard)
+    {
+        return;
+    }
+
+    Telemetry* const shared = g_shared.load(::std::memory_order_acquire);
+    if(!shared)
+    {
+        return;
+    }
+
+    // Threads presenting at once take turns, the odd sequence doubles as the writers' lock
+    ::std::atomic_ref<::std::uint32_t> sequence(shared->sequence);
+    ::std::uint32_t begin = sequence.load(::std::memory_order_relaxed);
+
+    while((begin & 1) || !sequence.compare_exchange_weak(begin, begin + 1, ::std::memory_order_relaxed))
+    {
+        if(begin & 1)
+        {
+            KIERO_SPIN_PAUSE();
+            begin = sequence.load(::std::memory_order_relaxed);
+        }
+    }
+
+    // Orders the odd sequence before the fields, and the previous writer's fields before ours
+    ::std::atomic_thread_fence(::std::memory_order_acq_rel);
+
+    ::std::atomic_ref<::std::uint64_t> frames(shared->frames);
+    const ::std::uint64_t frame = frames.load(::std::memory_order_relaxed) + 1;
+
+    ::std::atomic_ref<::std::uint32_t>(shared->intervals[frame % TelemetryCapacity]).store(interval, ::std::memory_order_relaxed);
+    ::std::atomic_ref<::std::int64_t>(shared->lastPresent).store(time, ::std::memory_order_relaxed);
+    ::std::atomic_ref<::std::uint32_t>(shared->renderType).store(static_cast<::std::uint32_t>(getRenderType()), ::std::memory_order_relaxed);
+    frames.store(frame, ::std::memory_order_relaxed);
+
+    ::std::atomic_ref<::std::uint32_t>(shared->slots).store(copyCensusCalls(shared->calls, TelemetrySlots), ::std::memory_order_relaxed);
+
+    sequence.store(begin + 2, ::std::memory_order_release);
+}
+
+}
+
+}
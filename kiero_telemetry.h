@@ -0,0 +1,141 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace kiero
+{
+	inline constexpr ::std::uint32_t TelemetryMagic = 0x4D4C544B; // "KTLM"
+	inline constexpr ::std::uint32_t TelemetryVersion = 2;
+
+	// The number of latest present-to-present intervals the segment keeps
+	inline constexpr ::std::uint32_t TelemetryCapacity = 1024;
+
+	// The number of methods table slots whose census counts the segment keeps, more than the
+	// largest table has
+	inline constexpr ::std::uint32_t TelemetrySlots = 512;
+
+	// The layout of the shared memory segment. Fields only ever get appended, a reader accepts
+	// any segment with its magic, its version or a later one and at least the size it knows.
+	// Everything below sequence is written between two increments of it: an odd sequence means
+	// a write is in progress, a reader that saw it change retries (see readTelemetry).
+	struct Telemetry
+	{
+		::std::uint32_t magic;
+		::std::uint32_t version;
+		::std::uint32_t size;      // of the segment in bytes
+		::std::uint32_t processId; // of the writer
+
+		::std::uint32_t sequence;
+		::std::uint32_t renderType; // kiero::RenderType
+
+		::std::uint64_t frames;      // frame boundaries (kiero_frame.h) passed since the start
+		::std::int64_t lastPresent;  // monotonic nanoseconds of the latest boundary, 0 before it
+
+		// Interval in nanoseconds between the frames - 1 and frames boundaries of a thread is
+		// at intervals[frames % TelemetryCapacity], 0 for a thread's first boundary
+		::std::uint32_t intervals[TelemetryCapacity];
+
+		// Version 2. While a census (kiero_census.h) runs, calls[i] is the number of calls of
+		// slot i since startCensus as of the latest boundary, 0 for a slot it does not count.
+		// slots is the methods count of the census' render type, 0 without a census.
+		::std::uint32_t slots;
+		::std::uint32_t reserved;
+		::std::uint64_t calls[TelemetrySlots];
+	};
+
+	static_assert(offsetof(Telemetry, sequence) == 16 && offsetof(Telemetry, frames) == 24 && offsetof(Telemetry, intervals) == 40);
+	static_assert(offsetof(Telemetry, slots) == 40 + 4 * TelemetryCapacity && offsetof(Telemetry, calls) == 48 + 4 * TelemetryCapacity);
+	static_assert(sizeof(Telemetry) == 48 + 4 * TelemetryCapacity + 8 * TelemetrySlots);
+
+	// A consistent copy of the segment, intervals oldest first
+	struct TelemetrySnapshot
+	{
+		RenderType renderType;
+		::std::uint32_t processId;
+		::std::uint64_t frames;
+		::std::int64_t lastPresent;
+
+		::std::uint32_t count;
+		::std::uint32_t intervals[TelemetryCapacity];
+
+		::std::uint32_t slots;
+		::std::uint64_t calls[TelemetrySlots];
+	};
+
+	// Publishes the render type, every frame boundary of the process and the census counts into
+	// the shared memory segment name (POSIX shm_open name, a leading '/' is added when missing,
+	// or a Windows file mapping name). A boundary costs one uncontended atomic exchange more
+	// while on, plus a copy of the counted slots during a census, a single load while off.
+	// Starting again replaces the previous segment.
+	Status startTelemetry(const char* const name);
+
+	// Unlinks and unmaps the segment, readers that still have it mapped keep the last values
+	void stopTelemetry();
+
+	// Copies the segment as of one moment. Retries while the writer is inside an update,
+	// returns false when the segment is not a kiero telemetry segment or kept changing.
+	inline bool readTelemetry(const Telemetry& shared, TelemetrySnapshot& snapshot) noexcept
+	{
+		using Word = ::std::atomic_ref<const ::std::uint32_t>;
+
+		if(shared.magic != TelemetryMagic || shared.version < TelemetryVersion || shared.size < sizeof(Telemetry))
+		{
+			return false;
+		}
+
+		for(int attempt = 0; attempt < 1000; ++attempt)
+		{
+			const ::std::uint32_t begin = Word(shared.sequence).load(::std::memory_order_acquire);
+			if(begin & 1)
+			{
+				continue;
+			}
+
+			const ::std::uint64_t frames = ::std::atomic_ref<const ::std::uint64_t>(shared.frames).load(::std::memory_order_relaxed);
+
+			snapshot.renderType = static_cast<RenderType>(Word(shared.renderType).load(::std::memory_order_relaxed));
+			snapshot.processId = shared.processId;
+			snapshot.frames = frames;
+			snapshot.lastPresent = ::std::atomic_ref<const ::std::int64_t>(shared.lastPresent).load(::std::memory_order_relaxed);
+
+			// The first boundary of every thread has no interval
+			const ::std::uint32_t available = frames < TelemetryCapacity ? static_cast<::std::uint32_t>(frames) : TelemetryCapacity;
+
+			snapshot.count = 0;
+			for(::std::uint64_t frame = frames - available + 1; frame <= frames; ++frame)
+			{
+				const ::std::uint32_t interval = Word(shared.intervals[frame % TelemetryCapacity]).load(::std::memory_order_relaxed);
+				if(interval != 0)
+				{
+					snapshot.intervals[snapshot.count++] = interval;
+				}
+			}
+
+			const ::std::uint32_t slots = Word(shared.slots).load(::std::memory_order_relaxed);
+
+			snapshot.slots = slots < TelemetrySlots ? slots : TelemetrySlots;
+			for(::std::uint32_t slot = 0; slot < snapshot.slots; ++slot)
+			{
+				snapshot.calls[slot] = ::std::atomic_ref<const ::std::uint64_t>(shared.calls[slot]).load(::std::memory_order_relaxed);
+			}
+
+			::std::atomic_thread_fence(::std::memory_order_acquire);
+			if(Word(shared.sequence).load(::std::memory_order_relaxed) == begin)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	namespace detail
+	{
+		// Called by the outermost FrameScope of a thread after recordPresent and recordCensusFrame
+		void publishPresent(const ::std::int64_t time, const ::std::uint32_t interval) noexcept;
+	}
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "kiero_frame.h"
+#include "kiero_signatures.h"
+#include "kiero_subscribers.h"
+
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define KIERO_FORCEINLINE __forceinline
+#else
+    #define KIERO_FORCEINLINE [[gnu::always_inline]] inline
+#endif
+
+namespace kiero
+{
+	// Leaves out the pre or post callback of bindThunk
+	struct NoCallback { };
+
+	namespace detail
+	{
+		template<typename Callback>
+		inline constexpr bool hasCallback = !::std::is_same_v<Callback, NoCallback>;
+
+		// Everything but the call to the original folds away, with no post callback the
+		// original is reached by a tail jump. Not for a frame boundary: its BoundaryScope ends
+		// the frame once the original returned, so the thunk keeps a frame around the call.
+		template<typename Pre, typename Post, typename Function, typename... Args>
+		KIERO_FORCEINLINE decltype(auto) invokeThunk(const Function original, Args... args)
+		{
+			using Return = decltype(original(args...));
+
+			if constexpr(hasCallback<Pre>)
+			{
+				Pre{}(args...);
+			}
+
+			if constexpr(!hasCallback<Post>)
+			{
+				return original(args...);
+			}
+			else if constexpr(::std::is_void_v<Return>)
+			{
+				original(args...);
+				Post{}(args...);
+			}
+			else
+			{
+				Return result = original(args...);
+				Post{}(result, args...);
+				return result;
+			}
+		}
+
+		// Ends the thread's frame (kiero_frame.h) once a frame boundary returned, nothing for
+		// the other methods. Its destructor runs after the original, even an empty post hook
+		// then costs a call and a return instead of a tail jump.
+		template<typename M, bool = isFrameBoundary<M>>
+		struct BoundaryScope
+		{
+		};
+
+		template<typename M>
+		struct BoundaryScope<M, true> : FrameScope
+		{
+		};
+
+		template<typename M, typename Pre, typename Post, typename Function = MethodFunction<M>>
+		struct Thunk;
+
+		template<typename M, typename Pre, typename Post, typename Return, typename... Args>
+		struct Thunk<M, Pre, Post, Return (*)(Args...)>
+		{
+			static inline Return (*original)(Args...) = nullptr;
+
+			static Return call(Args... args)
+			{
+				[[maybe_unused]] const BoundaryScope<M> frame;
+				return invokeThunk<Pre, Post>(original, args...);
+			}
+		};
+
+#if defined(_WIN32) && !defined(_WIN64)
+		// COM, WGL and Vulkan entry points are __stdcall on 32-bit Windows
+		template<typename M, typename Pre, typename Post, typename Return, typename... Args>
+		struct Thunk<M, Pre, Post, Return (__stdcall*)(Args...)>
+		{
+			static inline Return (__stdcall* original)(Args...) = nullptr;
+
+			static Return __stdcall call(Args... args)
+			{
+				[[maybe_unused]] const BoundaryScope<M> frame;
+				return invokeThunk<Pre, Post>(original, args...);
+			}
+		};
+#endif
+
+		// Runs the subscribers of slot around the original. Reads the list pointer and the list
+		// only, without a lock, and tail jumps to the original when nobody is subscribed.
+		template<typename Pre, typename Post, typename Function, typename... Args>
+		KIERO_FORCEINLINE decltype(auto) dispatch(const SubscriberSlot& slot, Args... args)
+		{
+			const auto original = reinterpret_cast<Function>(slot.original);
+
+			if(!enterEpoch())
+			{
+				return original(args...);
+			}
+
+			const SubscriberList* list = slot.list.load(::std::memory_order_acquire);
+			if(!list)
+			{
+				exitEpoch();
+				return original(args...);
+			}
+
+			const Subscriber* const subscribers = list->subscribers;
+			const ::std::uint32_t count = list->count;
+
+			for(::std::uint32_t i = 0; i < count; ++i)
+			{
+				if(subscribers[i].pre)
+				{
+					reinterpret_cast<Pre>(subscribers[i].pre)(args...);
+				}
+			}
+
+			// Post callbacks in reverse, the highest priority sees the call first and last
+			if constexpr(::std::is_void_v<decltype(original(args...))>)
+			{
+				original(args...);
+
+				for(::std::uint32_t i = count; i-- > 0;)
+				{
+					if(subscribers[i].post)
+					{
+						reinterpret_cast<Post>(subscribers[i].post)(args...);
+					}
+				}
+
+				exitEpoch();
+			}
+			else
+			{
+				auto result = original(args...);
+
+				for(::std::uint32_t i = count; i-- > 0;)
+				{
+					if(subscribers[i].post)
+					{
+						reinterpret_cast<Post>(subscribers[i].post)(result, args...);
+					}
+				}
+
+				exitEpoch();
+				return result;
+			}
+		}
+
+		// post(result, args...), or post(args...) for void functions. A specialization since
+		// naming Return& is ill-formed for void even in the branch a conditional_t drops.
+		template<typename Return, typename... Args>
+		struct PostCallbackOf
+		{
+			using Type = void (*)(Return&, Args...);
+		};
+
+		template<typename... Args>
+		struct PostCallbackOf<void, Args...>
+		{
+			using Type = void (*)(Args...);
+		};
+
+		// One per method, owning the method's subscriber slot
+		template<typename M, typename Function = MethodFunction<M>>
+		struct Dispatcher;
+
+		template<typename M, typename Return, typename... Args>
+		struct Dispatcher<M, Return (*)(Args...)>
+		{
+			using Pre = void (*)(Args...);
+			using Post = typename PostCallbackOf<Return, Args...>::Type;
+
+			static inline SubscriberSlot slot;
+
+			static Return call(Args... args)
+			{
+				[[maybe_unused]] const BoundaryScope<M> frame;
+				return dispatch<Pre, Post, Return (*)(Args...)>(slot, args...);
+			}
+		};
+
+#if defined(_WIN32) && !defined(_WIN64)
+		template<typename M, typename Return, typename... Args>
+		struct Dispatcher<M, Return (__stdcall*)(Args...)>
+		{
+			using Pre = void (*)(Args...);
+			using Post = typename PostCallbackOf<Return, Args...>::Type;
+
+			static inline SubscriberSlot slot;
+
+			static Return __stdcall call(Args... args)
+			{
+				[[maybe_unused]] const BoundaryScope<M> frame;
+				return dispatch<Pre, Post, Return (__stdcall*)(Args...)>(slot, args...);
+			}
+		};
+#endif
+	}
+
+	// Hooks the slot with a generated detour calling pre(args...) before the original and
+	// post(result, args...) (post(args...) for void functions) after it. result is an lvalue
+	// the post callback may change. The callbacks must be captureless (lambdas or empty
+	// functors), they are default constructed and inlined into the detour:
+	//
+	//   kiero::bindThunk<kiero::d3d11::IDXGISwapChain::Present>([](IDXGISwapChain* swapChain, UINT, UINT) { draw(swapChain); });
+	template<typename M, typename Pre = NoCallback, typename Post = NoCallback>
+	Status bindThunk(const Pre = { }, const Post = { })
+	{
+		static_assert(::std::is_empty_v<Pre> && ::std::is_empty_v<Post>, "thunk callbacks must be captureless");
+
+		using Thunk = detail::Thunk<M, Pre, Post>;
+		return bind<M>(&Thunk::call, Thunk::original);
+	}
+
+	template<typename M>
+	using PreCallback = typename detail::Dispatcher<M>::Pre;
+
+	template<typename M>
+	using PostCallback = typename detail::Dispatcher<M>::Post;
+
+	// Adds a subscriber to the slot, any number of them can share it. The slot is hooked by the
+	// first subscription (it fails when the slot was bound otherwise). Pre callbacks run by
+	// descending priority before the original, post callbacks in the opposite order after it;
+	// either may be null. Subscribing and unsubscribing never block the hooked function.
+	//
+	//   kiero::subscribe<kiero::d3d11::IDXGISwapChain::Present>(nullptr, [](HRESULT& result, IDXGISwapChain*, UINT, UINT) { ... }, 10, &id);
+	template<typename M>
+	Status subscribe(const PreCallback<M> pre, const PostCallback<M> post, const ::std::int32_t priority = 0, SubscriptionId* const id = nullptr)
+	{
+		using Dispatcher = detail::Dispatcher<M>;
+
+		detail::Subscriber subscriber { reinterpret_cast<void*>(pre), reinterpret_cast<void*>(post), priority, 0 };
+
+		const Status status = detail::subscribe(M::renderType, M::index, Dispatcher::slot, reinterpret_cast<void*>(&Dispatcher::call), subscriber);
+		if(status == Status::Success && id)
+		{
+			*id = subscriber.id;
+		}
+
+		return status;
+	}
+}
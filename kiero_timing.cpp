@@ -0,0 +1,738 @@
+#include "kiero_timing.h"
+#include "kiero_detour.h"
+#include "kiero_epoch.h"
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#elif defined(__x86_64__)
+# include <x86intrin.h>
+#endif
+
+namespace kiero
+{
+
+#if KIERO_DETOUR_SUPPORTED
+
+namespace
+{
+
+constexpr ::std::uint32_t MaxTimers = 64;
+
+// The timing gate is followed by a stub per part of each timer, "mov r11, &part; jmp gate"
+constexpr ::std::size_t StubSize = 16;
+constexpr ::std::size_t CodeSize = detail::MaxGateSize + MaxTimers * 2 * StubSize;
+
+// Histograms of TSC ticks: exact below 32, then 16 buckets per power of two, so a bucket's
+// midpoint is within 1/32 of any value in it. Values from 2^48 ticks on share the last octave.
+constexpr ::std::uint32_t SubBucketBits = 4;
+constexpr ::std::uint32_t SubBuckets = 1u << SubBucketBits;
+constexpr ::std::uint32_t ExactBuckets = SubBuckets * 2;
+constexpr ::std::uint32_t MaxValueBits = 48;
+constexpr ::std::uint32_t Buckets = ExactBuckets + (MaxValueBits - SubBucketBits - 1) * SubBuckets;
+
+enum Part : ::std::uint8_t
+{
+    HookPart,
+    OriginalPart,
+};
+
+struct TimedPart
+{
+    ::std::atomic<void*> function { nullptr }; // the detour, or the original
+    ::std::uint32_t timer = 0;
+    Part part = HookPart;
+};
+
+struct Timer
+{
+    TimedPart parts[2];
+
+    // Under g_timingMutex
+    bool active = false;
+    RenderType renderType = RenderType::None;
+    ::std::uint16_t index = 0;
+    detail::HookRoute stubs { };
+
+    // Set until the retired timer is free again, the calls that entered it may still run
+    ::std::atomic<bool> busy { false };
+
+    // Identifies this start of the timer to the thread histograms
+    ::std::atomic<::std::uint32_t> generation { 0 };
+};
+
+struct Histogram
+{
+    ::std::uint64_t counts[Buckets];
+    ::std::uint64_t total;
+    ::std::uint64_t max;
+};
+
+// Only the owning thread writes, with relaxed stores the readers merge from. A timer started
+// again gets a new generation and the owner clears the histograms on its next sample.
+struct ThreadTimer
+{
+    ::std::atomic<::std::uint32_t> generation { 0 }; // 0 while clearing
+    Histogram histograms[2];
+};
+
+// One per thread that ever called a timed index, never freed: a thread that exited gives its
+// record to the next one, which keeps adding to the same histograms
+struct ThreadTiming
+{
+    ::std::atomic<ThreadTimer*> timers[MaxTimers] { };
+
+    ::std::atomic<bool> used { true };
+    ThreadTiming* next = nullptr;
+};
+
+struct Frame
+{
+    void* returnAddress;
+    const TimedPart* part;
+    ::std::uint64_t begin;
+    ::std::uint64_t nested; // ticks in the original, for a detour's frame
+};
+
+// The timed calls in progress on this thread
+struct FrameStack
+{
+    Frame* frames;
+    ::std::size_t count;
+    ::std::size_t capacity;
+};
+
+Timer g_timers[MaxTimers];
+
+// Serializes starting and stopping, the timed calls only read the timers
+::std::mutex g_timingMutex;
+::std::uint8_t* g_code = nullptr; // allocated by the first start and never freed
+::std::uint32_t g_generation = 0;
+
+// The first start's reading of both clocks, converts ticks to nanoseconds
+::std::uint64_t g_calibrationTicks = 0;
+::std::chrono::steady_clock::time_point g_calibrationTime { };
+
+::std::atomic<ThreadTiming*> g_threadTimings { nullptr };
+
+thread_local FrameStack g_frameStack { };
+thread_local ThreadTiming* g_threadTiming = nullptr;
+
+// Frees the frame stack and gives the record back when the thread exits, only constructed
+// once either was taken
+struct FrameStackOwner
+{
+    ~FrameStackOwner()
+    {
+        delete[] g_frameStack.frames;
+        g_frameStack = FrameStack { };
+
+        if(g_threadTiming)
+        {
+            g_threadTiming->used.store(false, ::std::memory_order_release);
+            g_threadTiming = nullptr;
+        }
+    }
+};
+
+thread_local FrameStackOwner g_frameStackOwner;
+
+[[nodiscard]] ::std::uint64_t readTicks() noexcept
+{
+    return __rdtsc();
+}
+
+[[nodiscard]] ::std::uint32_t bucketOf(::std::uint64_t value) noexcept
+{
+    if(value < ExactBuckets)
+    {
+        return static_cast<::std::uint32_t>(value);
+    }
+
+    if(value >> MaxValueBits)
+    {
+        value = (::std::uint64_t { 1 } << MaxValueBits) - 1;
+    }
+
+    const ::std::uint32_t octave = static_cast<::std::uint32_t>(::std::bit_width(value)) - 1;
+    const ::std::uint32_t shift = octave - SubBucketBits;
+
+    return ExactBuckets + (octave - SubBucketBits - 1) * SubBuckets + static_cast<::std::uint32_t>((value >> shift) & (SubBuckets - 1));
+}
+
+// The middle of a bucket's range
+[[nodiscard]] ::std::uint64_t valueOf(const ::std::uint32_t bucket) noexcept
+{
+    if(bucket < ExactBuckets)
+    {
+        return bucket;
+    }
+
+    const ::std::uint32_t shift = (bucket - ExactBuckets) / SubBuckets + 1;
+    const ::std::uint64_t low = static_cast<::std::uint64_t>(SubBuckets + (bucket - ExactBuckets) % SubBuckets) << shift;
+
+    return low + (::std::uint64_t { 1 } << shift) / 2;
+}
+
+void addSample(Histogram& histogram, const ::std::uint64_t value) noexcept
+{
+    using Count = ::std::atomic_ref<::std::uint64_t>;
+
+    const Count count(histogram.counts[bucketOf(value)]);
+    count.store(count.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+
+    const Count total(histogram.total);
+    total.store(total.load(::std::memory_order_relaxed) + value, ::std::memory_order_relaxed);
+
+    const Count max(histogram.max);
+    if(value > max.load(::std::memory_order_relaxed))
+    {
+        max.store(value, ::std::memory_order_relaxed);
+    }
+}
+
+[[nodiscard]] ThreadTiming* attachThread() noexcept
+{
+    for(ThreadTiming* record = g_threadTimings.load(::std::memory_order_acquire); record; record = record->next)
+    {
+        bool used = false;
+        if(!record->used.load(::std::memory_order_relaxed) && record->used.compare_exchange_strong(used, true, ::std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto* const record = new(::std::nothrow) ThreadTiming;
+    if(!record)
+    {
+        return nullptr;
+    }
+
+    record->next = g_threadTimings.load(::std::memory_order_relaxed);
+    while(!g_threadTimings.compare_exchange_weak(record->next, record, ::std::memory_order_release, ::std::memory_order_relaxed))
+    {
+    }
+
+    return record;
+}
+
+// A sample the thread has no memory for is dropped
+void record(const ::std::uint32_t timer, const Part part, const ::std::uint64_t ticks) noexcept
+{
+    ThreadTiming* thread = g_threadTiming;
+    if(!thread)
+    {
+        // Touching the owner registers its destructor for this thread
+        (void) &g_frameStackOwner;
+
+        thread = attachThread();
+        if(!thread)
+        {
+            return;
+        }
+
+        g_threadTiming = thread;
+    }
+
+    ThreadTimer* threadTimer = thread->timers[timer].load(::std::memory_order_relaxed);
+    if(!threadTimer)
+    {
+        threadTimer = new(::std::nothrow) ThreadTimer;
+        if(!threadTimer)
+        {
+            return;
+        }
+
+        thread->timers[timer].store(threadTimer, ::std::memory_order_release);
+    }
+
+    const ::std::uint32_t generation = g_timers[timer].generation.load(::std::memory_order_relaxed);
+    if(threadTimer->generation.load(::std::memory_order_relaxed) != generation)
+    {
+        // Readers skip the histograms until the new generation is published
+        threadTimer->generation.store(0, ::std::memory_order_relaxed);
+        ::std::atomic_thread_fence(::std::memory_order_release);
+
+        for(Histogram& histogram : threadTimer->histograms)
+        {
+            for(::std::uint64_t& count : histogram.counts)
+            {
+                ::std::atomic_ref<::std::uint64_t>(count).store(0, ::std::memory_order_relaxed);
+            }
+
+            ::std::atomic_ref<::std::uint64_t>(histogram.total).store(0, ::std::memory_order_relaxed);
+            ::std::atomic_ref<::std::uint64_t>(histogram.max).store(0, ::std::memory_order_relaxed);
+        }
+
+        threadTimer->generation.store(generation, ::std::memory_order_release);
+    }
+
+    addSample(threadTimer->histograms[part], ticks);
+}
+
+// Returns the function the timing gate calls. The section keeps the timer from being reused
+// until the call returned. A call there is no memory to track runs untimed.
+void* enterTimed(const ::std::uintptr_t key, void* const returnAddress) noexcept
+{
+    const auto* const part = reinterpret_cast<const TimedPart*>(key);
+
+    if(!detail::enterEpoch())
+    {
+        return reinterpret_cast<void*>(reinterpret_cast<::std::uintptr_t>(part->function.load(::std::memory_order_acquire)) | detail::UntrackedCall);
+    }
+
+    void* const function = part->function.load(::std::memory_order_acquire);
+
+    FrameStack& stack = g_frameStack;
+    if(stack.count == stack.capacity)
+    {
+        const ::std::size_t capacity = stack.capacity ? stack.capacity * 2 : 16;
+
+        (void) &g_frameStackOwner;
+
+        auto* const frames = new(::std::nothrow) Frame[capacity];
+        if(!frames)
+        {
+            detail::exitEpoch();
+            return reinterpret_cast<void*>(reinterpret_cast<::std::uintptr_t>(function) | detail::UntrackedCall);
+        }
+
+        (void) ::std::memcpy(frames, stack.frames, stack.count * sizeof(Frame));
+        delete[] stack.frames;
+
+        stack.frames = frames;
+        stack.capacity = capacity;
+    }
+
+    // Last, the bookkeeping above is not part of the call
+    stack.frames[stack.count++] = { returnAddress, part, readTicks(), 0 };
+
+    return function;
+}
+
+void* exitTimed() noexcept
+{
+    const ::std::uint64_t end = readTicks();
+
+    FrameStack& stack = g_frameStack;
+    const Frame frame = stack.frames[--stack.count];
+    const ::std::uint64_t elapsed = end - frame.begin;
+
+    const TimedPart& part = *frame.part;
+    if(part.part == OriginalPart)
+    {
+        // Leaves the detour's own time to its frame
+        if(stack.count && stack.frames[stack.count - 1].part == &g_timers[part.timer].parts[HookPart])
+        {
+            stack.frames[stack.count - 1].nested += elapsed;
+        }
+
+        record(part.timer, OriginalPart, elapsed);
+    }
+    else
+    {
+        record(part.timer, HookPart, elapsed > frame.nested ? elapsed - frame.nested : 0);
+    }
+
+    detail::exitEpoch();
+
+    return frame.returnAddress;
+}
+
+[[nodiscard]] void* stubOf(const ::std::uint32_t timer, const Part part) noexcept
+{
+    return g_code + detail::MaxGateSize + (timer * 2 + part) * StubSize;
+}
+
+[[nodiscard]] bool ensureCode() noexcept
+{
+    if(g_code)
+    {
+        return true;
+    }
+
+    // The stubs use absolute addresses for the parts, any pages do
+    auto* const code = static_cast<::std::uint8_t*>(detail::allocateCode(reinterpret_cast<const void*>(&enterTimed), CodeSize));
+    if(!code)
+    {
+        return false;
+    }
+
+    (void) detail::writeGate(code, &enterTimed, &exitTimed);
+
+    for(::std::uint32_t timer = 0; timer < MaxTimers; ++timer)
+    {
+        for(::std::uint32_t part = 0; part < 2; ++part)
+        {
+            g_timers[timer].parts[part].timer = timer;
+            g_timers[timer].parts[part].part = static_cast<Part>(part);
+
+            const ::std::size_t offset = detail::MaxGateSize + (timer * 2 + part) * StubSize;
+            const ::std::uint64_t key = reinterpret_cast<::std::uintptr_t>(&g_timers[timer].parts[part]);
+            const ::std::int32_t displacement = -static_cast<::std::int32_t>(offset + 15);
+
+            // mov r11, &part; jmp gate
+            ::std::uint8_t* const stub = code + offset;
+            stub[0] = 0x49;
+            stub[1] = 0xBB;
+            (void) ::std::memcpy(stub + 2, &key, sizeof(key));
+            stub[10] = 0xE9;
+            (void) ::std::memcpy(stub + 11, &displacement, sizeof(displacement));
+            stub[15] = 0xCC;
+        }
+    }
+
+    detail::sealCode(code, CodeSize);
+
+    g_calibrationTicks = readTicks();
+    g_calibrationTime = ::std::chrono::steady_clock::now();
+
+    g_code = code;
+    return true;
+}
+
+[[nodiscard]] Timer* findTimer(const RenderType renderType, const ::std::uint16_t index) noexcept
+{
+    for(Timer& timer : g_timers)
+    {
+        if(timer.active && timer.renderType == renderType && timer.index == index)
+        {
+            return &timer;
+        }
+    }
+
+    return nullptr;
+}
+
+void freeTimer(void* const timer)
+{
+    static_cast<Timer*>(timer)->busy.store(false, ::std::memory_order_release);
+}
+
+// Puts the hook's own route back unless the index was bound anew meanwhile, the timer is free
+// again once the calls that entered it returned
+void stopLocked(Timer& timer) noexcept
+{
+    const detail::HookRoute route { timer.parts[HookPart].function.load(::std::memory_order_relaxed), nullptr, nullptr };
+
+    detail::HookRoute current;
+    (void) detail::rerouteHook(timer.renderType, timer.index, &timer.stubs, &route, current);
+
+    timer.active = false;
+    detail::retire(&timer, freeTimer);
+}
+
+void mergeTimer(const Timer& timer, const Part part, Histogram& merged) noexcept
+{
+    using Count = ::std::atomic_ref<const ::std::uint64_t>;
+
+    const ::std::uint32_t generation = timer.generation.load(::std::memory_order_relaxed);
+    const ::std::uint32_t index = timer.parts[part].timer;
+
+    for(const ThreadTiming* thread = g_threadTimings.load(::std::memory_order_acquire); thread; thread = thread->next)
+    {
+        const ThreadTimer* const threadTimer = thread->timers[index].load(::std::memory_order_acquire);
+        if(!threadTimer || threadTimer->generation.load(::std::memory_order_acquire) != generation)
+        {
+            continue;
+        }
+
+        const Histogram& histogram = threadTimer->histograms[part];
+
+        Histogram copy;
+        for(::std::uint32_t i = 0; i < Buckets; ++i)
+        {
+            copy.counts[i] = Count(histogram.counts[i]).load(::std::memory_order_relaxed);
+        }
+
+        copy.total = Count(histogram.total).load(::std::memory_order_relaxed);
+        copy.max = Count(histogram.max).load(::std::memory_order_relaxed);
+
+        // Cleared for a later generation meanwhile
+        ::std::atomic_thread_fence(::std::memory_order_acquire);
+        if(threadTimer->generation.load(::std::memory_order_relaxed) != generation)
+        {
+            continue;
+        }
+
+        for(::std::uint32_t i = 0; i < Buckets; ++i)
+        {
+            merged.counts[i] += copy.counts[i];
+        }
+
+        merged.total += copy.total;
+        merged.max = copy.max > merged.max ? copy.max : merged.max;
+    }
+}
+
+[[nodiscard]] LatencySummary summarize(const Histogram& histogram, const double nanosecondsPerTick) noexcept
+{
+    LatencySummary summary { };
+
+    for(const ::std::uint64_t count : histogram.counts)
+    {
+        summary.count += count;
+    }
+
+    if(summary.count == 0)
+    {
+        return summary;
+    }
+
+    const auto nanoseconds = [nanosecondsPerTick](const ::std::uint64_t ticks)
+    {
+        return static_cast<::std::uint64_t>(static_cast<double>(ticks) * nanosecondsPerTick + 0.5);
+    };
+
+    // The bucket of the sample at rank, never past the largest one
+    const auto percentile = [&](const ::std::uint64_t permille)
+    {
+        const ::std::uint64_t rank = (summary.count * permille + 999) / 1000;
+
+        ::std::uint64_t seen = 0;
+        ::std::uint32_t bucket = 0;
+        while(bucket < Buckets - 1 && (seen += histogram.counts[bucket]) < rank)
+        {
+            ++bucket;
+        }
+
+        const ::std::uint64_t value = valueOf(bucket);
+        return nanoseconds(value < histogram.max ? value : histogram.max);
+    };
+
+    summary.mean = nanoseconds(histogram.total / summary.count);
+    summary.p50 = percentile(500);
+    summary.p90 = percentile(900);
+    summary.p99 = percentile(990);
+    summary.max = nanoseconds(histogram.max);
+
+    return summary;
+}
+
+}
+
+Status startTiming(const RenderType renderType, const ::std::uint16_t index)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_timingMutex);
+
+    if(findTimer(renderType, index))
+    {
+        return Status::Success;
+    }
+
+    // The one started longest ago, the least likely to have a call still on its way in
+    Timer* timer = nullptr;
+    for(Timer& candidate : g_timers)
+    {
+        if(!candidate.active && !candidate.busy.load(::std::memory_order_acquire)
+            && (!timer || candidate.generation.load(::std::memory_order_relaxed) < timer->generation.load(::std::memory_order_relaxed)))
+        {
+            timer = &candidate;
+        }
+    }
+
+    if(!timer)
+    {
+        return Status::UnknownError;
+    }
+
+    // The hook's route, which the parts call once the stubs replace it
+    detail::HookRoute route;
+    Status status = detail::rerouteHook(renderType, index, nullptr, nullptr, route);
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    if(!ensureCode())
+    {
+        return Status::UnknownError;
+    }
+
+    const ::std::uint32_t id = static_cast<::std::uint32_t>(timer - g_timers);
+
+    timer->parts[HookPart].function.store(route.detour, ::std::memory_order_relaxed);
+    timer->parts[OriginalPart].function.store(route.copy, ::std::memory_order_relaxed);
+    if(++g_generation == 0)
+    {
+        ++g_generation;
+    }
+
+    timer->generation.store(g_generation, ::std::memory_order_relaxed);
+    timer->stubs = { stubOf(id, HookPart), stubOf(id, OriginalPart), nullptr };
+
+    // Publishes the parts along with the stubs. Fails when the index was bound anew since.
+    detail::HookRoute current;
+    status = detail::rerouteHook(renderType, index, &route, &timer->stubs, current);
+    if(status != Status::Success)
+    {
+        return status;
+    }
+
+    timer->active = true;
+    timer->renderType = renderType;
+    timer->index = index;
+    timer->busy.store(true, ::std::memory_order_relaxed);
+
+    return Status::Success;
+}
+
+Status startTiming(const ::std::uint16_t index)
+{
+    return startTiming(getRenderType(), index);
+}
+
+void stopTiming(const RenderType renderType, const ::std::uint16_t index)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_timingMutex);
+
+    if(Timer* const timer = findTimer(renderType, index))
+    {
+        stopLocked(*timer);
+    }
+}
+
+void stopTiming(const ::std::uint16_t index)
+{
+    stopTiming(getRenderType(), index);
+}
+
+Status getTiming(const RenderType renderType, const ::std::uint16_t index, TimingStats& stats)
+{
+    stats = { };
+
+    constexpr auto calibration = ::std::chrono::milliseconds(10);
+
+    ::std::chrono::steady_clock::time_point since;
+    {
+        const ::std::lock_guard<::std::mutex> lock(g_timingMutex);
+
+        if(!findTimer(renderType, index))
+        {
+            return Status::NotInitializedError;
+        }
+
+        since = g_calibrationTime;
+    }
+
+    // Long enough for the clocks' resolution not to matter
+    ::std::this_thread::sleep_until(since + calibration);
+
+    const ::std::lock_guard<::std::mutex> lock(g_timingMutex);
+
+    const Timer* const timer = findTimer(renderType, index);
+    if(!timer)
+    {
+        return Status::NotInitializedError;
+    }
+
+    const ::std::uint64_t ticks = readTicks() - g_calibrationTicks;
+    const ::std::chrono::duration<double, ::std::nano> elapsed = ::std::chrono::steady_clock::now() - g_calibrationTime;
+    const double nanosecondsPerTick = ticks ? elapsed.count() / static_cast<double>(ticks) : 0.0;
+
+    auto* const merged = new(::std::nothrow) Histogram[2]();
+    if(!merged)
+    {
+        return Status::UnknownError;
+    }
+
+    mergeTimer(*timer, HookPart, merged[HookPart]);
+    mergeTimer(*timer, OriginalPart, merged[OriginalPart]);
+
+    stats.hook = summarize(merged[HookPart], nanosecondsPerTick);
+    stats.original = summarize(merged[OriginalPart], nanosecondsPerTick);
+
+    delete[] merged;
+    return Status::Success;
+}
+
+Status getTiming(const ::std::uint16_t index, TimingStats& stats)
+{
+    return getTiming(getRenderType(), index, stats);
+}
+
+namespace detail
+{
+
+void releaseTiming(const RenderType renderType, const ::std::uint16_t index) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_timingMutex);
+
+    if(Timer* const timer = findTimer(renderType, index))
+    {
+        stopLocked(*timer);
+    }
+}
+
+void releaseTiming(const RenderType renderType) noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_timingMutex);
+
+    for(Timer& timer : g_timers)
+    {
+        if(timer.active && timer.renderType == renderType)
+        {
+            stopLocked(timer);
+        }
+    }
+}
+
+}
+
+#else
+
+Status startTiming(const RenderType, const ::std::uint16_t)
+{
+    return Status::NotSupportedError;
+}
+
+Status startTiming(const ::std::uint16_t)
+{
+    return Status::NotSupportedError;
+}
+
+void stopTiming(const RenderType, const ::std::uint16_t)
+{
+}
+
+void stopTiming(const ::std::uint16_t)
+{
+}
+
+Status getTiming(const RenderType, const ::std::uint16_t, TimingStats& stats)
+{
+    stats = { };
+    return Status::NotSupportedError;
+}
+
+Status getTiming(const ::std::uint16_t, TimingStats& stats)
+{
+    stats = { };
+    return Status::NotSupportedError;
+}
+
+namespace detail
+{
+
+void releaseTiming(const RenderType, const ::std::uint16_t) noexcept
+{
+}
+
+void releaseTiming(const RenderType) noexcept
+{
+}
+
+}
+
+#endif
+
+}
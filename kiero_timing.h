@@ -0,0 +1,68 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <cstdint>
+
+namespace kiero
+{
+	// Nanoseconds, the percentiles within about 3% of the recorded values
+	struct LatencySummary
+	{
+		::std::uint64_t count;
+		::std::uint64_t mean;
+		::std::uint64_t p50;
+		::std::uint64_t p90;
+		::std::uint64_t p99;
+		::std::uint64_t max;
+	};
+
+	struct TimingStats
+	{
+		LatencySummary hook;     // time in the detour, minus its calls of the original
+		LatencySummary original; // time in the original, per call of it
+	};
+
+	// Times every call of a bound index from now on: the hook's stub enters the detour, and the
+	// trampoline the original, through a timing gate that reads the TSC around both and records
+	// into log bucketed histograms of the calling thread, without a lock or a shared write.
+	// Costs two gate passes and four TSC reads per call, the detour's time includes the gate
+	// pass of its original calls. The original pointer bind wrote is left alone, the trampoline
+	// it points to jumps to the gate until stopTiming. A call the thread cannot record for lack
+	// of memory runs untimed. Up to 64 indices at a time, binds of the built-in detour engine only:
+	// MinHook, HookMode::ImportTable and layer slots return NotSupportedError, an index that is
+	// not bound NotInitializedError. Starting an index timed already keeps its samples. Must
+	// not be called from a detour.
+	Status startTiming(const RenderType renderType, const ::std::uint16_t index);
+	Status startTiming(const ::std::uint16_t index);
+
+	// Restores the hook and drops the samples. Unbinding the index or shutting its backend
+	// down stops its timing too. Must not be called from a detour.
+	void stopTiming(const RenderType renderType, const ::std::uint16_t index);
+	void stopTiming(const ::std::uint16_t index);
+
+	// Merges the histograms of every thread that called the index, threads that exited
+	// included. Returns NotInitializedError for an index that is not timed. Any thread may call
+	// it, the timed calls never wait for it. The first call within 10 ms of startTiming sleeps
+	// out the rest, that long calibrates the TSC against the steady clock.
+	Status getTiming(const RenderType renderType, const ::std::uint16_t index, TimingStats& stats);
+	Status getTiming(const ::std::uint16_t index, TimingStats& stats);
+
+	namespace detail
+	{
+		struct HookRoute
+		{
+			void* detour;   // jumped to by the hook's stub
+			void* original; // jumped to by the trampoline, null while it runs its copy
+			void* copy;     // the trampoline's copy of the original, only read
+		};
+
+		// Implemented by kiero.cpp. current receives the route of the hook bound to the index,
+		// which is then replaced by route if any, provided it still is expected if any.
+		Status rerouteHook(const RenderType renderType, const ::std::uint16_t index, const HookRoute* const expected, const HookRoute* const route, HookRoute& current);
+
+		// Stops timing an index that is being unbound, or a backend shutting down
+		void releaseTiming(const RenderType renderType, const ::std::uint16_t index) noexcept;
+		void releaseTiming(const RenderType renderType) noexcept;
+	}
+}
@@ -0,0 +1,456 @@
+#include "kiero_trace.h"
+
+#if KIERO_TRACE
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#ifdef _WIN32
+# include <Windows.h>
+#else
+# include <sys/syscall.h>
+# include <time.h>
+# include <unistd.h>
+#endif
+
+namespace kiero
+{
+
+namespace
+{
+
+struct TraceEvent
+{
+    const char* name;
+    ::std::int64_t begin;
+    ::std::int64_t duration;
+    detail::TraceCategory category;
+    detail::TraceArgument argument;
+    ::std::int32_t value;
+};
+
+static_assert(sizeof(TraceEvent) == 32);
+
+// A reader may copy an event while a reset lets its thread overwrite it, the words are atomics
+// so the copy is merely discarded. Relaxed word stores compile to plain moves.
+struct StoredEvent
+{
+    ::std::atomic<::std::uint64_t> words[4];
+};
+
+void storeEvent(StoredEvent& stored, const TraceEvent& event) noexcept
+{
+    ::std::uint64_t words[4];
+    (void) ::std::memcpy(words, &event, sizeof(words));
+
+    for(int i = 0; i < 4; ++i)
+    {
+        stored.words[i].store(words[i], ::std::memory_order_relaxed);
+    }
+}
+
+void loadEvent(const StoredEvent& stored, TraceEvent& event) noexcept
+{
+    ::std::uint64_t words[4];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        words[i] = stored.words[i].load(::std::memory_order_relaxed);
+    }
+
+    (void) ::std::memcpy(&event, words, sizeof(words));
+}
+
+constexpr ::std::uint32_t ChunkEvents = 1024;
+constexpr ::std::uint32_t MaxChunks = 256; // a thread records at most 256K spans per trace
+
+// One per thread that ever recorded a span. Only its thread writes it: events are appended
+// into chunks that are allocated once and kept, count publishes them. Records are never freed,
+// so writeTrace can walk the list without synchronizing with thread exit. Once their thread
+// exited they are recycled, but only when they hold no events of the current trace, the spans
+// of short lived threads (e.g. the initAsync workers) stay until the next startTrace.
+struct ThreadTrace
+{
+    // Bumped before count goes back to 0 (a new trace, or a new thread adopting the record),
+    // a reader that saw it change while copying drops what it copied
+    ::std::atomic<::std::uint32_t> resets { 0 };
+    ::std::atomic<::std::uint32_t> count { 0 };
+    ::std::atomic<::std::uint32_t> session { 0 }; // the trace the events belong to
+    ::std::atomic<::std::uint32_t> threadId { 0 };
+
+    ::std::atomic<StoredEvent*> chunks[MaxChunks] { };
+
+    ::std::atomic<bool> used { true };
+    ThreadTrace* next = nullptr;
+};
+
+// Serializes startTrace and writeTrace, the recording threads never take it
+::std::mutex g_traceMutex;
+
+::std::atomic<::std::uint32_t> g_session { 0 };
+::std::atomic<::std::int64_t> g_start { 0 }; // of the current trace, the written timestamps count from it
+
+::std::atomic<ThreadTrace*> g_traces { nullptr };
+
+thread_local ThreadTrace* g_threadTrace = nullptr;
+
+// Gives the record back when its thread exits, only constructed on the thread's first span
+struct TraceOwner
+{
+    ~TraceOwner()
+    {
+        if(g_threadTrace)
+        {
+            g_threadTrace->used.store(false, ::std::memory_order_release);
+            g_threadTrace = nullptr;
+        }
+    }
+};
+
+thread_local TraceOwner g_threadTraceOwner;
+
+[[nodiscard]] ::std::uint32_t currentThreadId() noexcept
+{
+#ifdef _WIN32
+    return static_cast<::std::uint32_t>(::GetCurrentThreadId());
+#else
+    return static_cast<::std::uint32_t>(::syscall(SYS_gettid));
+#endif
+}
+
+[[nodiscard]] ::std::uint32_t currentProcessId() noexcept
+{
+#ifdef _WIN32
+    return static_cast<::std::uint32_t>(::GetCurrentProcessId());
+#else
+    return static_cast<::std::uint32_t>(::getpid());
+#endif
+}
+
+// Empties the record, called by its own thread only
+void resetTrace(ThreadTrace& trace, const ::std::uint32_t session) noexcept
+{
+    trace.resets.store(trace.resets.load(::std::memory_order_relaxed) + 1, ::std::memory_order_relaxed);
+
+    // Pairs with the fence in writeTrace: a reader that copied any event written after this
+    // reset sees resets changed
+    ::std::atomic_thread_fence(::std::memory_order_release);
+
+    trace.count.store(0, ::std::memory_order_relaxed);
+    trace.session.store(session, ::std::memory_order_relaxed);
+}
+
+[[nodiscard]] ThreadTrace* acquireTrace() noexcept
+{
+    ThreadTrace* trace = nullptr;
+
+    const ::std::uint32_t session = g_session.load(::std::memory_order_acquire);
+
+    for(ThreadTrace* record = g_traces.load(::std::memory_order_acquire); record; record = record->next)
+    {
+        // A released record no longer changes
+        if(record->used.load(::std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        if(record->session.load(::std::memory_order_relaxed) == session && record->count.load(::std::memory_order_relaxed) != 0)
+        {
+            continue;
+        }
+
+        bool used = false;
+        if(record->used.compare_exchange_strong(used, true, ::std::memory_order_acquire))
+        {
+            trace = record;
+            break;
+        }
+    }
+
+    if(!trace)
+    {
+        trace = new(::std::nothrow) ThreadTrace;
+        if(!trace)
+        {
+            return nullptr;
+        }
+
+        trace->next = g_traces.load(::std::memory_order_relaxed);
+        while(!g_traces.compare_exchange_weak(trace->next, trace, ::std::memory_order_release, ::std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // The events of the thread that had the record must not show up under this one's id
+    resetTrace(*trace, 0);
+    trace->threadId.store(currentThreadId(), ::std::memory_order_relaxed);
+
+    return trace;
+}
+
+[[nodiscard]] const char* categoryName(const detail::TraceCategory category) noexcept
+{
+    switch(category)
+    {
+    case detail::TraceCategory::Init:
+        return "init";
+    case detail::TraceCategory::Hook:
+        return "hook";
+    case detail::TraceCategory::Frame:
+        return "frame";
+    }
+
+    return "kiero";
+}
+
+[[nodiscard]] const char* renderTypeName(const ::std::int32_t type) noexcept
+{
+    static constexpr const char* const names[] = { "None", "D3D9", "D3D10", "D3D11", "D3D12", "OpenGL", "Vulkan", "Auto" };
+
+    return type >= 0 && type < static_cast<::std::int32_t>(sizeof(names) / sizeof(names[0])) ? names[type] : "Unknown";
+}
+
+void writeEvent(::std::FILE* const file, const TraceEvent& event, const ::std::int64_t start, const ::std::uint32_t processId, const ::std::uint32_t threadId) noexcept
+{
+    // Microseconds with nanosecond precision
+    const ::std::int64_t begin = event.begin - start;
+
+    ::std::fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%lld.%03lld,\"dur\":%lld.%03lld",
+        event.name, categoryName(event.category), processId, threadId,
+        static_cast<long long>(begin / 1000), static_cast<long long>(begin % 1000),
+        static_cast<long long>(event.duration / 1000), static_cast<long long>(event.duration % 1000));
+
+    switch(event.argument)
+    {
+    case detail::TraceArgument::None:
+        break;
+    case detail::TraceArgument::RenderType:
+        ::std::fprintf(file, ",\"args\":{\"renderType\":\"%s\"}", renderTypeName(event.value));
+        break;
+    case detail::TraceArgument::Index:
+        ::std::fprintf(file, ",\"args\":{\"index\":%d}", event.value);
+        break;
+    case detail::TraceArgument::Count:
+        ::std::fprintf(file, ",\"args\":{\"count\":%d}", event.value);
+        break;
+    case detail::TraceArgument::Frame:
+        ::std::fprintf(file, ",\"args\":{\"frame\":%d}", event.value);
+        break;
+    }
+
+    ::std::fputs("}", file);
+}
+
+// Copies the thread's events of the session one chunk at a time, a chunk is only written once
+// the copy is known not to have raced with a reset
+void writeThread(::std::FILE* const file, const ThreadTrace& trace, const ::std::uint32_t session, const ::std::int64_t start, const ::std::uint32_t processId,
+    TraceEvent* const buffer) noexcept
+{
+    const ::std::uint32_t resets = trace.resets.load(::std::memory_order_acquire);
+    if(trace.session.load(::std::memory_order_relaxed) != session)
+    {
+        return;
+    }
+
+    const ::std::uint32_t count = trace.count.load(::std::memory_order_acquire);
+    const ::std::uint32_t threadId = trace.threadId.load(::std::memory_order_relaxed);
+
+    for(::std::uint32_t first = 0; first < count; first += ChunkEvents)
+    {
+        const StoredEvent* const chunk = trace.chunks[first / ChunkEvents].load(::std::memory_order_acquire);
+        const ::std::uint32_t copied = count - first < ChunkEvents ? count - first : ChunkEvents;
+
+        for(::std::uint32_t i = 0; i < copied; ++i)
+        {
+            loadEvent(chunk[i], buffer[i]);
+        }
+
+        ::std::atomic_thread_fence(::std::memory_order_acquire);
+        if(trace.resets.load(::std::memory_order_relaxed) != resets)
+        {
+            return;
+        }
+
+        for(::std::uint32_t i = 0; i < copied; ++i)
+        {
+            writeEvent(file, buffer[i], start, processId, threadId);
+        }
+    }
+}
+
+}
+
+Status startTrace(const bool frames)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_traceMutex);
+
+    // Threads still recording into the previous trace start over on their next span
+    g_start.store(detail::traceTime(), ::std::memory_order_relaxed);
+    g_session.store(g_session.load(::std::memory_order_relaxed) + 1, ::std::memory_order_release);
+
+    ::std::uint32_t categories = static_cast<::std::uint32_t>(detail::TraceCategory::Init) | static_cast<::std::uint32_t>(detail::TraceCategory::Hook);
+    if(frames)
+    {
+        categories |= static_cast<::std::uint32_t>(detail::TraceCategory::Frame);
+    }
+
+    detail::g_traceCategories.store(categories, ::std::memory_order_release);
+
+    return Status::Success;
+}
+
+void stopTrace() noexcept
+{
+    detail::g_traceCategories.store(0, ::std::memory_order_relaxed);
+}
+
+Status writeTrace(const char* const path)
+{
+    const ::std::lock_guard<::std::mutex> lock(g_traceMutex);
+
+    const ::std::uint32_t session = g_session.load(::std::memory_order_relaxed);
+    if(session == 0)
+    {
+        return Status::NotInitializedError;
+    }
+
+    auto* buffer = new(::std::nothrow) TraceEvent[ChunkEvents];
+    if(!buffer)
+    {
+        return Status::UnknownError;
+    }
+
+    ::std::FILE* const file = ::std::fopen(path, "w");
+    if(!file)
+    {
+        delete[] buffer;
+        return Status::UnknownError;
+    }
+
+    const ::std::uint32_t processId = currentProcessId();
+
+    ::std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"kiero " KIERO_VERSION "\"}}", processId);
+
+    for(const ThreadTrace* trace = g_traces.load(::std::memory_order_acquire); trace; trace = trace->next)
+    {
+        writeThread(file, *trace, session, g_start.load(::std::memory_order_relaxed), processId, buffer);
+    }
+
+    ::std::fputs("\n]}\n", file);
+
+    delete[] buffer;
+
+    return ::std::fclose(file) == 0 ? Status::Success : Status::UnknownError;
+}
+
+namespace detail
+{
+
+::std::int64_t traceTime() noexcept
+{
+#ifdef _WIN32
+    static const ::std::int64_t frequency = []
+    {
+        LARGE_INTEGER value;
+        ::QueryPerformanceFrequency(&value);
+        return static_cast<::std::int64_t>(value.QuadPart);
+    }();
+
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+
+    const ::std::int64_t ticks = counter.QuadPart;
+    return ticks / frequency * 1'000'000'000 + ticks % frequency * 1'000'000'000 / frequency;
+#else
+    timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<::std::int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+#endif
+}
+
+void recordTrace(const TraceCategory category, const char* const name, const ::std::int64_t begin, const ::std::int64_t end,
+    const TraceArgument argument, const ::std::int32_t value) noexcept
+{
+    ThreadTrace* trace = g_threadTrace;
+
+    if(!trace)
+    {
+        // Touching the owner registers its destructor for this thread
+        (void) &g_threadTraceOwner;
+
+        trace = acquireTrace();
+        if(!trace)
+        {
+            return;
+        }
+
+        g_threadTrace = trace;
+    }
+
+    const ::std::uint32_t session = g_session.load(::std::memory_order_acquire);
+    if(trace->session.load(::std::memory_order_relaxed) != session)
+    {
+        resetTrace(*trace, session);
+    }
+
+    // A span that began before startTrace belongs to no trace
+    if(begin < g_start.load(::std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const ::std::uint32_t index = trace->count.load(::std::memory_order_relaxed);
+    if(index >= ChunkEvents * MaxChunks)
+    {
+        return;
+    }
+
+    ::std::atomic<StoredEvent*>& slot = trace->chunks[index / ChunkEvents];
+
+    StoredEvent* chunk = slot.load(::std::memory_order_relaxed);
+    if(!chunk)
+    {
+        chunk = new(::std::nothrow) StoredEvent[ChunkEvents];
+        if(!chunk)
+        {
+            return;
+        }
+
+        slot.store(chunk, ::std::memory_order_release);
+    }
+
+    storeEvent(chunk[index % ChunkEvents], TraceEvent { name, begin, end - begin, category, argument, value });
+
+    trace->count.store(index + 1, ::std::memory_order_release);
+}
+
+}
+
+}
+
+#else
+
+namespace kiero
+{
+
+Status startTrace(const bool)
+{
+    return Status::NotSupportedError;
+}
+
+void stopTrace() noexcept
+{
+}
+
+Status writeTrace(const char* const)
+{
+    return Status::NotSupportedError;
+}
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "kiero.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace kiero
+{
+	// Starts recording timed spans of kiero's own work into per-thread buffers: every init
+	// stage (probing, the throwaway devices, symbol resolution, the cache, publishing) and
+	// shutdown, every bind and unbind, and with frames every frame boundary (kiero_frame.h).
+	// Starting again drops what was recorded. Needs KIERO_TRACE, returns NotSupportedError
+	// without it.
+	Status startTrace(const bool frames = false);
+
+	// Stops recording, what was recorded stays until the next startTrace
+	void stopTrace() noexcept;
+
+	// Writes the spans recorded since startTrace to path as Chrome trace event JSON, for
+	// chrome://tracing or ui.perfetto.dev. May be called while recording, the threads recording
+	// never wait for it.
+	Status writeTrace(const char* const path);
+
+	namespace detail
+	{
+		enum class TraceCategory : ::std::uint8_t
+		{
+			Init = 1 << 0,
+			Hook = 1 << 1,
+			Frame = 1 << 2,
+		};
+
+		// What the span's value is, it names the value in the written args
+		enum class TraceArgument : ::std::uint8_t
+		{
+			None,
+			RenderType,
+			Index,
+			Count,
+			Frame,
+		};
+
+#if KIERO_TRACE
+		// The categories recorded, 0 while stopped
+		inline ::std::atomic<::std::uint32_t> g_traceCategories { 0 };
+
+		[[nodiscard]] inline bool isTracing(const TraceCategory category) noexcept
+		{
+			return (g_traceCategories.load(::std::memory_order_relaxed) & static_cast<::std::uint32_t>(category)) != 0;
+		}
+
+		// Monotonic nanoseconds
+		[[nodiscard]] ::std::int64_t traceTime() noexcept;
+
+		// name must outlive the trace (a string literal)
+		void recordTrace(const TraceCategory category, const char* const name, const ::std::int64_t begin, const ::std::int64_t end,
+			const TraceArgument argument, const ::std::int32_t value) noexcept;
+
+		// Records the scope it lives in, costs one relaxed load while tracing is off
+		class TraceSpan
+		{
+		public:
+			TraceSpan(const TraceCategory category, const char* const name, const TraceArgument argument = TraceArgument::None, const ::std::int32_t value = 0) noexcept
+				: m_name(name), m_category(category), m_argument(argument), m_value(value)
+			{
+				if(isTracing(category))
+				{
+					m_begin = traceTime();
+				}
+			}
+
+			~TraceSpan()
+			{
+				if(m_begin != 0)
+				{
+					recordTrace(m_category, m_name, m_begin, traceTime(), m_argument, m_value);
+				}
+			}
+
+			TraceSpan(const TraceSpan&) = delete;
+			TraceSpan& operator=(const TraceSpan&) = delete;
+
+		private:
+			const char* m_name;
+			::std::int64_t m_begin = 0;
+			TraceCategory m_category;
+			TraceArgument m_argument;
+			::std::int32_t m_value;
+		};
+#endif
+	}
+}
+
+// KIERO_TRACE_SPAN(Hook, "bind", Index, index) records the rest of the enclosing scope,
+// compiled out without KIERO_TRACE
+#if KIERO_TRACE
+# define KIERO_TRACE_CONCAT_(a, b) a##b
+# define KIERO_TRACE_CONCAT(a, b) KIERO_TRACE_CONCAT_(a, b)
+# define KIERO_TRACE_SPAN(category, name, ...) \
+	const ::kiero::detail::TraceSpan KIERO_TRACE_CONCAT(kieroTraceSpan, __LINE__)(::kiero::detail::TraceCategory::category, name __VA_OPT__(, KIERO_TRACE_ARGUMENT_(__VA_ARGS__)))
+# define KIERO_TRACE_ARGUMENT_(argument, value) ::kiero::detail::TraceArgument::argument, static_cast<::std::int32_t>(value)
+#else
+# define KIERO_TRACE_SPAN(category, name, ...) static_cast<void>(0)
+#endif
@@ -0,0 +1,331 @@
+#include "kiero_vtable.h"
+#include "kiero_detour.h"
+#include "kiero_epoch.h"
+#include "kiero_trace.h"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#ifdef _WIN32
+# define WIN32_LEAN_AND_MEAN
+# include <Windows.h>
+#endif
+
+namespace kiero
+{
+
+namespace
+{
+
+// Entries in front of the first virtual function: the RTTI complete object locator
+// for MSVC, offset-to-top and typeinfo for the Itanium ABI
+#ifdef _MSC_VER
+constexpr ::std::size_t TablePrefix = 1;
+#else
+constexpr ::std::size_t TablePrefix = 2;
+#endif
+
+constexpr ::std::size_t MaxTableSize = 1024;
+
+struct ShadowTable
+{
+    void* object;
+    void** originalTable;
+    void** table; // TablePrefix entries followed by size slots
+    ::std::size_t size;
+    ::std::uint32_t references; // hooked slots
+
+    ShadowTable* next;
+};
+
+::std::mutex g_mutex;
+ShadowTable* g_tables = nullptr;
+
+#ifdef _WIN32
+
+[[nodiscard]] bool isReadable(const void* const address) noexcept
+{
+    MEMORY_BASIC_INFORMATION info;
+    return ::VirtualQuery(address, &info, sizeof(info)) && info.State == MEM_COMMIT && !(info.Protect & (PAGE_NOACCESS | PAGE_GUARD));
+}
+
+[[nodiscard]] bool isExecutable(const void* const address) noexcept
+{
+    MEMORY_BASIC_INFORMATION info;
+    return ::VirtualQuery(address, &info, sizeof(info)) && info.State == MEM_COMMIT && (info.Protect & (PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY));
+}
+
+::std::size_t countSlots(void** const table) noexcept
+{
+    ::std::size_t size = 0;
+    while(size < MaxTableSize && isReadable(table + size) && isExecutable(table[size]))
+    {
+        ++size;
+    }
+
+    return size;
+}
+
+#else
+
+struct SlotCounter
+{
+    void** table;
+    ::std::size_t size = 0;
+    bool done = false;
+
+    // Mappings are reported in address order, the code ones come from other modules
+    detail::Mapping readable[8] { };
+    ::std::size_t readableCount = 0;
+    detail::Mapping* executable = nullptr;
+    ::std::size_t executableCount = 0;
+    ::std::size_t executableCapacity = 0;
+};
+
+::std::size_t countSlots(void** const table) noexcept
+{
+    SlotCounter counter;
+    counter.table = table;
+
+    const bool scanned = detail::forEachMapping([](void* const context, const detail::Mapping& mapping)
+    {
+        auto& counter = *static_cast<SlotCounter*>(context);
+
+        if(mapping.executable)
+        {
+            if(counter.executableCount == counter.executableCapacity)
+            {
+                const ::std::size_t capacity = counter.executableCapacity ? counter.executableCapacity * 2 : 64;
+                auto* const ranges = new(::std::nothrow) detail::Mapping [capacity];
+                if(!ranges)
+                {
+                    return false;
+                }
+
+                (void) ::std::memcpy(ranges, counter.executable, counter.executableCount * sizeof(detail::Mapping));
+                delete[] counter.executable;
+                counter.executable = ranges;
+                counter.executableCapacity = capacity;
+            }
+
+            counter.executable[counter.executableCount++] = mapping;
+        }
+
+        // Readable mappings covering the table, contiguous from its start
+        const ::std::uintptr_t first = reinterpret_cast<::std::uintptr_t>(counter.table);
+        const ::std::uintptr_t last = first + MaxTableSize * sizeof(void*);
+
+        if(mapping.readable && mapping.end > first && mapping.start < last && counter.readableCount < ::std::size(counter.readable))
+        {
+            counter.readable[counter.readableCount++] = mapping;
+        }
+
+        return true;
+    }, &counter);
+
+    ::std::size_t size = 0;
+
+    if(scanned)
+    {
+        const auto contains = [](const detail::Mapping* const ranges, const ::std::size_t count, const ::std::uintptr_t address)
+        {
+            for(::std::size_t i = 0; i < count; ++i)
+            {
+                if(address >= ranges[i].start && address < ranges[i].end)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        while(size < MaxTableSize)
+        {
+            const ::std::uintptr_t slot = reinterpret_cast<::std::uintptr_t>(table + size);
+            if(!contains(counter.readable, counter.readableCount, slot) || !contains(counter.executable, counter.executableCount, reinterpret_cast<::std::uintptr_t>(table[size])))
+            {
+                break;
+            }
+
+            ++size;
+        }
+    }
+
+    delete[] counter.executable;
+    return size;
+}
+
+#endif
+
+[[nodiscard]] ::std::atomic_ref<void**> vtablePointer(void* const object) noexcept
+{
+    return ::std::atomic_ref<void**>(*static_cast<void***>(object));
+}
+
+void freeTable(void* const pointer)
+{
+    auto* const shadow = static_cast<ShadowTable*>(pointer);
+
+    delete[] shadow->table;
+    delete shadow;
+}
+
+// A caller may still be reading the table through a vptr it loaded before
+void retireTable(ShadowTable* const shadow) noexcept
+{
+    ShadowTable** link = &g_tables;
+    while(*link != shadow)
+    {
+        link = &(*link)->next;
+    }
+
+    *link = shadow->next;
+    detail::retire(shadow, freeTable);
+}
+
+// The shadow table of the object at that address, provided the object still uses it. One it
+// no longer uses belonged to an object since destroyed, or one being destroyed whose base
+// destructor set its own vptr, and is dropped without touching the object.
+ShadowTable* findTable(void* const object) noexcept
+{
+    for(ShadowTable* table = g_tables; table; table = table->next)
+    {
+        if(table->object == object)
+        {
+            if(vtablePointer(object).load() != table->table + TablePrefix)
+            {
+                retireTable(table);
+                return nullptr;
+            }
+
+            return table;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace
+
+Status bindInstance(void* const object, const ::std::uint16_t index, void** const original, void* const function)
+{
+    if(!object || !original || !function)
+    {
+        return Status::UnknownError;
+    }
+
+    KIERO_TRACE_SPAN(Hook, "bindInstance", Index, index);
+
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    ShadowTable* shadow = findTable(object);
+
+    if(!shadow)
+    {
+        void** const originalTable = vtablePointer(object).load();
+
+        const ::std::size_t size = countSlots(originalTable);
+        if(index >= size)
+        {
+            return Status::NotSupportedError;
+        }
+
+        shadow = new(::std::nothrow) ShadowTable;
+        void** const table = new(::std::nothrow) void* [TablePrefix + size];
+
+        if(!shadow || !table)
+        {
+            delete shadow;
+            delete[] table;
+            return Status::UnknownError;
+        }
+
+        (void) ::std::memcpy(static_cast<void*>(table), originalTable - TablePrefix, (TablePrefix + size) * sizeof(void*));
+
+        shadow->object = object;
+        shadow->originalTable = originalTable;
+        shadow->table = table;
+        shadow->size = size;
+        shadow->references = 0;
+        shadow->next = g_tables;
+        g_tables = shadow;
+
+        vtablePointer(object).store(table + TablePrefix);
+    }
+    else if(index >= shadow->size)
+    {
+        return Status::NotSupportedError;
+    }
+
+    void** const slot = shadow->table + TablePrefix + index;
+    if(*slot != shadow->originalTable[index])
+    {
+        return Status::UnknownError; // already hooked
+    }
+
+    *original = shadow->originalTable[index];
+    ::std::atomic_ref<void*>(*slot).store(function);
+    ++shadow->references;
+
+    return Status::Success;
+}
+
+void unbindInstance(void* const object, const ::std::uint16_t index)
+{
+    KIERO_TRACE_SPAN(Hook, "unbindInstance", Index, index);
+
+    if(!object)
+    {
+        return;
+    }
+
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    ShadowTable* const shadow = findTable(object);
+    if(!shadow || index >= shadow->size)
+    {
+        return;
+    }
+
+    void** const slot = shadow->table + TablePrefix + index;
+    if(*slot == shadow->originalTable[index])
+    {
+        return;
+    }
+
+    ::std::atomic_ref<void*>(*slot).store(shadow->originalTable[index]);
+
+    if(--shadow->references == 0)
+    {
+        // Unless a destructor running meanwhile set a vptr of its own
+        void** expected = shadow->table + TablePrefix;
+        (void) vtablePointer(object).compare_exchange_strong(expected, shadow->originalTable);
+
+        retireTable(shadow);
+    }
+}
+
+void detail::releaseShadowTables() noexcept
+{
+    const ::std::lock_guard<::std::mutex> lock(g_mutex);
+
+    // An instance still bound may have been destroyed without unbinding, its memory is not
+    // touched. Its shadow gets the original functions back and is left to the instance.
+    while(g_tables)
+    {
+        ShadowTable* const shadow = g_tables;
+        g_tables = shadow->next;
+
+        for(::std::size_t i = 0; i < shadow->size; ++i)
+        {
+            ::std::atomic_ref<void*>(shadow->table[TablePrefix + i]).store(shadow->originalTable[i]);
+        }
+
+        delete shadow;
+    }
+}
+
+}
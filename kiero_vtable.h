@@ -0,0 +1,10 @@
+#pragma once
+
+#include "kiero.h"
+
+namespace kiero::detail
+{
+	// Called by shutdown: forgets the instances still bound without touching them, their shadow
+	// vtables get the original functions back and are never freed
+	void releaseShadowTables() noexcept;
+}
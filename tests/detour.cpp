@@ -0,0 +1,368 @@
+// kiero-test-detour: the built-in detour engine on functions of known bytes. Decodes the
+// instructions a prologue starts with, hooks functions whose patched range holds a RIP-relative
+// load, a short branch out of the range, a call and a whole jump, rejects one it cannot
+// relocate, keeps the protection a page had before, never makes its trampolines and stubs
+// writable, and patches a function another thread is spinning in: the frozen thread must go on
+// from the trampoline's copy of its instruction.
+// Failures are reported on stderr, the exit code is their count.
+
+#include "kiero_detour.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Functions whose bytes the compiler cannot choose
+extern "C"
+{
+    int kiero_test_load();
+    int kiero_test_branch(int value);
+    int kiero_test_call();
+    int kiero_test_tail();
+    int kiero_test_loop();
+    void kiero_test_spin();
+}
+
+asm(R"(
+    .intel_syntax noprefix
+    .text
+
+    .p2align 4
+    .globl kiero_test_load
+    .hidden kiero_test_load
+kiero_test_load:
+    mov eax, dword ptr [rip + kiero_test_value]
+    ret
+
+    .p2align 4
+    .globl kiero_test_branch
+    .hidden kiero_test_branch
+kiero_test_branch:
+    test edi, edi
+    jz 1f
+    mov eax, 1
+    ret
+1:
+    mov eax, 2
+    ret
+
+    .p2align 4
+    .globl kiero_test_call
+    .hidden kiero_test_call
+kiero_test_call:
+    .byte 0xE8
+    .long kiero_test_seven - . - 4
+    add eax, 1
+    ret
+
+    .p2align 4
+    .globl kiero_test_tail
+    .hidden kiero_test_tail
+kiero_test_tail:
+    .byte 0xE9
+    .long kiero_test_seven - . - 4
+
+    .p2align 4
+kiero_test_seven:
+    mov eax, 7
+    ret
+
+    .p2align 4
+    .globl kiero_test_loop
+    .hidden kiero_test_loop
+kiero_test_loop:
+    loop 1f
+1:
+    mov eax, 0
+    ret
+
+    .p2align 4
+    .globl kiero_test_spin
+    .hidden kiero_test_spin
+kiero_test_spin:
+    pause
+    cmp byte ptr [rip + kiero_test_flag], 0
+    je kiero_test_spin
+    ret
+
+    .data
+kiero_test_value:
+    .long 42
+kiero_test_flag:
+    .byte 0
+
+    .text
+    .att_syntax prefix
+)");
+
+namespace
+{
+
+int g_failures = 0;
+
+void check(const bool condition, const char* const what)
+{
+    if(!condition)
+    {
+        ::std::fprintf(stderr, "%s\n", what);
+        ++g_failures;
+    }
+}
+
+void checkDecode()
+{
+    struct Case
+    {
+        ::std::uint8_t bytes[15];
+        ::std::uint8_t length;
+        ::std::uint8_t dispOffset;
+        kiero::detail::InstructionKind kind;
+    };
+
+    using Kind = kiero::detail::InstructionKind;
+
+    const Case cases[] =
+    {
+        { { 0x55 }, 1, 0, Kind::Plain },                                         // push rbp
+        { { 0x48, 0x89, 0xE5 }, 3, 0, Kind::Plain },                             // mov rbp, rsp
+        { { 0x48, 0x83, 0xEC, 0x20 }, 4, 0, Kind::Plain },                       // sub rsp, 0x20
+        { { 0x48, 0x8B, 0x05, 1, 2, 3, 4 }, 7, 3, Kind::Plain },                 // mov rax, [rip+disp32]
+        { { 0xF3, 0x0F, 0x1E, 0xFA }, 4, 0, Kind::Plain },                       // endbr64
+        { { 0xE8, 0, 0, 0, 0 }, 5, 0, Kind::Call },                              // call rel32
+        { { 0xEB, 0x10 }, 2, 0, Kind::Jmp },                                     // jmp rel8
+        { { 0x0F, 0x84, 0, 0, 0, 0 }, 6, 0, Kind::Jcc },                         // je rel32
+        { { 0xE2, 0x00 }, 2, 0, Kind::Loop },                                    // loop rel8
+        { { 0xC3 }, 1, 0, Kind::Return },                                        // ret
+        { { 0xFF, 0x25, 0, 0, 0, 0 }, 6, 2, Kind::Indirect },                    // jmp [rip+disp32]
+        { { 0x0F, 0x1F, 0x44, 0x00, 0x00 }, 5, 0, Kind::Nop },                   // nop dword [rax+rax]
+        { { 0x48, 0xB8, 1, 2, 3, 4, 5, 6, 7, 8 }, 10, 0, Kind::Plain },          // movabs rax, imm64
+        { { 0xC7, 0x05, 1, 2, 3, 4, 5, 6, 7, 8 }, 10, 2, Kind::Plain },          // mov dword [rip+disp32], imm32
+    };
+
+    for(const Case& test : cases)
+    {
+        kiero::detail::Instruction instruction;
+        const bool decoded = kiero::detail::decode(test.bytes, instruction);
+
+        char what[96];
+        ::std::snprintf(what, sizeof(what), "decode of %02x %02x %02x", test.bytes[0], test.bytes[1], test.bytes[2]);
+
+        check(decoded && instruction.length == test.length && instruction.dispOffset == test.dispOffset && instruction.kind == test.kind, what);
+    }
+}
+
+// The detour calls the original through the trampoline and marks the result as its own
+template<auto& hook, typename... Args>
+int detour(Args... args)
+{
+    return reinterpret_cast<int (*)(Args...)>(hook.trampoline)(args...) + 1000;
+}
+
+kiero::detail::Hook g_load;
+kiero::detail::Hook g_branch;
+kiero::detail::Hook g_call;
+kiero::detail::Hook g_tail;
+
+void checkHook(kiero::detail::Hook& hook, void* const target, void* const detour, const char* const name, int (*const call)(), const int original)
+{
+    char what[96];
+
+    ::std::uint8_t bytes[kiero::detail::MaxPatchSize];
+    ::std::memcpy(bytes, target, sizeof(bytes));
+
+    ::std::snprintf(what, sizeof(what), "createHook of %s failed", name);
+    check(kiero::detail::createHook(target, detour, hook) == kiero::Status::Success, what);
+
+    ::std::snprintf(what, sizeof(what), "enableHook of %s failed", name);
+    check(kiero::detail::enableHook(hook) == kiero::Status::Success, what);
+
+    ::std::snprintf(what, sizeof(what), "%s did not reach its detour, or its trampoline not the original", name);
+    check(call() == original + 1000, what);
+
+    ::std::snprintf(what, sizeof(what), "disableHook of %s failed", name);
+    check(kiero::detail::disableHook(hook) == kiero::Status::Success, what);
+
+    ::std::snprintf(what, sizeof(what), "%s is not itself again after disableHook", name);
+    check(call() == original && ::std::memcmp(bytes, target, sizeof(bytes)) == 0, what);
+
+    kiero::detail::destroyHook(hook);
+}
+
+void checkHooks()
+{
+    checkHook(g_load, reinterpret_cast<void*>(kiero_test_load), reinterpret_cast<void*>(detour<g_load>), "a RIP-relative load",
+        kiero_test_load, 42);
+
+    checkHook(g_call, reinterpret_cast<void*>(kiero_test_call), reinterpret_cast<void*>(detour<g_call>), "a call", kiero_test_call, 8);
+    checkHook(g_tail, reinterpret_cast<void*>(kiero_test_tail), reinterpret_cast<void*>(detour<g_tail>), "a jump", kiero_test_tail, 7);
+
+    // Both ways out of the short branch
+    checkHook(g_branch, reinterpret_cast<void*>(kiero_test_branch), reinterpret_cast<void*>(detour<g_branch, int>), "a taken short branch",
+        [] { return kiero_test_branch(0); }, 2);
+    checkHook(g_branch, reinterpret_cast<void*>(kiero_test_branch), reinterpret_cast<void*>(detour<g_branch, int>), "a short branch",
+        [] { return kiero_test_branch(1); }, 1);
+
+    kiero::detail::Hook loop;
+    check(kiero::detail::createHook(reinterpret_cast<void*>(kiero_test_loop), reinterpret_cast<void*>(kiero_test_load), loop) == kiero::Status::NotSupportedError,
+        "createHook relocated a loop instruction, which has no rel32 form");
+}
+
+[[nodiscard]] int protectionOf(const void* const address)
+{
+    struct Search
+    {
+        ::std::uintptr_t address;
+        int protection = -1;
+    };
+
+    Search search { reinterpret_cast<::std::uintptr_t>(address) };
+    (void) kiero::detail::forEachMapping([](void* const context, const kiero::detail::Mapping& mapping)
+    {
+        Search& search = *static_cast<Search*>(context);
+        if(search.address >= mapping.start && search.address < mapping.end)
+        {
+            search.protection = (mapping.readable ? PROT_READ : 0) | (mapping.writable ? PROT_WRITE : 0) | (mapping.executable ? PROT_EXEC : 0);
+            return false;
+        }
+
+        return true;
+    }, &search);
+
+    return search.protection;
+}
+
+// Patching and restoring keep the protection the page had, however it was mapped
+void checkProtection(const int protection, const char* const name)
+{
+    constexpr ::std::uint8_t five[] = { 0xB8, 5, 0, 0, 0, 0xC3 }; // mov eax, 5; ret
+
+    void* const page = ::mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(page == MAP_FAILED)
+    {
+        check(false, "mmap failed");
+        return;
+    }
+
+    ::std::memcpy(page, five, sizeof(five));
+    ::mprotect(page, 4096, protection);
+
+    kiero::detail::Hook hook;
+    const bool hooked = kiero::detail::createHook(page, reinterpret_cast<void*>(kiero_test_load), hook) == kiero::Status::Success
+        && kiero::detail::enableHook(hook) == kiero::Status::Success;
+
+    char what[96];
+    ::std::snprintf(what, sizeof(what), "hooking a function in a %s page failed", name);
+    check(hooked && reinterpret_cast<int (*)()>(page)() == 42, what);
+
+    ::std::snprintf(what, sizeof(what), "enableHook changed the protection of a %s page", name);
+    check(protectionOf(page) == protection, what);
+
+    (void) kiero::detail::disableHook(hook);
+
+    ::std::snprintf(what, sizeof(what), "disableHook changed the protection of a %s page", name);
+    check(protectionOf(page) == protection && reinterpret_cast<int (*)()>(page)() == 5, what);
+
+    kiero::detail::destroyHook(hook);
+
+    // The stub and trampoline stay with the target, so does the page
+}
+
+// Trampolines and stubs are written through an alias while other threads may run them, their
+// own pages stay r-x throughout, the stubs' entries rw-
+void checkPages(const kiero::detail::Hook& hook)
+{
+    const ::std::size_t page = static_cast<::std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto* const stub = reinterpret_cast<const ::std::uint8_t*>(hook.entry) - page;
+
+    check(protectionOf(hook.trampoline) == (PROT_READ | PROT_EXEC) && protectionOf(stub) == (PROT_READ | PROT_EXEC),
+        "a trampoline or stub page is not r-x");
+    check(protectionOf(hook.entry) == (PROT_READ | PROT_WRITE), "a stub's entry page is not rw-");
+}
+
+kiero::detail::Hook g_pages;
+
+void checkGeneratedCode()
+{
+    for(const bool drained : { false, true })
+    {
+        if(kiero::detail::createHook(reinterpret_cast<void*>(kiero_test_load), reinterpret_cast<void*>(detour<g_load>), g_pages, drained) != kiero::Status::Success)
+        {
+            check(false, "createHook of a RIP-relative load failed");
+            continue;
+        }
+
+        check(kiero::detail::enableHook(g_pages) == kiero::Status::Success && kiero::detail::routeTrampoline(g_pages, reinterpret_cast<void*>(kiero_test_call)) == kiero::Status::Success,
+            "enableHook or routeTrampoline of a RIP-relative load failed");
+        checkPages(g_pages);
+
+        // A drained hook no thread runs is freed right away
+        kiero::detail::Hook* const hooks[] = { &g_pages };
+        check(kiero::detail::destroyHooks(hooks, 1) == kiero::Status::Success, "destroyHooks of an idle hook failed");
+        check(kiero_test_load() == 42, "kiero_test_load is not itself again after destroyHooks");
+    }
+}
+
+kiero::detail::Hook g_spin;
+::std::atomic<int> g_spinDetours { 0 };
+
+void spinDetour()
+{
+    g_spinDetours.fetch_add(1, ::std::memory_order_relaxed);
+}
+
+// The spinning thread sits anywhere in kiero_test_spin's overwritten range when the hook is
+// enabled, it must leave the loop through the detour instead of running half a jump
+void checkFrozenThreads()
+{
+    if(kiero::detail::createHook(reinterpret_cast<void*>(kiero_test_spin), reinterpret_cast<void*>(spinDetour), g_spin) != kiero::Status::Success)
+    {
+        check(false, "createHook of the spinning function failed");
+        return;
+    }
+
+    constexpr int Rounds = 200;
+
+    for(int i = 0; i < Rounds; ++i)
+    {
+        ::std::atomic<bool> started { false };
+        ::std::thread spinner([&]
+        {
+            started.store(true, ::std::memory_order_release);
+            kiero_test_spin();
+        });
+
+        while(!started.load(::std::memory_order_acquire))
+        {
+            ::std::this_thread::yield();
+        }
+
+        ::std::this_thread::sleep_for(::std::chrono::microseconds(100 + i * 7 % 300));
+
+        check(kiero::detail::enableHook(g_spin) == kiero::Status::Success, "enableHook of the spinning function failed");
+        spinner.join();
+        check(kiero::detail::disableHook(g_spin) == kiero::Status::Success, "disableHook of the spinning function failed");
+    }
+
+    check(g_spinDetours.load() == Rounds, "a thread spinning in a patched prologue did not leave through the detour");
+    kiero::detail::destroyHook(g_spin);
+}
+
+} // namespace
+
+int main()
+{
+    checkDecode();
+    checkHooks();
+    checkProtection(PROT_READ | PROT_EXEC, "r-x");
+    checkProtection(PROT_READ | PROT_WRITE | PROT_EXEC, "rwx");
+    checkGeneratedCode();
+    checkFrozenThreads();
+
+    return g_failures;
+}
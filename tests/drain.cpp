@@ -0,0 +1,194 @@
+// kiero-test-drain: drained hooks of the built-in detour engine. Threads keep calling a hooked
+// function while the main thread hooks and destroys it again and again: once destroyHooks
+// returns Success no thread may be inside the detour, and the freed stub and trampoline must
+// never run again (a thread that did would crash or call into the next hook's code). A hook
+// destroyed from inside its own detour is left pending and drained by drainHooks later.
+// Failures are reported on stderr, the exit code is their count.
+
+#include "kiero_detour.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// Functions whose bytes the compiler cannot choose
+extern "C"
+{
+    int kiero_test_work(int value);
+    int kiero_test_self(int value);
+}
+
+asm(R"(
+    .intel_syntax noprefix
+    .text
+
+    .p2align 4
+    .globl kiero_test_work
+    .hidden kiero_test_work
+kiero_test_work:
+    mov eax, edi
+    add eax, 1
+    ret
+
+    .p2align 4
+    .globl kiero_test_self
+    .hidden kiero_test_self
+kiero_test_self:
+    mov eax, edi
+    add eax, 2
+    ret
+
+    .att_syntax prefix
+)");
+
+namespace
+{
+
+int g_failures = 0;
+
+void check(const bool condition, const char* const what)
+{
+    if(!condition)
+    {
+        ::std::fprintf(stderr, "%s\n", what);
+        ++g_failures;
+    }
+}
+
+using Function = int (*)(int);
+
+kiero::detail::Hook g_work;
+::std::atomic<Function> g_original { nullptr };
+::std::atomic<int> g_inside { 0 };
+::std::atomic<::std::uint64_t> g_detours { 0 };
+
+int workDetour(const int value)
+{
+    g_inside.fetch_add(1, ::std::memory_order_acq_rel);
+
+    // Long enough for the freezes to find threads in here
+    for(int i = 0; i < 16; ++i)
+    {
+        __builtin_ia32_pause();
+    }
+
+    const int result = g_original.load(::std::memory_order_acquire)(value);
+
+    g_detours.fetch_add(1, ::std::memory_order_relaxed);
+    g_inside.fetch_sub(1, ::std::memory_order_acq_rel);
+
+    return result;
+}
+
+void checkHammered()
+{
+    constexpr unsigned Threads = 4;
+    constexpr int Rounds = 50;
+
+    ::std::atomic<bool> stop { false };
+    ::std::atomic<bool> wrong { false };
+    ::std::vector<::std::thread> workers;
+
+    for(unsigned i = 0; i < Threads; ++i)
+    {
+        workers.emplace_back([&stop, &wrong]
+        {
+            for(int value = 0; !stop.load(::std::memory_order_relaxed); ++value)
+            {
+                if(kiero_test_work(value) != value + 1)
+                {
+                    wrong.store(true, ::std::memory_order_relaxed);
+                }
+
+                // Some time outside, as a game spends it between its graphics calls
+                for(int i = 0; i < 256; ++i)
+                {
+                    __builtin_ia32_pause();
+                }
+            }
+        });
+    }
+
+    int drained = 0;
+
+    for(int round = 0; round < Rounds; ++round)
+    {
+        if(kiero::detail::createHook(reinterpret_cast<void*>(kiero_test_work), reinterpret_cast<void*>(workDetour), g_work, true) != kiero::Status::Success)
+        {
+            check(false, "createHook of a drained hook failed");
+            break;
+        }
+
+        g_original.store(reinterpret_cast<Function>(g_work.trampoline), ::std::memory_order_release);
+
+        check(kiero::detail::enableHook(g_work) == kiero::Status::Success, "enableHook of a drained hook failed");
+        ::std::this_thread::sleep_for(::std::chrono::microseconds(100 + round * 7 % 300));
+
+        kiero::detail::Hook* const hooks[] = { &g_work };
+        if(kiero::detail::destroyHooks(hooks, 1) == kiero::Status::Success)
+        {
+            ++drained;
+            check(g_inside.load(::std::memory_order_acquire) == 0, "destroyHooks returned while a thread was inside the drained detour");
+        }
+    }
+
+    stop.store(true, ::std::memory_order_relaxed);
+
+    for(::std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    check(!wrong.load(), "a call through a drained hook returned a wrong result");
+    check(g_detours.load() > 0, "no call went through the drained detour");
+    check(drained > 0, "no drained hook was freed while the threads kept calling");
+    check(kiero::detail::drainHooks(1000) == kiero::Status::Success, "drainHooks left hooks pending once the threads stopped");
+}
+
+kiero::detail::Hook g_self;
+Function g_selfOriginal = nullptr;
+kiero::Status g_selfStatus = kiero::Status::Success;
+::std::chrono::steady_clock::duration g_selfElapsed { };
+
+int selfDetour(const int value)
+{
+    const auto start = ::std::chrono::steady_clock::now();
+
+    kiero::detail::Hook* const hooks[] = { &g_self };
+    g_selfStatus = kiero::detail::destroyHooks(hooks, 1);
+    g_selfElapsed = ::std::chrono::steady_clock::now() - start;
+
+    return g_selfOriginal(value) + 1000;
+}
+
+// Waiting for the detour it is called from would never end, destroyHooks returns right away
+void checkSelf()
+{
+    if(kiero::detail::createHook(reinterpret_cast<void*>(kiero_test_self), reinterpret_cast<void*>(selfDetour), g_self, true) != kiero::Status::Success)
+    {
+        check(false, "createHook of a drained hook failed");
+        return;
+    }
+
+    g_selfOriginal = reinterpret_cast<Function>(g_self.trampoline);
+    check(kiero::detail::enableHook(g_self) == kiero::Status::Success, "enableHook of a drained hook failed");
+
+    check(kiero_test_self(1) == 1003, "the drained hook destroying itself did not reach its trampoline");
+    check(g_selfStatus == kiero::Status::TimeoutError, "destroyHooks from inside the detour did not leave the hook pending");
+    check(g_selfElapsed < ::std::chrono::milliseconds(500), "destroyHooks from inside the detour waited for itself");
+    check(kiero_test_self(1) == 3, "the hook destroyed from its detour still runs");
+    check(kiero::detail::drainHooks(1000) == kiero::Status::Success, "drainHooks did not free the hook destroyed from its detour");
+}
+
+} // namespace
+
+int main()
+{
+    checkHammered();
+    checkSelf();
+
+    return g_failures;
+}
@@ -0,0 +1,236 @@
+// kiero-test-gl: a headless OpenGL application whose swaps are intercepted. The test renders into
+// an EGL pbuffer on the surfaceless platform, through Mesa's software rasterizer (llvmpipe), with
+// eglSwapBuffers and glClear bound by kiero. Every swap and clear of the bound frames must reach
+// the detours and still render, none may once they are unbound. libEGL.so.1 and libGL.so.1 are
+// loaded at run time, without them or a display the test is skipped (exit code 77). Failures
+// are reported on stderr, the exit code is their count.
+
+#include "kiero.h"
+#include "kiero_frame.h"
+#include "kiero_methods.h"
+
+#include <EGL/egl.h>
+#include <GL/gl.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <dlfcn.h>
+
+namespace
+{
+
+int g_failures = 0;
+
+void check(const bool condition, const char* const what)
+{
+    if(!condition)
+    {
+        ::std::fprintf(stderr, "%s\n", what);
+        ++g_failures;
+    }
+}
+
+constexpr int Skipped = 77;
+constexpr int Frames = 16;
+constexpr EGLint Size = 16;
+
+using SwapBuffers = EGLBoolean (*)(EGLDisplay, EGLSurface);
+using Clear = void (*)(GLbitfield);
+using ClearColor = void (*)(GLclampf, GLclampf, GLclampf, GLclampf);
+using ReadPixels = void (*)(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void*);
+
+SwapBuffers g_originalSwapBuffers = nullptr;
+Clear g_originalClear = nullptr;
+
+int g_swaps = 0;
+int g_clears = 0;
+
+EGLBoolean hookedSwapBuffers(const EGLDisplay display, const EGLSurface surface)
+{
+    const kiero::FrameScope frame;
+
+    ++g_swaps;
+    return g_originalSwapBuffers(display, surface);
+}
+
+void hookedClear(const GLbitfield mask)
+{
+    ++g_clears;
+    g_originalClear(mask);
+}
+
+// The EGL entry points the test calls, looked up in libEGL.so.1
+struct Egl
+{
+    PFNEGLGETDISPLAYPROC getDisplay;
+    PFNEGLINITIALIZEPROC initialize;
+    PFNEGLTERMINATEPROC terminate;
+    PFNEGLBINDAPIPROC bindApi;
+    PFNEGLCHOOSECONFIGPROC chooseConfig;
+    PFNEGLCREATEPBUFFERSURFACEPROC createPbufferSurface;
+    PFNEGLDESTROYSURFACEPROC destroySurface;
+    PFNEGLCREATECONTEXTPROC createContext;
+    PFNEGLDESTROYCONTEXTPROC destroyContext;
+    PFNEGLMAKECURRENTPROC makeCurrent;
+    SwapBuffers swapBuffers;
+
+    explicit Egl(void* const library)
+        : getDisplay(reinterpret_cast<PFNEGLGETDISPLAYPROC>(::dlsym(library, "eglGetDisplay")))
+        , initialize(reinterpret_cast<PFNEGLINITIALIZEPROC>(::dlsym(library, "eglInitialize")))
+        , terminate(reinterpret_cast<PFNEGLTERMINATEPROC>(::dlsym(library, "eglTerminate")))
+        , bindApi(reinterpret_cast<PFNEGLBINDAPIPROC>(::dlsym(library, "eglBindAPI")))
+        , chooseConfig(reinterpret_cast<PFNEGLCHOOSECONFIGPROC>(::dlsym(library, "eglChooseConfig")))
+        , createPbufferSurface(reinterpret_cast<PFNEGLCREATEPBUFFERSURFACEPROC>(::dlsym(library, "eglCreatePbufferSurface")))
+        , destroySurface(reinterpret_cast<PFNEGLDESTROYSURFACEPROC>(::dlsym(library, "eglDestroySurface")))
+        , createContext(reinterpret_cast<PFNEGLCREATECONTEXTPROC>(::dlsym(library, "eglCreateContext")))
+        , destroyContext(reinterpret_cast<PFNEGLDESTROYCONTEXTPROC>(::dlsym(library, "eglDestroyContext")))
+        , makeCurrent(reinterpret_cast<PFNEGLMAKECURRENTPROC>(::dlsym(library, "eglMakeCurrent")))
+        , swapBuffers(reinterpret_cast<SwapBuffers>(::dlsym(library, "eglSwapBuffers")))
+    {
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return getDisplay && initialize && terminate && bindApi && chooseConfig && createPbufferSurface && destroySurface && createContext
+            && destroyContext && makeCurrent && swapBuffers;
+    }
+};
+
+// The GL entry points, looked up in libGL.so.1
+struct Gl
+{
+    Clear clear;
+    ClearColor clearColor;
+    ReadPixels readPixels;
+
+    explicit Gl(void* const library)
+        : clear(reinterpret_cast<Clear>(::dlsym(library, "glClear")))
+        , clearColor(reinterpret_cast<ClearColor>(::dlsym(library, "glClearColor")))
+        , readPixels(reinterpret_cast<ReadPixels>(::dlsym(library, "glReadPixels")))
+    {
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return clear && clearColor && readPixels;
+    }
+};
+
+// Clears to red, green then blue and swaps, checking the clear reached the pbuffer
+void render(const Egl& egl, const Gl& gl, const EGLDisplay display, const EGLSurface surface, const int frame)
+{
+    const int channel = frame % 3;
+    gl.clearColor(channel == 0, channel == 1, channel == 2, 1.0f);
+    gl.clear(GL_COLOR_BUFFER_BIT);
+
+    unsigned char pixel[4] = { };
+    gl.readPixels(Size / 2, Size / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+    check(pixel[channel] == 0xff && pixel[(channel + 1) % 3] == 0 && pixel[(channel + 2) % 3] == 0, "a clear did not reach the pbuffer");
+
+    check(egl.swapBuffers(display, surface) == EGL_TRUE, "eglSwapBuffers failed");
+}
+
+} // namespace
+
+int main()
+{
+    // Software rendering without a window system, whatever the machine has
+    ::setenv("EGL_PLATFORM", "surfaceless", 0);
+    ::setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+
+    // Loaded before kiero::init, which only resolves from libraries already loaded
+    void* const eglLibrary = ::dlopen("libEGL.so.1", RTLD_NOW | RTLD_GLOBAL);
+    void* const glLibrary = ::dlopen("libGL.so.1", RTLD_NOW | RTLD_GLOBAL);
+
+    if(!eglLibrary || !glLibrary)
+    {
+        ::std::printf("skipped, libEGL.so.1 or libGL.so.1 is not installed\n");
+        return Skipped;
+    }
+
+    const Egl egl(eglLibrary);
+    const Gl gl(glLibrary);
+
+    if(!egl || !gl)
+    {
+        ::std::printf("skipped, libEGL.so.1 or libGL.so.1 misses an entry point\n");
+        return Skipped;
+    }
+
+    const EGLDisplay display = egl.getDisplay(EGL_DEFAULT_DISPLAY);
+    if(display == EGL_NO_DISPLAY || egl.initialize(display, nullptr, nullptr) != EGL_TRUE)
+    {
+        ::std::printf("skipped, no EGL display\n");
+        return Skipped;
+    }
+
+    const EGLint configAttributes[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8, EGL_NONE };
+    const EGLint surfaceAttributes[] = { EGL_WIDTH, Size, EGL_HEIGHT, Size, EGL_NONE };
+
+    EGLConfig config = nullptr;
+    EGLint configsCount = 0;
+
+    const bool configured = egl.bindApi(EGL_OPENGL_API) == EGL_TRUE && egl.chooseConfig(display, configAttributes, &config, 1, &configsCount) == EGL_TRUE
+        && configsCount == 1;
+
+    const EGLSurface surface = configured ? egl.createPbufferSurface(display, config, surfaceAttributes) : EGL_NO_SURFACE;
+    const EGLContext context = surface != EGL_NO_SURFACE ? egl.createContext(display, config, EGL_NO_CONTEXT, nullptr) : EGL_NO_CONTEXT;
+
+    if(context == EGL_NO_CONTEXT || egl.makeCurrent(display, surface, surface, context) != EGL_TRUE)
+    {
+        ::std::printf("skipped, no OpenGL pbuffer on the EGL display\n");
+
+        if(surface != EGL_NO_SURFACE)
+        {
+            egl.destroySurface(display, surface);
+        }
+
+        egl.terminate(display);
+        return Skipped;
+    }
+
+    if(kiero::init(kiero::RenderType::OpenGL) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "init failed with libEGL.so.1 and libGL.so.1 loaded\n");
+        return 1;
+    }
+
+    check(kiero::getMethod(kiero::opengl::eglSwapBuffers::index) == reinterpret_cast<void*>(egl.swapBuffers), "the methods table has another eglSwapBuffers");
+
+    check(kiero::bind(kiero::RenderType::OpenGL, kiero::opengl::eglSwapBuffers::index, reinterpret_cast<void**>(&g_originalSwapBuffers),
+        reinterpret_cast<void*>(&hookedSwapBuffers)) == kiero::Status::Success, "binding eglSwapBuffers failed");
+    check(kiero::bind(kiero::RenderType::OpenGL, kiero::opengl::glClear::index, reinterpret_cast<void**>(&g_originalClear),
+        reinterpret_cast<void*>(&hookedClear)) == kiero::Status::Success, "binding glClear failed");
+
+    const ::std::uint64_t firstFrame = kiero::getFrameIndex();
+
+    for(int frame = 0; frame < Frames; ++frame)
+    {
+        render(egl, gl, display, surface, frame);
+    }
+
+    check(g_swaps == Frames, "a bound eglSwapBuffers was not intercepted");
+    check(g_clears == Frames, "a bound glClear was not intercepted");
+    check(kiero::getFrameIndex() - firstFrame == Frames, "the intercepted swaps did not each end a frame");
+
+    kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::eglSwapBuffers::index);
+    kiero::unbind(kiero::RenderType::OpenGL, kiero::opengl::glClear::index);
+
+    // Unbound, the application renders as before without the detours
+    render(egl, gl, display, surface, Frames);
+    check(g_swaps == Frames && g_clears == Frames, "an unbound function was still intercepted");
+
+    ::std::printf("%d swaps, %d clears intercepted\n", g_swaps, g_clears);
+
+    kiero::shutdown();
+
+    egl.makeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    egl.destroyContext(display, context);
+    egl.destroySurface(display, surface);
+    egl.terminate(display);
+
+    return g_failures;
+}
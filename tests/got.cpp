@@ -0,0 +1,93 @@
+// kiero-test-got: GOT hooks follow the objects loaded after them. A function exported by a
+// library of its own is hooked in the import tables, then a library calling it is dlopened:
+// the next frame boundary must patch its import, dlclose must make the hook forget the
+// library's slot, and a second dlopen of it is patched again. Disabling restores every import.
+// Failures are reported on stderr, the exit code is their count.
+
+#include "kiero_frame.h"
+#include "kiero_got.h"
+
+#include <cstdio>
+
+#include <dlfcn.h>
+
+extern "C" int kiero_test_answer();
+
+namespace
+{
+
+int g_failures = 0;
+
+void check(const bool condition, const char* const what)
+{
+    if(!condition)
+    {
+        ::std::fprintf(stderr, "%s\n", what);
+        ++g_failures;
+    }
+}
+
+int answerDetour()
+{
+    return 1000;
+}
+
+using Ask = int (*)();
+
+kiero::detail::GotHook g_answer;
+
+// Loads the caller and ends a frame, which picks it up
+[[nodiscard]] void* loadCaller(Ask& ask)
+{
+    void* const caller = ::dlopen(KIERO_TEST_GOT_CALLER, RTLD_NOW | RTLD_LOCAL);
+    if(!caller)
+    {
+        check(false, ::dlerror());
+        return nullptr;
+    }
+
+    ask = reinterpret_cast<Ask>(::dlsym(caller, "kiero_test_ask"));
+
+    {
+        const kiero::FrameScope frame;
+    }
+
+    return caller;
+}
+
+} // namespace
+
+int main()
+{
+    if(kiero::detail::createGotHook(reinterpret_cast<void*>(kiero_test_answer), reinterpret_cast<void*>(answerDetour), g_answer) != kiero::Status::Success)
+    {
+        check(false, "createGotHook of kiero_test_answer failed");
+        return g_failures;
+    }
+
+    kiero::detail::GotHook* const hooks[] = { &g_answer };
+    check(kiero::detail::enableGotHooks(hooks, 1, nullptr) == kiero::Status::Success, "enableGotHooks of kiero_test_answer failed");
+    check(kiero_test_answer() == 1000, "the executable's import of kiero_test_answer was not patched");
+
+    const ::std::size_t slots = g_answer.slotsCount;
+
+    Ask ask = nullptr;
+    void* caller = loadCaller(ask);
+    check(ask && ask() == 1000, "the frame boundary did not patch a library loaded after the bind");
+
+    ::dlclose(caller);
+    {
+        const kiero::FrameScope frame;
+    }
+    check(g_answer.slotsCount == slots, "the hook kept the slot of an unloaded library");
+
+    caller = loadCaller(ask);
+    check(ask && ask() == 1000, "the frame boundary did not patch a library loaded again");
+
+    kiero::detail::disableGotHook(g_answer);
+    check(kiero_test_answer() == 42 && ask && ask() == 42, "disableGotHook left an import patched");
+
+    ::dlclose(caller);
+
+    return g_failures;
+}
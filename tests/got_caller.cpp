@@ -0,0 +1,7 @@
+// Loaded by tests/got.cpp after its bind, calls the hooked function through its own import table
+extern "C" int kiero_test_answer();
+
+extern "C" __attribute__((visibility("default"))) int kiero_test_ask()
+{
+    return kiero_test_answer();
+}
@@ -0,0 +1,5 @@
+// The function tests/got.cpp hooks in the import tables, exported by a library of its own
+extern "C" __attribute__((visibility("default"), noinline)) int kiero_test_answer()
+{
+    return 42;
+}
@@ -0,0 +1,247 @@
+// kiero-test-subscribers: subscriptions to one slot changing while threads call it. Threads keep
+// calling the stand-in libGL.so.1's glFlush, whose slot an anchor subscription keeps hooked,
+// while other threads subscribe and unsubscribe callbacks of their own. Every call must run the
+// pre callbacks by descending priority and the post callbacks of the same subscribers in the
+// opposite order: a list freed or replaced under a call shows up as an unbalanced or misordered
+// one. Failures are reported on stderr, the exit code is their count.
+
+#include "kiero.h"
+#include "kiero_methods.h"
+#include "kiero_thunk.h"
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+int g_failures = 0;
+
+void check(const bool condition, const char* const what)
+{
+    if(!condition)
+    {
+        ::std::fprintf(stderr, "%s\n", what);
+        ++g_failures;
+    }
+}
+
+using Flush = kiero::opengl::glFlush;
+
+constexpr unsigned Callers = 2;
+constexpr unsigned Churners = 3;
+constexpr int Changes = 2000;
+
+// The state of the call the thread is in, reset by the anchor's pre callback
+struct Call
+{
+    bool inside;
+    ::std::int32_t lastPre;
+    ::std::int32_t lastPost;
+    ::std::uint32_t pending; // pre callbacks whose post did not run yet
+};
+
+thread_local Call t_call { };
+
+::std::atomic<bool> g_outside { false };
+::std::atomic<bool> g_misordered { false };
+::std::atomic<bool> g_unbalanced { false };
+::std::atomic<::std::uint64_t> g_calls { 0 };
+
+void anchorPre()
+{
+    t_call = { true, INT_MAX, INT_MIN, 0 };
+}
+
+void anchorPost()
+{
+    if(t_call.pending != 0)
+    {
+        g_unbalanced.store(true, ::std::memory_order_relaxed);
+    }
+
+    t_call.inside = false;
+    g_calls.fetch_add(1, ::std::memory_order_relaxed);
+}
+
+// The churned callbacks, Priority 1 to Churners * 2, each only ever subscribed by one thread
+template<::std::int32_t Priority>
+struct Churned
+{
+    static inline ::std::atomic<::std::uint64_t> pres { 0 };
+    static inline ::std::atomic<::std::uint64_t> posts { 0 };
+
+    static void pre()
+    {
+        if(!t_call.inside)
+        {
+            g_outside.store(true, ::std::memory_order_relaxed);
+        }
+
+        if(Priority >= t_call.lastPre)
+        {
+            g_misordered.store(true, ::std::memory_order_relaxed);
+        }
+
+        t_call.lastPre = Priority;
+        ++t_call.pending;
+        pres.fetch_add(1, ::std::memory_order_relaxed);
+    }
+
+    static void post()
+    {
+        if(Priority <= t_call.lastPost)
+        {
+            g_misordered.store(true, ::std::memory_order_relaxed);
+        }
+
+        if(t_call.pending == 0)
+        {
+            g_unbalanced.store(true, ::std::memory_order_relaxed);
+        }
+
+        t_call.lastPost = Priority;
+        --t_call.pending;
+        posts.fetch_add(1, ::std::memory_order_relaxed);
+    }
+};
+
+struct Callbacks
+{
+    kiero::PreCallback<Flush> pre;
+    kiero::PostCallback<Flush> post;
+    ::std::int32_t priority;
+    ::std::atomic<::std::uint64_t>* pres;
+    ::std::atomic<::std::uint64_t>* posts;
+};
+
+template<::std::int32_t Priority>
+constexpr Callbacks makeCallbacks() noexcept
+{
+    return { &Churned<Priority>::pre, &Churned<Priority>::post, Priority, &Churned<Priority>::pres, &Churned<Priority>::posts };
+}
+
+const Callbacks g_callbacks[Churners * 2] = { makeCallbacks<1>(), makeCallbacks<2>(), makeCallbacks<3>(), makeCallbacks<4>(), makeCallbacks<5>(), makeCallbacks<6>() };
+
+// Subscribes the thread's two callbacks in turns, dropping them in either order
+void churn(const unsigned thread, ::std::atomic<bool>& failed)
+{
+    const Callbacks& first = g_callbacks[thread * 2];
+    const Callbacks& second = g_callbacks[thread * 2 + 1];
+
+    for(int change = 0; change < Changes; ++change)
+    {
+        kiero::SubscriptionId firstId = 0;
+        kiero::SubscriptionId secondId = 0;
+
+        if(kiero::subscribe<Flush>(first.pre, first.post, first.priority, &firstId) != kiero::Status::Success
+            || kiero::subscribe<Flush>(second.pre, second.post, second.priority, &secondId) != kiero::Status::Success)
+        {
+            failed.store(true, ::std::memory_order_relaxed);
+        }
+
+        if(change % 3 == 0)
+        {
+            ::std::this_thread::yield();
+        }
+
+        kiero::unsubscribe(change % 2 ? firstId : secondId);
+        kiero::unsubscribe(change % 2 ? secondId : firstId);
+    }
+}
+
+} // namespace
+
+// Exported by the stand-in libGL.so.1
+extern "C" void glFlush();
+
+int main()
+{
+    if(kiero::init(kiero::RenderType::OpenGL) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "init failed, the stand-in libGL.so.1 is not loaded\n");
+        return 1;
+    }
+
+    kiero::SubscriptionId anchor = 0;
+    if(kiero::subscribe<Flush>(&anchorPre, &anchorPost, INT_MAX, &anchor) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "subscribing the anchor failed\n");
+        return 1;
+    }
+
+    ::std::atomic<bool> stop { false };
+    ::std::atomic<bool> failed { false };
+    ::std::vector<::std::thread> callers;
+    ::std::vector<::std::thread> churners;
+
+    for(unsigned i = 0; i < Callers; ++i)
+    {
+        callers.emplace_back([&stop]
+        {
+            while(!stop.load(::std::memory_order_relaxed))
+            {
+                glFlush();
+            }
+        });
+    }
+
+    for(unsigned i = 0; i < Churners; ++i)
+    {
+        churners.emplace_back(churn, i, ::std::ref(failed));
+    }
+
+    for(::std::thread& churner : churners)
+    {
+        churner.join();
+    }
+
+    stop.store(true, ::std::memory_order_relaxed);
+
+    for(::std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    check(!failed.load(), "a subscribe failed while the slot was called");
+    check(!g_outside.load(), "a churned pre callback ran outside the anchor's call");
+    check(!g_misordered.load(), "callbacks of one call ran out of priority order");
+    check(!g_unbalanced.load(), "a call ran a pre callback without its post callback, or the other way around");
+    check(g_calls.load() > 0, "no call went through the anchor");
+
+    ::std::uint64_t churned = 0;
+    for(const Callbacks& callbacks : g_callbacks)
+    {
+        check(callbacks.pres->load() == callbacks.posts->load(), "a churned callback ran its pre and post callbacks a different number of times");
+        churned += callbacks.pres->load();
+    }
+
+    check(churned > 0, "no call ran a churned callback");
+
+    // Only the anchor is left
+    const ::std::uint64_t calls = g_calls.load();
+    glFlush();
+    check(g_calls.load() == calls + 1, "the anchor missed a call once the churn stopped");
+
+    ::std::uint64_t after = 0;
+    for(const Callbacks& callbacks : g_callbacks)
+    {
+        after += callbacks.pres->load();
+    }
+
+    check(after == churned, "an unsubscribed callback still ran");
+
+    // With nobody subscribed the dispatcher goes straight to the original
+    kiero::unsubscribe(anchor);
+    glFlush();
+    check(g_calls.load() == calls + 1, "the unsubscribed anchor still ran");
+
+    ::std::printf("%llu calls, %llu churned callbacks\n", static_cast<unsigned long long>(calls), static_cast<unsigned long long>(churned));
+
+    kiero::shutdown();
+    return g_failures;
+}
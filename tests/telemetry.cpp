@@ -0,0 +1,173 @@
+// kiero-test-telemetry: the telemetry segment read by another process while it is written. The
+// test counts the stand-in libGL.so.1 with a census and publishes its frame boundaries, a forked
+// reader process maps the segment and copies it until the last boundary. Every boundary follows
+// Flushes glFlush calls of the only presenting thread, so a consistent snapshot holds exactly
+// frames * Flushes of them: a torn copy shows up as another count. Failures are reported on
+// stderr, the exit code is their count, the reader's included.
+
+#include "kiero.h"
+#include "kiero_census.h"
+#include "kiero_frame.h"
+#include "kiero_methods.h"
+#include "kiero_telemetry.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Exported by the stand-in libGL.so.1
+extern "C" void glFlush();
+
+namespace
+{
+
+int g_failures = 0;
+
+void check(const bool condition, const char* const what)
+{
+    if(!condition)
+    {
+        ::std::fprintf(stderr, "%s\n", what);
+        ++g_failures;
+    }
+}
+
+constexpr ::std::uint64_t Frames = 20000;
+constexpr ::std::uint64_t Flushes = 8;
+
+constexpr ::std::uint32_t FlushSlot = kiero::opengl::glFlush::index;
+
+// Runs in the forked process, returns its failures
+int readSegment(const char* const name)
+{
+    const int descriptor = ::shm_open(name, O_RDONLY, 0);
+    if(descriptor < 0)
+    {
+        check(false, "the reader could not open the segment");
+        return g_failures;
+    }
+
+    void* const memory = ::mmap(nullptr, sizeof(kiero::Telemetry), PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);
+
+    if(memory == MAP_FAILED)
+    {
+        check(false, "the reader could not map the segment");
+        return g_failures;
+    }
+
+    const auto& shared = *static_cast<const kiero::Telemetry*>(memory);
+    check(shared.version == kiero::TelemetryVersion && shared.size == sizeof(kiero::Telemetry), "the segment has another version or size");
+
+    static kiero::TelemetrySnapshot snapshot;
+
+    const auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(30);
+
+    ::std::uint64_t previous = 0;
+    ::std::uint64_t reads = 0;
+    ::std::uint64_t early = 0;
+    bool torn = false;
+
+    while(previous < Frames && ::std::chrono::steady_clock::now() < deadline)
+    {
+        if(!kiero::readTelemetry(shared, snapshot))
+        {
+            continue;
+        }
+
+        ++reads;
+        early += snapshot.frames < Frames;
+
+        if(snapshot.frames < previous || snapshot.slots != kiero::opengl::MethodsCount || snapshot.calls[FlushSlot] != snapshot.frames * Flushes
+            || snapshot.count > snapshot.frames || (snapshot.frames != 0 && snapshot.lastPresent == 0))
+        {
+            torn = true;
+        }
+
+        previous = snapshot.frames;
+    }
+
+    check(previous == Frames, "the reader did not see the last boundary");
+    check(!torn, "the reader copied an inconsistent snapshot");
+    check(early != 0, "the reader never read while the boundaries were published");
+
+    // Slots the census counts but nobody calls stay 0
+    check(snapshot.calls[kiero::opengl::glAccum::index] == 0, "a slot that was never called has calls");
+
+    ::std::printf("reader: %llu snapshots, %llu before the last boundary\n", static_cast<unsigned long long>(reads), static_cast<unsigned long long>(early));
+    ::std::fflush(stdout);
+
+    return g_failures;
+}
+
+} // namespace
+
+int main()
+{
+    if(kiero::init(kiero::RenderType::OpenGL) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "init failed, the stand-in libGL.so.1 is not loaded\n");
+        return 1;
+    }
+
+    if(kiero::startCensus(kiero::RenderType::OpenGL) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "startCensus failed\n");
+        return 1;
+    }
+
+    const ::std::string name = "/kiero-test-telemetry-" + ::std::to_string(::getpid());
+    if(kiero::startTelemetry(name.c_str()) != kiero::Status::Success)
+    {
+        ::std::fprintf(stderr, "startTelemetry failed\n");
+        return 1;
+    }
+
+    ::std::fflush(stdout);
+
+    const pid_t reader = ::fork();
+    if(reader == 0)
+    {
+        ::_exit(readSegment(name.c_str()));
+    }
+
+    check(reader > 0, "fork failed");
+
+    for(::std::uint64_t frame = 0; frame < Frames; ++frame)
+    {
+        for(::std::uint64_t i = 0; i < Flushes; ++i)
+        {
+            glFlush();
+        }
+
+        {
+            const kiero::FrameScope boundary;
+        }
+
+        // Lets the reader in on a single CPU
+        if(frame % 64 == 0)
+        {
+            ::std::this_thread::sleep_for(::std::chrono::microseconds(200));
+        }
+    }
+
+    int status = 0;
+    if(reader > 0 && ::waitpid(reader, &status, 0) == reader)
+    {
+        check(WIFEXITED(status), "the reader process crashed");
+        g_failures += WIFEXITED(status) ? WEXITSTATUS(status) : 0;
+    }
+
+    kiero::stopTelemetry();
+    kiero::stopCensus();
+    kiero::shutdown();
+
+    return g_failures;
+}
@@ -0,0 +1,261 @@
+// kiero-telemetry: prints the frame telemetry a process publishes with kiero::startTelemetry
+//
+//   kiero-telemetry <name> [period in milliseconds]
+//
+// Without a period it prints once, with one it keeps printing until the segment goes away.
+
+#include "kiero_telemetry.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+# include <Windows.h>
+#else
+# include <fcntl.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <time.h>
+# include <unistd.h>
+#endif
+
+namespace
+{
+
+[[nodiscard]] const char* renderTypeName(const kiero::RenderType renderType) noexcept
+{
+    switch(renderType)
+    {
+        case kiero::RenderType::D3D9:   return "D3D9";
+        case kiero::RenderType::D3D10:  return "D3D10";
+        case kiero::RenderType::D3D11:  return "D3D11";
+        case kiero::RenderType::D3D12:  return "D3D12";
+        case kiero::RenderType::OpenGL: return "OpenGL";
+        case kiero::RenderType::Vulkan: return "Vulkan";
+        default:                        return "None";
+    }
+}
+
+#ifdef _WIN32
+
+[[nodiscard]] ::std::int64_t now() noexcept
+{
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    ::QueryPerformanceFrequency(&frequency);
+    ::QueryPerformanceCounter(&counter);
+
+    return counter.QuadPart / frequency.QuadPart * 1'000'000'000 + counter.QuadPart % frequency.QuadPart * 1'000'000'000 / frequency.QuadPart;
+}
+
+void sleepFor(const unsigned milliseconds) noexcept
+{
+    ::Sleep(milliseconds);
+}
+
+[[nodiscard]] const kiero::Telemetry* openSegment(const char* const name) noexcept
+{
+    HANDLE mapping = ::OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if(!mapping)
+    {
+        return nullptr;
+    }
+
+    // The view keeps the mapping alive
+    const void* const memory = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+
+    return static_cast<const kiero::Telemetry*>(memory);
+}
+
+// A closed mapping outlives the writer while we hold a view, check the writer itself
+[[nodiscard]] bool isAlive(const kiero::Telemetry& shared, const char*) noexcept
+{
+    HANDLE process = ::OpenProcess(SYNCHRONIZE, FALSE, shared.processId);
+    if(!process)
+    {
+        return false;
+    }
+
+    const bool alive = ::WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+    ::CloseHandle(process);
+    return alive;
+}
+
+#else
+
+[[nodiscard]] ::std::int64_t now() noexcept
+{
+    timespec time;
+    ::clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<::std::int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+}
+
+void sleepFor(const unsigned milliseconds) noexcept
+{
+    ::usleep(milliseconds * 1000);
+}
+
+[[nodiscard]] const kiero::Telemetry* openSegment(const char* const name) noexcept
+{
+    const int descriptor = ::shm_open(name, O_RDONLY, 0);
+    if(descriptor < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat status;
+    void* memory = MAP_FAILED;
+
+    if(::fstat(descriptor, &status) == 0 && static_cast<::std::size_t>(status.st_size) >= sizeof(kiero::Telemetry))
+    {
+        memory = ::mmap(nullptr, static_cast<::std::size_t>(status.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+    }
+
+    ::close(descriptor);
+    return memory == MAP_FAILED ? nullptr : static_cast<const kiero::Telemetry*>(memory);
+}
+
+// stopTelemetry unlinks the name, a later startTelemetry links a new segment to it
+[[nodiscard]] bool isAlive(const kiero::Telemetry& shared, const char* const name) noexcept
+{
+    const int descriptor = ::shm_open(name, O_RDONLY, 0);
+    if(descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+    const bool alive = ::fstat(descriptor, &status) == 0 && status.st_size != 0 && ::kill(static_cast<pid_t>(shared.processId), 0) == 0;
+    ::close(descriptor);
+    return alive;
+}
+
+#endif
+
+void print(const kiero::TelemetrySnapshot& snapshot)
+{
+    ::std::printf("pid %u  %-6s  frames %llu", snapshot.processId, renderTypeName(snapshot.renderType), static_cast<unsigned long long>(snapshot.frames));
+
+    if(snapshot.lastPresent != 0)
+    {
+        ::std::printf("  last %.1f ms ago", (now() - snapshot.lastPresent) / 1e6);
+    }
+
+    if(snapshot.count != 0)
+    {
+        ::std::uint32_t sorted[kiero::TelemetryCapacity];
+        ::std::copy(snapshot.intervals, snapshot.intervals + snapshot.count, sorted);
+        ::std::sort(sorted, sorted + snapshot.count);
+
+        ::std::uint64_t sum = 0;
+        for(::std::uint32_t i = 0; i < snapshot.count; ++i)
+        {
+            sum += sorted[i];
+        }
+
+        const double average = static_cast<double>(sum) / snapshot.count / 1e6;
+
+        // Nearest rank
+        const auto percentile = [&](const double fraction)
+        {
+            const ::std::uint32_t rank = ::std::clamp<::std::uint32_t>(static_cast<::std::uint32_t>(fraction * snapshot.count + 0.999999), 1, snapshot.count);
+            return sorted[rank - 1] / 1e6;
+        };
+
+        ::std::printf("  %.1f fps  p50 %.2f  p99 %.2f  max %.2f ms (%u frames)", average > 0.0 ? 1000.0 / average : 0.0,
+            percentile(0.5), percentile(0.99), sorted[snapshot.count - 1] / 1e6, snapshot.count);
+    }
+
+    // The busiest slots of a census, by methods table index
+    if(snapshot.slots != 0)
+    {
+        ::std::uint32_t busiest[3] = { };
+        ::std::uint32_t found = 0;
+
+        for(::std::uint32_t slot = 0; slot < snapshot.slots; ++slot)
+        {
+            if(snapshot.calls[slot] == 0)
+            {
+                continue;
+            }
+
+            ::std::uint32_t i = found < 3 ? found++ : 3;
+            for(; i > 0 && snapshot.calls[busiest[i - 1]] < snapshot.calls[slot]; --i)
+            {
+                if(i < 3)
+                {
+                    busiest[i] = busiest[i - 1];
+                }
+            }
+
+            if(i < 3)
+            {
+                busiest[i] = slot;
+            }
+        }
+
+        for(::std::uint32_t i = 0; i < found; ++i)
+        {
+            ::std::printf("  #%u %llu calls", busiest[i], static_cast<unsigned long long>(snapshot.calls[busiest[i]]));
+        }
+    }
+
+    ::std::printf("\n");
+    ::std::fflush(stdout);
+}
+
+}
+
+int main(const int argc, char** const argv)
+{
+    if(argc < 2 || argc > 3)
+    {
+        ::std::fprintf(stderr, "usage: %s <name> [period in milliseconds]\n", argv[0]);
+        return 2;
+    }
+
+#ifdef _WIN32
+    const ::std::string name = argv[1];
+#else
+    const ::std::string name = argv[1][0] == '/' ? ::std::string(argv[1]) : '/' + ::std::string(argv[1]);
+#endif
+    const unsigned period = argc == 3 ? static_cast<unsigned>(::std::strtoul(argv[2], nullptr, 10)) : 0;
+
+    const kiero::Telemetry* const shared = openSegment(name.c_str());
+    if(!shared)
+    {
+        ::std::fprintf(stderr, "%s: no telemetry segment named %s\n", argv[0], name.c_str());
+        return 1;
+    }
+
+    if(shared->magic != kiero::TelemetryMagic || shared->version < kiero::TelemetryVersion || shared->size < sizeof(kiero::Telemetry))
+    {
+        ::std::fprintf(stderr, "%s: %s is not a kiero telemetry segment of version %u or later\n", argv[0], name.c_str(), kiero::TelemetryVersion);
+        return 1;
+    }
+
+    kiero::TelemetrySnapshot snapshot;
+
+    do
+    {
+        // Only fails while the writer keeps updating, the next period gets another chance
+        if(kiero::readTelemetry(*shared, snapshot))
+        {
+            print(snapshot);
+        }
+
+        if(period != 0)
+        {
+            sleepFor(period);
+        }
+    }
+    while(period != 0 && isAlive(*shared, name.c_str()));
+
+    return 0;
+}